@@ -81,6 +81,54 @@ namespace etl
 
   template <typename TIterator, typename TCompare>
   ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void intro_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void intro_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void merge_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void merge_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator, typename TBufferIterator>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last);
+
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare);
 }
 
 //*****************************************************************************
@@ -236,7 +284,7 @@ namespace etl
   {
     while (sb != se)
     {
-      *db = etl::move(*sb);
+      *db = ETL_MOVE(*sb);
       ++db;
       ++sb;
     }
@@ -261,7 +309,7 @@ namespace etl
   {
     while (sb != se)
     {
-      *(--de) = etl::move(*(--se));
+      *(--de) = ETL_MOVE(*(--se));
     }
 
     return de;
@@ -831,22 +879,24 @@ namespace etl
   {
     // Push Heap Helper
     template <typename TIterator, typename TDistance, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14
     void push_heap(TIterator first, TDistance value_index, TDistance top_index, TValue value, TCompare compare)
     {
       TDistance parent = (value_index - 1) / 2;
 
       while ((value_index > top_index) && compare(first[parent], value))
       {
-        first[value_index] = etl::move(first[parent]);
+        first[value_index] = ETL_MOVE(first[parent]);
         value_index = parent;
         parent = (value_index - 1) / 2;
       }
 
-      first[value_index] = etl::move(value);
+      first[value_index] = ETL_MOVE(value);
     }
 
     // Adjust Heap Helper
     template <typename TIterator, typename TDistance, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14
     void adjust_heap(TIterator first, TDistance value_index, TDistance length, TValue value, TCompare compare)
     {
       TDistance top_index = value_index;
@@ -859,22 +909,23 @@ namespace etl
           --child2nd;
         }
 
-        first[value_index] = etl::move(first[child2nd]);
+        first[value_index] = ETL_MOVE(first[child2nd]);
         value_index = child2nd;
         child2nd = 2 * (child2nd + 1);
       }
 
       if (child2nd == length)
       {
-        first[value_index] = etl::move(first[child2nd - 1]);
+        first[value_index] = ETL_MOVE(first[child2nd - 1]);
         value_index = child2nd - 1;
       }
 
-      push_heap(first, value_index, top_index, etl::move(value), compare);
+      push_heap(first, value_index, top_index, ETL_MOVE(value), compare);
     }
 
     // Is Heap Helper
     template <typename TIterator, typename TDistance, typename TCompare>
+    ETL_CONSTEXPR14
     bool is_heap(const TIterator first, const TDistance n, TCompare compare)
     {
       TDistance parent = 0;
@@ -898,19 +949,21 @@ namespace etl
 
   // Pop Heap
   template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14
   void pop_heap(TIterator first, TIterator last, TCompare compare)
   {
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
     typedef typename etl::iterator_traits<TIterator>::difference_type distance_t;
 
-    value_t value = etl::move(last[-1]);
-    last[-1] = etl::move(first[0]);
+    value_t value = ETL_MOVE(last[-1]);
+    last[-1] = ETL_MOVE(first[0]);
 
-    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), etl::move(value), compare);
+    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), ETL_MOVE(value), compare);
   }
 
   // Pop Heap
   template <typename TIterator>
+  ETL_CONSTEXPR14
   void pop_heap(TIterator first, TIterator last)
   {
     typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
@@ -920,16 +973,18 @@ namespace etl
 
   // Push Heap
   template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14
   void push_heap(TIterator first, TIterator last, TCompare compare)
   {
     typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
     typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
 
-    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(etl::move(*(last - 1))), compare);
+    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(ETL_MOVE(*(last - 1))), compare);
   }
 
   // Push Heap
   template <typename TIterator>
+  ETL_CONSTEXPR14
   void push_heap(TIterator first, TIterator last)
   {
     typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
@@ -939,6 +994,7 @@ namespace etl
 
   // Make Heap
   template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14
   void make_heap(TIterator first, TIterator last, TCompare compare)
   {
     typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
@@ -953,7 +1009,7 @@ namespace etl
 
     while (true)
     {
-      private_heap::adjust_heap(first, parent, length, etl::move(*(first + parent)), compare);
+      private_heap::adjust_heap(first, parent, length, ETL_MOVE(*(first + parent)), compare);
 
       if (parent == 0)
       {
@@ -966,6 +1022,7 @@ namespace etl
 
   // Make Heap
   template <typename TIterator>
+  ETL_CONSTEXPR14
   void make_heap(TIterator first, TIterator last)
   {
     typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
@@ -976,7 +1033,8 @@ namespace etl
   // Is Heap
   template <typename TIterator>
   ETL_NODISCARD
-    bool is_heap(TIterator first, TIterator last)
+  ETL_CONSTEXPR14
+  bool is_heap(TIterator first, TIterator last)
   {
     typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
 
@@ -986,6 +1044,7 @@ namespace etl
   // Is Heap
   template <typename TIterator, typename TCompare>
   ETL_NODISCARD
+  ETL_CONSTEXPR14
   bool is_heap(TIterator first, TIterator last, TCompare compare)
   {
     return private_heap::is_heap(first, last - first, compare);
@@ -993,6 +1052,7 @@ namespace etl
 
   // Sort Heap
   template <typename TIterator>
+  ETL_CONSTEXPR14
   void sort_heap(TIterator first, TIterator last)
   {
     while (first != last)
@@ -1004,6 +1064,7 @@ namespace etl
 
   // Sort Heap
   template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14
   void sort_heap(TIterator first, TIterator last, TCompare compare)
   {
     while (first != last)
@@ -1072,7 +1133,8 @@ namespace etl
     ETL_CONSTEXPR14
     TIterator rotate_general(TIterator first, TIterator middle, TIterator last)
     {
-      TIterator next = middle;
+      TIterator next   = middle;
+      TIterator result = last;
 
       while (first != next)
       {
@@ -1085,6 +1147,12 @@ namespace etl
 
         if (next == last)
         {
+          // The first time around, 'first' is at the new position of the first item.
+          if (result == last)
+          {
+            result = first;
+          }
+
           next = middle;
         }
         else if (first == middle)
@@ -1093,7 +1161,7 @@ namespace etl
         }
       }
 
-      return first;
+      return result;
     }
 
     //*********************************
@@ -1104,13 +1172,13 @@ namespace etl
       typedef typename etl::iterator_traits<TIterator>::value_type value_type;
 
       // Save the first item.
-      value_type temp(etl::move(*first));
+      value_type temp(ETL_MOVE(*first));
 
       // Move the rest.
       TIterator result = etl::move(etl::next(first), last, first);
 
       // Restore the first item in its rotated position.
-      *result = etl::move(temp);
+      *result = ETL_MOVE(temp);
 
       // The new position of the first item.
       return result;
@@ -1125,13 +1193,13 @@ namespace etl
 
       // Save the last item.
       TIterator previous = etl::prev(last);
-      value_type temp(etl::move(*previous));
+      value_type temp(ETL_MOVE(*previous));
 
       // Move the rest.
       TIterator result = etl::move_backward(first, previous, last);
 
       // Restore the last item in its rotated position.
-      *first = etl::move(temp);
+      *first = ETL_MOVE(temp);
 
       // The new position of the first item.
       return result;
@@ -1143,6 +1211,16 @@ namespace etl
   ETL_CONSTEXPR14
   TIterator rotate(TIterator first, TIterator middle, TIterator last)
   {
+    if (first == middle)
+    {
+      return last;
+    }
+
+    if (middle == last)
+    {
+      return first;
+    }
+
     if (etl::next(first) == middle)
     {
       return private_algorithm::rotate_left_by_one(first, last);
@@ -1784,48 +1862,99 @@ namespace etl
   }
 
 #if ETL_NOT_USING_STL
+  namespace private_algorithm
+  {
+    //*********************************
+    // Random access iterators use introsort.
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::intro_sort(first, last, compare);
+    }
+
+    //*********************************
+    // Other iterators use shell sort.
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::shell_sort(first, last, compare);
+    }
+
+    //*********************************
+    // Random access iterators use merge sort.
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      stable_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::merge_sort(first, last, compare);
+    }
+
+    //*********************************
+    // Other iterators use insertion sort.
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      stable_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::insertion_sort(first, last, compare);
+    }
+  }
+
   //***************************************************************************
   /// Sorts the elements.
+  /// Uses introsort for random access iterators, otherwise shell sort.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14
   void sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::shell_sort(first, last, compare);
+    private_algorithm::sort(first, last, compare);
   }
 
   //***************************************************************************
   /// Sorts the elements.
+  /// Uses introsort for random access iterators, otherwise shell sort.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
+  ETL_CONSTEXPR14
   void sort(TIterator first, TIterator last)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    private_algorithm::sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
   /// Sorts the elements.
   /// Stable.
+  /// Uses merge sort for random access iterators, otherwise insertion sort.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14
   void stable_sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::insertion_sort(first, last, compare);
+    private_algorithm::stable_sort(first, last, compare);
   }
 
   //***************************************************************************
   /// Sorts the elements.
   /// Stable.
+  /// Uses merge sort for random access iterators, otherwise insertion sort.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
+  ETL_CONSTEXPR14
   void stable_sort(TIterator first, TIterator last)
   {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    private_algorithm::stable_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 #else
   //***************************************************************************
@@ -1834,6 +1963,7 @@ namespace etl
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
+  ETL_CONSTEXPR20
   void sort(TIterator first, TIterator last, TCompare compare)
   {
     std::sort(first, last, compare);
@@ -1844,6 +1974,7 @@ namespace etl
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
+  ETL_CONSTEXPR20
   void sort(TIterator first, TIterator last)
   {
     std::sort(first, last);
@@ -1873,6 +2004,43 @@ namespace etl
   }
 #endif
 
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses merge sort with a caller supplied buffer and does not allocate.
+  /// See etl::merge_sort.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void stable_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare)
+  {
+    etl::merge_sort(first, last, buffer_first, buffer_last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses merge sort with a caller supplied buffer and does not allocate.
+  /// See etl::merge_sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void stable_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last)
+  {
+    etl::merge_sort(first, last, buffer_first, buffer_last);
+  }
+
   //***************************************************************************
   /// Accumulates values.
   ///\ingroup algorithm
@@ -2833,6 +3001,397 @@ namespace etl
     etl::sort_heap(first, last);
   }
 
+  //***************************************************************************
+  namespace private_algorithm
+  {
+    //*********************************
+    // Ranges of this length or less are sorted by insertion sort.
+    struct sort_threshold
+    {
+      static ETL_CONSTANT int value = 16;
+    };
+
+    //*********************************
+    // Insertion sort that moves elements along, rather than rotating.
+    // Stable.
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    void linear_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        value_t   value = ETL_MOVE(*itr);
+        TIterator hole  = itr;
+        TIterator previous = itr;
+
+        while ((hole != first) && compare(value, *(--previous)))
+        {
+          *hole = ETL_MOVE(*previous);
+          hole  = previous;
+        }
+
+        *hole = ETL_MOVE(value);
+      }
+    }
+
+    //*********************************
+    // Swaps the median of a, b & c in to 'result'.
+    template <typename TIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+    ETL_CONSTEXPR20
+#else
+    ETL_CONSTEXPR14
+#endif
+    void move_median_to_first(TIterator result, TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      if (compare(*a, *b))
+      {
+        if (compare(*b, *c))
+        {
+          etl::iter_swap(result, b);
+        }
+        else if (compare(*a, *c))
+        {
+          etl::iter_swap(result, c);
+        }
+        else
+        {
+          etl::iter_swap(result, a);
+        }
+      }
+      else if (compare(*a, *c))
+      {
+        etl::iter_swap(result, a);
+      }
+      else if (compare(*b, *c))
+      {
+        etl::iter_swap(result, c);
+      }
+      else
+      {
+        etl::iter_swap(result, b);
+      }
+    }
+
+    //*********************************
+    // Partitions [first, last) around the pivot.
+    // The median of three selection guarantees that the scans stop within the range.
+    template <typename TIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+    ETL_CONSTEXPR20
+#else
+    ETL_CONSTEXPR14
+#endif
+    TIterator unguarded_partition(TIterator first, TIterator last, TIterator pivot, TCompare compare)
+    {
+      while (true)
+      {
+        while (compare(*first, *pivot))
+        {
+          ++first;
+        }
+
+        --last;
+
+        while (compare(*pivot, *last))
+        {
+          --last;
+        }
+
+        if (!(first < last))
+        {
+          return first;
+        }
+
+        etl::iter_swap(first, last);
+        ++first;
+      }
+    }
+
+    //*********************************
+    // Quicksorts partitions down to the threshold size.
+    // Switches to heap sort if the depth limit is reached.
+    template <typename TIterator, typename TDistance, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+    ETL_CONSTEXPR20
+#else
+    ETL_CONSTEXPR14
+#endif
+    void intro_sort_loop(TIterator first, TIterator last, TDistance depth_limit, TCompare compare)
+    {
+      while ((last - first) > sort_threshold::value)
+      {
+        if (depth_limit == 0)
+        {
+          etl::make_heap(first, last, compare);
+          etl::sort_heap(first, last, compare);
+          return;
+        }
+
+        --depth_limit;
+
+        TIterator middle = first + ((last - first) / 2);
+        move_median_to_first(first, first + 1, middle, last - 1, compare);
+
+        TIterator cut = unguarded_partition(first + 1, last, first, compare);
+
+        // Recurse for the upper partition and loop for the lower.
+        intro_sort_loop(cut, last, depth_limit, compare);
+        last = cut;
+      }
+    }
+
+    //*********************************
+    // Merges the sorted ranges [first, middle) and [middle, last).
+    // The lower range is moved to the buffer and merged forward, if it fits.
+    // Otherwise the ranges are split and rotated so that each half may be merged recursively.
+    template <typename TIterator, typename TDistance, typename TBufferIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+    ETL_CONSTEXPR20
+#else
+    ETL_CONSTEXPR14
+#endif
+    void merge_adaptive(TIterator first, TIterator middle, TIterator last,
+                        TDistance length1, TDistance length2,
+                        TBufferIterator buffer, TDistance buffer_size,
+                        TCompare compare)
+    {
+      if ((length1 == 0) || (length2 == 0))
+      {
+        return;
+      }
+
+      // Already in order?
+      if (!compare(*middle, *(middle - 1)))
+      {
+        return;
+      }
+
+      if ((length1 + length2) == 2)
+      {
+        etl::iter_swap(first, middle);
+        return;
+      }
+
+      if (length1 <= buffer_size)
+      {
+        TBufferIterator buffer_end = etl::move(first, middle, buffer);
+
+        while ((buffer != buffer_end) && (middle != last))
+        {
+          if (compare(*middle, *buffer))
+          {
+            *first = ETL_MOVE(*middle);
+            ++middle;
+          }
+          else
+          {
+            *first = ETL_MOVE(*buffer);
+            ++buffer;
+          }
+
+          ++first;
+        }
+
+        etl::move(buffer, buffer_end, first);
+        return;
+      }
+
+      TIterator first_cut  = first;
+      TIterator second_cut = middle;
+      TDistance length11   = 0;
+      TDistance length22   = 0;
+
+      if (length1 > length2)
+      {
+        length11   = length1 / 2;
+        first_cut  = first + length11;
+        second_cut = etl::lower_bound(middle, last, *first_cut, compare);
+        length22   = second_cut - middle;
+      }
+      else
+      {
+        length22   = length2 / 2;
+        second_cut = middle + length22;
+        first_cut  = etl::upper_bound(first, middle, *second_cut, compare);
+        length11   = first_cut - first;
+      }
+
+      TIterator new_middle = etl::rotate(first_cut, middle, second_cut);
+
+      merge_adaptive(first, first_cut, new_middle, length11, length22, buffer, buffer_size, compare);
+      merge_adaptive(new_middle, second_cut, last, length1 - length11, length2 - length22, buffer, buffer_size, compare);
+    }
+
+    //*********************************
+    template <typename TIterator, typename TDistance, typename TBufferIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+    ETL_CONSTEXPR20
+#else
+    ETL_CONSTEXPR14
+#endif
+    void merge_sort(TIterator first, TIterator last, TBufferIterator buffer, TDistance buffer_size, TCompare compare)
+    {
+      const TDistance length = last - first;
+
+      if (length <= sort_threshold::value)
+      {
+        linear_insertion_sort(first, last, compare);
+        return;
+      }
+
+      TIterator middle = first + (length / 2);
+
+      merge_sort(first, middle, buffer, buffer_size, compare);
+      merge_sort(middle, last, buffer, buffer_size, compare);
+      merge_adaptive(first, middle, last, middle - first, last - middle, buffer, buffer_size, compare);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using introsort.
+  /// Quicksort with median of three pivot selection, switching to heap sort if
+  /// the recursion becomes too deep, and insertion sort for short ranges.
+  /// O(N log N) in the worst case. Not stable.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void intro_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t length = last - first;
+
+    if (length < 2)
+    {
+      return;
+    }
+
+    // Depth limit is 2 * log2(N)
+    difference_t depth_limit = 0;
+
+    while (length > 1)
+    {
+      depth_limit += 2;
+      length /= 2;
+    }
+
+    private_algorithm::intro_sort_loop(first, last, depth_limit, compare);
+    private_algorithm::linear_insertion_sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using introsort.
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void intro_sort(TIterator first, TIterator last)
+  {
+    etl::intro_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort.
+  /// Stable.
+  /// Uses the caller supplied buffer of value_type to merge.
+  /// A buffer of half of the length of the range gives O(N log N).
+  /// A smaller buffer, or none, merges in place with rotations, O(N log^2 N).
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    private_algorithm::merge_sort(first, last, buffer_first, difference_t(etl::distance(buffer_first, buffer_last)), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort.
+  /// Stable.
+  /// Uses the caller supplied buffer of value_type to merge.
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last)
+  {
+    etl::merge_sort(first, last, buffer_first, buffer_last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort.
+  /// Stable.
+  /// Merges in place, O(N log^2 N).
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void merge_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+    value_t* buffer = ETL_NULLPTR;
+
+    etl::merge_sort(first, last, buffer, buffer, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort.
+  /// Stable.
+  /// Merges in place, O(N log^2 N).
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+#if ETL_USING_STD_NAMESPACE
+  ETL_CONSTEXPR20
+#else
+  ETL_CONSTEXPR14
+#endif
+  void merge_sort(TIterator first, TIterator last)
+  {
+    etl::merge_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
   //***************************************************************************
   /// Returns the maximum value.
   //***************************************************************************
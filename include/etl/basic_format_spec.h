@@ -121,6 +121,17 @@ namespace etl
       const bool show_base;
     };
 
+    //*********************************
+    struct floating_point_format_spec
+    {
+      ETL_CONSTEXPR floating_point_format_spec(uint_least8_t floating_point_format_)
+        : floating_point_format(floating_point_format_)
+      {
+      }
+
+      const uint_least8_t floating_point_format;
+    };
+
     //*********************************
     struct left_spec
     {
@@ -171,6 +182,33 @@ namespace etl
   //*********************************
   static ETL_CONSTANT private_basic_format_spec::base_spec hex(16U);
 
+  //***************************************************************************
+  /// The floating point formats.
+  /// fixed      : A fixed number of digits after the point, from the precision.
+  /// scientific : One digit before the point, a fixed number of digits after
+  ///              the point from the precision, and a decimal exponent.
+  /// shortest   : The shortest text that reads back as the same value.
+  ///              Fixed or scientific, whichever is shorter. Ignores precision.
+  //***************************************************************************
+  struct floating_point_format
+  {
+    enum enum_type
+    {
+      Fixed,
+      Scientific,
+      Shortest
+    };
+  };
+
+  //*********************************
+  static ETL_CONSTANT private_basic_format_spec::floating_point_format_spec fixed(floating_point_format::Fixed);
+
+  //*********************************
+  static ETL_CONSTANT private_basic_format_spec::floating_point_format_spec scientific(floating_point_format::Scientific);
+
+  //*********************************
+  static ETL_CONSTANT private_basic_format_spec::floating_point_format_spec shortest(floating_point_format::Shortest);
+
   //*********************************
   static ETL_CONSTANT private_basic_format_spec::left_spec left;
 
@@ -215,6 +253,7 @@ namespace etl
       , boolalpha_(false)
       , show_base_(false)
       , fill_(typename TString::value_type(' '))
+      , floating_point_format_(etl::floating_point_format::Fixed)
     {
     }
 
@@ -237,6 +276,7 @@ namespace etl
       , boolalpha_(boolalpha__)
       , show_base_(show_base__)
       , fill_(fill__)
+      , floating_point_format_(etl::floating_point_format::Fixed)
     {
     }
 
@@ -253,6 +293,7 @@ namespace etl
       boolalpha_      = false;
       show_base_      = false;
       fill_           = typename TString::value_type(' ');
+      floating_point_format_ = etl::floating_point_format::Fixed;
     }
 
     //***************************************************************************
@@ -457,6 +498,78 @@ namespace etl
       return boolalpha_;
     }
 
+    //***************************************************************************
+    /// Sets fixed floating point format.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& fixed()
+    {
+      floating_point_format_ = etl::floating_point_format::Fixed;
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Sets scientific floating point format.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& scientific()
+    {
+      floating_point_format_ = etl::floating_point_format::Scientific;
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Sets shortest round trip floating point format.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& shortest()
+    {
+      floating_point_format_ = etl::floating_point_format::Shortest;
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Sets the floating point format.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& floating_point_format(uint32_t f)
+    {
+      floating_point_format_ = static_cast<uint_least8_t>(f);
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Gets the floating point format.
+    //***************************************************************************
+    ETL_CONSTEXPR uint32_t get_floating_point_format() const
+    {
+      return floating_point_format_;
+    }
+
+    //***************************************************************************
+    /// Gets the fixed floating point format flag.
+    //***************************************************************************
+    ETL_CONSTEXPR bool is_fixed() const
+    {
+      return floating_point_format_ == etl::floating_point_format::Fixed;
+    }
+
+    //***************************************************************************
+    /// Gets the scientific floating point format flag.
+    //***************************************************************************
+    ETL_CONSTEXPR bool is_scientific() const
+    {
+      return floating_point_format_ == etl::floating_point_format::Scientific;
+    }
+
+    //***************************************************************************
+    /// Gets the shortest floating point format flag.
+    //***************************************************************************
+    ETL_CONSTEXPR bool is_shortest() const
+    {
+      return floating_point_format_ == etl::floating_point_format::Shortest;
+    }
+
     //***************************************************************************
     /// Equality operator.
     //***************************************************************************
@@ -469,7 +582,8 @@ namespace etl
              (lhs.left_justified_ == rhs.left_justified_) &&
              (lhs.boolalpha_ == rhs.boolalpha_) &&
              (lhs.show_base_ == rhs.show_base_) &&
-             (lhs.fill_ == rhs.fill_);
+             (lhs.fill_ == rhs.fill_) &&
+             (lhs.floating_point_format_ == rhs.floating_point_format_);
     }
 
     //***************************************************************************
@@ -490,6 +604,7 @@ namespace etl
     bool boolalpha_;
     bool show_base_;
     typename TString::value_type fill_;
+    uint_least8_t floating_point_format_;
   };
 }
 
@@ -47,6 +47,7 @@ SOFTWARE.
 #include "exception.h"
 #include "binary.h"
 #include "flags.h"
+#include "private/string_search.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -301,6 +302,15 @@ namespace etl
 #endif
   };
 
+  template <typename T>
+  class ibasic_string;
+
+  namespace private_transcode
+  {
+    template <typename T>
+    void set_truncated(etl::ibasic_string<T>& s);
+  }
+
   //***************************************************************************
   /// The base class for specifically sized strings.
   /// Can be used as a reference type for all strings containing a specific type.
@@ -1349,21 +1359,7 @@ namespace etl
     //*********************************************************************
     size_type find(const ibasic_string<T>& str, size_type pos = 0) const
     {
-      if ((pos + str.size()) > size())
-      {
-        return npos;
-      }
-
-      const_iterator iposition = etl::search(begin() + pos, end(), str.begin(), str.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return etl::private_string_search::find(p_buffer, size(), pos, str.data(), str.size());
     }
 
     //*********************************************************************
@@ -1373,23 +1369,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos = 0) const
     {
-#if ETL_IS_DEBUG_BUILD
-      if ((pos + etl::strlen(s)) > size())
-      {
-        return npos;
-      }
-#endif
-
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + etl::strlen(s));
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return etl::private_string_search::find(p_buffer, size(), pos, s, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1400,23 +1380,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos, size_type n) const
     {
-#if ETL_IS_DEBUG_BUILD
-      if ((pos + etl::strlen(s) - n) > size())
-      {
-        return npos;
-      }
-#endif
-
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + n);
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return etl::private_string_search::find(p_buffer, size(), pos, s, n);
     }
 
     //*********************************************************************
@@ -1426,16 +1390,7 @@ namespace etl
     //*********************************************************************
     size_type find(T c, size_type position = 0) const
     {
-      const_iterator i = etl::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return etl::distance(begin(), i);
-      }
-      else
-      {
-        return npos;
-      }
+      return etl::private_string_search::find(p_buffer, size(), position, c);
     }
 
     //*********************************************************************
@@ -1445,28 +1400,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const ibasic_string<T>& str, size_type position = npos) const
     {
-      if ((str.size()) > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator iposition = etl::search(rbegin() + position, rend(), str.rbegin(), str.rend());
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - str.size() - etl::distance(rbegin(), iposition);
-      }
+      return etl::private_string_search::rfind(p_buffer, size(), position, str.data(), str.size());
     }
 
     //*********************************************************************
@@ -1476,33 +1410,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const_pointer s, size_type position = npos) const
     {
-      size_type len = etl::strlen(s);
-
-      if (len > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + len);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = etl::search(rbegin() + position, rend(), srbegin, srend);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - len - etl::distance(rbegin(), iposition);
-      }
+      return etl::private_string_search::rfind(p_buffer, size(), position, s, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1512,31 +1420,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(const_pointer s, size_type position, size_type length_) const
     {
-      if (length_ > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + length_);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = etl::search(rbegin() + position, rend(), srbegin, srend);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - length_ - etl::distance(rbegin(), iposition);
-      }
+      return etl::private_string_search::rfind(p_buffer, size(), position, s, length_);
     }
 
     //*********************************************************************
@@ -1546,23 +1430,7 @@ namespace etl
     //*********************************************************************
     size_type rfind(T c, size_type position = npos) const
     {
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator i = etl::find(rbegin() + position, rend(), c);
-
-      if (i != rend())
-      {
-        return size() - etl::distance(rbegin(), i) - 1;
-      }
-      else
-      {
-        return npos;
-      }
+      return etl::private_string_search::rfind(p_buffer, size(), position, c);
     }
 
     //*********************************************************************
@@ -1887,21 +1755,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
-        }
-      }
-
-      return npos;
+      return etl::private_string_search::find_of(p_buffer, size(), position, s, n, true);
     }
 
     //*********************************************************************
@@ -1911,18 +1765,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(value_type c, size_type position = 0) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return etl::private_string_search::find_of(p_buffer, size(), position, &c, 1U, true);
     }
 
     //*********************************************************************
@@ -1953,30 +1796,7 @@ namespace etl
     //*********************************************************************
     size_type find_last_of(const_pointer s, size_type position, size_type n) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return etl::private_string_search::rfind_of(p_buffer, size(), position, s, n, true);
     }
 
     //*********************************************************************
@@ -1986,27 +1806,7 @@ namespace etl
     //*********************************************************************
     size_type find_last_of(value_type c, size_type position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        if (p_buffer[position] == c)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return etl::private_string_search::rfind_of(p_buffer, size(), position, &c, 1U, true);
     }
 
     //*********************************************************************
@@ -2037,28 +1837,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_not_of(const_pointer s, size_type position, size_type n) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          bool found = false;
-
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return etl::private_string_search::find_of(p_buffer, size(), position, s, n, false);
     }
 
     //*********************************************************************
@@ -2068,18 +1847,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_not_of(value_type c, size_type position = 0) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] != c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return etl::private_string_search::find_of(p_buffer, size(), position, &c, 1U, false);
     }
 
     //*********************************************************************
@@ -2110,37 +1878,7 @@ namespace etl
     //*********************************************************************
     size_type find_last_not_of(const_pointer s, size_type position, size_type n) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        for (size_type j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return etl::private_string_search::rfind_of(p_buffer, size(), position, s, n, false);
     }
 
     //*********************************************************************
@@ -2148,27 +1886,7 @@ namespace etl
     //*********************************************************************
     size_type find_last_not_of(value_type c, size_type position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        if (p_buffer[position] != c)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return etl::private_string_search::rfind_of(p_buffer, size(), position, &c, 1U, false);
     }
 
     //*************************************************************************
@@ -2289,6 +2007,12 @@ namespace etl
       p_buffer = p_buffer_;
     }
 
+    //*************************************************************************
+    /// Lets etl::transcode set the 'truncated' flag of its output string.
+    //*************************************************************************
+    template <typename U>
+    friend void etl::private_transcode::set_truncated(etl::ibasic_string<U>& s);
+
   private:
 
     //*************************************************************************
@@ -2296,30 +2020,25 @@ namespace etl
     //*************************************************************************
     int compare(const_pointer first1, const_pointer last1, const_pointer first2, const_pointer last2) const
     {
-      while ((first1 != last1) && (first2 != last2))
-      {
-        if (*first1 < *first2)
-        {
-          // Compared character is lower.
-          return -1;
-        }
-        else if (*first1 > *first2)
-        {
-          // Compared character is higher.
-          return 1;
-        }
+      const size_type length1 = size_type(last1 - first1);
+      const size_type length2 = size_type(last2 - first2);
+      const size_type length  = etl::min(length1, length2);
 
-        ++first1;
-        ++first2;
+      const size_type i = etl::private_string_search::mismatch(first1, first2, length);
+
+      if (i != length)
+      {
+        // Compared character is lower or higher.
+        return (first1[i] < first2[i]) ? -1 : 1;
       }
 
       // We reached the end of one or both of the strings.
-      if ((first1 == last1) && (first2 == last2))
+      if (length1 == length2)
       {
         // Same length.
         return 0;
       }
-      else if (first1 == last1)
+      else if (length1 < length2)
       {
         // Compared string is shorter.
         return -1;
@@ -191,6 +191,15 @@ namespace etl
       return ss;
     }
 
+    //*********************************
+    /// etl::floating_point_format_spec from etl::fixed, etl::scientific & etl::shortest stream manipulators
+    //*********************************
+    friend basic_string_stream& operator <<(basic_string_stream& ss, etl::private_basic_format_spec::floating_point_format_spec spec)
+    {
+      ss.spec.floating_point_format(spec.floating_point_format);
+      return ss;
+    }
+
     //*********************************
     /// etl::left_spec from etl::left stream manipulator
     //*********************************
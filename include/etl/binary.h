@@ -506,6 +506,61 @@ namespace etl
     return second ^ ((second ^ first) & MASK);
   }
 
+  namespace private_binary
+  {
+    //*************************************************************************
+    /// Compiler builtin backends for the bit counting functions.
+    /// GCC and Clang evaluate the builtins in constant expressions, so the
+    /// functions that use them remain constexpr.
+    /// 'T' is an unsigned type of up to 64 bits.
+    //*************************************************************************
+#if ETL_USING_BUILTIN_POPCOUNT
+    template <typename T>
+    ETL_CONSTEXPR14 uint_least8_t builtin_count_bits(T value)
+    {
+      return (sizeof(T) <= sizeof(unsigned int)) ? static_cast<uint_least8_t>(__builtin_popcount(static_cast<unsigned int>(value)))
+                                                 : static_cast<uint_least8_t>(__builtin_popcountll(static_cast<unsigned long long>(value)));
+    }
+#endif
+
+#if ETL_USING_BUILTIN_PARITY
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 uint_least8_t builtin_parity(T value)
+    {
+      return (sizeof(T) <= sizeof(unsigned int)) ? static_cast<uint_least8_t>(__builtin_parity(static_cast<unsigned int>(value)))
+                                                 : static_cast<uint_least8_t>(__builtin_parityll(static_cast<unsigned long long>(value)));
+    }
+#endif
+
+#if ETL_USING_BUILTIN_CTZ
+    //*************************************************************************
+    /// The builtin is undefined for zero.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 uint_least8_t builtin_count_trailing_zeros(T value)
+    {
+      return (value == 0U) ? static_cast<uint_least8_t>(etl::integral_limits<T>::bits)
+                           : (sizeof(T) <= sizeof(unsigned int)) ? static_cast<uint_least8_t>(__builtin_ctz(static_cast<unsigned int>(value)))
+                                                                 : static_cast<uint_least8_t>(__builtin_ctzll(static_cast<unsigned long long>(value)));
+    }
+#endif
+
+#if ETL_USING_BUILTIN_CLZ
+    //*************************************************************************
+    /// The builtin is undefined for zero.
+    /// The result is adjusted for types narrower than the builtin's argument.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 uint_least8_t builtin_count_leading_zeros(T value)
+    {
+      return (value == 0U) ? static_cast<uint_least8_t>(etl::integral_limits<T>::bits)
+                           : (sizeof(T) <= sizeof(unsigned int)) ? static_cast<uint_least8_t>(__builtin_clz(static_cast<unsigned int>(value)) - (etl::integral_limits<unsigned int>::bits - etl::integral_limits<T>::bits))
+                                                                 : static_cast<uint_least8_t>(__builtin_clzll(static_cast<unsigned long long>(value)) - (etl::integral_limits<unsigned long long>::bits - etl::integral_limits<T>::bits));
+    }
+#endif
+  }
+
   //***************************************************************************
   /// Reverse bits.
   ///\ingroup binary
@@ -523,11 +578,15 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 8U), T>::type
     reverse_bits(T value)
   {
+#if ETL_USING_BUILTIN_BITREVERSE
+    return static_cast<T>(__builtin_bitreverse8(value));
+#else
     value = ((value & 0xAAU) >> 1U) | ((value & 0x55U) << 1U);
     value = ((value & 0xCCU) >> 2U) | ((value & 0x33U) << 2U);
     value = (value >> 4U) | ((value & 0x0FU) << 4U);
 
     return value;
+#endif
   }
 
   //***********************************
@@ -568,12 +627,16 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 16U), T>::type
     reverse_bits(T value)
   {
+#if ETL_USING_BUILTIN_BITREVERSE
+    return static_cast<T>(__builtin_bitreverse16(value));
+#else
     value = ((value & 0xAAAAU) >> 1U) | ((value & 0x5555U) << 1U);
     value = ((value & 0xCCCCU) >> 2U) | ((value & 0x3333U) << 2U);
     value = ((value & 0xF0F0U) >> 4U) | ((value & 0x0F0FU) << 4U);
     value = (value >> 8U) | ((value & 0xFFU) << 8U);
 
     return value;
+#endif
   }
 
   //***********************************
@@ -615,6 +678,9 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 32U), T>::type
     reverse_bits(T value)
   {
+#if ETL_USING_BUILTIN_BITREVERSE
+    return static_cast<T>(__builtin_bitreverse32(value));
+#else
     value = ((value & 0xAAAAAAAAUL) >>  1U) | ((value & 0x55555555UL) <<  1U);
     value = ((value & 0xCCCCCCCCUL) >>  2U) | ((value & 0x33333333UL) <<  2U);
     value = ((value & 0xF0F0F0F0UL) >>  4U) | ((value & 0x0F0F0F0FUL) <<  4U);
@@ -622,6 +688,7 @@ namespace etl
     value = (value >> 16U) | ((value & 0xFFFFU) << 16U);
 
     return value;
+#endif
   }
 
   //***********************************
@@ -666,6 +733,9 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 64U), T>::type
     reverse_bits(T value)
   {
+#if ETL_USING_BUILTIN_BITREVERSE
+    return static_cast<T>(__builtin_bitreverse64(value));
+#else
     value = ((value & 0xAAAAAAAAAAAAAAAAULL) >>  1U) | ((value & 0x5555555555555555ULL) <<  1U);
     value = ((value & 0xCCCCCCCCCCCCCCCCULL) >>  2U) | ((value & 0x3333333333333333ULL) <<  2U);
     value = ((value & 0xF0F0F0F0F0F0F0F0ULL) >>  4U) | ((value & 0x0F0F0F0F0F0F0F0FULL) <<  4U);
@@ -674,6 +744,7 @@ namespace etl
     value = (value >> 32U) | ((value & 0xFFFFFFFFULL) << 32U);
 
     return value;
+#endif
   }
 
   //***********************************
@@ -910,6 +981,8 @@ namespace etl
   {
 #if ETL_CPP23_SUPPORTED && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_BUILTIN_POPCOUNT
+    return etl::private_binary::builtin_count_bits(value);
 #else
     uint32_t count = 0U;
 
@@ -933,6 +1006,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_BUILTIN_POPCOUNT
+    return etl::private_binary::builtin_count_bits(value);
 #else
     uint32_t count = 0U;
 
@@ -956,6 +1031,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_BUILTIN_POPCOUNT
+    return etl::private_binary::builtin_count_bits(value);
 #else
     uint32_t count = 0U;
 
@@ -981,6 +1058,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_BUILTIN_POPCOUNT
+    return etl::private_binary::builtin_count_bits(value);
 #else
     uint64_t count = 0U;
 
@@ -1020,9 +1099,13 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 8U), uint_least8_t>::type
     parity(T value)
   {
+#if ETL_USING_BUILTIN_PARITY
+    return etl::private_binary::builtin_parity(value);
+#else
     value ^= value >> 4U;
     value &= 0x0FU;
     return (0x6996U >> value) & 1U;
+#endif
   }
 #endif
 
@@ -1035,10 +1118,14 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 16U), uint_least8_t>::type
     parity(T value)
   {
+#if ETL_USING_BUILTIN_PARITY
+    return etl::private_binary::builtin_parity(value);
+#else
     value ^= value >> 8U;
     value ^= value >> 4U;
     value &= 0x0FU;
     return (0x6996U >> value) & 1U;
+#endif
   }
 
   //***************************************************************************
@@ -1050,11 +1137,15 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 32U), uint_least8_t>::type
     parity(T value)
   {
+#if ETL_USING_BUILTIN_PARITY
+    return etl::private_binary::builtin_parity(value);
+#else
     value ^= value >> 16U;
     value ^= value >> 8U;
     value ^= value >> 4U;
     value &= 0x0FU;
     return (0x6996U >> value) & 1U;
+#endif
   }
 
 #if ETL_USING_64BIT_TYPES
@@ -1067,12 +1158,16 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 64U), uint_least8_t>::type
     parity(T value)
   {
+#if ETL_USING_BUILTIN_PARITY
+    return etl::private_binary::builtin_parity(value);
+#else
     value ^= value >> 32U;
     value ^= value >> 16U;
     value ^= value >> 8U;
     value ^= value >> 4U;
     value &= 0x0FU;
     return (0x69966996UL >> value) & 1U;
+#endif
   }
 #endif
 
@@ -1103,6 +1198,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return etl::private_binary::builtin_count_trailing_zeros(value);
 #else
     uint_least8_t count = 0U;
 
@@ -1152,6 +1249,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return etl::private_binary::builtin_count_trailing_zeros(value);
 #else
     uint_least8_t count = 0U;
 
@@ -1206,6 +1305,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return etl::private_binary::builtin_count_trailing_zeros(value);
 #else
     uint_least8_t count = 0U;
 
@@ -1267,6 +1368,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return etl::private_binary::builtin_count_trailing_zeros(value);
 #else
       uint_least8_t count = 0U;
 
@@ -1349,6 +1452,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_one(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return etl::private_binary::builtin_count_trailing_zeros(static_cast<T>(~value));
 #else
     uint_least8_t count = 0U;
 
@@ -1398,6 +1503,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_one(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return etl::private_binary::builtin_count_trailing_zeros(static_cast<T>(~value));
 #else
     uint_least8_t count = 0U;
 
@@ -1452,6 +1559,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_one(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return etl::private_binary::builtin_count_trailing_zeros(static_cast<T>(~value));
 #else
     uint_least8_t count = 0U;
 
@@ -1513,6 +1622,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_one(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return etl::private_binary::builtin_count_trailing_zeros(static_cast<T>(~value));
 #else
     uint_least8_t count = 0U;
 
@@ -1524,6 +1635,12 @@ namespace etl
     {
       count = 1U;
 
+      if ((value & 0xFFFFFFFFULL) == 0xFFFFFFFFULL)
+      {
+        value >>= 32U;
+        count += 32U;
+      }
+
       if ((value & 0xFFFFULL) == 0xFFFFULL)
       {
         value >>= 16U;
@@ -1589,6 +1706,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_zero(value);
+#elif ETL_USING_BUILTIN_CLZ
+    return etl::private_binary::builtin_count_leading_zeros(value);
 #else
     uint_least8_t count = 0U;
 
@@ -1638,6 +1757,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_zero(value);
+#elif ETL_USING_BUILTIN_CLZ
+    return etl::private_binary::builtin_count_leading_zeros(value);
 #else
     uint_least8_t count = 0U;
 
@@ -1692,6 +1813,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_zero(value);
+#elif ETL_USING_BUILTIN_CLZ
+    return etl::private_binary::builtin_count_leading_zeros(value);
 #else
     uint_least8_t count = 0U;
 
@@ -1753,6 +1876,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_zero(value);
+#elif ETL_USING_BUILTIN_CLZ
+    return etl::private_binary::builtin_count_leading_zeros(value);
 #else
     uint_least8_t count = 0U;
 
@@ -1764,7 +1889,7 @@ namespace etl
     {
       count = 1U;
 
-      if ((value & 0xFFFFFFFFF0000000ULL) == 0U)
+      if ((value & 0xFFFFFFFF00000000ULL) == 0U)
       {
         value <<= 32U;
         count += 32U;
@@ -1819,7 +1944,7 @@ namespace etl
   {
     typedef typename etl::make_unsigned<T>::type unsigned_t;
 
-    return static_cast<T>(count_trailing_ones(static_cast<unsigned_t>(value)));
+    return static_cast<T>(count_leading_zeros(static_cast<unsigned_t>(value)));
   }
 
 #if ETL_USING_8BIT_TYPES
@@ -1835,6 +1960,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_one(value);
+#elif ETL_USING_BUILTIN_CLZ
+    return etl::private_binary::builtin_count_leading_zeros(static_cast<T>(~value));
 #else
     uint_least8_t count = 0U;
 
@@ -1884,6 +2011,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_one(value);
+#elif ETL_USING_BUILTIN_CLZ
+    return etl::private_binary::builtin_count_leading_zeros(static_cast<T>(~value));
 #else
     uint_least8_t count = 0U;
 
@@ -1938,6 +2067,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_one(value);
+#elif ETL_USING_BUILTIN_CLZ
+    return etl::private_binary::builtin_count_leading_zeros(static_cast<T>(~value));
 #else
     uint_least8_t count = 0U;
 
@@ -1951,8 +2082,8 @@ namespace etl
 
       if ((value & 0xFFFF0000UL) == 0xFFFF0000UL)
       {
-        value <<= 8U;
-        count += 8U;
+        value <<= 16U;
+        count += 16U;
       }
 
       if ((value & 0xFF000000UL) == 0xFF000000UL)
@@ -1999,6 +2130,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_one(value);
+#elif ETL_USING_BUILTIN_CLZ
+    return etl::private_binary::builtin_count_leading_zeros(static_cast<T>(~value));
 #else
     uint_least8_t count = 0U;
 
@@ -2012,14 +2145,14 @@ namespace etl
 
       if ((value & 0xFFFFFFFF00000000ULL) == 0xFFFFFFFF00000000ULL)
       {
-        value <<= 8U;
-        count += 8U;
+        value <<= 32U;
+        count += 32U;
       }
 
       if ((value & 0xFFFF000000000000ULL) == 0xFFFF000000000000ULL)
       {
-        value <<= 8U;
-        count += 8U;
+        value <<= 16U;
+        count += 16U;
       }
 
       if ((value & 0xFF00000000000000ULL) == 0xFF00000000000000ULL)
@@ -546,6 +546,34 @@ namespace etl
     size_t        bits_available;         ///< The number of bits still available in the bitstream buffer.
   };
 
+  namespace private_bit_stream
+  {
+    //*************************************************************************
+    /// The register that bits are packed in to, or unpacked from, before
+    /// being moved to or from the buffer as whole chars.
+    /// Values wider than 'Max_Chunk_Bits' are moved in more than one chunk.
+    /// Big endian streams hold the bits most significant first.
+    /// Little endian spans hold the bits least significant first, so that the
+    /// bits are reversed once per register, rather than once per value.
+    //*************************************************************************
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t accumulator_type;
+#else
+    typedef uint32_t accumulator_type;
+#endif
+
+    static ETL_CONSTANT uint_least8_t Accumulator_Bits = CHAR_BIT * sizeof(accumulator_type);
+    static ETL_CONSTANT uint_least8_t Max_Chunk_Bits   = Accumulator_Bits / 2U;
+
+    //*************************************************************************
+    /// A mask of the lowest 'nbits' bits, where nbits <= Max_Chunk_Bits.
+    //*************************************************************************
+    inline accumulator_type chunk_mask(uint_least8_t nbits)
+    {
+      return (accumulator_type(1U) << nbits) - 1U;
+    }
+  }
+
   //***************************************************************************
   /// Writes bits streams.
   //***************************************************************************
@@ -694,7 +722,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value, bool>::type
       write(T value, uint_least8_t nbits = CHAR_BIT * sizeof(T))
     {
-      bool success = (available(nbits) > 0U);
+      bool success = (nbits <= bits_available);
 
       if (success)
       {
@@ -708,6 +736,80 @@ namespace etl
       return success;
     }
 
+    //***************************************************************************
+    /// Writes a span of integral values, each of 'nbits' bits.
+    /// The values are packed in a register and written as whole chars.
+    //***************************************************************************
+    template <typename T, size_t Extent>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, typename etl::remove_cv<T>::type>::value, void>::type
+      write_unchecked(etl::span<T, Extent> values, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      typedef typename etl::unsigned_type<typename etl::remove_cv<T>::type>::type unsigned_t;
+
+      nbits = (nbits > (CHAR_BIT * sizeof(T))) ? (CHAR_BIT * sizeof(T)) : nbits;
+
+      if (callback.is_valid())
+      {
+        // The buffer may be smaller than the span, so flush after each value.
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          write_data<unsigned_t>(static_cast<unsigned_t>(values[i]), nbits);
+        }
+
+        return;
+      }
+
+      if (stream_endianness == etl::endian::little)
+      {
+        write_span_lsb_first<unsigned_t>(values.data(), values.size(), nbits);
+      }
+      else
+      {
+        write_span_msb_first<unsigned_t>(values.data(), values.size(), nbits);
+      }
+
+      bits_available -= values.size() * nbits;
+    }
+
+    //***************************************************************************
+    /// Writes a span of integral values, each of 'nbits' bits.
+    /// Returns <b>false</b>, and writes nothing, if there is not room for all of them.
+    /// If there is a callback, the values are written one at a time and the
+    /// write stops at the first value that does not fit.
+    //***************************************************************************
+    template <typename T, size_t Extent>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, typename etl::remove_cv<T>::type>::value, bool>::type
+      write(etl::span<T, Extent> values, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      if (callback.is_valid())
+      {
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          if (!write(values[i], nbits))
+          {
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+      const size_t width = (nbits > (CHAR_BIT * sizeof(T))) ? (CHAR_BIT * sizeof(T)) : nbits;
+
+      bool success = ((values.size() * width) <= bits_available);
+
+      if (success)
+      {
+        write_unchecked(values, nbits);
+      }
+      else
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::bit_stream_overflow));
+      }
+
+      return success;
+    }
+
     //***************************************************************************
     /// Skip n bits, up to the maximum space available.
     /// Returns <b>true</b> if the skip was possible.
@@ -924,45 +1026,261 @@ namespace etl
       // Make sure that we are not writing more bits than should be available.
       nbits = (nbits > (CHAR_BIT * sizeof(T))) ? (CHAR_BIT * sizeof(T)) : nbits;
 
+      private_bit_stream::accumulator_type accumulator;
+      uint_least8_t                        accumulator_bits;
+
+      load_accumulator(accumulator, accumulator_bits);
+      push_value(accumulator, accumulator_bits, order_bits(value, nbits), nbits);
+      store_accumulator(accumulator, accumulator_bits);
+
+      bits_available -= nbits;
+
+      if (callback.is_valid())
+      {
+        flush_full_bytes();
+      }
+    }
+
+    //***************************************************************************
+    /// Returns the lowest 'nbits' of the value in the order that they are
+    /// written to the stream, most significant first.
+    //***************************************************************************
+    template <typename T>
+    private_bit_stream::accumulator_type order_bits(T value, uint_least8_t nbits) const
+    {
       if (stream_endianness == etl::endian::little)
       {
         value = etl::reverse_bits(value);
-        value = value >> ((CHAR_BIT * sizeof(T)) - nbits);
+        value = (nbits == 0U) ? T(0U) : T(value >> ((CHAR_BIT * sizeof(T)) - nbits));
       }
 
-      // Send the bits to the stream.
-      while (nbits != 0)
+      return static_cast<private_bit_stream::accumulator_type>(value);
+    }
+
+    //***************************************************************************
+    /// Writes values to a big endian stream.
+    //***************************************************************************
+    template <typename TUnsigned, typename T>
+    void write_span_msb_first(const T* values, size_t count, uint_least8_t nbits)
+    {
+      private_bit_stream::accumulator_type accumulator;
+      uint_least8_t                        accumulator_bits;
+
+      load_accumulator(accumulator, accumulator_bits);
+
+      if (nbits <= private_bit_stream::Max_Chunk_Bits)
+      {
+        const private_bit_stream::accumulator_type mask = private_bit_stream::chunk_mask(nbits);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          push_bits(accumulator, accumulator_bits, static_cast<TUnsigned>(values[i]) & mask, nbits);
+        }
+      }
+      else
       {
-        unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
-        nbits -= mask_width;
-        T mask = ((T(1U) << mask_width) - 1U) << nbits;
+        for (size_t i = 0U; i < count; ++i)
+        {
+          push_value(accumulator, accumulator_bits, static_cast<TUnsigned>(values[i]), nbits);
+        }
+      }
 
-        // Move chunk to lowest char bits.
-        // Chunks are never larger than one char.
-        T chunk = ((value & mask) >> nbits) << (bits_available_in_char - mask_width);
+      store_accumulator(accumulator, accumulator_bits);
+    }
 
-        write_chunk(static_cast<char>(chunk), mask_width);
+    //***************************************************************************
+    /// Writes values to a little endian stream.
+    //***************************************************************************
+    template <typename TUnsigned, typename T>
+    void write_span_lsb_first(const T* values, size_t count, uint_least8_t nbits)
+    {
+      private_bit_stream::accumulator_type accumulator;
+      uint_least8_t                        accumulator_bits;
+
+      load_accumulator_lsb_first(accumulator, accumulator_bits);
+
+      if (nbits <= private_bit_stream::Max_Chunk_Bits)
+      {
+        const private_bit_stream::accumulator_type mask = private_bit_stream::chunk_mask(nbits);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          push_bits_lsb_first(accumulator, accumulator_bits, static_cast<TUnsigned>(values[i]) & mask, nbits);
+        }
+      }
+      else
+      {
+        for (size_t i = 0U; i < count; ++i)
+        {
+          push_value_lsb_first(accumulator, accumulator_bits, static_cast<TUnsigned>(values[i]), nbits);
+        }
       }
 
-      if (callback.is_valid())
+      store_accumulator_lsb_first(accumulator, accumulator_bits);
+    }
+
+    //***************************************************************************
+    /// Loads the used bits of a partially filled char in to the accumulator.
+    //***************************************************************************
+    void load_accumulator(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits) const
+    {
+      accumulator_bits = static_cast<uint_least8_t>(CHAR_BIT - bits_available_in_char);
+      accumulator      = (accumulator_bits == 0U) ? 0U : (static_cast<unsigned char>(pdata[char_index]) >> bits_available_in_char);
+    }
+
+    //***************************************************************************
+    /// Adds up to 'Max_Chunk_Bits' bits to the accumulator.
+    /// The value must not have any bits set above 'nbits'.
+    /// Whole chars are only written to the buffer when the accumulator is full.
+    //***************************************************************************
+    void push_bits(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits, private_bit_stream::accumulator_type value, uint_least8_t nbits)
+    {
+      if ((accumulator_bits + nbits) > (CHAR_BIT * sizeof(private_bit_stream::accumulator_type)))
       {
-        flush_full_bytes();
+        write_whole_chars(accumulator, accumulator_bits);
       }
+
+      accumulator = (accumulator << nbits) | value;
+      accumulator_bits += nbits;
     }
 
     //***************************************************************************
-    /// Write a data chunk to the stream
+    /// Adds a value of any width to the accumulator.
     //***************************************************************************
-    void write_chunk(char chunk, unsigned char nbits)
+    void push_value(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits, private_bit_stream::accumulator_type value, uint_least8_t nbits)
     {
-      // Clear if new byte.
-      if (bits_available_in_char == CHAR_BIT)
+      while (nbits > private_bit_stream::Max_Chunk_Bits)
       {
-        pdata[char_index] = 0U;
+        nbits -= private_bit_stream::Max_Chunk_Bits;
+        push_bits(accumulator, accumulator_bits, (value >> nbits) & private_bit_stream::chunk_mask(private_bit_stream::Max_Chunk_Bits), private_bit_stream::Max_Chunk_Bits);
       }
 
-      pdata[char_index] |= chunk;
-      step(nbits);
+      push_bits(accumulator, accumulator_bits, value & private_bit_stream::chunk_mask(nbits), nbits);
+    }
+
+    //***************************************************************************
+    /// Writes the whole chars in the accumulator to the buffer.
+    //***************************************************************************
+    void write_whole_chars(private_bit_stream::accumulator_type accumulator, uint_least8_t& accumulator_bits)
+    {
+      while (accumulator_bits >= CHAR_BIT)
+      {
+        accumulator_bits -= CHAR_BIT;
+        pdata[char_index++] = static_cast<char>(accumulator >> accumulator_bits);
+      }
+    }
+
+    //***************************************************************************
+    /// Writes the accumulator to the buffer.
+    /// A partially filled last char is stored left aligned, with the unused bits clear.
+    //***************************************************************************
+    void store_accumulator(private_bit_stream::accumulator_type accumulator, uint_least8_t accumulator_bits)
+    {
+      write_whole_chars(accumulator, accumulator_bits);
+
+      if (accumulator_bits == 0U)
+      {
+        bits_available_in_char = CHAR_BIT;
+      }
+      else
+      {
+        pdata[char_index]      = static_cast<char>(accumulator << (CHAR_BIT - accumulator_bits));
+        bits_available_in_char = static_cast<unsigned char>(CHAR_BIT - accumulator_bits);
+      }
+    }
+
+    //***************************************************************************
+    /// Loads the used bits of a partially filled char in to the accumulator,
+    /// least significant first.
+    //***************************************************************************
+    void load_accumulator_lsb_first(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits) const
+    {
+      using private_bit_stream::accumulator_type;
+      using private_bit_stream::Accumulator_Bits;
+
+      accumulator_bits = static_cast<uint_least8_t>(CHAR_BIT - bits_available_in_char);
+
+      if (accumulator_bits == 0U)
+      {
+        accumulator = 0U;
+      }
+      else
+      {
+        const accumulator_type c = static_cast<unsigned char>(pdata[char_index]);
+
+        accumulator = etl::reverse_bits(accumulator_type(c << (Accumulator_Bits - CHAR_BIT))) & private_bit_stream::chunk_mask(accumulator_bits);
+      }
+    }
+
+    //***************************************************************************
+    /// Adds up to 'Max_Chunk_Bits' bits to the accumulator, least significant first.
+    /// The value must not have any bits set above 'nbits'.
+    //***************************************************************************
+    void push_bits_lsb_first(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits, private_bit_stream::accumulator_type value, uint_least8_t nbits)
+    {
+      // Keep the shift below the width of the accumulator.
+      if ((accumulator_bits + nbits) >= private_bit_stream::Accumulator_Bits)
+      {
+        write_whole_chars_lsb_first(accumulator, accumulator_bits);
+      }
+
+      accumulator |= value << accumulator_bits;
+      accumulator_bits += nbits;
+    }
+
+    //***************************************************************************
+    /// Adds a value of any width to the accumulator, least significant first.
+    //***************************************************************************
+    void push_value_lsb_first(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits, private_bit_stream::accumulator_type value, uint_least8_t nbits)
+    {
+      while (nbits > private_bit_stream::Max_Chunk_Bits)
+      {
+        push_bits_lsb_first(accumulator, accumulator_bits, value & private_bit_stream::chunk_mask(private_bit_stream::Max_Chunk_Bits), private_bit_stream::Max_Chunk_Bits);
+        value >>= private_bit_stream::Max_Chunk_Bits;
+        nbits -= private_bit_stream::Max_Chunk_Bits;
+      }
+
+      push_bits_lsb_first(accumulator, accumulator_bits, value & private_bit_stream::chunk_mask(nbits), nbits);
+    }
+
+    //***************************************************************************
+    /// Writes the whole chars in the least significant first accumulator to the buffer.
+    /// The accumulator is reversed once for all of the chars.
+    //***************************************************************************
+    void write_whole_chars_lsb_first(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits)
+    {
+      const uint_least8_t whole_bits = accumulator_bits - (accumulator_bits % CHAR_BIT);
+
+      if (whole_bits != 0U)
+      {
+        const private_bit_stream::accumulator_type msb_first = etl::reverse_bits(accumulator);
+
+        for (uint_least8_t shift = private_bit_stream::Accumulator_Bits - CHAR_BIT; accumulator_bits >= CHAR_BIT; shift -= CHAR_BIT)
+        {
+          pdata[char_index++] = static_cast<char>(msb_first >> shift);
+          accumulator_bits -= CHAR_BIT;
+        }
+
+        accumulator = (whole_bits == private_bit_stream::Accumulator_Bits) ? 0U : (accumulator >> whole_bits);
+      }
+    }
+
+    //***************************************************************************
+    /// Writes the least significant first accumulator to the buffer.
+    //***************************************************************************
+    void store_accumulator_lsb_first(private_bit_stream::accumulator_type accumulator, uint_least8_t accumulator_bits)
+    {
+      write_whole_chars_lsb_first(accumulator, accumulator_bits);
+
+      if (accumulator_bits == 0U)
+      {
+        bits_available_in_char = CHAR_BIT;
+      }
+      else
+      {
+        pdata[char_index]      = static_cast<char>(etl::reverse_bits(accumulator) >> (private_bit_stream::Accumulator_Bits - CHAR_BIT));
+        bits_available_in_char = static_cast<unsigned char>(CHAR_BIT - accumulator_bits);
+      }
     }
 
     //***************************************************************************
@@ -1188,6 +1506,54 @@ namespace etl
       return result;
     }
 
+    //***************************************************************************
+    /// Reads a span of integral values, each of 'nbits' bits.
+    /// The chars are loaded in to a register and unpacked from there.
+    //***************************************************************************
+    template <typename T, size_t Extent>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, void>::type
+      read_unchecked(etl::span<T, Extent> values, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      typedef typename etl::unsigned_type<T>::type unsigned_t;
+
+      nbits = (nbits > (CHAR_BIT * sizeof(T))) ? (CHAR_BIT * sizeof(T)) : nbits;
+
+      if (stream_endianness == etl::endian::little)
+      {
+        read_span_lsb_first<unsigned_t>(values.data(), values.size(), nbits);
+      }
+      else
+      {
+        read_span_msb_first<unsigned_t>(values.data(), values.size(), nbits);
+      }
+
+      bits_available -= values.size() * nbits;
+    }
+
+    //***************************************************************************
+    /// Reads a span of integral values, each of 'nbits' bits.
+    /// Returns <b>false</b>, and reads nothing, if the stream does not contain enough bits.
+    //***************************************************************************
+    template <typename T, size_t Extent>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, bool>::type
+      read(etl::span<T, Extent> values, uint_least8_t nbits = CHAR_BIT * sizeof(T))
+    {
+      const size_t width = (nbits > (CHAR_BIT * sizeof(T))) ? (CHAR_BIT * sizeof(T)) : nbits;
+
+      bool success = ((values.size() * width) <= bits_available);
+
+      if (success)
+      {
+        read_unchecked(values, nbits);
+      }
+      else
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::bit_stream_overflow));
+      }
+
+      return success;
+    }
+
     //***************************************************************************
     /// Returns the number of bytes in the stream buffer.
     //***************************************************************************
@@ -1286,60 +1652,281 @@ namespace etl
       // Make sure that we are not reading more bits than should be available.
       nbits = (nbits > (CHAR_BIT * sizeof(T))) ? (CHAR_BIT * sizeof(T)) : nbits;
 
-      T value = 0;
-      uint_least8_t bits = nbits;
+      private_bit_stream::accumulator_type accumulator;
+      uint_least8_t                        accumulator_bits;
+      size_t                               index;
+
+      load_accumulator(accumulator, accumulator_bits, index);
+
+      const T value = static_cast<T>(pull_value(accumulator, accumulator_bits, index, nbits));
+
+      store_accumulator(accumulator_bits, index);
+
+      bits_available -= nbits;
+
+      return order_bits(value, nbits, is_signed);
+    }
+
+    //***************************************************************************
+    /// Reads values from a big endian stream.
+    //***************************************************************************
+    template <typename TUnsigned, typename T>
+    void read_span_msb_first(T* values, size_t count, uint_least8_t nbits)
+    {
+      private_bit_stream::accumulator_type accumulator;
+      uint_least8_t                        accumulator_bits;
+      size_t                               index;
 
-      // Get the bits from the stream.
-      while (nbits != 0)
+      load_accumulator(accumulator, accumulator_bits, index);
+
+      if (nbits <= private_bit_stream::Max_Chunk_Bits)
       {
-        unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
+        const private_bit_stream::accumulator_type mask = private_bit_stream::chunk_mask(nbits);
 
-        T chunk = get_chunk(mask_width);
+        for (size_t i = 0U; i < count; ++i)
+        {
+          const TUnsigned value = static_cast<TUnsigned>(pull_bits(accumulator, accumulator_bits, index, nbits) & mask);
 
-        nbits -= mask_width;
-        value |= static_cast<T>(chunk << nbits);
+          values[i] = static_cast<T>(extend_sign(value, nbits, etl::is_signed<T>::value));
+        }
       }
+      else
+      {
+        for (size_t i = 0U; i < count; ++i)
+        {
+          const TUnsigned value = static_cast<TUnsigned>(pull_value(accumulator, accumulator_bits, index, nbits));
 
-      if (stream_endianness == etl::endian::little)
+          values[i] = static_cast<T>(extend_sign(value, nbits, etl::is_signed<T>::value));
+        }
+      }
+
+      store_accumulator(accumulator_bits, index);
+    }
+
+    //***************************************************************************
+    /// Reads values from a little endian stream.
+    //***************************************************************************
+    template <typename TUnsigned, typename T>
+    void read_span_lsb_first(T* values, size_t count, uint_least8_t nbits)
+    {
+      private_bit_stream::accumulator_type accumulator;
+      uint_least8_t                        accumulator_bits;
+      size_t                               index;
+
+      load_accumulator_lsb_first(accumulator, accumulator_bits, index);
+
+      if (nbits <= private_bit_stream::Max_Chunk_Bits)
+      {
+        const private_bit_stream::accumulator_type mask = private_bit_stream::chunk_mask(nbits);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          const TUnsigned value = static_cast<TUnsigned>(pull_bits_lsb_first(accumulator, accumulator_bits, index, nbits) & mask);
+
+          values[i] = static_cast<T>(extend_sign(value, nbits, etl::is_signed<T>::value));
+        }
+      }
+      else
       {
-        value = value << ((CHAR_BIT * sizeof(T)) - bits);
+        for (size_t i = 0U; i < count; ++i)
+        {
+          const TUnsigned value = static_cast<TUnsigned>(pull_value_lsb_first(accumulator, accumulator_bits, index, nbits));
+
+          values[i] = static_cast<T>(extend_sign(value, nbits, etl::is_signed<T>::value));
+        }
+      }
+
+      store_accumulator(accumulator_bits, index);
+    }
+
+    //***************************************************************************
+    /// Converts 'nbits' bits read from the stream, most significant first,
+    /// to a value.
+    //***************************************************************************
+    template <typename T>
+    T order_bits(T value, uint_least8_t nbits, bool is_signed) const
+    {
+      if ((stream_endianness == etl::endian::little) && (nbits != 0U))
+      {
+        value = value << ((CHAR_BIT * sizeof(T)) - nbits);
         value = etl::reverse_bits(value);
       }
 
-      if (is_signed && (bits != (CHAR_BIT * sizeof(T))))
+      return extend_sign(value, nbits, is_signed);
+    }
+
+    //***************************************************************************
+    /// Sign extends an 'nbits' wide value, if signed.
+    //***************************************************************************
+    template <typename T>
+    T extend_sign(T value, uint_least8_t nbits, bool is_signed) const
+    {
+      if (is_signed && (nbits != 0U) && (nbits != (CHAR_BIT * sizeof(T))))
       {
-        value = etl::sign_extend<T, T>(value, bits);
+        value = etl::sign_extend<T, T>(value, nbits);
       }
 
       return value;
     }
 
     //***************************************************************************
-    /// Get a data chunk from the stream
+    /// Loads the unread bits of a partially read char in to the accumulator.
+    /// 'index' is set to the next char to load.
     //***************************************************************************
-    unsigned char get_chunk(unsigned char nbits)
+    void load_accumulator(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits, size_t& index) const
     {
-      unsigned char value = pdata[char_index];
-      value >>= (bits_available_in_char - nbits);
+      index = char_index;
 
-      unsigned char mask;
+      if (bits_available_in_char == CHAR_BIT)
+      {
+        accumulator      = 0U;
+        accumulator_bits = 0U;
+      }
+      else
+      {
+        accumulator      = static_cast<unsigned char>(pdata[index++]);
+        accumulator_bits = bits_available_in_char;
+      }
+    }
 
-      if (nbits == CHAR_BIT)
+    //***************************************************************************
+    /// Takes up to 'Max_Chunk_Bits' bits from the accumulator, loading whole
+    /// chars from the buffer as required.
+    /// The bits above 'nbits' in the result are undefined.
+    //***************************************************************************
+    private_bit_stream::accumulator_type pull_bits(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits, size_t& index, uint_least8_t nbits) const
+    {
+      while (accumulator_bits < nbits)
       {
-        mask = etl::integral_limits<unsigned char>::max;
+        accumulator = (accumulator << CHAR_BIT) | static_cast<unsigned char>(pdata[index++]);
+        accumulator_bits += CHAR_BIT;
+      }
+
+      accumulator_bits -= nbits;
+
+      return accumulator >> accumulator_bits;
+    }
+
+    //***************************************************************************
+    /// Takes a value of any width from the accumulator.
+    //***************************************************************************
+    private_bit_stream::accumulator_type pull_value(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits, size_t& index, uint_least8_t nbits) const
+    {
+      private_bit_stream::accumulator_type value = 0U;
+
+      while (nbits > private_bit_stream::Max_Chunk_Bits)
+      {
+        nbits -= private_bit_stream::Max_Chunk_Bits;
+        value = (value << private_bit_stream::Max_Chunk_Bits) | (pull_bits(accumulator, accumulator_bits, index, private_bit_stream::Max_Chunk_Bits) & private_bit_stream::chunk_mask(private_bit_stream::Max_Chunk_Bits));
+      }
+
+      return (value << nbits) | (pull_bits(accumulator, accumulator_bits, index, nbits) & private_bit_stream::chunk_mask(nbits));
+    }
+
+    //***************************************************************************
+    /// Loads the unread bits of a partially read char in to the accumulator,
+    /// least significant first.
+    /// 'index' is set to the next char to load.
+    //***************************************************************************
+    void load_accumulator_lsb_first(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits, size_t& index) const
+    {
+      using private_bit_stream::accumulator_type;
+      using private_bit_stream::Accumulator_Bits;
+
+      index = char_index;
+
+      if (bits_available_in_char == CHAR_BIT)
+      {
+        accumulator      = 0U;
+        accumulator_bits = 0U;
       }
       else
       {
-        mask = (1U << nbits) - 1;
+        const accumulator_type c = static_cast<unsigned char>(pdata[index++]);
+
+        accumulator      = etl::reverse_bits(accumulator_type(c << (Accumulator_Bits - CHAR_BIT))) >> (CHAR_BIT - bits_available_in_char);
+        accumulator_bits = bits_available_in_char;
       }
+    }
 
-      value &= mask;
+    //***************************************************************************
+    /// Takes up to 'Max_Chunk_Bits' bits from the least significant first accumulator.
+    /// When more are required, as many whole chars as will fit are loaded and
+    /// reversed together.
+    /// The bits above 'nbits' in the result are undefined.
+    //***************************************************************************
+    private_bit_stream::accumulator_type pull_bits_lsb_first(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits, size_t& index, uint_least8_t nbits) const
+    {
+      using private_bit_stream::accumulator_type;
+      using private_bit_stream::Accumulator_Bits;
 
-      step(nbits);
+      if (accumulator_bits < nbits)
+      {
+        size_t       count     = (Accumulator_Bits - accumulator_bits) / CHAR_BIT;
+        const size_t remaining = length_chars - index;
+
+        count = (count < remaining) ? count : remaining;
+
+        if (count != 0U)
+        {
+          accumulator_type word = 0U;
+
+          for (size_t i = 0U; i < count; ++i)
+          {
+            word = (word << CHAR_BIT) | static_cast<unsigned char>(pdata[index++]);
+          }
+
+          accumulator |= etl::reverse_bits(accumulator_type(word << (Accumulator_Bits - (count * CHAR_BIT)))) << accumulator_bits;
+          accumulator_bits += static_cast<uint_least8_t>(count * CHAR_BIT);
+        }
+      }
+
+      const accumulator_type value = accumulator;
+
+      accumulator >>= nbits;
+      accumulator_bits -= nbits;
 
       return value;
     }
 
+    //***************************************************************************
+    /// Takes a value of any width from the least significant first accumulator.
+    //***************************************************************************
+    private_bit_stream::accumulator_type pull_value_lsb_first(private_bit_stream::accumulator_type& accumulator, uint_least8_t& accumulator_bits, size_t& index, uint_least8_t nbits) const
+    {
+      private_bit_stream::accumulator_type value = 0U;
+      uint_least8_t                        shift = 0U;
+
+      while (nbits > private_bit_stream::Max_Chunk_Bits)
+      {
+        value |= (pull_bits_lsb_first(accumulator, accumulator_bits, index, private_bit_stream::Max_Chunk_Bits) & private_bit_stream::chunk_mask(private_bit_stream::Max_Chunk_Bits)) << shift;
+        shift += private_bit_stream::Max_Chunk_Bits;
+        nbits -= private_bit_stream::Max_Chunk_Bits;
+      }
+
+      return value | ((pull_bits_lsb_first(accumulator, accumulator_bits, index, nbits) & private_bit_stream::chunk_mask(nbits)) << shift);
+    }
+
+    //***************************************************************************
+    /// Sets the read position from the state of the accumulator.
+    /// The unread bits are from the last chars loaded.
+    //***************************************************************************
+    void store_accumulator(uint_least8_t accumulator_bits, size_t index)
+    {
+      const size_t unread_chars = (accumulator_bits + CHAR_BIT - 1U) / CHAR_BIT;
+
+      char_index = index - unread_chars;
+
+      if (accumulator_bits == 0U)
+      {
+        bits_available_in_char = CHAR_BIT;
+      }
+      else
+      {
+        bits_available_in_char = static_cast<unsigned char>(accumulator_bits - ((unread_chars - 1U) * CHAR_BIT));
+      }
+    }
+
     //***************************************************************************
     /// Get a bool from the stream
     //***************************************************************************
@@ -39,6 +39,8 @@ SOFTWARE.
 #include "algorithm.h"
 #include "iterator.h"
 #include "memory.h"
+#include "binary.h"
+#include "unaligned_type.h"
 #include "span.h"
 #include "iterator.h"
 #include "optional.h"
@@ -48,6 +50,7 @@ SOFTWARE.
 
 #include <stdint.h>
 #include <limits.h>
+#include <string.h>
 
 namespace etl
 {
@@ -78,6 +81,70 @@ namespace etl
     }
   };
 
+  namespace private_byte_stream
+  {
+    //*************************************************************************
+    /// Copies n words, reversing the bytes of each one.
+    /// The words are loaded and stored with memcpy, so neither buffer needs to
+    /// be aligned. The loop is simple enough for compilers to vectorise.
+    //*************************************************************************
+    template <typename TWord>
+    void copy_reversed_words(const char* source, char* destination, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        TWord word;
+
+        memcpy(&word, source, sizeof(TWord));
+        word = etl::reverse_bytes(word);
+        memcpy(destination, &word, sizeof(TWord));
+
+        source      += sizeof(TWord);
+        destination += sizeof(TWord);
+      }
+    }
+
+    //*************************************************************************
+    /// Copies n values of 'size' bytes.
+    /// If 'reverse' is true then the bytes of each value are reversed.
+    //*************************************************************************
+    inline void copy_block(const char* source, char* destination, size_t n, size_t size, bool reverse)
+    {
+      if (n == 0U)
+      {
+        return;
+      }
+
+      if (!reverse || (size == 1U))
+      {
+        memcpy(destination, source, n * size);
+      }
+      else if (size == 2U)
+      {
+        copy_reversed_words<uint16_t>(source, destination, n);
+      }
+      else if (size == 4U)
+      {
+        copy_reversed_words<uint32_t>(source, destination, n);
+      }
+#if ETL_USING_64BIT_TYPES
+      else if (size == 8U)
+      {
+        copy_reversed_words<uint64_t>(source, destination, n);
+      }
+#endif
+      else
+      {
+        while (n-- != 0U)
+        {
+          etl::reverse_copy(source, source + size, destination);
+          source      += size;
+          destination += size;
+        }
+      }
+    }
+  }
+
   //***************************************************************************
   /// Encodes a byte stream.
   //***************************************************************************
@@ -216,13 +283,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
       write_unchecked(const etl::span<T>& range)
     {
-      typename etl::span<T>::iterator itr = range.begin();
-
-      while (itr != range.end())
-      {
-        to_bytes(*itr);
-        ++itr;
-      }
+      to_bytes(range.data(), range.size());
     }
 
     //***************************************************************************
@@ -253,11 +314,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
       write_unchecked(const T* start, size_t length)
     {
-      while (length-- != 0U)
-      {
-        to_bytes(*start);
-        ++start;
-      }
+      to_bytes(start, length);
     }
 
     //***************************************************************************
@@ -503,6 +560,31 @@ namespace etl
       step(sizeof(T));
     }
 
+    //*********************************
+    /// Copies the whole block in one go, byte swapping if the stream and
+    /// platform endianness differ.
+    /// The callback, if set, is still called once for each value.
+    //*********************************
+    template <typename T>
+    void to_bytes(const T* source, size_t n)
+    {
+      const etl::endian platform_endianness = etl::endianness::value();
+
+      private_byte_stream::copy_block(reinterpret_cast<const char*>(source), pcurrent, n, sizeof(T), stream_endianness != platform_endianness);
+
+      if (callback.is_valid())
+      {
+        while (n-- != 0U)
+        {
+          step(sizeof(T));
+        }
+      }
+      else
+      {
+        pcurrent += n * sizeof(T);
+      }
+    }
+
     //*********************************
     void step(size_t n)
     {
@@ -682,12 +764,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(etl::span<T> range)
     {
-      typename etl::span<T>::iterator destination = range.begin();
-
-      while (destination != range.end())
-      {
-        *destination++ = from_bytes<T>();
-      }
+      from_bytes(range.data(), range.size());
 
       return etl::span<const T>(range.begin(), range.end());
     }
@@ -715,12 +792,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(T* start,  size_t length)
     {
-      T* destination = start;
-
-      for (size_t i = 0; i < length; ++i)
-      {
-        *destination++ = from_bytes<T>();
-      }
+      from_bytes(start, length);
 
       return etl::span<const T>(start, length);
     }
@@ -741,6 +813,43 @@ namespace etl
       return etl::optional<etl::span<const T> >();
     }
 
+    //***************************************************************************
+    /// Read a range of etl::unaligned_type from the stream, without copying.
+    /// The span refers to the stream buffer.
+    /// The values are decoded in the endianness of T, not of the stream.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_unaligned_type<T>::value, etl::span<const T> >::type
+      read_view_unchecked(size_t n)
+    {
+      ETL_STATIC_ASSERT(sizeof(T) == T::Size, "Unaligned type must not be padded");
+
+      const T* pview = reinterpret_cast<const T*>(pcurrent);
+      pcurrent += n * sizeof(T);
+
+      return etl::span<const T>(pview, n);
+    }
+
+    //***************************************************************************
+    /// Read a range of etl::unaligned_type from the stream, without copying.
+    /// The span refers to the stream buffer.
+    /// The values are decoded in the endianness of T, not of the stream.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_unaligned_type<T>::value, etl::optional<etl::span<const T> > >::type
+      read_view(size_t n)
+    {
+      etl::optional<etl::span<const T> > result;
+
+      // Do we have enough room?
+      if (available<T>() >= n)
+      {
+        result = read_view_unchecked<T>(n);
+      }
+
+      return result;
+    }
+
     //***************************************************************************
     /// Skip n items of T, up to the maximum space available.
     /// Returns <b>true</b> if the skip was possible.
@@ -886,6 +995,33 @@ namespace etl
       return value;
     }
 
+    //*********************************
+    /// Copies the whole block in one go, byte swapping if the stream and
+    /// platform endianness differ.
+    //*********************************
+    template <typename T>
+    typename etl::enable_if<!etl::is_same<T, bool>::value, void>::type
+      from_bytes(T* destination, size_t n)
+    {
+      const etl::endian platform_endianness = etl::endianness::value();
+
+      private_byte_stream::copy_block(pcurrent, reinterpret_cast<char*>(destination), n, sizeof(T), stream_endianness != platform_endianness);
+      pcurrent += n * sizeof(T);
+    }
+
+    //*********************************
+    /// bool must be converted value by value.
+    //*********************************
+    template <typename T>
+    typename etl::enable_if<etl::is_same<T, bool>::value, void>::type
+      from_bytes(T* destination, size_t n)
+    {
+      while (n-- != 0U)
+      {
+        *destination++ = from_bytes<T>();
+      }
+    }
+
     //*********************************
     void copy_value(const char* source, char* destination, size_t length) const
     {
@@ -35,6 +35,7 @@ SOFTWARE.
 #include "delegate.h"
 #include "static_assert.h"
 #include "timer.h"
+#include "timer_engine.h"
 #include "error_handler.h"
 #include "placement_new.h"
 
@@ -44,8 +45,9 @@ namespace etl
 {
   //***************************************************************************
   /// Interface for callback timer
+  ///\tparam TEngine The engine that orders the active timers.
   //***************************************************************************
-  template <typename TInterruptGuard>
+  template <typename TInterruptGuard, typename TEngine = etl::timer_delta_list>
   class icallback_timer_interrupt
   {
   public:
@@ -105,7 +107,7 @@ namespace etl
             TInterruptGuard guard;
             (void)guard; // Silence 'unused variable warnings.
 
-            active_list.remove(timer.id, false);
+            active_list.remove(timer.id);
           }
 
           // Reset in-place.
@@ -164,39 +166,26 @@ namespace etl
     {
       if (enabled)
       {
-        // We have something to do?
-        bool has_active = !active_list.empty();       
+        // Process the expired timers.
+        etl::timer::id::type id = active_list.next_expired(count);
 
-        if (has_active)
+        while (id != etl::timer::id::NO_TIMER)
         {
-          while (has_active && (count >= active_list.front().delta))
-          {
-            timer_data& timer = active_list.front();
-
-            count -= timer.delta;
+          timer_data& timer = timer_array[id];
 
-            active_list.remove(timer.id, true);
-
-            if (timer.callback.is_valid())
-            {
-              timer.callback();
-            }
-
-            if (timer.repeating)
-            {
-              // Reinsert the timer.
-              timer.delta = timer.period;
-              active_list.insert(timer.id);
-            }
-
-            has_active = !active_list.empty();
+          if (timer.callback.is_valid())
+          {
+            timer.callback();
           }
 
-          if (has_active)
+          if (timer.repeating)
           {
-            // Subtract any remainder from the next due timeout.
-            active_list.front().delta -= count;
+            // Reinsert the timer.
+            timer.delta = timer.period;
+            active_list.insert(timer.id);
           }
+
+          id = active_list.next_expired(count);
         }
 
         return true;
@@ -228,7 +217,7 @@ namespace etl
 
             if (timer.is_active())
             {
-              active_list.remove(timer.id, false);
+              active_list.remove(timer.id);
             }
 
             timer.delta = immediate_ ? 0U : timer.period;
@@ -262,7 +251,7 @@ namespace etl
             TInterruptGuard guard;
             (void)guard; // Silence 'unused variable warnings.
 
-            active_list.remove(timer.id, false);
+            active_list.remove(timer.id);
           }
 
           result = true;
@@ -380,189 +369,11 @@ namespace etl
 
   private:
 
-    //*************************************************************************
-    /// A specialised intrusive linked list for timer data.
-    //*************************************************************************
-    class timer_list
-    {
-    public:
-
-      //*******************************
-      timer_list(timer_data* ptimers_)
-        : head(etl::timer::id::NO_TIMER)
-        , tail(etl::timer::id::NO_TIMER)
-        , current(etl::timer::id::NO_TIMER)
-        , ptimers(ptimers_)
-      {
-      }
-
-      //*******************************
-      bool empty() const
-      {
-        return head == etl::timer::id::NO_TIMER;
-      }
-
-      //*******************************
-      // Inserts the timer at the correct delta position
-      //*******************************
-      void insert(etl::timer::id::type id_)
-      {
-        timer_data& timer = ptimers[id_];
-
-        if (head == etl::timer::id::NO_TIMER)
-        {
-          // No entries yet.
-          head = id_;
-          tail = id_;
-          timer.previous = etl::timer::id::NO_TIMER;
-          timer.next = etl::timer::id::NO_TIMER;
-        }
-        else
-        {
-          // We already have entries.
-          etl::timer::id::type test_id = begin();
-
-          while (test_id != etl::timer::id::NO_TIMER)
-          {
-            timer_data& test = ptimers[test_id];
-
-            // Find the correct place to insert.
-            if (timer.delta <= test.delta)
-            {
-              if (test.id == head)
-              {
-                head = timer.id;
-              }
-
-              // Insert before test.
-              timer.previous = test.previous;
-              test.previous = timer.id;
-              timer.next = test.id;
-
-              // Adjust the next delta to compensate.
-              test.delta -= timer.delta;
-
-              if (timer.previous != etl::timer::id::NO_TIMER)
-              {
-                ptimers[timer.previous].next = timer.id;
-              }
-              break;
-            }
-            else
-            {
-              timer.delta -= test.delta;
-            }
-
-            test_id = next(test_id);
-          }
-
-          // Reached the end?
-          if (test_id == etl::timer::id::NO_TIMER)
-          {
-            // Tag on to the tail.
-            ptimers[tail].next = timer.id;
-            timer.previous = tail;
-            timer.next = etl::timer::id::NO_TIMER;
-            tail = timer.id;
-          }
-        }
-      }
-
-      //*******************************
-      void remove(etl::timer::id::type id_, bool has_expired)
-      {
-        timer_data& timer = ptimers[id_];
-
-        if (head == id_)
-        {
-          head = timer.next;
-        }
-        else
-        {
-          ptimers[timer.previous].next = timer.next;
-        }
-
-        if (tail == id_)
-        {
-          tail = timer.previous;
-        }
-        else
-        {
-          ptimers[timer.next].previous = timer.previous;
-        }
-
-        if (!has_expired)
-        {
-          // Adjust the next delta.
-          if (timer.next != etl::timer::id::NO_TIMER)
-          {
-            ptimers[timer.next].delta += timer.delta;
-          }
-        }
-
-        timer.previous = etl::timer::id::NO_TIMER;
-        timer.next = etl::timer::id::NO_TIMER;
-        timer.delta = etl::timer::state::INACTIVE;
-      }
-
-      //*******************************
-      timer_data& front()
-      {
-        return ptimers[head];
-      }
-
-      //*******************************
-      etl::timer::id::type begin()
-      {
-        current = head;
-        return current;
-      }
-
-      //*******************************
-      etl::timer::id::type previous(etl::timer::id::type last)
-      {
-        current = ptimers[last].previous;
-        return current;
-      }
-
-      //*******************************
-      etl::timer::id::type next(etl::timer::id::type last)
-      {
-        current = ptimers[last].next;
-        return current;
-      }
-
-      //*******************************
-      void clear()
-      {
-        etl::timer::id::type id = begin();
-
-        while (id != etl::timer::id::NO_TIMER)
-        {
-          timer_data& timer = ptimers[id];
-          id = next(id);
-          timer.next = etl::timer::id::NO_TIMER;
-        }
-
-        head = etl::timer::id::NO_TIMER;
-        tail = etl::timer::id::NO_TIMER;
-        current = etl::timer::id::NO_TIMER;
-      }
-
-    private:
-
-      etl::timer::id::type head;
-      etl::timer::id::type tail;
-      etl::timer::id::type current;
-
-      timer_data* const ptimers;
-    };
-
     // The array of timer data structures.
     timer_data* const timer_array;
 
     // The list of active timers.
-    timer_list active_list;
+    typename TEngine::template engine<timer_data> active_list;
 
     volatile bool enabled;
     volatile uint_least8_t number_of_registered_timers;
@@ -575,26 +386,26 @@ namespace etl
   //***************************************************************************
   /// The callback timer
   //***************************************************************************
-  template <uint_least8_t MAX_TIMERS_, typename TInterruptGuard>
-  class callback_timer_interrupt : public etl::icallback_timer_interrupt<TInterruptGuard>
+  template <uint_least8_t MAX_TIMERS_, typename TInterruptGuard, typename TEngine = etl::timer_delta_list>
+  class callback_timer_interrupt : public etl::icallback_timer_interrupt<TInterruptGuard, TEngine>
   {
   public:
 
     ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254U, "No more than 254 timers are allowed");
 
-    typedef typename icallback_timer_interrupt<TInterruptGuard>::callback_type callback_type;
+    typedef typename icallback_timer_interrupt<TInterruptGuard, TEngine>::callback_type callback_type;
 
     //*******************************************
     /// Constructor.
     //*******************************************
     callback_timer_interrupt()
-      : icallback_timer_interrupt<TInterruptGuard>(timer_array, MAX_TIMERS_)
+      : icallback_timer_interrupt<TInterruptGuard, TEngine>(timer_array, MAX_TIMERS_)
     {
     }
 
   private:
 
-    typename icallback_timer_interrupt<TInterruptGuard>::timer_data timer_array[MAX_TIMERS_];
+    typename icallback_timer_interrupt<TInterruptGuard, TEngine>::timer_data timer_array[MAX_TIMERS_];
   };
 }
 
@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "algorithm.h"
 #include "iterator.h"
+#include "private/string_search.h"
 
 #include <stdint.h>
 
@@ -114,6 +115,11 @@ namespace etl
 
       if (str != 0)
       {
+        if (etl::private_string_search::is_byte_char<char_type>::value && etl::private_string_search::is_runtime())
+        {
+          return etl::private_string_search::length_bytes(str);
+        }
+
         while (*str++ != 0)
         {
           ++count;
@@ -184,38 +190,22 @@ namespace etl
     //*************************************************************************
     static ETL_CONSTEXPR14 int compare(const char_type* s1, const char_type* s2, size_t count)
     {
-      for (size_t i = 0UL; i < count; ++i)
-      {
-        if (*s1 < *s2)
-        {
-          return -1;
-        }
-          else if (*s1 > *s2)
-        {
-          return 1;
-        }
+      const size_t i = etl::private_string_search::mismatch(s1, s2, count);
 
-        ++s1;
-        ++s2;
+      if (i == count)
+      {
+        return 0;
       }
 
-      return 0;
+      return (s1[i] < s2[i]) ? -1 : 1;
     }
 
     //*************************************************************************
     static ETL_CONSTEXPR14 const char_type* find(const char_type* p, size_t count, const char_type& ch)
     {
-      for (size_t i = 0UL; i < count; ++i)
-      {
-        if (*p == ch)
-        {
-          return p;
-        }
-
-        ++p;
-      }
+      const size_t i = etl::private_string_search::find_char(p, count, ch);
 
-      return 0;
+      return (i == count) ? 0 : p + i;
     }
 
     //*************************************************************************
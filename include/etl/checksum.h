@@ -32,17 +32,114 @@ SOFTWARE.
 #include "frame_check_sequence.h"
 
 #include <stdint.h>
+#include <string.h>
 
 ///\defgroup checksum Checksum calculation
 ///\ingroup maths
 
 namespace etl
 {
+  namespace private_checksum
+  {
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t word_t;
+#else
+    typedef uint32_t word_t;
+#endif
+
+    //*************************************************************************
+    /// Reads a word from unaligned memory.
+    /// The byte order does not matter for sums and XORs.
+    //*************************************************************************
+    inline word_t read_word(const uint8_t* p)
+    {
+      word_t word;
+      memcpy(&word, p, sizeof(word_t));
+
+      return word;
+    }
+
+    //*************************************************************************
+    /// Sums the bytes in a block, a word at a time.
+    /// Pairs of bytes are added in to 16 bit lanes, which are emptied before
+    /// they can overflow.
+    //*************************************************************************
+    inline word_t sum_bytes(const uint8_t* begin, const uint8_t* end)
+    {
+      static ETL_CONSTANT word_t Low_Bytes     = word_t(~word_t(0U)) / 0xFFFFU * 0x00FFU; // 0x00FF00FF...
+      static ETL_CONSTANT size_t Words_Per_Run = 128U;                                     // 128 * 2 * 255 < 65536
+
+      word_t total = 0U;
+
+      while (size_t(end - begin) >= sizeof(word_t))
+      {
+        size_t words = size_t(end - begin) / sizeof(word_t);
+
+        if (words > Words_Per_Run)
+        {
+          words = Words_Per_Run;
+        }
+
+        word_t lanes = 0U;
+
+        while (words-- != 0U)
+        {
+          const word_t word = read_word(begin);
+
+          lanes += (word & Low_Bytes) + ((word >> 8U) & Low_Bytes);
+          begin += sizeof(word_t);
+        }
+
+        for (size_t i = 0U; i < (sizeof(word_t) * 8U); i += 16U)
+        {
+          total += (lanes >> i) & 0xFFFFU;
+        }
+      }
+
+      while (begin != end)
+      {
+        total += *begin;
+        ++begin;
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// XORs the bytes in a block, a word at a time.
+    //*************************************************************************
+    inline uint8_t xor_bytes(const uint8_t* begin, const uint8_t* end)
+    {
+      word_t word = 0U;
+
+      while (size_t(end - begin) >= sizeof(word_t))
+      {
+        word  ^= read_word(begin);
+        begin += sizeof(word_t);
+      }
+
+      uint8_t result = 0U;
+
+      for (size_t i = 0U; i < (sizeof(word_t) * 8U); i += 8U)
+      {
+        result ^= uint8_t(word >> i);
+      }
+
+      while (begin != end)
+      {
+        result ^= *begin;
+        ++begin;
+      }
+
+      return result;
+    }
+  }
+
   //***************************************************************************
   /// Standard addition checksum policy.
   //***************************************************************************
   template <typename T>
-  struct checksum_policy_sum
+  struct checksum_policy_sum : public etl::frame_check_sequence_block_policy
   {
     typedef T value_type;
 
@@ -56,6 +153,11 @@ namespace etl
       return sum + value;
     }
 
+    T add_block(T sum, const uint8_t* begin, const uint8_t* end) const
+    {
+      return T(sum + private_checksum::sum_bytes(begin, end));
+    }
+
     T final(T sum) const
     {
       return sum;
@@ -90,7 +192,7 @@ namespace etl
   /// Standard XOR checksum policy.
   //***************************************************************************
   template <typename T>
-  struct checksum_policy_xor
+  struct checksum_policy_xor : public etl::frame_check_sequence_block_policy
   {
     typedef T value_type;
 
@@ -104,6 +206,11 @@ namespace etl
       return sum ^ value;
     }
 
+    T add_block(T sum, const uint8_t* begin, const uint8_t* end) const
+    {
+      return T(sum ^ private_checksum::xor_bytes(begin, end));
+    }
+
     T final(T sum) const
     {
       return sum;
@@ -138,7 +245,7 @@ namespace etl
   /// Parity checksum policy.
   //***************************************************************************
   template <typename T>
-  struct checksum_policy_parity
+  struct checksum_policy_parity : public etl::frame_check_sequence_block_policy
   {
     typedef T value_type;
 
@@ -152,6 +259,11 @@ namespace etl
       return sum ^ etl::parity(value);
     }
 
+    T add_block(T sum, const uint8_t* begin, const uint8_t* end) const
+    {
+      return T(sum ^ etl::parity(private_checksum::xor_bytes(begin, end)));
+    }
+
     T final(T sum) const
     {
       return sum;
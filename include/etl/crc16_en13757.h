@@ -70,9 +70,11 @@ namespace etl
   };
 #endif
 
-  typedef etl::crc16_en13757_t<256U> crc16_en13757_t256;
-  typedef etl::crc16_en13757_t<16U>  crc16_en13757_t16;
-  typedef etl::crc16_en13757_t<4U>   crc16_en13757_t4;
-  typedef crc16_en13757_t256         crc16_en13757;
+  typedef etl::crc16_en13757_t<4096U> crc16_en13757_t4096;
+  typedef etl::crc16_en13757_t<2048U> crc16_en13757_t2048;
+  typedef etl::crc16_en13757_t<256U>  crc16_en13757_t256;
+  typedef etl::crc16_en13757_t<16U>   crc16_en13757_t16;
+  typedef etl::crc16_en13757_t<4U>    crc16_en13757_t4;
+  typedef crc16_en13757_t256           crc16_en13757;
 }
 #endif
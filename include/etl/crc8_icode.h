@@ -70,10 +70,12 @@ namespace etl
   };
 #endif
     
-  typedef etl::crc8_icode_t<256U> crc8_icode_t256;
-  typedef etl::crc8_icode_t<16U>  crc8_icode_t16;
-  typedef etl::crc8_icode_t<4U>   crc8_icode_t4;
-  typedef crc8_icode_t256         crc8_icode;
+  typedef etl::crc8_icode_t<4096U> crc8_icode_t4096;
+  typedef etl::crc8_icode_t<2048U> crc8_icode_t2048;
+  typedef etl::crc8_icode_t<256U>  crc8_icode_t256;
+  typedef etl::crc8_icode_t<16U>   crc8_icode_t16;
+  typedef etl::crc8_icode_t<4U>    crc8_icode_t4;
+  typedef crc8_icode_t256           crc8_icode;
 }
 
 #endif
@@ -70,10 +70,12 @@ namespace etl
   };
 #endif
     
-  typedef etl::crc8_maxim_t<256U> crc8_maxim_t256;
-  typedef etl::crc8_maxim_t<16U>  crc8_maxim_t16;
-  typedef etl::crc8_maxim_t<4U>   crc8_maxim_t4;
-  typedef crc8_maxim_t256         crc8_maxim;
+  typedef etl::crc8_maxim_t<4096U> crc8_maxim_t4096;
+  typedef etl::crc8_maxim_t<2048U> crc8_maxim_t2048;
+  typedef etl::crc8_maxim_t<256U>  crc8_maxim_t256;
+  typedef etl::crc8_maxim_t<16U>   crc8_maxim_t16;
+  typedef etl::crc8_maxim_t<4U>    crc8_maxim_t4;
+  typedef crc8_maxim_t256           crc8_maxim;
 }
 
 #endif
@@ -100,5 +100,11 @@ SOFTWARE.
 #define ETL_BIP_BUFFER_SPSC_ATOMIC_FILE_ID "67"
 #define ETL_REFERENCE_COUNTED_OBJECT_FILE_ID "68"
 #define ETL_TO_ARITHMETIC_FILE_ID "69"
+#define ETL_QUEUE_MPMC_ATOMIC_FILE_ID "70"
+#define ETL_FLAT_HASH_MAP_FILE_ID "71"
+#define ETL_FLAT_HASH_SET_FILE_ID "72"
+#define ETL_RADIX_SORT_FILE_ID "73"
+#define ETL_INLINE_FLAT_MAP_FILE_ID "74"
+#define ETL_INLINE_FLAT_SET_FILE_ID "75"
 
 #endif
@@ -0,0 +1,587 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_HASH_SET_INCLUDED
+#define ETL_FLAT_HASH_SET_INCLUDED
+
+#include "platform.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "nth_type.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/flat_hash_table.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup flat_hash_set flat_hash_set
+/// An open addressing hash set with the capacity defined at compile time.
+/// The values are stored in a contiguous array of slots, with a parallel array
+/// of control bytes that are searched a group at a time.
+/// Erasing an element may move other elements, so invalidates iterators,
+/// pointers and references to all but the iterator returned from erase.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the flat_hash_set.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  class flat_hash_set_exception : public etl::exception
+  {
+  public:
+
+    flat_hash_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the flat_hash_set.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  class flat_hash_set_full : public etl::flat_hash_set_exception
+  {
+  public:
+
+    flat_hash_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_set_exception(ETL_ERROR_TEXT("flat_hash_set:full", ETL_FLAT_HASH_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the flat_hash_set.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  class flat_hash_set_out_of_range : public etl::flat_hash_set_exception
+  {
+  public:
+
+    flat_hash_set_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_set_exception(ETL_ERROR_TEXT("flat_hash_set:range", ETL_FLAT_HASH_SET_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the flat_hash_set.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  class flat_hash_set_iterator : public etl::flat_hash_set_exception
+  {
+  public:
+
+    flat_hash_set_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_set_exception(ETL_ERROR_TEXT("flat_hash_set:iterator", ETL_FLAT_HASH_SET_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Invalid size exception for the flat_hash_set.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  class flat_hash_set_invalid_size : public etl::flat_hash_set_exception
+  {
+  public:
+
+    flat_hash_set_invalid_size(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_set_exception(ETL_ERROR_TEXT("flat_hash_set:size", ETL_FLAT_HASH_SET_FILE_ID"D"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized flat_hash_set.
+  /// Can be used as a reference type for all flat_hash_set containing a specific type.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iflat_hash_set : public etl::private_flat_hash::table<TKey, TKey, etl::private_flat_hash::key_of_key<TKey>, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::private_flat_hash::table<TKey, TKey, etl::private_flat_hash::key_of_key<TKey>, THash, TKeyEqual> base;
+
+    typedef typename base::insert_position insert_position;
+
+  public:
+
+    typedef TKey              value_type;
+    typedef TKey              key_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef const TKey& key_parameter_t;
+
+    typedef typename base::iterator        iterator;
+    typedef typename base::const_iterator  const_iterator;
+    typedef typename base::difference_type difference_type;
+
+    //*********************************************************************
+    /// Assigns values to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(flat_hash_set_iterator));
+      ETL_ASSERT(size_t(d) <= this->max_size(), ETL_ERROR(flat_hash_set_full));
+#endif
+
+      this->clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set is already full.
+    ///\param key The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key)
+    {
+      insert_position position = this->find_insert_position(key);
+
+      if (position.exists)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(this->to_iterator(position.index), false);
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(flat_hash_set_full), (ETL_OR_STD::pair<iterator, bool>(this->end(), false)));
+
+      ::new (this->slot_address(position.index)) value_type(key);
+
+      return ETL_OR_STD::pair<iterator, bool>(this->occupy(position), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set is already full.
+    ///\param key The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key)
+    {
+      insert_position position = this->find_insert_position(key);
+
+      if (position.exists)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(this->to_iterator(position.index), false);
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(flat_hash_set_full), (ETL_OR_STD::pair<iterator, bool>(this->end(), false)));
+
+      ::new (this->slot_address(position.index)) value_type(etl::move(key));
+
+      return ETL_OR_STD::pair<iterator, bool>(this->occupy(position), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set is already full.
+    ///\param position     The position to insert at.
+    ///\param key The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key)
+    {
+      return insert(key).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set is already full.
+    ///\param position     The position to insert at.
+    ///\param key The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key)
+    {
+      return insert(etl::move(key)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set does not have enough free space.
+    ///\param position The position to insert at.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iflat_hash_set& operator = (const iflat_hash_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->key_hash_function  = rhs.hash_function();
+        this->key_equal_function = rhs.key_eq();
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iflat_hash_set& operator = (iflat_hash_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->clear();
+        this->key_hash_function  = rhs.hash_function();
+        this->key_equal_function = rhs.key_eq();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iflat_hash_set(value_type* pslots_, uint8_t* pcontrol_, size_t number_of_slots_, size_t maximum_size_, hasher key_hash_function_, key_equal key_equal_function_)
+      : base(pslots_, pcontrol_, number_of_slots_, maximum_size_, key_hash_function_, key_equal_function_)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator first, iterator last)
+    {
+      while (first != last)
+      {
+        insert(etl::move(*first));
+        ++first;
+      }
+    }
+#endif
+
+  private:
+
+    // Disable copy construction.
+    iflat_hash_set(const iflat_hash_set&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FLAT_HASH_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iflat_hash_set()
+    {
+    }
+#else
+  protected:
+    ~iflat_hash_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first flat_hash_set.
+  ///\param rhs Reference to the second flat_hash_set.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iflat_hash_set<TKey, THash, TKeyEqual>& lhs, const etl::iflat_hash_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    typedef typename etl::iflat_hash_set<TKey, THash, TKeyEqual>::const_iterator const_iterator;
+
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    for (const_iterator itr = lhs.begin(); itr != lhs.end(); ++itr)
+    {
+      if (!rhs.contains(*itr))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first flat_hash_set.
+  ///\param rhs Reference to the second flat_hash_set.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iflat_hash_set<TKey, THash, TKeyEqual>& lhs, const etl::iflat_hash_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated flat_hash_set implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class flat_hash_set : public etl::iflat_hash_set<TKey, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iflat_hash_set<TKey, THash, TKeyEqual> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE  = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_SLOTS = etl::private_flat_hash::slot_count<MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    flat_hash_set(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::value_type*>(&slots), control, MAX_SLOTS, MAX_SIZE, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    flat_hash_set(const flat_hash_set& other)
+      : base(reinterpret_cast<typename base::value_type*>(&slots), control, MAX_SLOTS, MAX_SIZE, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    flat_hash_set(flat_hash_set&& other)
+      : base(reinterpret_cast<typename base::value_type*>(&slots), control, MAX_SLOTS, MAX_SIZE, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_hash_set(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::value_type*>(&slots), control, MAX_SLOTS, MAX_SIZE, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    flat_hash_set(std::initializer_list<TKey> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::value_type*>(&slots), control, MAX_SLOTS, MAX_SIZE, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_hash_set()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_hash_set& operator = (const flat_hash_set& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    flat_hash_set& operator = (flat_hash_set&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The storage for the values.
+    typename etl::aligned_storage<sizeof(typename base::value_type) * MAX_SLOTS, etl::alignment_of<typename base::value_type>::value>::type slots;
+
+    /// The control bytes, including the copies of the first group that follow the last slot.
+    uint8_t control[MAX_SLOTS + base::Group_Width - 1U];
+  };
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... T>
+  flat_hash_set(T...) -> flat_hash_set<etl::nth_type_t<0, T...>, sizeof...(T)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename... T>
+  constexpr auto make_flat_hash_set(T&&... keys) -> etl::flat_hash_set<TKey, sizeof...(T), THash, TKeyEqual>
+  {
+    return { {etl::forward<T>(keys)...} };
+  }
+#endif
+
+  //*************************************************************************
+  /// A flat_hash_set implementation that uses externally supplied buffers.
+  /// The slot buffer must hold 'slot_count' values and the control buffer
+  /// must hold control_size(slot_count) bytes.
+  /// 'slot_count' must be a power of 2, of at least 2.
+  //*************************************************************************
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class flat_hash_set_ext : public etl::iflat_hash_set<TKey, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iflat_hash_set<TKey, THash, TKeyEqual> base;
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_invalid_size if 'slot_count' is not a power of 2.
+    //*************************************************************************
+    flat_hash_set_ext(void* slot_buffer, uint8_t* control_buffer, size_t slot_count, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::value_type*>(slot_buffer), control_buffer, slot_count, base::max_size_for(slot_count), hash, equal)
+    {
+      ETL_ASSERT((slot_count >= 2U) && ((slot_count & (slot_count - 1U)) == 0U), ETL_ERROR(flat_hash_set_invalid_size));
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_invalid_size if 'slot_count' is not a power of 2.
+    //*************************************************************************
+    flat_hash_set_ext(const flat_hash_set_ext& other, void* slot_buffer, uint8_t* control_buffer, size_t slot_count)
+      : base(reinterpret_cast<typename base::value_type*>(slot_buffer), control_buffer, slot_count, base::max_size_for(slot_count), other.hash_function(), other.key_eq())
+    {
+      ETL_ASSERT((slot_count >= 2U) && ((slot_count & (slot_count - 1U)) == 0U), ETL_ERROR(flat_hash_set_invalid_size));
+
+      base::assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_hash_set_ext()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_hash_set_ext& operator = (const flat_hash_set_ext& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+  private:
+
+    // Disable copy construction without buffers.
+    flat_hash_set_ext(const flat_hash_set_ext&) ETL_DELETE;
+  };
+}
+
+#endif
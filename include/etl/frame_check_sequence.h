@@ -35,6 +35,11 @@ SOFTWARE.
 
 #include <stdint.h>
 
+#if ETL_USING_CPP20 && ETL_USING_STL
+  #include <iterator>
+  #include <memory>
+#endif
+
 ETL_STATIC_ASSERT(ETL_USING_8BIT_TYPES, "This file does not currently support targets with no 8bit type");
 
 ///\defgroup frame_check_sequence Frame check sequence calculation
@@ -88,8 +93,50 @@ namespace etl
 
       TFCS* p_fcs;
     };
+
+    //***************************************************
+    /// Is the iterator a pointer, or an iterator over contiguous memory?
+    //***************************************************
+    template <typename TIterator>
+    struct is_contiguous_iterator
+    {
+#if ETL_USING_CPP20 && ETL_USING_STL
+      static ETL_CONSTANT bool value = etl::is_pointer<TIterator>::value || std::contiguous_iterator<TIterator>;
+#else
+      static ETL_CONSTANT bool value = etl::is_pointer<TIterator>::value;
+#endif
+    };
+
+    //***************************************************
+    /// Gets the address of the byte at a contiguous iterator.
+    //***************************************************
+    template <typename T>
+    const uint8_t* to_byte_pointer(T* itr)
+    {
+      return reinterpret_cast<const uint8_t*>(itr);
+    }
+
+#if ETL_USING_CPP20 && ETL_USING_STL
+    template <typename TIterator>
+    const uint8_t* to_byte_pointer(TIterator itr)
+    {
+      return reinterpret_cast<const uint8_t*>(std::to_address(itr));
+    }
+#endif
   }
 
+  //***************************************************************************
+  /// Policies that derive from this can process a contiguous block of bytes
+  /// in one call, through the member function
+  /// value_type add_block(value_type frame_check, const uint8_t* begin, const uint8_t* end) const
+  /// frame_check_sequence uses it when a range is added through pointers or,
+  /// for C++20, any contiguous iterator.
+  ///\ingroup frame_check_sequence
+  //***************************************************************************
+  struct frame_check_sequence_block_policy
+  {
+  };
+
   //***************************************************************************
   /// Calculates a frame check sequence according to the specified policy.
   ///\tparam TPolicy The type used to enact the policy.
@@ -146,11 +193,10 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, *begin);
-        ++begin;
-      }
+      typedef etl::integral_constant<bool, etl::is_base_of<etl::frame_check_sequence_block_policy, policy_type>::value &&
+                                           private_frame_check_sequence::is_contiguous_iterator<TIterator>::value> use_block;
+
+      add_range(begin, end, use_block());
     }
 
     //*************************************************************************
@@ -187,6 +233,30 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, *begin);
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range as a block.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      frame_check = policy.add_block(frame_check,
+                                     private_frame_check_sequence::to_byte_pointer(begin),
+                                     private_frame_check_sequence::to_byte_pointer(end));
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
@@ -566,11 +566,16 @@ namespace etl
     //********************************************
     etl::fsm_state_id_t process_event(const etl::imessage& message)
     {
-      etl::fsm_state_id_t new_state_id;
+      etl::fsm_state_id_t new_state_id = Pass_To_Parent;
 
-      const bool was_handled = (process_event_type<TMessageTypes>(message, new_state_id) || ...);
+      const size_t index = id_table::find(message.get_message_id());
 
-      if (!was_handled || (new_state_id == Pass_To_Parent))
+      if (index < sizeof...(TMessageTypes))
+      {
+        new_state_id = process_event_type(index, message);
+      }
+
+      if (new_state_id == Pass_To_Parent)
       {
         new_state_id = (p_parent != nullptr) ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message);
       }
@@ -578,20 +583,31 @@ namespace etl
       return new_state_id;
     }
 
+    typedef etl::private_message_router::message_id_table<TMessageTypes...> id_table;
+
+    typedef etl::fsm_state_id_t (*handler_t)(fsm_state&, const etl::imessage&);
+
     //********************************************
-    template <typename TMessage>
-    bool process_event_type(const etl::imessage& msg, etl::fsm_state_id_t& state_id)
+    etl::fsm_state_id_t process_event_type(size_t index, const etl::imessage& msg)
     {
-      if (TMessage::ID == msg.get_message_id())
+      if constexpr (sizeof...(TMessageTypes) != 0U)
       {
-        state_id = static_cast<TDerived*>(this)->on_event(static_cast<const TMessage&>(msg));
-        return true;
+        static constexpr handler_t handlers[] = { &fsm_state::template process_event_type<TMessageTypes>... };
+
+        return handlers[index](*this, msg);
       }
       else
       {
-        return false;
+        return Pass_To_Parent;
       }
     }
+
+    //********************************************
+    template <typename TMessage>
+    static etl::fsm_state_id_t process_event_type(fsm_state& state, const etl::imessage& msg)
+    {
+      return static_cast<TDerived&>(state).on_event(static_cast<const TMessage&>(msg));
+    }
   };
 #else
 //*************************************************************************************************
@@ -74,6 +74,7 @@ cog.outl("//********************************************************************
 #include "largest.h"
 #include "nullptr.h"
 #include "placement_new.h"
+#include "smallest.h"
 #include "successor.h"
 #include "type_traits.h"
 
@@ -107,6 +108,25 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// A bitmap of the message ids that a router accepts.
+  /// Covers the ids from 'first_id' to 'first_id + size - 1'.
+  //***************************************************************************
+  struct accepted_message_ids
+  {
+    //********************************************
+    bool test(etl::message_id_t id) const
+    {
+      const size_t offset = static_cast<size_t>(id) - static_cast<size_t>(first_id);
+
+      return (offset < size) && ((p_bitmap[offset / 8U] & (1U << (offset % 8U))) != 0U);
+    }
+
+    etl::message_id_t first_id; ///< The first id in the bitmap.
+    size_t            size;     ///< The number of ids in the bitmap.
+    const uint8_t*    p_bitmap; ///< A bit for each id.
+  };
+
   //***************************************************************************
   /// Forward declare null message router functionality.
   //***************************************************************************
@@ -158,6 +178,31 @@ namespace etl
       return accepts(msg.get_message_id());
     }
 
+    //********************************************
+    /// Checks whether the router accepts the message id.
+    /// Uses the router's bitmap of accepted ids, if it has one, rather than
+    /// the virtual 'accepts'.
+    //********************************************
+    bool accepts_id(etl::message_id_t id) const
+    {
+      if (p_accepted_ids != ETL_NULLPTR)
+      {
+        return p_accepted_ids->test(id) || (has_successor() && get_successor().accepts(id));
+      }
+      else
+      {
+        return accepts(id);
+      }
+    }
+
+    //********************************************
+    /// Gets the bitmap of the ids accepted by the router, or ETL_NULLPTR if it does not have one.
+    //********************************************
+    const etl::accepted_message_ids* get_accepted_message_ids() const
+    {
+      return p_accepted_ids;
+    }
+
     //********************************************
     etl::message_router_id_t get_message_router_id() const
     {
@@ -177,23 +222,36 @@ namespace etl
   protected:
 
     imessage_router(etl::message_router_id_t id_)
-      : message_router_id(id_)
+      : p_accepted_ids(ETL_NULLPTR)
+      , message_router_id(id_)
     {
     }
 
     imessage_router(etl::message_router_id_t id_, imessage_router& successor_)
       : successor(successor_)
+      , p_accepted_ids(ETL_NULLPTR)
       , message_router_id(id_)
     {
     }
 
+    //********************************************
+    /// Sets the bitmap of the ids accepted by the router.
+    /// A router that overrides 'accepts' must not have a bitmap that disagrees with it.
+    /// etl::message_router does not set one if its derived class overrides 'accepts'.
+    //********************************************
+    void set_accepted_message_ids(const etl::accepted_message_ids* p_accepted_ids_)
+    {
+      p_accepted_ids = p_accepted_ids_;
+    }
+
   private:
 
     // Disabled.
     imessage_router(const imessage_router&);
     imessage_router& operator =(const imessage_router&);
 
-    etl::message_router_id_t  message_router_id;
+    const etl::accepted_message_ids* p_accepted_ids;
+    etl::message_router_id_t         message_router_id;
   };
 
   //***************************************************************************
@@ -390,12 +448,253 @@ namespace etl
     destination.receive(id, message);
   }
 
+#if ETL_USING_CPP17
+  namespace private_message_router
+  {
+    //***************************************************************************
+    /// The ids of a list of message types, and the functions that build the
+    /// tables for etl::private_message_router::message_id_table.
+    //***************************************************************************
+    template <typename... TMessageTypes>
+    class message_id_list
+    {
+    public:
+
+      static constexpr size_t Number_Of_Ids = sizeof...(TMessageTypes);
+      static constexpr size_t Capacity      = (Number_Of_Ids == 0U) ? 1U : Number_Of_Ids;
+
+      typedef typename etl::smallest_uint_for_value<Number_Of_Ids>::type index_t;
+
+      //*******************************
+      struct ids_t
+      {
+        etl::message_id_t values[Capacity];
+      };
+
+      //*******************************
+      static constexpr ids_t ids()
+      {
+        return ids_t{ { TMessageTypes::ID... } };
+      }
+
+      //*******************************
+      static constexpr etl::message_id_t first_id()
+      {
+        const ids_t list = ids();
+
+        etl::message_id_t id = list.values[0];
+
+        for (size_t i = 1U; i < Number_Of_Ids; ++i)
+        {
+          id = (list.values[i] < id) ? list.values[i] : id;
+        }
+
+        return id;
+      }
+
+      //*******************************
+      static constexpr etl::message_id_t last_id()
+      {
+        const ids_t list = ids();
+
+        etl::message_id_t id = list.values[0];
+
+        for (size_t i = 1U; i < Number_Of_Ids; ++i)
+        {
+          id = (list.values[i] > id) ? list.values[i] : id;
+        }
+
+        return id;
+      }
+
+      /// The number of ids from the first to the last.
+      static constexpr size_t Range = (Number_Of_Ids == 0U) ? 0U : (static_cast<size_t>(last_id()) - static_cast<size_t>(first_id()) + 1U);
+
+      /// Use a table indexed by id if the ids are not too sparse.
+      static constexpr bool Is_Dense = (Range <= ((4U * Number_Of_Ids) + 64U));
+
+      static constexpr size_t Table_Size = !Is_Dense ? Capacity : ((Range == 0U) ? 1U : Range);
+
+      //*******************************
+      /// If dense, the position of each id in the list, indexed by id, or
+      /// Number_Of_Ids if it is not in the list.
+      /// If sparse, the ids in order, and their positions in the list.
+      //*******************************
+      struct table_t
+      {
+        index_t           positions[Table_Size];
+        etl::message_id_t ids[Table_Size];
+      };
+
+      //*******************************
+      static constexpr table_t table()
+      {
+        const ids_t list = ids();
+
+        table_t result = {};
+
+        if constexpr (Is_Dense)
+        {
+          for (size_t i = 0U; i < Table_Size; ++i)
+          {
+            result.positions[i] = static_cast<index_t>(Number_Of_Ids);
+          }
+
+          // Backwards, so that the first of any duplicated ids is used.
+          for (size_t i = Number_Of_Ids; i != 0U; --i)
+          {
+            result.positions[static_cast<size_t>(list.values[i - 1U]) - static_cast<size_t>(first_id())] = static_cast<index_t>(i - 1U);
+          }
+        }
+        else
+        {
+          // A stable insertion sort, so that the first of any duplicated ids is found first.
+          for (size_t i = 0U; i < Number_Of_Ids; ++i)
+          {
+            size_t j = i;
+
+            while ((j != 0U) && (list.values[i] < result.ids[j - 1U]))
+            {
+              result.ids[j]       = result.ids[j - 1U];
+              result.positions[j] = result.positions[j - 1U];
+              --j;
+            }
+
+            result.ids[j]       = list.values[i];
+            result.positions[j] = static_cast<index_t>(i);
+          }
+        }
+
+        return result;
+      }
+
+      //*******************************
+      struct bitmap_t
+      {
+        uint8_t values[(Table_Size + 7U) / 8U];
+      };
+
+      //*******************************
+      static constexpr bitmap_t bitmap()
+      {
+        const ids_t list = ids();
+
+        bitmap_t result = {};
+
+        if constexpr (Is_Dense)
+        {
+          for (size_t i = 0U; i < Number_Of_Ids; ++i)
+          {
+            const size_t offset = static_cast<size_t>(list.values[i]) - static_cast<size_t>(first_id());
+
+            result.values[offset / 8U] |= static_cast<uint8_t>(1U << (offset % 8U));
+          }
+        }
+
+        return result;
+      }
+    };
+
+    //***************************************************************************
+    /// A compile time table of the ids of a list of message types.
+    /// Finds the position of an id in the list with a table indexed by id if
+    /// the ids are dense, otherwise with a binary search of the sorted ids.
+    /// If the ids are dense, also has a bitmap of the ids.
+    //***************************************************************************
+    template <typename... TMessageTypes>
+    class message_id_table
+    {
+    private:
+
+      typedef message_id_list<TMessageTypes...> list_t;
+
+    public:
+
+      static constexpr size_t            Number_Of_Ids = list_t::Number_Of_Ids;
+      static constexpr bool              Is_Dense      = list_t::Is_Dense;
+      static constexpr etl::message_id_t First_Id      = list_t::first_id();
+
+      //*******************************
+      /// Gets the position of the id in the list of message types, or
+      /// Number_Of_Ids if it is not in the list.
+      //*******************************
+      static size_t find(etl::message_id_t id)
+      {
+        if constexpr (Is_Dense)
+        {
+          const size_t offset = static_cast<size_t>(id) - static_cast<size_t>(First_Id);
+
+          return (offset < list_t::Range) ? table.positions[offset] : Number_Of_Ids;
+        }
+        else
+        {
+          // Branchless lower bound.
+          const etl::message_id_t* first = table.ids;
+          size_t                   count = Number_Of_Ids;
+
+          while (count > 1U)
+          {
+            const size_t half = count / 2U;
+
+            first  = (first[half - 1U] < id) ? first + half : first;
+            count -= half;
+          }
+
+          first += (*first < id) ? 1U : 0U;
+
+          const size_t position = static_cast<size_t>(first - table.ids);
+
+          return ((position < Number_Of_Ids) && (*first == id)) ? table.positions[position] : Number_Of_Ids;
+        }
+      }
+
+      //*******************************
+      /// Gets the bitmap of the ids, or ETL_NULLPTR if the ids are sparse.
+      //*******************************
+      static const etl::accepted_message_ids* get_accepted_message_ids()
+      {
+        return Is_Dense ? &accepted_ids : ETL_NULLPTR;
+      }
+
+    private:
+
+      static constexpr typename list_t::table_t  table  = list_t::table();
+      static constexpr typename list_t::bitmap_t bitmap = list_t::bitmap();
+
+      static constexpr etl::accepted_message_ids accepted_ids = { First_Id, list_t::Range, bitmap.values };
+    };
+
+    //***************************************************************************
+    /// Deduces the class that declares the 'accepts(etl::message_id_t)' found by lookup.
+    //***************************************************************************
+    template <typename TClass>
+    TClass* accepts_declared_by(bool (TClass::*)(etl::message_id_t) const);
+
+    //***************************************************************************
+    /// True if TDerived declares its own 'accepts(etl::message_id_t)' rather than
+    /// using the one in TRouter. Also true if it cannot be determined, such as
+    /// when the derived 'accepts' is not public.
+    //***************************************************************************
+    template <typename TDerived, typename TRouter, typename = void>
+    struct overrides_accepts : etl::true_type
+    {
+    };
+
+    template <typename TDerived, typename TRouter>
+    struct overrides_accepts<TDerived, TRouter, etl::void_t<decltype(accepts_declared_by(&TDerived::accepts))> >
+      : etl::bool_constant<!etl::is_same<decltype(accepts_declared_by(&TDerived::accepts)), TRouter*>::value>
+    {
+    };
+  }
+#endif
+
 //*************************************************************************************************
 // For C++17 and above.
 //*************************************************************************************************
 #if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
   //***************************************************************************
   // The definition for all message types.
+  // Messages are dispatched with a compile time table of the message ids.
   //***************************************************************************
   template <typename TDerived, typename... TMessageTypes>
   class message_router : public imessage_router
@@ -408,12 +707,14 @@ namespace etl
     message_router()
       : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
     {
+      set_accepted_message_ids(get_accepted_message_ids_for_derived());
     }
 
     //**********************************************
     message_router(etl::imessage_router& successor_)
       : imessage_router(etl::imessage_router::MESSAGE_ROUTER, successor_)
     {
+      set_accepted_message_ids(get_accepted_message_ids_for_derived());
     }
 
     //**********************************************
@@ -421,6 +722,7 @@ namespace etl
       : imessage_router(id_)
     {
       ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
+      set_accepted_message_ids(get_accepted_message_ids_for_derived());
     }
 
     //**********************************************
@@ -428,6 +730,7 @@ namespace etl
       : imessage_router(id_, successor_)
     {
       ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
+      set_accepted_message_ids(get_accepted_message_ids_for_derived());
     }
 
     //**********************************************
@@ -435,9 +738,13 @@ namespace etl
 
     void receive(const etl::imessage& msg) ETL_OVERRIDE
     {
-      const bool was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
+      const size_t index = id_table::find(msg.get_message_id());
 
-      if (!was_handled)
+      if (index < sizeof...(TMessageTypes))
+      {
+        receive_message_type(index, msg);
+      }
+      else
       {
         if (has_successor())
         {
@@ -475,7 +782,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      return (accepts_type<TMessageTypes>(id) || ...);
+      return (id_table::find(id) < sizeof...(TMessageTypes)) || (has_successor() && get_successor().accepts(id));
     }
 
     //********************************************
@@ -498,41 +805,43 @@ namespace etl
 
   private:
 
+    typedef etl::private_message_router::message_id_table<TMessageTypes...> id_table;
+
+    typedef void (*handler_t)(message_router&, const etl::imessage&);
+
     //********************************************
-    template <typename TMessage>
-    bool receive_message_type(const etl::imessage& msg)
+    /// The bitmap of the accepted ids, or ETL_NULLPTR if TDerived overrides
+    /// 'accepts', as the bitmap would bypass it.
+    //********************************************
+    static const etl::accepted_message_ids* get_accepted_message_ids_for_derived()
     {
-      if (TMessage::ID == msg.get_message_id())
+      if constexpr (etl::private_message_router::overrides_accepts<TDerived, message_router>::value)
       {
-        static_cast<TDerived*>(this)->on_receive(static_cast<const TMessage&>(msg));
-        return true;
+        return ETL_NULLPTR;
       }
       else
       {
-        return false;
+        return id_table::get_accepted_message_ids();
       }
     }
 
     //********************************************
-    template <typename TMessage>
-    bool accepts_type(etl::message_id_t id) const
+    void receive_message_type(size_t index, const etl::imessage& msg)
     {
-      if (TMessage::ID == id)
-      {
-        return true;
-      }
-      else
+      if constexpr (sizeof...(TMessageTypes) != 0U)
       {
-        if (has_successor())
-        {
-          return get_successor().accepts(id);
-        }
-        else
-        {
-          return false;
-        }
+        static constexpr handler_t handlers[] = { &message_router::template receive_message_type<TMessageTypes>... };
+
+        handlers[index](*this, msg);
       }
     }
+
+    //********************************************
+    template <typename TMessage>
+    static void receive_message_type(message_router& router, const etl::imessage& msg)
+    {
+      static_cast<TDerived&>(router).on_receive(static_cast<const TMessage&>(msg));
+    }
   };
 #else
 //*************************************************************************************************
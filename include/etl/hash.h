@@ -35,8 +35,9 @@ SOFTWARE.
 
 #if ETL_USING_8BIT_TYPES
 
-// The default hash calculation.
+// The hash calculations.
 #include "fnv_1.h"
+#include "wyhash.h"
 #include "type_traits.h"
 #include "static_assert.h"
 
@@ -51,12 +52,12 @@ namespace etl
   namespace private_hash
   {
     //*************************************************************************
-    /// Hash to use when size_t is 16 bits.
+    /// FNV-1a hash to use when size_t is 16 bits.
     /// T is always expected to be size_t.
     //*************************************************************************
     template <typename T>
     typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type
-    generic_hash(const uint8_t* begin, const uint8_t* end)
+    fnv_1a_hash(const uint8_t* begin, const uint8_t* end)
     {
       uint32_t h = fnv_1a_32(begin, end);
 
@@ -64,28 +65,66 @@ namespace etl
     }
 
     //*************************************************************************
-    /// Hash to use when size_t is 32 bits.
+    /// FNV-1a hash to use when size_t is 32 bits.
     /// T is always expected to be size_t.
     //*************************************************************************
     template <typename T>
     typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type
-    generic_hash(const uint8_t* begin, const uint8_t* end)
+    fnv_1a_hash(const uint8_t* begin, const uint8_t* end)
     {
       return fnv_1a_32(begin, end);
     }
 
 #if ETL_USING_64BIT_TYPES
     //*************************************************************************
-    /// Hash to use when size_t is 64 bits.
+    /// FNV-1a hash to use when size_t is 64 bits.
     /// T is always expected to be size_t.
     //*************************************************************************
     template <typename T>
     typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type
-    generic_hash(const uint8_t* begin, const uint8_t* end)
+    fnv_1a_hash(const uint8_t* begin, const uint8_t* end)
     {
       return fnv_1a_64(begin, end);
     }
 #endif
+  }
+
+  //***************************************************************************
+  /// Hash policy that uses FNV-1a.
+  /// Consumes one byte per iteration.
+  ///\ingroup hash
+  //***************************************************************************
+  struct hash_policy_fnv_1a
+  {
+    static size_t hash(const uint8_t* begin, const uint8_t* end)
+    {
+      return private_hash::fnv_1a_hash<size_t>(begin, end);
+    }
+  };
+
+  //***************************************************************************
+  /// The hash policy used for strings, views and wide scalars.
+  /// Define ETL_HASH_USE_WYHASH to select wyhash, which consumes a 64 bit word
+  /// at a time, otherwise FNV-1a is used.
+  ///\ingroup hash
+  //***************************************************************************
+#if defined(ETL_HASH_USE_WYHASH) && ETL_USING_64BIT_TYPES
+  typedef etl::hash_policy_wyhash hash_policy_default;
+#else
+  typedef etl::hash_policy_fnv_1a hash_policy_default;
+#endif
+
+  namespace private_hash
+  {
+    //*************************************************************************
+    /// Hashes a range of bytes with the default hash policy.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    size_t generic_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      return etl::hash_policy_default::hash(begin, end);
+    }
 
     //*************************************************************************
     /// Primary definition of base hash class, by default is poisoned
@@ -477,6 +516,25 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Hashes the contents of a contiguous container of trivial elements, such
+  /// as a string, string_view, span or vector, with a selectable hash policy.
+  /// May be used as the hash function for the unordered and flat containers.
+  ///\tparam T       The container type. Must supply data(), size() and value_type.
+  ///\tparam TPolicy The hash policy. Default = etl::hash_policy_default.
+  ///\ingroup hash
+  //***************************************************************************
+  template <typename T, typename TPolicy = etl::hash_policy_default>
+  struct contiguous_hash
+  {
+    size_t operator ()(const T& container) const
+    {
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(container.data());
+
+      return TPolicy::hash(p, p + (container.size() * sizeof(typename T::value_type)));
+    }
+  };
+
   namespace private_hash
   {
     //*************************************************************************
@@ -0,0 +1,891 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INLINE_FLAT_MAP_INCLUDED
+#define ETL_INLINE_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "nth_type.h"
+#include "span.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/inline_flat_table.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup inline_flat_map inline_flat_map
+/// Sorted maps with the capacity defined at compile time.
+/// Unlike etl::flat_map, which holds a sorted array of pointers to elements in
+/// a pool, the keys are held in order in a contiguous array and the mapped
+/// values in a second array, so a search only reads keys and never follows a
+/// pointer. The search is a branchless binary search.
+/// Inserting or erasing an element moves the elements after it, so invalidates
+/// iterators, pointers and references to them.
+/// Dereferencing an iterator returns a proxy with 'first' and 'second' members
+/// that refer to the key and the mapped value.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the inline_flat_map.
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  class inline_flat_map_exception : public etl::exception
+  {
+  public:
+
+    inline_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the inline_flat_map.
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  class inline_flat_map_full : public etl::inline_flat_map_exception
+  {
+  public:
+
+    inline_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::inline_flat_map_exception(ETL_ERROR_TEXT("inline_flat_map:full", ETL_INLINE_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the inline_flat_map.
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  class inline_flat_map_out_of_range : public etl::inline_flat_map_exception
+  {
+  public:
+
+    inline_flat_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::inline_flat_map_exception(ETL_ERROR_TEXT("inline_flat_map:range", ETL_INLINE_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized inline_flat_map.
+  /// Can be used as a reference type for all inline_flat_map containing a specific type.
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class iinline_flat_map : public etl::private_inline_flat::map_table<TKey, TMapped, TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_inline_flat::map_table<TKey, TMapped, TKeyCompare> base;
+
+  public:
+
+    typedef typename base::value_type             value_type;
+    typedef typename base::key_type               key_type;
+    typedef typename base::mapped_type            mapped_type;
+    typedef typename base::key_compare            key_compare;
+    typedef typename base::reference              reference;
+    typedef typename base::const_reference        const_reference;
+    typedef typename base::size_type              size_type;
+    typedef typename base::difference_type        difference_type;
+    typedef typename base::iterator               iterator;
+    typedef typename base::const_iterator         const_iterator;
+    typedef typename base::reverse_iterator       reverse_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+    typedef typename base::key_parameter_t        key_parameter_t;
+
+  private:
+
+    typedef ETL_OR_STD::pair<iterator, bool> insert_result_t;
+
+  public:
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if a new element is needed and the map is full.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      const size_t index = this->lower_bound_index(key);
+
+      if (!this->key_at_equals(index, key))
+      {
+        ETL_ASSERT(!this->full(), ETL_ERROR(inline_flat_map_full));
+
+        this->insert_at(index, key, mapped_type());
+      }
+
+      return this->pmapped[index];
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_out_of_range if the key is not in the map.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      const size_t index = this->find_index(key);
+
+      ETL_ASSERT(index != this->current_size, ETL_ERROR(inline_flat_map_out_of_range));
+
+      return this->pmapped[index];
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_out_of_range if the key is not in the map.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const size_t index = this->find_index(key);
+
+      ETL_ASSERT(index != this->current_size, ETL_ERROR(inline_flat_map_out_of_range));
+
+      return this->pmapped[index];
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the map.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the map is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const value_type& value)
+    {
+      const size_t index = this->lower_bound_index(value.first);
+
+      if (this->key_at_equals(index, value.first))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(this->make_iterator(index), false);
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(inline_flat_map_full), insert_result_t(this->end(), false));
+
+      return ETL_OR_STD::pair<iterator, bool>(this->insert_at(index, value.first, value.second), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the map.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the map is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type&& value)
+    {
+      const size_t index = this->lower_bound_index(value.first);
+
+      if (this->key_at_equals(index, value.first))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(this->make_iterator(index), false);
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(inline_flat_map_full), insert_result_t(this->end(), false));
+
+      return ETL_OR_STD::pair<iterator, bool>(this->insert_at(index, etl::move(value.first), etl::move(value.second)), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the map.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the map is already full.
+    ///\param position The position hint. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const value_type& value)
+    {
+      return insert(value).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the map.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the map does not have enough free space.
+    /// Values that are already in key order are appended without moving other elements.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(value_type(*first));
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a key and mapped value, or assigns the mapped value if the key exists.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the map is already full.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_or_assign(key_parameter_t key, const mapped_type& mapped)
+    {
+      const size_t index = this->lower_bound_index(key);
+
+      if (this->key_at_equals(index, key))
+      {
+        this->pmapped[index] = mapped;
+
+        return ETL_OR_STD::pair<iterator, bool>(this->make_iterator(index), false);
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(inline_flat_map_full), insert_result_t(this->end(), false));
+
+      return ETL_OR_STD::pair<iterator, bool>(this->insert_at(index, key, mapped), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Emplaces a key and a mapped value constructed from the arguments.
+    /// Does nothing if the key exists.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the map is already full.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*********************************************************************
+    template <typename... TArgs>
+    ETL_OR_STD::pair<iterator, bool> emplace(key_parameter_t key, TArgs&&... args)
+    {
+      const size_t index = this->lower_bound_index(key);
+
+      if (this->key_at_equals(index, key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(this->make_iterator(index), false);
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(inline_flat_map_full), insert_result_t(this->end(), false));
+
+      return ETL_OR_STD::pair<iterator, bool>(this->insert_at(index, key, mapped_type(etl::forward<TArgs>(args)...)), true);
+    }
+#else
+    //*********************************************************************
+    /// Emplaces a key and a mapped value.
+    /// Does nothing if the key exists.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the map is already full.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace(key_parameter_t key, const mapped_type& mapped)
+    {
+      return insert(value_type(key, mapped));
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the map.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      this->clear();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the map does not have enough free space.
+    //*************************************************************************
+    iinline_flat_map& operator = (const iinline_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        ETL_ASSERT_AND_RETURN_VALUE(rhs.size() <= this->max_size(), ETL_ERROR(inline_flat_map_full), *this);
+
+        this->copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the map does not have enough free space.
+    //*************************************************************************
+    iinline_flat_map& operator = (iinline_flat_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        ETL_ASSERT_AND_RETURN_VALUE(rhs.size() <= this->max_size(), ETL_ERROR(inline_flat_map_full), *this);
+
+        this->move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iinline_flat_map(TKey* pkeys_, TMapped* pmapped_, size_t max_size_, const TKeyCompare& compare_)
+      : base(pkeys_, pmapped_, max_size_, compare_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    iinline_flat_map(const iinline_flat_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INLINE_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iinline_flat_map()
+    {
+    }
+#else
+  protected:
+    ~iinline_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized inline_flat_multimap.
+  /// Can be used as a reference type for all inline_flat_multimap containing a specific type.
+  /// Elements with equal keys are kept in the order that they were inserted.
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class iinline_flat_multimap : public etl::private_inline_flat::map_table<TKey, TMapped, TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_inline_flat::map_table<TKey, TMapped, TKeyCompare> base;
+
+  public:
+
+    typedef typename base::value_type             value_type;
+    typedef typename base::key_type               key_type;
+    typedef typename base::mapped_type            mapped_type;
+    typedef typename base::key_compare            key_compare;
+    typedef typename base::reference              reference;
+    typedef typename base::const_reference        const_reference;
+    typedef typename base::size_type              size_type;
+    typedef typename base::difference_type        difference_type;
+    typedef typename base::iterator               iterator;
+    typedef typename base::const_iterator         const_iterator;
+    typedef typename base::reverse_iterator       reverse_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+    typedef typename base::key_parameter_t        key_parameter_t;
+
+    //*********************************************************************
+    /// Inserts a value to the multimap, after any elements with an equal key.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the multimap is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the inserted element.
+    //*********************************************************************
+    iterator insert(const value_type& value)
+    {
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(inline_flat_map_full), this->end());
+
+      return this->insert_at(this->upper_bound_index(value.first), value.first, value.second);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the multimap, after any elements with an equal key.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the multimap is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the inserted element.
+    //*********************************************************************
+    iterator insert(value_type&& value)
+    {
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(inline_flat_map_full), this->end());
+
+      return this->insert_at(this->upper_bound_index(value.first), etl::move(value.first), etl::move(value.second));
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the multimap.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the multimap is already full.
+    ///\param position The position hint. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const value_type& value)
+    {
+      return insert(value);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the multimap.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the multimap does not have enough free space.
+    /// Values that are already in key order are appended without moving other elements.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(value_type(*first));
+        ++first;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Emplaces a key and a mapped value constructed from the arguments.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the multimap is already full.
+    ///\return An iterator to the inserted element.
+    //*********************************************************************
+    template <typename... TArgs>
+    iterator emplace(key_parameter_t key, TArgs&&... args)
+    {
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(inline_flat_map_full), this->end());
+
+      return this->insert_at(this->upper_bound_index(key), key, mapped_type(etl::forward<TArgs>(args)...));
+    }
+#else
+    //*********************************************************************
+    /// Emplaces a key and a mapped value.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the multimap is already full.
+    ///\return An iterator to the inserted element.
+    //*********************************************************************
+    iterator emplace(key_parameter_t key, const mapped_type& mapped)
+    {
+      return insert(value_type(key, mapped));
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the multimap.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the multimap does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      this->clear();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the multimap does not have enough free space.
+    //*************************************************************************
+    iinline_flat_multimap& operator = (const iinline_flat_multimap& rhs)
+    {
+      if (&rhs != this)
+      {
+        ETL_ASSERT_AND_RETURN_VALUE(rhs.size() <= this->max_size(), ETL_ERROR(inline_flat_map_full), *this);
+
+        this->copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    /// If asserts or exceptions are enabled, emits inline_flat_map_full if the multimap does not have enough free space.
+    //*************************************************************************
+    iinline_flat_multimap& operator = (iinline_flat_multimap&& rhs)
+    {
+      if (&rhs != this)
+      {
+        ETL_ASSERT_AND_RETURN_VALUE(rhs.size() <= this->max_size(), ETL_ERROR(inline_flat_map_full), *this);
+
+        this->move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iinline_flat_multimap(TKey* pkeys_, TMapped* pmapped_, size_t max_size_, const TKeyCompare& compare_)
+      : base(pkeys_, pmapped_, max_size_, compare_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    iinline_flat_multimap(const iinline_flat_multimap&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INLINE_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iinline_flat_multimap()
+    {
+    }
+#else
+  protected:
+    ~iinline_flat_multimap()
+    {
+    }
+#endif
+  };
+
+  namespace private_inline_flat
+  {
+    //*************************************************************************
+    /// Compares the keys and the mapped values of two maps.
+    //*************************************************************************
+    template <typename TKey, typename TMapped, typename TKeyCompare>
+    bool equal(const etl::private_inline_flat::map_table<TKey, TMapped, TKeyCompare>& lhs,
+               const etl::private_inline_flat::map_table<TKey, TMapped, TKeyCompare>& rhs)
+    {
+      return (lhs.size() == rhs.size()) &&
+             etl::equal(lhs.keys().begin(), lhs.keys().end(), rhs.keys().begin()) &&
+             etl::equal(lhs.values().begin(), lhs.values().end(), rhs.values().begin());
+    }
+  }
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first inline_flat_map.
+  ///\param rhs Reference to the second inline_flat_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::iinline_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::iinline_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return etl::private_inline_flat::equal(lhs, rhs);
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first inline_flat_map.
+  ///\param rhs Reference to the second inline_flat_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::iinline_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::iinline_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first inline_flat_multimap.
+  ///\param rhs Reference to the second inline_flat_multimap.
+  ///\return <b>true</b> if the multimaps are equal, otherwise <b>false</b>
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::iinline_flat_multimap<TKey, TMapped, TKeyCompare>& lhs, const etl::iinline_flat_multimap<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return etl::private_inline_flat::equal(lhs, rhs);
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first inline_flat_multimap.
+  ///\param rhs Reference to the second inline_flat_multimap.
+  ///\return <b>true</b> if the multimaps are not equal, otherwise <b>false</b>
+  ///\ingroup inline_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::iinline_flat_multimap<TKey, TMapped, TKeyCompare>& lhs, const etl::iinline_flat_multimap<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated inline_flat_map implementation that uses fixed size buffers.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TKeyCompare = etl::less<TKey> >
+  class inline_flat_map : public etl::iinline_flat_map<TKey, TMapped, TKeyCompare>
+  {
+  private:
+
+    typedef etl::iinline_flat_map<TKey, TMapped, TKeyCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    inline_flat_map(const TKeyCompare& compare = TKeyCompare())
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TMapped*>(&mapped_buffer), MAX_SIZE, compare)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    inline_flat_map(const inline_flat_map& other)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TMapped*>(&mapped_buffer), MAX_SIZE, other.key_comp())
+    {
+      this->copy_from(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    inline_flat_map(inline_flat_map&& other)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TMapped*>(&mapped_buffer), MAX_SIZE, other.key_comp())
+    {
+      this->move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    inline_flat_map(TIterator first_, TIterator last_, const TKeyCompare& compare = TKeyCompare())
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TMapped*>(&mapped_buffer), MAX_SIZE, compare)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    inline_flat_map(std::initializer_list<ETL_OR_STD::pair<TKey, TMapped>> init, const TKeyCompare& compare = TKeyCompare())
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TMapped*>(&mapped_buffer), MAX_SIZE, compare)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~inline_flat_map()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    inline_flat_map& operator = (const inline_flat_map& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    inline_flat_map& operator = (inline_flat_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The storage for the keys.
+    typename etl::aligned_storage<sizeof(TKey) * MAX_SIZE, etl::alignment_of<TKey>::value>::type key_buffer;
+
+    /// The storage for the mapped values.
+    typename etl::aligned_storage<sizeof(TMapped) * MAX_SIZE, etl::alignment_of<TMapped>::value>::type mapped_buffer;
+  };
+
+  //*************************************************************************
+  /// A templated inline_flat_multimap implementation that uses fixed size buffers.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TKeyCompare = etl::less<TKey> >
+  class inline_flat_multimap : public etl::iinline_flat_multimap<TKey, TMapped, TKeyCompare>
+  {
+  private:
+
+    typedef etl::iinline_flat_multimap<TKey, TMapped, TKeyCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    inline_flat_multimap(const TKeyCompare& compare = TKeyCompare())
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TMapped*>(&mapped_buffer), MAX_SIZE, compare)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    inline_flat_multimap(const inline_flat_multimap& other)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TMapped*>(&mapped_buffer), MAX_SIZE, other.key_comp())
+    {
+      this->copy_from(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    inline_flat_multimap(inline_flat_multimap&& other)
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TMapped*>(&mapped_buffer), MAX_SIZE, other.key_comp())
+    {
+      this->move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    inline_flat_multimap(TIterator first_, TIterator last_, const TKeyCompare& compare = TKeyCompare())
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TMapped*>(&mapped_buffer), MAX_SIZE, compare)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    inline_flat_multimap(std::initializer_list<ETL_OR_STD::pair<TKey, TMapped>> init, const TKeyCompare& compare = TKeyCompare())
+      : base(reinterpret_cast<TKey*>(&key_buffer), reinterpret_cast<TMapped*>(&mapped_buffer), MAX_SIZE, compare)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~inline_flat_multimap()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    inline_flat_multimap& operator = (const inline_flat_multimap& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    inline_flat_multimap& operator = (inline_flat_multimap&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The storage for the keys.
+    typename etl::aligned_storage<sizeof(TKey) * MAX_SIZE, etl::alignment_of<TKey>::value>::type key_buffer;
+
+    /// The storage for the mapped values.
+    typename etl::aligned_storage<sizeof(TMapped) * MAX_SIZE, etl::alignment_of<TMapped>::value>::type mapped_buffer;
+  };
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  inline_flat_map(TPairs...) -> inline_flat_map<typename etl::nth_type_t<0, TPairs...>::first_type,
+                                                typename etl::nth_type_t<0, TPairs...>::second_type,
+                                                sizeof...(TPairs)>;
+
+  template <typename... TPairs>
+  inline_flat_multimap(TPairs...) -> inline_flat_multimap<typename etl::nth_type_t<0, TPairs...>::first_type,
+                                                          typename etl::nth_type_t<0, TPairs...>::second_type,
+                                                          sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey>, typename... TPairs>
+  constexpr auto make_inline_flat_map(TPairs&&... pairs) -> etl::inline_flat_map<TKey, TMapped, sizeof...(TPairs), TKeyCompare>
+  {
+    return { {etl::forward<TPairs>(pairs)...} };
+  }
+
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey>, typename... TPairs>
+  constexpr auto make_inline_flat_multimap(TPairs&&... pairs) -> etl::inline_flat_multimap<TKey, TMapped, sizeof...(TPairs), TKeyCompare>
+  {
+    return { {etl::forward<TPairs>(pairs)...} };
+  }
+#endif
+}
+
+#endif
@@ -0,0 +1,749 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INLINE_FLAT_SET_INCLUDED
+#define ETL_INLINE_FLAT_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "nth_type.h"
+#include "span.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/inline_flat_table.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup inline_flat_set inline_flat_set
+/// Sorted sets with the capacity defined at compile time.
+/// Unlike etl::flat_set, which holds a sorted array of pointers to elements in
+/// a pool, the keys are held in order in a contiguous array, so a search never
+/// follows a pointer. The search is a branchless binary search.
+/// Inserting or erasing an element moves the elements after it, so invalidates
+/// iterators, pointers and references to them.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the inline_flat_set.
+  ///\ingroup inline_flat_set
+  //***************************************************************************
+  class inline_flat_set_exception : public etl::exception
+  {
+  public:
+
+    inline_flat_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the inline_flat_set.
+  ///\ingroup inline_flat_set
+  //***************************************************************************
+  class inline_flat_set_full : public etl::inline_flat_set_exception
+  {
+  public:
+
+    inline_flat_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::inline_flat_set_exception(ETL_ERROR_TEXT("inline_flat_set:full", ETL_INLINE_FLAT_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized inline_flat_set.
+  /// Can be used as a reference type for all inline_flat_set containing a specific type.
+  ///\ingroup inline_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = etl::less<TKey> >
+  class iinline_flat_set : public etl::private_inline_flat::set_table<TKey, TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_inline_flat::set_table<TKey, TKeyCompare> base;
+
+  public:
+
+    typedef typename base::value_type             value_type;
+    typedef typename base::key_type               key_type;
+    typedef typename base::key_compare            key_compare;
+    typedef typename base::value_compare          value_compare;
+    typedef typename base::reference              reference;
+    typedef typename base::const_reference        const_reference;
+    typedef typename base::pointer                pointer;
+    typedef typename base::const_pointer          const_pointer;
+    typedef typename base::size_type              size_type;
+    typedef typename base::difference_type        difference_type;
+    typedef typename base::iterator               iterator;
+    typedef typename base::const_iterator         const_iterator;
+    typedef typename base::reverse_iterator       reverse_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+    typedef typename base::key_parameter_t        key_parameter_t;
+
+  private:
+
+    typedef ETL_OR_STD::pair<iterator, bool> insert_result_t;
+
+  public:
+
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the set is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const value_type& value)
+    {
+      const size_t index = this->lower_bound_index(value);
+
+      if (this->key_at_equals(index, value))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(this->pkeys + index, false);
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(inline_flat_set_full), insert_result_t(this->end(), false));
+
+      return ETL_OR_STD::pair<iterator, bool>(this->insert_at(index, value), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the set is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type&& value)
+    {
+      const size_t index = this->lower_bound_index(value);
+
+      if (this->key_at_equals(index, value))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(this->pkeys + index, false);
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(inline_flat_set_full), insert_result_t(this->end(), false));
+
+      return ETL_OR_STD::pair<iterator, bool>(this->insert_at(index, etl::move(value)), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the set is already full.
+    ///\param position The position hint. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const value_type& value)
+    {
+      return insert(value).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the set.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the set does not have enough free space.
+    /// Values that are already in order are appended without moving other elements.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Emplaces a value constructed from the arguments.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the set is already full.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*********************************************************************
+    template <typename... TArgs>
+    ETL_OR_STD::pair<iterator, bool> emplace(TArgs&&... args)
+    {
+      return insert(value_type(etl::forward<TArgs>(args)...));
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the set.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      this->clear();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the set does not have enough free space.
+    //*************************************************************************
+    iinline_flat_set& operator = (const iinline_flat_set& rhs)
+    {
+      if (&rhs != this)
+      {
+        ETL_ASSERT_AND_RETURN_VALUE(rhs.size() <= this->max_size(), ETL_ERROR(inline_flat_set_full), *this);
+
+        this->copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the set does not have enough free space.
+    //*************************************************************************
+    iinline_flat_set& operator = (iinline_flat_set&& rhs)
+    {
+      if (&rhs != this)
+      {
+        ETL_ASSERT_AND_RETURN_VALUE(rhs.size() <= this->max_size(), ETL_ERROR(inline_flat_set_full), *this);
+
+        this->move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iinline_flat_set(TKey* pkeys_, size_t max_size_, const TKeyCompare& compare_)
+      : base(pkeys_, max_size_, compare_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    iinline_flat_set(const iinline_flat_set&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INLINE_FLAT_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iinline_flat_set()
+    {
+    }
+#else
+  protected:
+    ~iinline_flat_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized inline_flat_multiset.
+  /// Can be used as a reference type for all inline_flat_multiset containing a specific type.
+  /// Equal elements are kept in the order that they were inserted.
+  ///\ingroup inline_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = etl::less<TKey> >
+  class iinline_flat_multiset : public etl::private_inline_flat::set_table<TKey, TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_inline_flat::set_table<TKey, TKeyCompare> base;
+
+  public:
+
+    typedef typename base::value_type             value_type;
+    typedef typename base::key_type               key_type;
+    typedef typename base::key_compare            key_compare;
+    typedef typename base::value_compare          value_compare;
+    typedef typename base::reference              reference;
+    typedef typename base::const_reference        const_reference;
+    typedef typename base::pointer                pointer;
+    typedef typename base::const_pointer          const_pointer;
+    typedef typename base::size_type              size_type;
+    typedef typename base::difference_type        difference_type;
+    typedef typename base::iterator               iterator;
+    typedef typename base::const_iterator         const_iterator;
+    typedef typename base::reverse_iterator       reverse_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+    typedef typename base::key_parameter_t        key_parameter_t;
+
+    //*********************************************************************
+    /// Inserts a value to the multiset, after any equal elements.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the multiset is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the inserted element.
+    //*********************************************************************
+    iterator insert(const value_type& value)
+    {
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(inline_flat_set_full), this->end());
+
+      return this->insert_at(this->upper_bound_index(value), value);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the multiset, after any equal elements.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the multiset is already full.
+    ///\param value The value to insert.
+    ///\return An iterator to the inserted element.
+    //*********************************************************************
+    iterator insert(value_type&& value)
+    {
+      ETL_ASSERT_AND_RETURN_VALUE(!this->full(), ETL_ERROR(inline_flat_set_full), this->end());
+
+      return this->insert_at(this->upper_bound_index(value), etl::move(value));
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the multiset.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the multiset is already full.
+    ///\param position The position hint. Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const value_type& value)
+    {
+      return insert(value);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the multiset.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the multiset does not have enough free space.
+    /// Values that are already in order are appended without moving other elements.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Emplaces a value constructed from the arguments.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the multiset is already full.
+    ///\return An iterator to the inserted element.
+    //*********************************************************************
+    template <typename... TArgs>
+    iterator emplace(TArgs&&... args)
+    {
+      return insert(value_type(etl::forward<TArgs>(args)...));
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the multiset.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the multiset does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      this->clear();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the multiset does not have enough free space.
+    //*************************************************************************
+    iinline_flat_multiset& operator = (const iinline_flat_multiset& rhs)
+    {
+      if (&rhs != this)
+      {
+        ETL_ASSERT_AND_RETURN_VALUE(rhs.size() <= this->max_size(), ETL_ERROR(inline_flat_set_full), *this);
+
+        this->copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    /// If asserts or exceptions are enabled, emits inline_flat_set_full if the multiset does not have enough free space.
+    //*************************************************************************
+    iinline_flat_multiset& operator = (iinline_flat_multiset&& rhs)
+    {
+      if (&rhs != this)
+      {
+        ETL_ASSERT_AND_RETURN_VALUE(rhs.size() <= this->max_size(), ETL_ERROR(inline_flat_set_full), *this);
+
+        this->move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iinline_flat_multiset(TKey* pkeys_, size_t max_size_, const TKeyCompare& compare_)
+      : base(pkeys_, max_size_, compare_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    iinline_flat_multiset(const iinline_flat_multiset&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INLINE_FLAT_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iinline_flat_multiset()
+    {
+    }
+#else
+  protected:
+    ~iinline_flat_multiset()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first inline_flat_set.
+  ///\param rhs Reference to the second inline_flat_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup inline_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator ==(const etl::iinline_flat_set<TKey, TKeyCompare>& lhs, const etl::iinline_flat_set<TKey, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first inline_flat_set.
+  ///\param rhs Reference to the second inline_flat_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup inline_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator !=(const etl::iinline_flat_set<TKey, TKeyCompare>& lhs, const etl::iinline_flat_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first inline_flat_multiset.
+  ///\param rhs Reference to the second inline_flat_multiset.
+  ///\return <b>true</b> if the multisets are equal, otherwise <b>false</b>
+  ///\ingroup inline_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator ==(const etl::iinline_flat_multiset<TKey, TKeyCompare>& lhs, const etl::iinline_flat_multiset<TKey, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first inline_flat_multiset.
+  ///\param rhs Reference to the second inline_flat_multiset.
+  ///\return <b>true</b> if the multisets are not equal, otherwise <b>false</b>
+  ///\ingroup inline_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator !=(const etl::iinline_flat_multiset<TKey, TKeyCompare>& lhs, const etl::iinline_flat_multiset<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated inline_flat_set implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TKeyCompare = etl::less<TKey> >
+  class inline_flat_set : public etl::iinline_flat_set<TKey, TKeyCompare>
+  {
+  private:
+
+    typedef etl::iinline_flat_set<TKey, TKeyCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    inline_flat_set(const TKeyCompare& compare = TKeyCompare())
+      : base(reinterpret_cast<TKey*>(&key_buffer), MAX_SIZE, compare)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    inline_flat_set(const inline_flat_set& other)
+      : base(reinterpret_cast<TKey*>(&key_buffer), MAX_SIZE, other.key_comp())
+    {
+      this->copy_from(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    inline_flat_set(inline_flat_set&& other)
+      : base(reinterpret_cast<TKey*>(&key_buffer), MAX_SIZE, other.key_comp())
+    {
+      this->move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    inline_flat_set(TIterator first_, TIterator last_, const TKeyCompare& compare = TKeyCompare())
+      : base(reinterpret_cast<TKey*>(&key_buffer), MAX_SIZE, compare)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    inline_flat_set(std::initializer_list<TKey> init, const TKeyCompare& compare = TKeyCompare())
+      : base(reinterpret_cast<TKey*>(&key_buffer), MAX_SIZE, compare)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~inline_flat_set()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    inline_flat_set& operator = (const inline_flat_set& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    inline_flat_set& operator = (inline_flat_set&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The storage for the keys.
+    typename etl::aligned_storage<sizeof(TKey) * MAX_SIZE, etl::alignment_of<TKey>::value>::type key_buffer;
+  };
+
+  //*************************************************************************
+  /// A templated inline_flat_multiset implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TKeyCompare = etl::less<TKey> >
+  class inline_flat_multiset : public etl::iinline_flat_multiset<TKey, TKeyCompare>
+  {
+  private:
+
+    typedef etl::iinline_flat_multiset<TKey, TKeyCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    inline_flat_multiset(const TKeyCompare& compare = TKeyCompare())
+      : base(reinterpret_cast<TKey*>(&key_buffer), MAX_SIZE, compare)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    inline_flat_multiset(const inline_flat_multiset& other)
+      : base(reinterpret_cast<TKey*>(&key_buffer), MAX_SIZE, other.key_comp())
+    {
+      this->copy_from(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    inline_flat_multiset(inline_flat_multiset&& other)
+      : base(reinterpret_cast<TKey*>(&key_buffer), MAX_SIZE, other.key_comp())
+    {
+      this->move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    inline_flat_multiset(TIterator first_, TIterator last_, const TKeyCompare& compare = TKeyCompare())
+      : base(reinterpret_cast<TKey*>(&key_buffer), MAX_SIZE, compare)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    inline_flat_multiset(std::initializer_list<TKey> init, const TKeyCompare& compare = TKeyCompare())
+      : base(reinterpret_cast<TKey*>(&key_buffer), MAX_SIZE, compare)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~inline_flat_multiset()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    inline_flat_multiset& operator = (const inline_flat_multiset& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    inline_flat_multiset& operator = (inline_flat_multiset&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The storage for the keys.
+    typename etl::aligned_storage<sizeof(TKey) * MAX_SIZE, etl::alignment_of<TKey>::value>::type key_buffer;
+  };
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... T>
+  inline_flat_set(T...) -> inline_flat_set<etl::nth_type_t<0, T...>, sizeof...(T)>;
+
+  template <typename... T>
+  inline_flat_multiset(T...) -> inline_flat_multiset<etl::nth_type_t<0, T...>, sizeof...(T)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TKeyCompare = etl::less<TKey>, typename... T>
+  constexpr auto make_inline_flat_set(T&&... keys) -> etl::inline_flat_set<TKey, sizeof...(T), TKeyCompare>
+  {
+    return { {etl::forward<T>(keys)...} };
+  }
+
+  template <typename TKey, typename TKeyCompare = etl::less<TKey>, typename... T>
+  constexpr auto make_inline_flat_multiset(T&&... keys) -> etl::inline_flat_multiset<TKey, sizeof...(T), TKeyCompare>
+  {
+    return { {etl::forward<T>(keys)...} };
+  }
+#endif
+}
+
+#endif
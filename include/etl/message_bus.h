@@ -172,7 +172,7 @@ namespace etl
           {
             etl::imessage_router& router = **irouter;
 
-            if (router.accepts(shared_msg.get_message().get_message_id()))
+            if (router.accepts_id(shared_msg.get_message().get_message_id()))
             {
               router.receive(shared_msg);
             }
@@ -196,7 +196,7 @@ namespace etl
           // Call all of them.
           while (range.first != range.second)
           {
-            if ((*(range.first))->accepts(shared_msg.get_message().get_message_id()))
+            if ((*(range.first))->accepts_id(shared_msg.get_message().get_message_id()))
             {
               (*(range.first))->receive(shared_msg);
             }
@@ -227,7 +227,7 @@ namespace etl
       {
         etl::imessage_router& successor = get_successor();
 
-        if (successor.accepts(shared_msg.get_message().get_message_id()))
+        if (successor.accepts_id(shared_msg.get_message().get_message_id()))
         {
           successor.receive(destination_router_id, shared_msg);
         }
@@ -251,7 +251,7 @@ namespace etl
           {
             etl::imessage_router& router = **irouter;
 
-            if (router.accepts(message.get_message_id()))
+            if (router.accepts_id(message.get_message_id()))
             {
               router.receive(message);
             }
@@ -277,7 +277,7 @@ namespace etl
           // Call all of them.
           while (range.first != range.second)
           {
-            if ((*(range.first))->accepts(message.get_message_id()))
+            if ((*(range.first))->accepts_id(message.get_message_id()))
             {
               (*(range.first))->receive(message);
             }
@@ -308,7 +308,7 @@ namespace etl
       {
         etl::imessage_router& successor = get_successor();
 
-        if (successor.accepts(message.get_message_id()))
+        if (successor.accepts_id(message.get_message_id()))
         {
           successor.receive(destination_router_id, message);
         }
@@ -37,6 +37,7 @@ SOFTWARE.
 #include "message_bus.h"
 #include "static_assert.h"
 #include "timer.h"
+#include "timer_engine.h"
 #include "delegate.h"
 #include "algorithm.h"
 
@@ -46,8 +47,10 @@ namespace etl
 {
   //***************************************************************************
   /// Interface for message timer
+  ///\tparam TEngine The engine that orders the active timers.
   //***************************************************************************
-  class imessage_timer_locked
+  template <typename TEngine>
+  class ibasic_message_timer_locked
   {
   public:
 
@@ -112,7 +115,7 @@ namespace etl
           if (timer.is_active())
           {
             lock();
-            active_list.remove(timer.id, true);
+            active_list.remove(timer.id);
             unlock();
           }
 
@@ -172,38 +175,25 @@ namespace etl
       {
         if (try_lock())
         {
-          // We have something to do?
-          bool has_active = !active_list.empty();
+          // Process the expired timers.
+          etl::timer::id::type id = active_list.next_expired(count);
 
-          if (has_active)
+          while (id != etl::timer::id::NO_TIMER)
           {
-            while (has_active && (count >= active_list.front().delta))
-            {
-              timer_data& timer = active_list.front();
-
-              count -= timer.delta;
-
-              active_list.remove(timer.id, true);
+            timer_data& timer = timer_array[id];
 
-              if (timer.p_router != ETL_NULLPTR)
-              {
-                timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
-              }
-
-              if (timer.repeating)
-              {
-                timer.delta = timer.period;
-                active_list.insert(timer.id);
-              }
-
-              has_active = !active_list.empty();
+            if (timer.p_router != ETL_NULLPTR)
+            {
+              timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
             }
 
-            if (has_active)
+            if (timer.repeating)
             {
-              // Subtract any remainder from the next due timeout.
-              active_list.front().delta -= count;
+              timer.delta = timer.period;
+              active_list.insert(timer.id);
             }
+
+            id = active_list.next_expired(count);
           }
 
           unlock();
@@ -236,7 +226,7 @@ namespace etl
             lock();
             if (timer.is_active())
             {
-              active_list.remove(timer.id, false);
+              active_list.remove(timer.id);
             }
 
             timer.delta = immediate_ ? 0 : timer.period;
@@ -269,7 +259,7 @@ namespace etl
           if (timer.is_active())
           {
             lock();
-            active_list.remove(timer.id, false);
+            active_list.remove(timer.id);
             unlock();
           }
 
@@ -393,7 +383,7 @@ namespace etl
     //*******************************************
     /// Constructor.
     //*******************************************
-    imessage_timer_locked(timer_data* const timer_array_, const uint_least8_t  MAX_TIMERS_)
+    ibasic_message_timer_locked(timer_data* const timer_array_, const uint_least8_t  MAX_TIMERS_)
       : timer_array(timer_array_)
       , active_list(timer_array_)
       , enabled(false)
@@ -405,195 +395,17 @@ namespace etl
     //*******************************************
     /// Destructor.
     //*******************************************
-    ~imessage_timer_locked()
+    ~ibasic_message_timer_locked()
     {
     }
 
   private:
 
-    //*************************************************************************
-    /// A specialised intrusive linked list for timer data.
-    //*************************************************************************
-    class timer_list
-    {
-    public:
-
-      //*******************************
-      timer_list(timer_data* ptimers_)
-        : head(etl::timer::id::NO_TIMER)
-        , tail(etl::timer::id::NO_TIMER)
-        , current(etl::timer::id::NO_TIMER)
-        , ptimers(ptimers_)
-      {
-      }
-
-      //*******************************
-      bool empty() const
-      {
-        return head == etl::timer::id::NO_TIMER;
-      }
-
-      //*******************************
-      // Inserts the timer at the correct delta position
-      //*******************************
-      void insert(etl::timer::id::type id_)
-      {
-        timer_data& timer = ptimers[id_];
-
-        if (head == etl::timer::id::NO_TIMER)
-        {
-          // No entries yet.
-          head = id_;
-          tail = id_;
-          timer.previous = etl::timer::id::NO_TIMER;
-          timer.next = etl::timer::id::NO_TIMER;
-        }
-        else
-        {
-          // We already have entries.
-          etl::timer::id::type test_id = begin();
-
-          while (test_id != etl::timer::id::NO_TIMER)
-          {
-            timer_data& test = ptimers[test_id];
-
-            // Find the correct place to insert.
-            if (timer.delta <= test.delta)
-            {
-              if (test.id == head)
-              {
-                head = timer.id;
-              }
-
-              // Insert before test.
-              timer.previous = test.previous;
-              test.previous = timer.id;
-              timer.next = test.id;
-
-              // Adjust the next delta to compensate.
-              test.delta -= timer.delta;
-
-              if (timer.previous != etl::timer::id::NO_TIMER)
-              {
-                ptimers[timer.previous].next = timer.id;
-              }
-              break;
-            }
-            else
-            {
-              timer.delta -= test.delta;
-            }
-
-            test_id = next(test_id);
-          }
-
-          // Reached the end?
-          if (test_id == etl::timer::id::NO_TIMER)
-          {
-            // Tag on to the tail.
-            ptimers[tail].next = timer.id;
-            timer.previous = tail;
-            timer.next = etl::timer::id::NO_TIMER;
-            tail = timer.id;
-          }
-        }
-      }
-
-      //*******************************
-      void remove(etl::timer::id::type id_, bool has_expired)
-      {
-        timer_data& timer = ptimers[id_];
-
-        if (head == id_)
-        {
-          head = timer.next;
-        }
-        else
-        {
-          ptimers[timer.previous].next = timer.next;
-        }
-
-        if (tail == id_)
-        {
-          tail = timer.previous;
-        }
-        else
-        {
-          ptimers[timer.next].previous = timer.previous;
-        }
-
-        if (!has_expired)
-        {
-          // Adjust the next delta.
-          if (timer.next != etl::timer::id::NO_TIMER)
-          {
-            ptimers[timer.next].delta += timer.delta;
-          }
-        }
-
-        timer.previous = etl::timer::id::NO_TIMER;
-        timer.next = etl::timer::id::NO_TIMER;
-        timer.delta = etl::timer::state::INACTIVE;
-      }
-
-      //*******************************
-      timer_data& front()
-      {
-        return ptimers[head];
-      }
-
-      //*******************************
-      etl::timer::id::type begin()
-      {
-        current = head;
-        return current;
-      }
-
-      //*******************************
-      etl::timer::id::type previous(etl::timer::id::type last)
-      {
-        current = ptimers[last].previous;
-        return current;
-      }
-
-      //*******************************
-      etl::timer::id::type next(etl::timer::id::type last)
-      {
-        current = ptimers[last].next;
-        return current;
-      }
-
-      //*******************************
-      void clear()
-      {
-        etl::timer::id::type id = begin();
-
-        while (id != etl::timer::id::NO_TIMER)
-        {
-          timer_data& timer = ptimers[id];
-          id = next(id);
-          timer.next = etl::timer::id::NO_TIMER;
-        }
-
-        head = etl::timer::id::NO_TIMER;
-        tail = etl::timer::id::NO_TIMER;
-        current = etl::timer::id::NO_TIMER;
-      }
-
-    private:
-
-      etl::timer::id::type head;
-      etl::timer::id::type tail;
-      etl::timer::id::type current;
-
-      timer_data* const ptimers;
-    };
-
     // The array of timer data structures.
     timer_data* const timer_array;
 
     // The list of active timers.
-    timer_list active_list;
+    typename TEngine::template engine<timer_data> active_list;
 
     volatile bool enabled;
 
@@ -608,26 +420,31 @@ namespace etl
     const uint_least8_t MAX_TIMERS;
   };
 
+  //***************************************************************************
+  /// Interface for message timer using the default engine.
+  //***************************************************************************
+  typedef ibasic_message_timer_locked<etl::timer_delta_list> imessage_timer_locked;
+
   //***************************************************************************
   /// The message timer
   //***************************************************************************
-  template <uint_least8_t MAX_TIMERS_>
-  class message_timer_locked : public etl::imessage_timer_locked
+  template <uint_least8_t MAX_TIMERS_, typename TEngine = etl::timer_delta_list>
+  class message_timer_locked : public etl::ibasic_message_timer_locked<TEngine>
   {
   public:
 
     ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254, "No more than 254 timers are allowed");
 
-    typedef imessage_timer_locked::callback_type callback_type;
-    typedef imessage_timer_locked::try_lock_type try_lock_type;
-    typedef imessage_timer_locked::lock_type     lock_type;
-    typedef imessage_timer_locked::unlock_type   unlock_type;
+    typedef typename ibasic_message_timer_locked<TEngine>::callback_type callback_type;
+    typedef typename ibasic_message_timer_locked<TEngine>::try_lock_type try_lock_type;
+    typedef typename ibasic_message_timer_locked<TEngine>::lock_type     lock_type;
+    typedef typename ibasic_message_timer_locked<TEngine>::unlock_type   unlock_type;
 
     //*******************************************
     /// Constructor.
     //*******************************************
     message_timer_locked()
-      : imessage_timer_locked(timer_array, MAX_TIMERS_)
+      : ibasic_message_timer_locked<TEngine>(timer_array, MAX_TIMERS_)
     {
     }
 
@@ -635,14 +452,14 @@ namespace etl
     /// Constructor.
     //*******************************************
     message_timer_locked(try_lock_type try_lock_, lock_type lock_, unlock_type unlock_)
-      : imessage_timer_locked(timer_array, MAX_TIMERS_)
+      : ibasic_message_timer_locked<TEngine>(timer_array, MAX_TIMERS_)
     {
       this->set_locks(try_lock_, lock_, unlock_);
     }
 
   private:
 
-    timer_data timer_array[MAX_TIMERS_];
+    typename etl::ibasic_message_timer_locked<TEngine>::timer_data timer_array[MAX_TIMERS_];
   };
 }
 
@@ -231,6 +231,13 @@ SOFTWARE.
   #define ETL_HAS_MUTABLE_ARRAY_VIEW 0
 #endif
 
+//*************************************
+// The size of a cache line, in bytes.
+// Used to separate data that is written by different cores.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
+
 //*************************************
 // The macros below are dependent on the profile.
 // C++11
@@ -415,6 +422,7 @@ namespace etl
     // General
     static ETL_CONSTANT long cplusplus                        = __cplusplus;
     static ETL_CONSTANT int  language_standard                = ETL_LANGUAGE_STANDARD;
+    static ETL_CONSTANT int  cache_line_size                  = ETL_CACHE_LINE_SIZE;
 
     // Using...
     static ETL_CONSTANT bool using_stl                        = (ETL_USING_STL == 1);
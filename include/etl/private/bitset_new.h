@@ -499,55 +499,104 @@ namespace etl
 
     //*************************************************************************
     /// Finds the next bit in the specified state.
+    /// Scans a whole element at a time, skipping elements that have no bits in
+    /// the required state.
     ///\param state    The state to search for.
     ///\param position The position to start from.
     ///\returns The position of the bit or npos if none were found.
     //*************************************************************************
     ETL_CONSTEXPR14 size_t find_next(const_pointer pbuffer, size_t number_of_elements, size_t total_bits, bool state, size_t position) const ETL_NOEXCEPT
     {
-      // Where to start.
+      if (position >= total_bits)
+      {
+        return npos;
+      }
+
+      // The bits in the required state are set after inverting with this.
+      const element_type invert = state ? All_Clear_Element : All_Set_Element;
+
       size_t index = position >> log2<Bits_Per_Element>::value;
-      size_t bit   = position & (Bits_Per_Element - 1);
 
-      element_type mask = 1 << bit;
+      element_type value = element_type((pbuffer[index] ^ invert) & element_type(All_Set_Element << (position & (Bits_Per_Element - 1U))));
 
-      // For each element in the bitset...
-      while (index < number_of_elements)
+      while (value == All_Clear_Element)
       {
-        element_type value = pbuffer[index];
+        index = skip_elements(pbuffer, number_of_elements, invert, index + 1U);
 
-        // Needs checking?
-        if ((state && (value != All_Clear_Element)) ||
-            (!state && (value != All_Set_Element)))
+        if (index == number_of_elements)
         {
-          // For each bit in the element...
-          while ((bit < Bits_Per_Element) && (position < total_bits))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
+          return npos;
         }
-        else
+
+        value = element_type(pbuffer[index] ^ invert);
+      }
+
+      // The unused bits at the top of the last element are clear, so may be found when searching for clear bits.
+      position = (index << log2<Bits_Per_Element>::value) + etl::count_trailing_zeros(value);
+
+      return (position < total_bits) ? position : npos;
+    }
+
+    //*************************************************************************
+    /// Finds the previous bit in the specified state.
+    ///\param state    The state to search for.
+    ///\param position The position to start from, searching towards bit 0.
+    ///                 Positions past the end start from the last bit.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t find_prev(const_pointer pbuffer, size_t total_bits, bool state, size_t position) const ETL_NOEXCEPT
+    {
+      if (total_bits == 0U)
+      {
+        return npos;
+      }
+
+      if (position >= total_bits)
+      {
+        position = total_bits - 1U;
+      }
+
+      // The bits in the required state are set after inverting with this.
+      const element_type invert = state ? All_Clear_Element : All_Set_Element;
+
+      size_t index = position >> log2<Bits_Per_Element>::value;
+
+      element_type value = element_type((pbuffer[index] ^ invert) & element_type(All_Set_Element >> (Bits_Per_Element - 1U - (position & (Bits_Per_Element - 1U)))));
+
+      while (value == All_Clear_Element)
+      {
+        if (index == 0U)
         {
-          position += (Bits_Per_Element - bit);
+          return npos;
         }
 
-        // Start at the beginning for all other elements.
-        bit = 0;
-        mask = 1;
+        --index;
 
-        ++index;
+        value = element_type(pbuffer[index] ^ invert);
       }
 
-      return npos;
+      return (index << log2<Bits_Per_Element>::value) + (Bits_Per_Element - 1U - etl::count_leading_zeros(value));
+    }
+
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending order.
+    //*************************************************************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 void for_each_set_bit(const_pointer pbuffer, size_t number_of_elements, TFunction& function) const
+    {
+      for (size_t index = 0U; index < number_of_elements; ++index)
+      {
+        element_type value  = pbuffer[index];
+        const size_t offset = index << log2<Bits_Per_Element>::value;
+
+        while (value != All_Clear_Element)
+        {
+          function(offset + etl::count_trailing_zeros(value));
+
+          // Clear the lowest set bit.
+          value = element_type(value & (value - 1U));
+        }
+      }
     }
 
     //*************************************************************************
@@ -793,6 +842,36 @@ namespace etl
         ++pbuffer2;
       }
     }
+
+  private:
+
+    //*************************************************************************
+    /// Returns the index of the first element from 'index' that is not equal
+    /// to 'skip', or 'number_of_elements' if there are none.
+    /// Runs are tested four elements at a time, which compilers can vectorise.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 size_t skip_elements(const_pointer pbuffer, size_t number_of_elements, element_type skip, size_t index) ETL_NOEXCEPT
+    {
+      while ((index + 4U) <= number_of_elements)
+      {
+        const element_type differences = element_type((pbuffer[index]      ^ skip) | (pbuffer[index + 1U] ^ skip) |
+                                                      (pbuffer[index + 2U] ^ skip) | (pbuffer[index + 3U] ^ skip));
+
+        if (differences != All_Clear_Element)
+        {
+          break;
+        }
+
+        index += 4U;
+      }
+
+      while ((index < number_of_elements) && (pbuffer[index] == skip))
+      {
+        ++index;
+      }
+
+      return index;
+    }
   };
  
   //***************************************************************************
@@ -1459,33 +1538,73 @@ namespace etl
     {
       if (position < Active_Bits)
       {
-        // Where to start.
-        size_t bit = position;
-
-        element_type mask = 1U << position;
+        // The bits in the required state, from 'position' upwards.
+        const element_type value = element_type((state ? buffer : element_type(~buffer)) & element_type(All_Set_Element << position));
 
-        // Needs checking?
-        if ((state && (buffer != All_Clear_Element)) || (!state && (buffer != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while (bit < Active_Bits)
-          {
-            // Equal to the required state?
-            if (((buffer & mask) != 0) == state)
-            {
-              return bit;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++bit;
-          }
+          return etl::count_trailing_zeros(value);
         }
       }
 
       return npos;
     }
 
+    //*************************************************************************
+    /// Finds the previous bit in the specified state.
+    ///\param state    The state to search for.
+    ///\param position The position to start from, searching towards bit 0.
+    ///                 Positions past the end start from the last bit.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t find_prev(bool state, size_t position) const ETL_NOEXCEPT
+    {
+      if (position >= Active_Bits)
+      {
+        position = Active_Bits - 1U;
+      }
+
+      // The bits in the required state, from 'position' downwards.
+      const element_type value = element_type((state ? buffer : element_type(~buffer)) & element_type(All_Set_Element >> (Active_Bits - 1U - position)));
+
+      if (value != All_Clear_Element)
+      {
+        return Active_Bits - 1U - etl::count_leading_zeros(value);
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the last bit in the specified state.
+    ///\param state The state to search for.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t find_last(bool state) const ETL_NOEXCEPT
+    {
+      return find_prev(state, npos);
+    }
+
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending order.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 TFunction for_each_set_bit(TFunction function) const
+    {
+      element_type value = buffer;
+
+      while (value != All_Clear_Element)
+      {
+        function(size_t(etl::count_trailing_zeros(value)));
+
+        // Clear the lowest set bit.
+        value = element_type(value & (value - 1U));
+      }
+
+      return function;
+    }
+
     //*************************************************************************
     /// operator &
     //*************************************************************************
@@ -2124,6 +2243,40 @@ namespace etl
       return ibitset.find_next(buffer, Number_Of_Elements, Active_Bits, state, position);
     }
 
+    //*************************************************************************
+    /// Finds the previous bit in the specified state.
+    ///\param state    The state to search for.
+    ///\param position The position to start from, searching towards bit 0.
+    ///                 Positions past the end start from the last bit.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t find_prev(bool state, size_t position) const ETL_NOEXCEPT
+    {
+      return ibitset.find_prev(buffer, Active_Bits, state, position);
+    }
+
+    //*************************************************************************
+    /// Finds the last bit in the specified state.
+    ///\param state The state to search for.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t find_last(bool state) const ETL_NOEXCEPT
+    {
+      return ibitset.find_prev(buffer, Active_Bits, state, npos);
+    }
+
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending order.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 TFunction for_each_set_bit(TFunction function) const
+    {
+      ibitset.for_each_set_bit(buffer, Number_Of_Elements, function);
+
+      return function;
+    }
+
     //*************************************************************************
     /// operator &
     //*************************************************************************
@@ -3108,33 +3261,73 @@ namespace etl
     {
       if (position < Active_Bits)
       {
-        // Where to start.
-        size_t bit = position;
-
-        element_type mask = 1U << position;
+        // The bits in the required state, from 'position' upwards.
+        const element_type value = element_type((state ? *pbuffer : element_type(~*pbuffer)) & element_type(All_Set_Element << position));
 
-        // Needs checking?
-        if ((state && (*pbuffer != All_Clear_Element)) || (!state && (*pbuffer != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while (bit < Active_Bits)
-          {
-            // Equal to the required state?
-            if (((*pbuffer & mask) != 0) == state)
-            {
-              return bit;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++bit;
-          }
+          return etl::count_trailing_zeros(value);
         }
       }
 
       return npos;
     }
 
+    //*************************************************************************
+    /// Finds the previous bit in the specified state.
+    ///\param state    The state to search for.
+    ///\param position The position to start from, searching towards bit 0.
+    ///                 Positions past the end start from the last bit.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t find_prev(bool state, size_t position) const ETL_NOEXCEPT
+    {
+      if (position >= Active_Bits)
+      {
+        position = Active_Bits - 1U;
+      }
+
+      // The bits in the required state, from 'position' downwards.
+      const element_type value = element_type((state ? *pbuffer : element_type(~*pbuffer)) & element_type(All_Set_Element >> (Active_Bits - 1U - position)));
+
+      if (value != All_Clear_Element)
+      {
+        return Active_Bits - 1U - etl::count_leading_zeros(value);
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the last bit in the specified state.
+    ///\param state The state to search for.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t find_last(bool state) const ETL_NOEXCEPT
+    {
+      return find_prev(state, npos);
+    }
+
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending order.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 TFunction for_each_set_bit(TFunction function) const
+    {
+      element_type value = *pbuffer;
+
+      while (value != All_Clear_Element)
+      {
+        function(size_t(etl::count_trailing_zeros(value)));
+
+        // Clear the lowest set bit.
+        value = element_type(value & (value - 1U));
+      }
+
+      return function;
+    }
+
     //*************************************************************************
     /// operator &=
     //*************************************************************************
@@ -3776,6 +3969,40 @@ namespace etl
       return ibitset.find_next(pbuffer, Number_Of_Elements, Active_Bits, state, position);
     }
 
+    //*************************************************************************
+    /// Finds the previous bit in the specified state.
+    ///\param state    The state to search for.
+    ///\param position The position to start from, searching towards bit 0.
+    ///                 Positions past the end start from the last bit.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t find_prev(bool state, size_t position) const ETL_NOEXCEPT
+    {
+      return ibitset.find_prev(pbuffer, Active_Bits, state, position);
+    }
+
+    //*************************************************************************
+    /// Finds the last bit in the specified state.
+    ///\param state The state to search for.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t find_last(bool state) const ETL_NOEXCEPT
+    {
+      return ibitset.find_prev(pbuffer, Active_Bits, state, npos);
+    }
+
+    //*************************************************************************
+    /// Calls the function with the position of each set bit, in ascending order.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 TFunction for_each_set_bit(TFunction function) const
+    {
+      ibitset.for_each_set_bit(pbuffer, Number_Of_Elements, function);
+
+      return function;
+    }
+
     //*************************************************************************
     /// operator &=
     //*************************************************************************
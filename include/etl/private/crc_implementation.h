@@ -45,6 +45,30 @@ SOFTWARE.
 #pragma diag_suppress 1300
 #endif
 
+//*****************************************************************************
+// Hardware CRC instructions are used for block updates when the target is
+// compiled with them enabled.
+// SSE4.2 supplies CRC32-C. ARMv8 supplies CRC32 and CRC32-C.
+// Define ETL_CRC_NO_HARDWARE to always use the tables.
+//*****************************************************************************
+#if !defined(ETL_CRC_NO_HARDWARE)
+  #if defined(__SSE4_2__) || defined(__AVX__)
+    #define ETL_CRC_USING_SSE42 1
+    #include <nmmintrin.h>
+  #elif defined(__ARM_FEATURE_CRC32)
+    #define ETL_CRC_USING_ARM_CRC32 1
+    #include <arm_acle.h>
+  #endif
+#endif
+
+#if !defined(ETL_CRC_USING_SSE42)
+  #define ETL_CRC_USING_SSE42 0
+#endif
+
+#if !defined(ETL_CRC_USING_ARM_CRC32)
+  #define ETL_CRC_USING_ARM_CRC32 0
+#endif
+
 namespace etl
 {
   namespace private_crc
@@ -125,6 +149,34 @@ namespace etl
                                                crc_partial_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Entry>::value>::value>::value>::value>::value>::value>::value>::value;
     };
 
+    //*****************************************************************************
+    /// CRC Slice Table Entry
+    /// The CRC of the byte 'Index' followed by 'Slice' zero bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    class crc_slice_table_entry
+    {
+    private:
+
+      static ETL_CONSTANT TAccumulator Previous       = crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice - 1U>::value;
+      static ETL_CONSTANT size_t       Previous_Index = Reflect ? size_t(Previous & 0xFFU) : size_t((Previous >> (Accumulator_Bits - 8U)) & 0xFFU);
+
+    public:
+
+      static ETL_CONSTANT TAccumulator value = TAccumulator((Reflect ? TAccumulator(Previous >> 8U) : TAccumulator(Previous << 8U)) ^
+                                                            crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Previous_Index, 8U>::value);
+    };
+
+    //*********************************
+    // Slice 0 is the 256 entry table.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+    class crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 0U>
+    {
+    public:
+
+      static ETL_CONSTANT TAccumulator value = crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 8U>::value;
+    };
+
     //*****************************************************************************
     /// CRC Update Chunk
     //*****************************************************************************
@@ -238,6 +290,18 @@ namespace etl
 
         return crc;
       }
+
+      //*************************************************************************
+      TAccumulator add_block(TAccumulator crc, const uint8_t* begin, const uint8_t* end) const
+      {
+        while (begin != end)
+        {
+          crc = add(crc, *begin);
+          ++begin;
+        }
+
+        return crc;
+      }
     };
 
     //*********************************
@@ -281,6 +345,18 @@ namespace etl
 
         return crc;
       }
+
+      //*************************************************************************
+      TAccumulator add_block(TAccumulator crc, const uint8_t* begin, const uint8_t* end) const
+      {
+        while (begin != end)
+        {
+          crc = add(crc, *begin);
+          ++begin;
+        }
+
+        return crc;
+      }
     };
 
     //*********************************
@@ -555,80 +631,286 @@ namespace etl
 
         return crc;
       }
+
+      //*************************************************************************
+      TAccumulator add_block(TAccumulator crc, const uint8_t* begin, const uint8_t* end) const
+      {
+        while (begin != end)
+        {
+          crc = add(crc, *begin);
+          ++begin;
+        }
+
+        return crc;
+      }
     };
 
     //*****************************************************************************
-    // CRC Policies.
+    // Slice tables.
+    // 'Slices' tables of 256 entries, where table 'n' is the CRC of each byte
+    // followed by 'n' zero bytes.
     //*****************************************************************************
-    template <typename TCrcParameters, size_t Table_Size>
-    struct crc_policy;
+#define ETL_CRC_SLICE_ENTRY(S, I)      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, (I), (S)>::value
+#define ETL_CRC_SLICE_ENTRIES_4(S, I)  ETL_CRC_SLICE_ENTRY(S, I),      ETL_CRC_SLICE_ENTRY(S, I + 1U),       ETL_CRC_SLICE_ENTRY(S, I + 2U),       ETL_CRC_SLICE_ENTRY(S, I + 3U)
+#define ETL_CRC_SLICE_ENTRIES_16(S, I) ETL_CRC_SLICE_ENTRIES_4(S, I),  ETL_CRC_SLICE_ENTRIES_4(S, I + 4U),   ETL_CRC_SLICE_ENTRIES_4(S, I + 8U),   ETL_CRC_SLICE_ENTRIES_4(S, I + 12U)
+#define ETL_CRC_SLICE_ENTRIES_64(S, I) ETL_CRC_SLICE_ENTRIES_16(S, I), ETL_CRC_SLICE_ENTRIES_16(S, I + 16U), ETL_CRC_SLICE_ENTRIES_16(S, I + 32U), ETL_CRC_SLICE_ENTRIES_16(S, I + 48U)
+#define ETL_CRC_SLICE_ENTRIES_256(S)   { ETL_CRC_SLICE_ENTRIES_64(S, 0U), ETL_CRC_SLICE_ENTRIES_64(S, 64U), ETL_CRC_SLICE_ENTRIES_64(S, 128U), ETL_CRC_SLICE_ENTRIES_64(S, 192U) }
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_table_values;
 
     //*********************************
-    // Policy for 256 entry table.
-    template <typename TCrcParameters>
-    struct crc_policy<TCrcParameters, 256U> : public crc_table<typename TCrcParameters::accumulator_type, 
-                                                               TCrcParameters::Accumulator_Bits, 
-                                                               8U, 
-                                                               0xFFU, 
-                                                               TCrcParameters::Polynomial, 
-                                                               TCrcParameters::Reflect, 
-                                                               256U> 
+    // Slice by 8.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_slice_table_values<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U>
     {
-      typedef typename TCrcParameters::accumulator_type accumulator_type;
-      typedef accumulator_type value_type;
+      typedef const TAccumulator (*pointer)[256U];
 
       //*************************************************************************
-      ETL_CONSTEXPR accumulator_type initial() const
+      static pointer get()
       {
-        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
-                                       : TCrcParameters::Initial;
+        static ETL_CONSTANT TAccumulator table[8U][256U] =
+        {
+          ETL_CRC_SLICE_ENTRIES_256(0U), ETL_CRC_SLICE_ENTRIES_256(1U), ETL_CRC_SLICE_ENTRIES_256(2U), ETL_CRC_SLICE_ENTRIES_256(3U),
+          ETL_CRC_SLICE_ENTRIES_256(4U), ETL_CRC_SLICE_ENTRIES_256(5U), ETL_CRC_SLICE_ENTRIES_256(6U), ETL_CRC_SLICE_ENTRIES_256(7U)
+        };
+
+        return table;
       }
 
       //*************************************************************************
-      accumulator_type final(accumulator_type crc) const
+      static TAccumulator lookup(const uint8_t* b)
       {
-        return crc ^ TCrcParameters::Xor_Out;
+        const pointer t = get();
+
+        return t[7U][b[0U]] ^ t[6U][b[1U]] ^ t[5U][b[2U]] ^ t[4U][b[3U]] ^
+               t[3U][b[4U]] ^ t[2U][b[5U]] ^ t[1U][b[6U]] ^ t[0U][b[7U]];
       }
     };
 
     //*********************************
-    // Policy for 16 entry table.
-    template <typename TCrcParameters>
-    struct crc_policy<TCrcParameters, 16U> : public crc_table<typename TCrcParameters::accumulator_type, 
-                                                              TCrcParameters::Accumulator_Bits, 
-                                                              4U, 
-                                                              0x0FU, 
-                                                              TCrcParameters::Polynomial, 
-                                                              TCrcParameters::Reflect, 
-                                                              16U> 
+    // Slice by 16.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_slice_table_values<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U>
     {
-      typedef typename TCrcParameters::accumulator_type accumulator_type;
-      typedef accumulator_type value_type;
+      typedef const TAccumulator (*pointer)[256U];
 
       //*************************************************************************
-      ETL_CONSTEXPR accumulator_type initial() const
+      static pointer get()
       {
-        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
-                                       : TCrcParameters::Initial;
+        static ETL_CONSTANT TAccumulator table[16U][256U] =
+        {
+          ETL_CRC_SLICE_ENTRIES_256(0U),  ETL_CRC_SLICE_ENTRIES_256(1U),  ETL_CRC_SLICE_ENTRIES_256(2U),  ETL_CRC_SLICE_ENTRIES_256(3U),
+          ETL_CRC_SLICE_ENTRIES_256(4U),  ETL_CRC_SLICE_ENTRIES_256(5U),  ETL_CRC_SLICE_ENTRIES_256(6U),  ETL_CRC_SLICE_ENTRIES_256(7U),
+          ETL_CRC_SLICE_ENTRIES_256(8U),  ETL_CRC_SLICE_ENTRIES_256(9U),  ETL_CRC_SLICE_ENTRIES_256(10U), ETL_CRC_SLICE_ENTRIES_256(11U),
+          ETL_CRC_SLICE_ENTRIES_256(12U), ETL_CRC_SLICE_ENTRIES_256(13U), ETL_CRC_SLICE_ENTRIES_256(14U), ETL_CRC_SLICE_ENTRIES_256(15U)
+        };
+
+        return table;
       }
 
       //*************************************************************************
-      accumulator_type final(accumulator_type crc) const
+      static TAccumulator lookup(const uint8_t* b)
       {
-        return crc ^ TCrcParameters::Xor_Out;
+        const pointer t = get();
+
+        return t[15U][b[0U]] ^ t[14U][b[1U]] ^ t[13U][b[2U]] ^ t[12U][b[3U]] ^
+               t[11U][b[4U]] ^ t[10U][b[5U]] ^ t[9U][b[6U]] ^ t[8U][b[7U]] ^
+               t[7U][b[8U]] ^ t[6U][b[9U]] ^ t[5U][b[10U]] ^ t[4U][b[11U]] ^
+               t[3U][b[12U]] ^ t[2U][b[13U]] ^ t[1U][b[14U]] ^ t[0U][b[15U]];
       }
     };
 
+#undef ETL_CRC_SLICE_ENTRY
+#undef ETL_CRC_SLICE_ENTRIES_4
+#undef ETL_CRC_SLICE_ENTRIES_16
+#undef ETL_CRC_SLICE_ENTRIES_64
+#undef ETL_CRC_SLICE_ENTRIES_256
+
     //*********************************
-    // Policy for 4 entry table.
-    template <typename TCrcParameters>
-    struct crc_policy<TCrcParameters, 4U> : public crc_table<typename TCrcParameters::accumulator_type, 
-                                                             TCrcParameters::Accumulator_Bits, 
-                                                             2U, 
-                                                             0x03U, 
-                                                             TCrcParameters::Polynomial, 
-                                                             TCrcParameters::Reflect, 
-                                                             4U> 
+    // Slice by 'Slices' table.
+    // Blocks of 'Slices' bytes are processed with one independent lookup per byte.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_table
+    {
+      ETL_STATIC_ASSERT(Slices >= (Accumulator_Bits / 8U), "Slices must cover the accumulator");
+
+      typedef crc_slice_table_values<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices> values;
+
+      //*************************************************************************
+      TAccumulator add(TAccumulator crc, uint8_t value) const
+      {
+        return crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(crc, value, values::get()[0]);
+      }
+
+      //*************************************************************************
+      TAccumulator add_block(TAccumulator crc, const uint8_t* begin, const uint8_t* end) const
+      {
+        static ETL_CONSTANT size_t Accumulator_Bytes = Accumulator_Bits / 8U;
+
+        while (size_t(end - begin) >= Slices)
+        {
+          uint8_t bytes[Slices];
+
+          for (size_t i = 0U; i < Slices; ++i)
+          {
+            bytes[i] = begin[i];
+          }
+
+          // The bytes that overlap the accumulator.
+          for (size_t i = 0U; i < Accumulator_Bytes; ++i)
+          {
+            bytes[i] ^= Reflect ? uint8_t(crc >> (8U * i))
+                                : uint8_t(crc >> (Accumulator_Bits - (8U * (i + 1U))));
+          }
+
+          crc    = values::lookup(bytes);
+          begin += Slices;
+        }
+
+        while (begin != end)
+        {
+          crc = add(crc, *begin);
+          ++begin;
+        }
+
+        return crc;
+      }
+    };
+
+    //*****************************************************************************
+    /// Reads little endian words.
+    /// Compilers recognise these as single loads on little endian targets.
+    //*****************************************************************************
+    inline uint32_t crc_read_le32(const uint8_t* p)
+    {
+      return uint32_t(p[0]) | (uint32_t(p[1]) << 8U) | (uint32_t(p[2]) << 16U) | (uint32_t(p[3]) << 24U);
+    }
+
+#if ETL_USING_64BIT_TYPES
+    inline uint64_t crc_read_le64(const uint8_t* p)
+    {
+      return uint64_t(crc_read_le32(p)) | (uint64_t(crc_read_le32(p + 4U)) << 32U);
+    }
+#endif
+
+    //*****************************************************************************
+    // Hardware CRC.
+    // By default, no hardware support.
+    //*****************************************************************************
+    template <typename TAccumulator, TAccumulator Polynomial, bool Reflect>
+    struct crc_hardware
+    {
+      static ETL_CONSTANT bool Available = false;
+
+      static TAccumulator add_block(TAccumulator crc, const uint8_t*, const uint8_t*)
+      {
+        return crc;
+      }
+    };
+
+#if ETL_CRC_USING_SSE42
+    //*********************************
+    // CRC32-C using SSE4.2.
+    template <>
+    struct crc_hardware<uint32_t, 0x1EDC6F41UL, true>
+    {
+      static ETL_CONSTANT bool Available = true;
+
+      static uint32_t add_block(uint32_t crc, const uint8_t* begin, const uint8_t* end)
+      {
+  #if defined(__x86_64__) || defined(_M_X64)
+        uint64_t crc64 = crc;
+
+        while (size_t(end - begin) >= 8U)
+        {
+          crc64  = _mm_crc32_u64(crc64, crc_read_le64(begin));
+          begin += 8U;
+        }
+
+        crc = uint32_t(crc64);
+  #else
+        while (size_t(end - begin) >= 4U)
+        {
+          crc    = _mm_crc32_u32(crc, crc_read_le32(begin));
+          begin += 4U;
+        }
+  #endif
+
+        while (begin != end)
+        {
+          crc = _mm_crc32_u8(crc, *begin);
+          ++begin;
+        }
+
+        return crc;
+      }
+    };
+#endif
+
+#if ETL_CRC_USING_ARM_CRC32
+    //*********************************
+    // CRC32 using ARMv8 CRC instructions.
+    template <>
+    struct crc_hardware<uint32_t, 0x04C11DB7UL, true>
+    {
+      static ETL_CONSTANT bool Available = true;
+
+      static uint32_t add_block(uint32_t crc, const uint8_t* begin, const uint8_t* end)
+      {
+        while (size_t(end - begin) >= 8U)
+        {
+          crc    = __crc32d(crc, crc_read_le64(begin));
+          begin += 8U;
+        }
+
+        while (begin != end)
+        {
+          crc = __crc32b(crc, *begin);
+          ++begin;
+        }
+
+        return crc;
+      }
+    };
+
+    //*********************************
+    // CRC32-C using ARMv8 CRC instructions.
+    template <>
+    struct crc_hardware<uint32_t, 0x1EDC6F41UL, true>
+    {
+      static ETL_CONSTANT bool Available = true;
+
+      static uint32_t add_block(uint32_t crc, const uint8_t* begin, const uint8_t* end)
+      {
+        while (size_t(end - begin) >= 8U)
+        {
+          crc    = __crc32cd(crc, crc_read_le64(begin));
+          begin += 8U;
+        }
+
+        while (begin != end)
+        {
+          crc = __crc32cb(crc, *begin);
+          ++begin;
+        }
+
+        return crc;
+      }
+    };
+#endif
+
+    //*****************************************************************************
+    // CRC Policies.
+    //*****************************************************************************
+
+    //*********************************
+    // Common to all policies.
+    // Blocks use hardware instructions if they are available for the
+    // parameters, otherwise the table.
+    template <typename TCrcParameters, typename TTable>
+    struct crc_policy_base : public TTable,
+                             public etl::frame_check_sequence_block_policy
     {
       typedef typename TCrcParameters::accumulator_type accumulator_type;
       typedef accumulator_type value_type;
@@ -640,12 +922,96 @@ namespace etl
                                        : TCrcParameters::Initial;
       }
 
+      //*************************************************************************
+      accumulator_type add_block(accumulator_type crc, const uint8_t* begin, const uint8_t* end) const
+      {
+        typedef crc_hardware<accumulator_type, TCrcParameters::Polynomial, TCrcParameters::Reflect> hardware;
+
+        if ETL_IF_CONSTEXPR(hardware::Available)
+        {
+          return hardware::add_block(crc, begin, end);
+        }
+        else
+        {
+          return TTable::add_block(crc, begin, end);
+        }
+      }
+
       //*************************************************************************
       accumulator_type final(accumulator_type crc) const
       {
         return crc ^ TCrcParameters::Xor_Out;
       }
     };
+
+    template <typename TCrcParameters, size_t Table_Size>
+    struct crc_policy;
+
+    //*********************************
+    // Policy for 16 x 256 entry slice table.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 4096U> : public crc_policy_base<TCrcParameters,
+                                                                      crc_slice_table<typename TCrcParameters::accumulator_type,
+                                                                                      TCrcParameters::Accumulator_Bits,
+                                                                                      TCrcParameters::Polynomial,
+                                                                                      TCrcParameters::Reflect,
+                                                                                      16U> >
+    {
+    };
+
+    //*********************************
+    // Policy for 8 x 256 entry slice table.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 2048U> : public crc_policy_base<TCrcParameters,
+                                                                      crc_slice_table<typename TCrcParameters::accumulator_type,
+                                                                                      TCrcParameters::Accumulator_Bits,
+                                                                                      TCrcParameters::Polynomial,
+                                                                                      TCrcParameters::Reflect,
+                                                                                      8U> >
+    {
+    };
+
+    //*********************************
+    // Policy for 256 entry table.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 256U> : public crc_policy_base<TCrcParameters,
+                                                                     crc_table<typename TCrcParameters::accumulator_type,
+                                                                               TCrcParameters::Accumulator_Bits,
+                                                                               8U,
+                                                                               0xFFU,
+                                                                               TCrcParameters::Polynomial,
+                                                                               TCrcParameters::Reflect,
+                                                                               256U> >
+    {
+    };
+
+    //*********************************
+    // Policy for 16 entry table.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 16U> : public crc_policy_base<TCrcParameters,
+                                                                    crc_table<typename TCrcParameters::accumulator_type,
+                                                                              TCrcParameters::Accumulator_Bits,
+                                                                              4U,
+                                                                              0x0FU,
+                                                                              TCrcParameters::Polynomial,
+                                                                              TCrcParameters::Reflect,
+                                                                              16U> >
+    {
+    };
+
+    //*********************************
+    // Policy for 4 entry table.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 4U> : public crc_policy_base<TCrcParameters,
+                                                                   crc_table<typename TCrcParameters::accumulator_type,
+                                                                             TCrcParameters::Accumulator_Bits,
+                                                                             2U,
+                                                                             0x03U,
+                                                                             TCrcParameters::Polynomial,
+                                                                             TCrcParameters::Reflect,
+                                                                             4U> >
+    {
+    };
   }
 
   //*****************************************************************************
@@ -656,7 +1022,7 @@ namespace etl
   {
   public:
 
-    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) || (Table_Size == 2048U) || (Table_Size == 4096U), "Table size must be 4, 16, 256, 2048 or 4096");
 
     //*************************************************************************
     /// Default constructor.
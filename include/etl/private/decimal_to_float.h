@@ -0,0 +1,487 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DECIMAL_TO_FLOAT_INCLUDED
+#define ETL_DECIMAL_TO_FLOAT_INCLUDED
+
+///\ingroup private
+
+#include "../platform.h"
+#include "../static_assert.h"
+#include "../bit.h"
+#include "float_to_decimal.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_USING_64BIT_TYPES
+
+//*****************************************************************************
+// Converts a decimal significand and exponent to the correctly rounded
+// IEEE-754 binary floating point value.
+// Uses the algorithm from "Number Parsing at a Gigabyte per Second"
+// by Daniel Lemire, after Michael Eisel.
+// The 128 bit powers of ten are shared with private_float_to_decimal.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_decimal_to_float
+  {
+    //*************************************************************************
+    /// The parameters of the IEEE-754 binary formats.
+    //*************************************************************************
+    template <typename T>
+    struct binary_format;
+
+    template <>
+    struct binary_format<double>
+    {
+      typedef uint64_t bits_type;
+
+      static const int32_t Mantissa_Explicit_Bits     = 52;
+      static const int32_t Minimum_Exponent           = -1023;
+      static const int32_t Infinite_Power             = 0x7FF;
+      static const int32_t Sign_Index                 = 63;
+      static const int32_t Min_Exponent_Round_To_Even = -4;
+      static const int32_t Max_Exponent_Round_To_Even = 23;
+      static const int32_t Smallest_Power_Of_Ten      = -342;
+      static const int32_t Largest_Power_Of_Ten       = 308;
+    };
+
+    template <>
+    struct binary_format<float>
+    {
+      typedef uint32_t bits_type;
+
+      static const int32_t Mantissa_Explicit_Bits     = 23;
+      static const int32_t Minimum_Exponent           = -127;
+      static const int32_t Infinite_Power             = 0xFF;
+      static const int32_t Sign_Index                 = 31;
+      static const int32_t Min_Exponent_Round_To_Even = -17;
+      static const int32_t Max_Exponent_Round_To_Even = 10;
+      static const int32_t Smallest_Power_Of_Ten      = -64;
+      static const int32_t Largest_Power_Of_Ten       = 38;
+    };
+
+    //*************************************************************************
+    /// The binary significand, without the implicit bit, and biased exponent
+    /// of a value.
+    //*************************************************************************
+    struct adjusted_mantissa
+    {
+      uint64_t mantissa;
+      int32_t  power2;
+    };
+
+    //*************************************************************************
+    /// Computes the 128 bit product of w and 5^q, truncated to the precision
+    /// needed. The table holds 10^q rounded up, which has the same bits as 5^q.
+    /// The algorithm expects 5^q truncated, except for -27 <= q < 0, where it
+    /// expects it rounded up.
+    //*************************************************************************
+    inline private_float_to_decimal::uint128 multiply_by_pow5(uint64_t w, int32_t q, int32_t bit_precision)
+    {
+      using private_float_to_decimal::pow10_table;
+
+      const uint64_t* g = pow10_table<>::g[q - pow10_table<>::Min_K];
+
+      const bool is_rounded_up = (q >= -27) && (q < 0);
+
+      const uint64_t g_lo = is_rounded_up ? g[1] : g[1] - 1U;
+      const uint64_t g_hi = (is_rounded_up || (g[1] != 0U)) ? g[0] : g[0] - 1U;
+
+      private_float_to_decimal::uint128 first = private_float_to_decimal::multiply(w, g_hi);
+
+      const uint64_t precision_mask = ~uint64_t(0U) >> bit_precision;
+
+      // Only use the lower half of the power if the upper half is not enough.
+      if ((first.hi & precision_mask) == precision_mask)
+      {
+        const private_float_to_decimal::uint128 second = private_float_to_decimal::multiply(w, g_lo);
+
+        first.lo += second.hi;
+        first.hi += (second.hi > first.lo) ? 1U : 0U;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Computes w * 10^q as a binary significand and biased exponent, rounded
+    /// to nearest, ties to even.
+    //*************************************************************************
+    template <typename T>
+    adjusted_mantissa compute_float(int32_t q, uint64_t w)
+    {
+      typedef binary_format<T> format;
+
+      ETL_STATIC_ASSERT(format::Smallest_Power_Of_Ten >= private_float_to_decimal::pow10_table<>::Min_K, "Powers of ten table is too small");
+      ETL_STATIC_ASSERT(format::Largest_Power_Of_Ten <= private_float_to_decimal::pow10_table<>::Max_K, "Powers of ten table is too small");
+
+      adjusted_mantissa answer;
+      answer.mantissa = 0U;
+      answer.power2   = 0;
+
+      if ((w == 0U) || (q < format::Smallest_Power_Of_Ten))
+      {
+        // Zero.
+        return answer;
+      }
+
+      if (q > format::Largest_Power_Of_Ten)
+      {
+        // Infinity.
+        answer.power2 = format::Infinite_Power;
+        return answer;
+      }
+
+      // Normalise the significand.
+      const int32_t lz = static_cast<int32_t>(etl::countl_zero(w));
+      w <<= lz;
+
+      // The product is always precise enough to decide the rounding.
+      const private_float_to_decimal::uint128 product = multiply_by_pow5(w, q, format::Mantissa_Explicit_Bits + 3);
+
+      const int32_t upper_bit = static_cast<int32_t>(product.hi >> 63U);
+      const int32_t shift     = upper_bit + 64 - format::Mantissa_Explicit_Bits - 3;
+
+      answer.mantissa = product.hi >> shift;
+      answer.power2   = private_float_to_decimal::floor_log2_pow10(q) + 63 + upper_bit - lz - format::Minimum_Exponent;
+
+      if (answer.power2 <= 0)
+      {
+        // Subnormal.
+        if ((-answer.power2 + 1) >= 64)
+        {
+          answer.mantissa = 0U;
+          answer.power2   = 0;
+          return answer;
+        }
+
+        answer.mantissa >>= -answer.power2 + 1;
+        answer.mantissa += (answer.mantissa & 1U);
+        answer.mantissa >>= 1U;
+        answer.power2 = (answer.mantissa < (uint64_t(1U) << format::Mantissa_Explicit_Bits)) ? 0 : 1;
+
+        return answer;
+      }
+
+      // Exactly half way between two values? Round to even.
+      if ((product.lo <= 1U) &&
+          (q >= format::Min_Exponent_Round_To_Even) &&
+          (q <= format::Max_Exponent_Round_To_Even) &&
+          ((answer.mantissa & 3U) == 1U))
+      {
+        if ((answer.mantissa << shift) == product.hi)
+        {
+          answer.mantissa &= ~uint64_t(1U);
+        }
+      }
+
+      answer.mantissa += (answer.mantissa & 1U);
+      answer.mantissa >>= 1U;
+
+      if (answer.mantissa >= (uint64_t(2U) << format::Mantissa_Explicit_Bits))
+      {
+        answer.mantissa = (uint64_t(1U) << format::Mantissa_Explicit_Bits);
+        ++answer.power2;
+      }
+
+      answer.mantissa &= ~(uint64_t(1U) << format::Mantissa_Explicit_Bits);
+
+      if (answer.power2 >= format::Infinite_Power)
+      {
+        answer.mantissa = 0U;
+        answer.power2   = format::Infinite_Power;
+      }
+
+      return answer;
+    }
+
+    //*************************************************************************
+    /// A fixed capacity unsigned integer, large enough to hold any decimal
+    /// significand that needs to be compared exactly with a binary value.
+    /// Only used when the leading 19 digits do not decide the rounding.
+    /// Also holds the exact integer significand of any double, for formatting.
+    //*************************************************************************
+    class big_integer
+    {
+    public:
+
+      static const size_t Capacity = 96U;
+
+      //*******************************
+      explicit big_integer(uint64_t value = 0U)
+        : size(0U)
+      {
+        while (value != 0U)
+        {
+          limbs[size++] = static_cast<uint32_t>(value);
+          value >>= 32U;
+        }
+      }
+
+      //*******************************
+      /// this = this * multiplier + addend
+      //*******************************
+      void multiply_add(uint32_t multiplier, uint32_t addend)
+      {
+        uint64_t carry = addend;
+
+        for (size_t i = 0U; i < size; ++i)
+        {
+          const uint64_t product = (static_cast<uint64_t>(limbs[i]) * multiplier) + carry;
+          limbs[i] = static_cast<uint32_t>(product);
+          carry    = product >> 32U;
+        }
+
+        if ((carry != 0U) && (size < Capacity))
+        {
+          limbs[size++] = static_cast<uint32_t>(carry);
+        }
+      }
+
+      //*******************************
+      /// this = this * 5^n
+      //*******************************
+      void multiply_pow5(uint32_t n)
+      {
+        // 5^13 is the largest power that fits in 32 bits.
+        static const uint32_t Pow5_13 = 1220703125UL;
+
+        while (n >= 13U)
+        {
+          multiply_add(Pow5_13, 0U);
+          n -= 13U;
+        }
+
+        uint32_t multiplier = 1U;
+
+        while (n-- != 0U)
+        {
+          multiplier *= 5U;
+        }
+
+        multiply_add(multiplier, 0U);
+      }
+
+      //*******************************
+      /// this = this * 2^n
+      //*******************************
+      void shift_left(uint32_t n)
+      {
+        if (size == 0U)
+        {
+          return;
+        }
+
+        const size_t limb_shift = n / 32U;
+        const size_t bit_shift  = n % 32U;
+
+        if ((size + limb_shift) >= Capacity)
+        {
+          return;
+        }
+
+        // Make room for the bits shifted out of the top limb.
+        limbs[size] = 0U;
+
+        for (size_t i = size + 1U; i-- != 0U;)
+        {
+          uint32_t limb = limbs[i] << bit_shift;
+
+          if ((bit_shift != 0U) && (i != 0U))
+          {
+            limb |= limbs[i - 1U] >> (32U - bit_shift);
+          }
+
+          limbs[i + limb_shift] = limb;
+        }
+
+        for (size_t i = 0U; i < limb_shift; ++i)
+        {
+          limbs[i] = 0U;
+        }
+
+        size += limb_shift + 1U;
+
+        while ((size != 0U) && (limbs[size - 1U] == 0U))
+        {
+          --size;
+        }
+      }
+
+      //*******************************
+      /// this = this / divisor
+      /// Returns the remainder.
+      //*******************************
+      uint32_t divide(uint32_t divisor)
+      {
+        uint64_t remainder = 0U;
+
+        for (size_t i = size; i-- != 0U;)
+        {
+          const uint64_t dividend = (remainder << 32U) | limbs[i];
+          limbs[i]  = static_cast<uint32_t>(dividend / divisor);
+          remainder = dividend % divisor;
+        }
+
+        while ((size != 0U) && (limbs[size - 1U] == 0U))
+        {
+          --size;
+        }
+
+        return static_cast<uint32_t>(remainder);
+      }
+
+      //*******************************
+      bool is_zero() const
+      {
+        return size == 0U;
+      }
+
+      //*******************************
+      /// Returns -1, 0 or 1 as lhs is less than, equal to, or greater than rhs.
+      //*******************************
+      static int compare(const big_integer& lhs, const big_integer& rhs)
+      {
+        if (lhs.size != rhs.size)
+        {
+          return (lhs.size < rhs.size) ? -1 : 1;
+        }
+
+        for (size_t i = lhs.size; i-- != 0U;)
+        {
+          if (lhs.limbs[i] != rhs.limbs[i])
+          {
+            return (lhs.limbs[i] < rhs.limbs[i]) ? -1 : 1;
+          }
+        }
+
+        return 0;
+      }
+
+    private:
+
+      uint32_t limbs[Capacity];
+      size_t   size;
+    };
+
+    //*************************************************************************
+    /// Compares digits * 10^exponent with the value half way between 'lower'
+    /// and the next representable value.
+    /// Returns -1, 0 or 1 as the decimal is less than, equal to, or greater
+    /// than the half way value.
+    //*************************************************************************
+    template <typename T>
+    int compare_with_half_way(big_integer digits, int32_t exponent, const adjusted_mantissa& lower)
+    {
+      typedef binary_format<T> format;
+
+      // lower = significand * 2^exponent2
+      uint64_t significand = lower.mantissa;
+      int32_t  exponent2   = format::Minimum_Exponent - format::Mantissa_Explicit_Bits;
+
+      if (lower.power2 == 0)
+      {
+        // Subnormal.
+        ++exponent2;
+      }
+      else
+      {
+        significand |= (uint64_t(1U) << format::Mantissa_Explicit_Bits);
+        exponent2   += lower.power2;
+      }
+
+      // half_way = (2 * significand + 1) * 2^(exponent2 - 1)
+      big_integer half_way((2U * significand) + 1U);
+
+      int32_t digits_exponent2   = 0;
+      int32_t half_way_exponent2 = exponent2 - 1;
+
+      if (exponent >= 0)
+      {
+        digits.multiply_pow5(static_cast<uint32_t>(exponent));
+        digits_exponent2 = exponent;
+      }
+      else
+      {
+        // Multiply both sides by 10^-exponent.
+        half_way.multiply_pow5(static_cast<uint32_t>(-exponent));
+        half_way_exponent2 -= exponent;
+      }
+
+      if (digits_exponent2 > half_way_exponent2)
+      {
+        digits.shift_left(static_cast<uint32_t>(digits_exponent2 - half_way_exponent2));
+      }
+      else
+      {
+        half_way.shift_left(static_cast<uint32_t>(half_way_exponent2 - digits_exponent2));
+      }
+
+      return big_integer::compare(digits, half_way);
+    }
+
+    //*************************************************************************
+    /// Returns true if the adjusted mantissa is infinity.
+    //*************************************************************************
+    template <typename T>
+    bool is_infinite(const adjusted_mantissa& am)
+    {
+      return (am.power2 == binary_format<T>::Infinite_Power);
+    }
+
+    //*************************************************************************
+    /// Builds the floating point value from the adjusted mantissa.
+    //*************************************************************************
+    template <typename T>
+    T to_float(const adjusted_mantissa& am, bool negative)
+    {
+      typedef binary_format<T>           format;
+      typedef typename format::bits_type bits_type;
+
+      ETL_STATIC_ASSERT(sizeof(T) == sizeof(bits_type), "Floating point type must be IEEE-754");
+
+      bits_type bits = static_cast<bits_type>(am.mantissa) |
+                       (static_cast<bits_type>(am.power2) << format::Mantissa_Explicit_Bits) |
+                       (static_cast<bits_type>(negative ? 1U : 0U) << format::Sign_Index);
+
+      T value;
+      memcpy(&value, &bits, sizeof(value));
+
+      return value;
+    }
+  }
+}
+
+#endif
+#endif
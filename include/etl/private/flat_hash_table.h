@@ -0,0 +1,1128 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_HASH_TABLE_INCLUDED
+#define ETL_FLAT_HASH_TABLE_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../iterator.h"
+#include "../utility.h"
+#include "../placement_new.h"
+#include "../power.h"
+#include "../debug_count.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// The open addressing table shared by etl::flat_hash_map and etl::flat_hash_set.
+//
+// Values are stored in a contiguous array of slots, indexed by a parallel array
+// of control bytes. A control byte is either 'Empty' or holds 7 bits of the
+// value's hash. Lookups use linear probing, comparing a group of control bytes
+// at a time, and only compare keys for matching control bytes.
+//
+// The group comparison uses SSE2 or NEON if available, otherwise a portable
+// word at a time (SWAR) implementation.
+// Define ETL_FLAT_HASH_NO_SIMD to always use the portable implementation.
+//
+// Erasing uses backward shift deletion, so no tombstones are left behind and
+// the table never degrades. Erasing may move other values in the table, so
+// invalidates pointers and references to them.
+//*****************************************************************************
+
+#if !defined(ETL_FLAT_HASH_NO_SIMD)
+  #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define ETL_FLAT_HASH_USING_SSE2 1
+    #include <emmintrin.h>
+  #elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && !defined(__ARM_BIG_ENDIAN) && ETL_USING_64BIT_TYPES
+    #define ETL_FLAT_HASH_USING_NEON 1
+    #include <arm_neon.h>
+  #endif
+#endif
+
+#if !defined(ETL_FLAT_HASH_USING_SSE2)
+  #define ETL_FLAT_HASH_USING_SSE2 0
+#endif
+
+#if !defined(ETL_FLAT_HASH_USING_NEON)
+  #define ETL_FLAT_HASH_USING_NEON 0
+#endif
+
+namespace etl
+{
+  namespace private_flat_hash
+  {
+    //*************************************************************************
+    /// Control byte values.
+    /// Occupied slots hold a 7 bit hash fragment, so never have the top bit set.
+    //*************************************************************************
+    struct control
+    {
+      enum
+      {
+        Empty = 0x80U
+      };
+    };
+
+    //*************************************************************************
+    /// A bitmask of the matching control bytes in a group.
+    /// Each control byte is represented by 2^SHIFT bits.
+    //*************************************************************************
+    template <typename TMask, int SHIFT>
+    class match_mask
+    {
+    public:
+
+      explicit match_mask(TMask mask_)
+        : mask(mask_)
+      {
+      }
+
+      bool any() const
+      {
+        return mask != 0U;
+      }
+
+      size_t lowest() const
+      {
+        return size_t(etl::count_trailing_zeros(mask)) >> SHIFT;
+      }
+
+      void clear_lowest()
+      {
+        mask &= TMask(mask - 1U);
+      }
+
+    private:
+
+      TMask mask;
+    };
+
+#if ETL_FLAT_HASH_USING_SSE2
+    //*************************************************************************
+    /// A group of 16 control bytes, compared with SSE2.
+    //*************************************************************************
+    class group
+    {
+    public:
+
+      typedef match_mask<uint32_t, 0> mask_type;
+
+      enum
+      {
+        Width = 16U
+      };
+
+      explicit group(const uint8_t* pcontrol)
+        : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pcontrol)))
+      {
+      }
+
+      mask_type match(uint8_t fragment) const
+      {
+        return mask_type(uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(fragment))))));
+      }
+
+      mask_type match_empty() const
+      {
+        return mask_type(uint32_t(_mm_movemask_epi8(bytes)));
+      }
+
+    private:
+
+      __m128i bytes;
+    };
+
+#elif ETL_FLAT_HASH_USING_NEON
+    //*************************************************************************
+    /// A group of 8 control bytes, compared with NEON.
+    //*************************************************************************
+    class group
+    {
+    public:
+
+      typedef match_mask<uint64_t, 3> mask_type;
+
+      enum
+      {
+        Width = 8U
+      };
+
+      explicit group(const uint8_t* pcontrol)
+        : bytes(vld1_u8(pcontrol))
+      {
+      }
+
+      mask_type match(uint8_t fragment) const
+      {
+        const uint8x8_t equal = vceq_u8(bytes, vdup_n_u8(fragment));
+
+        return mask_type(vget_lane_u64(vreinterpret_u64_u8(equal), 0) & UINT64_C(0x8080808080808080));
+      }
+
+      mask_type match_empty() const
+      {
+        return mask_type(vget_lane_u64(vreinterpret_u64_u8(bytes), 0) & UINT64_C(0x8080808080808080));
+      }
+
+    private:
+
+      uint8x8_t bytes;
+    };
+
+#else
+    //*************************************************************************
+    /// A group of control bytes, compared a word at a time.
+    //*************************************************************************
+    class group
+    {
+    public:
+
+  #if ETL_USING_64BIT_TYPES
+      typedef uint64_t word_type;
+  #else
+      typedef uint32_t word_type;
+  #endif
+
+      typedef match_mask<word_type, 3> mask_type;
+
+      enum
+      {
+        Width = sizeof(word_type)
+      };
+
+      explicit group(const uint8_t* pcontrol)
+        : bytes(0U)
+      {
+        for (size_t i = 0U; i < Width; ++i)
+        {
+          bytes |= word_type(pcontrol[i]) << (8U * i);
+        }
+      }
+
+      //*******************************
+      /// May report false positives for bytes following a match,
+      /// but these are rejected by the key comparison.
+      //*******************************
+      mask_type match(uint8_t fragment) const
+      {
+        const word_type x = bytes ^ word_type(Lsbs * fragment);
+
+        return mask_type(word_type((x - Lsbs) & ~x & Msbs));
+      }
+
+      mask_type match_empty() const
+      {
+        return mask_type(word_type(bytes & Msbs));
+      }
+
+    private:
+
+      static ETL_CONSTANT word_type Lsbs = word_type(~word_type(0U)) / 0xFFU;
+      static ETL_CONSTANT word_type Msbs = word_type(Lsbs << 7U);
+
+      word_type bytes;
+    };
+#endif
+
+    //*************************************************************************
+    /// Gets the key of a map value.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct key_of_pair
+    {
+      const TKey& operator()(const TValue& value) const
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// Gets the key of a set value.
+    //*************************************************************************
+    template <typename TKey>
+    struct key_of_key
+    {
+      const TKey& operator()(const TKey& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// The multiplier used to spread the hash over the table.
+    //*************************************************************************
+    template <size_t SIZE = sizeof(size_t)>
+    struct hash_multiplier;
+
+    template <>
+    struct hash_multiplier<2U>
+    {
+      static size_t value() { return size_t(0x9E37U); }
+    };
+
+    template <>
+    struct hash_multiplier<4U>
+    {
+      static size_t value() { return size_t(0x9E3779B9UL); }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct hash_multiplier<8U>
+    {
+      static size_t value() { return size_t(0x9E3779B97F4A7C15ULL); }
+    };
+#endif
+
+    //*************************************************************************
+    /// Calculates the number of slots for a maximum number of values.
+    /// Keeps the load factor at or below 7/8 and is always a power of 2.
+    //*************************************************************************
+    template <size_t MAX_SIZE>
+    struct slot_count
+    {
+      static ETL_CONSTANT size_t value = etl::power_of_2_round_up<MAX_SIZE + (MAX_SIZE / 7U) + 1U>::value;
+    };
+
+    //*************************************************************************
+    /// The open addressing hash table.
+    ///\tparam TValue    The stored value type.
+    ///\tparam TKey      The key type.
+    ///\tparam TKeyOf    Functor that returns the key of a value.
+    ///\tparam THash     The key hash functor.
+    ///\tparam TKeyEqual The key equality functor.
+    //*************************************************************************
+    template <typename TValue, typename TKey, typename TKeyOf, typename THash, typename TKeyEqual>
+    class table
+    {
+    public:
+
+      typedef TValue            value_type;
+      typedef TKey              key_type;
+      typedef THash             hasher;
+      typedef TKeyEqual         key_equal;
+      typedef value_type&       reference;
+      typedef const value_type& const_reference;
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+      typedef size_t            size_type;
+
+      typedef const TKey& key_parameter_t;
+
+      //*********************************************************************
+      /// The number of control bytes read at a time.
+      //*********************************************************************
+      static ETL_CONSTANT size_t Group_Width = group::Width;
+
+      //*********************************************************************
+      /// Returns the size of the control byte buffer needed for a slot count.
+      //*********************************************************************
+      static ETL_CONSTEXPR size_t control_size(size_t slot_count)
+      {
+        return slot_count + Group_Width - 1U;
+      }
+
+      //*********************************************************************
+      /// Returns the maximum number of values that can be stored for a slot count.
+      //*********************************************************************
+      static ETL_CONSTEXPR size_t max_size_for(size_t slot_count)
+      {
+        return (slot_count < 8U) ? ((slot_count == 0U) ? 0U : slot_count - 1U) : slot_count - (slot_count / 8U);
+      }
+
+      //*********************************************************************
+      class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, TValue>
+      {
+      public:
+
+        friend class table;
+        friend class const_iterator;
+
+        //*********************************
+        iterator()
+          : ptable(ETL_NULLPTR)
+          , index(0U)
+        {
+        }
+
+        //*********************************
+        iterator& operator ++()
+        {
+          index = ptable->next_occupied(index);
+          return *this;
+        }
+
+        //*********************************
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          index = ptable->next_occupied(index);
+          return temp;
+        }
+
+        //*********************************
+        reference operator *() const
+        {
+          return ptable->pslots[index];
+        }
+
+        //*********************************
+        pointer operator ->() const
+        {
+          return &(ptable->pslots[index]);
+        }
+
+        //*********************************
+        friend bool operator == (const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.index == rhs.index;
+        }
+
+        //*********************************
+        friend bool operator != (const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        iterator(table* ptable_, size_t index_)
+          : ptable(ptable_)
+          , index(index_)
+        {
+        }
+
+        table* ptable;
+        size_t index;
+      };
+
+      //*********************************************************************
+      class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const TValue>
+      {
+      public:
+
+        friend class table;
+
+        //*********************************
+        const_iterator()
+          : ptable(ETL_NULLPTR)
+          , index(0U)
+        {
+        }
+
+        //*********************************
+        const_iterator(const typename table::iterator& other)
+          : ptable(other.ptable)
+          , index(other.index)
+        {
+        }
+
+        //*********************************
+        const_iterator& operator ++()
+        {
+          index = ptable->next_occupied(index);
+          return *this;
+        }
+
+        //*********************************
+        const_iterator operator ++(int)
+        {
+          const_iterator temp(*this);
+          index = ptable->next_occupied(index);
+          return temp;
+        }
+
+        //*********************************
+        const_reference operator *() const
+        {
+          return ptable->pslots[index];
+        }
+
+        //*********************************
+        const_pointer operator ->() const
+        {
+          return &(ptable->pslots[index]);
+        }
+
+        //*********************************
+        friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return lhs.index == rhs.index;
+        }
+
+        //*********************************
+        friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        const_iterator(const table* ptable_, size_t index_)
+          : ptable(ptable_)
+          , index(index_)
+        {
+        }
+
+        const table* ptable;
+        size_t       index;
+      };
+
+      typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of the table.
+      //*********************************************************************
+      iterator begin()
+      {
+        return iterator(this, first_occupied());
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the table.
+      //*********************************************************************
+      const_iterator begin() const
+      {
+        return const_iterator(this, first_occupied());
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the table.
+      //*********************************************************************
+      const_iterator cbegin() const
+      {
+        return const_iterator(this, first_occupied());
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of the table.
+      //*********************************************************************
+      iterator end()
+      {
+        return iterator(this, number_of_slots);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the table.
+      //*********************************************************************
+      const_iterator end() const
+      {
+        return const_iterator(this, number_of_slots);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the table.
+      //*********************************************************************
+      const_iterator cend() const
+      {
+        return const_iterator(this, number_of_slots);
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      iterator find(key_parameter_t key)
+      {
+        return iterator(this, find_index(key));
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      const_iterator find(key_parameter_t key) const
+      {
+        return const_iterator(this, find_index(key));
+      }
+
+      //*********************************************************************
+      /// Counts an element.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      size_t count(key_parameter_t key) const
+      {
+        return (find_index(key) == number_of_slots) ? 0U : 1U;
+      }
+
+      //*********************************************************************
+      /// Check if the table contains the key.
+      //*********************************************************************
+      bool contains(key_parameter_t key) const
+      {
+        return find_index(key) != number_of_slots;
+      }
+
+      //*********************************************************************
+      /// Returns a range containing all elements with the key.
+      ///\param key The key to search for.
+      ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+      //*********************************************************************
+      ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+      {
+        iterator f = find(key);
+        iterator l = f;
+
+        if (l != end())
+        {
+          ++l;
+        }
+
+        return ETL_OR_STD::pair<iterator, iterator>(f, l);
+      }
+
+      //*********************************************************************
+      /// Returns a range containing all elements with the key.
+      ///\param key The key to search for.
+      ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+      //*********************************************************************
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+      {
+        const_iterator f = find(key);
+        const_iterator l = f;
+
+        if (l != end())
+        {
+          ++l;
+        }
+
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+      }
+
+      //*********************************************************************
+      /// Erases an element.
+      ///\param key The key to erase.
+      ///\return The number of elements erased. 0 or 1.
+      //*********************************************************************
+      size_t erase(key_parameter_t key)
+      {
+        const size_t index = find_index(key);
+
+        if (index == number_of_slots)
+        {
+          return 0U;
+        }
+
+        erase_slots(index, 1U);
+
+        return 1U;
+      }
+
+      //*********************************************************************
+      /// Erases an element.
+      /// Other elements may be moved into the erased slot, so only the
+      /// returned iterator remains valid.
+      ///\param ielement Iterator to the element.
+      ///\return An iterator to the element following the erased one.
+      //*********************************************************************
+      iterator erase(const_iterator ielement)
+      {
+        return erase(ielement, etl::next(ielement));
+      }
+
+      //*********************************************************************
+      /// Erases a range of elements.
+      /// Other elements may be moved into the erased slots, so only the
+      /// returned iterator remains valid.
+      ///\param first Iterator to the first element.
+      ///\param last  Iterator to the last element.
+      ///\return An iterator to the element following the erased ones.
+      //*********************************************************************
+      iterator erase(const_iterator first, const_iterator last)
+      {
+        if (first == last)
+        {
+          return iterator(this, first.index);
+        }
+
+        const size_t first_index = first.index;
+        const size_t last_index  = (last.index == number_of_slots) ? origin : last.index;
+
+        erase_slots(first_index, (last_index - first_index) & mask);
+
+        // Elements following the range may have moved in to it.
+        if (is_occupied(first_index))
+        {
+          return iterator(this, first_index);
+        }
+        else
+        {
+          return iterator(this, next_occupied(first_index));
+        }
+      }
+
+      //*********************************************************************
+      /// Clears the table.
+      //*********************************************************************
+      void clear()
+      {
+        initialise();
+      }
+
+      //*********************************************************************
+      /// Gets the size of the table.
+      //*********************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //*********************************************************************
+      /// Gets the maximum possible size of the table.
+      //*********************************************************************
+      size_type max_size() const
+      {
+        return maximum_size;
+      }
+
+      //*********************************************************************
+      /// Gets the maximum possible size of the table.
+      //*********************************************************************
+      size_type capacity() const
+      {
+        return maximum_size;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the table is empty.
+      //*********************************************************************
+      bool empty() const
+      {
+        return current_size == 0U;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the table is full.
+      //*********************************************************************
+      bool full() const
+      {
+        return current_size == maximum_size;
+      }
+
+      //*********************************************************************
+      /// Returns the remaining capacity.
+      //*********************************************************************
+      size_t available() const
+      {
+        return maximum_size - current_size;
+      }
+
+      //*********************************************************************
+      /// Returns the number of slots.
+      //*********************************************************************
+      size_type bucket_count() const
+      {
+        return number_of_slots;
+      }
+
+      //*********************************************************************
+      /// Returns the number of slots.
+      //*********************************************************************
+      size_type max_bucket_count() const
+      {
+        return number_of_slots;
+      }
+
+      //*********************************************************************
+      /// Returns the load factor = size / bucket_count.
+      //*********************************************************************
+      float load_factor() const
+      {
+        return static_cast<float>(size()) / static_cast<float>(bucket_count());
+      }
+
+      //*********************************************************************
+      /// Returns the function that hashes the keys.
+      //*********************************************************************
+      hasher hash_function() const
+      {
+        return key_hash_function;
+      }
+
+      //*********************************************************************
+      /// Returns the function that compares the keys.
+      //*********************************************************************
+      key_equal key_eq() const
+      {
+        return key_equal_function;
+      }
+
+    protected:
+
+      //*********************************************************************
+      /// The result of a search for an insert position.
+      //*********************************************************************
+      struct insert_position
+      {
+        size_t  index;
+        uint8_t fragment;
+        bool    exists;
+      };
+
+      //*********************************************************************
+      /// Constructor.
+      //*********************************************************************
+      table(TValue* pslots_, uint8_t* pcontrol_, size_t number_of_slots_, size_t maximum_size_, hasher key_hash_function_, key_equal key_equal_function_)
+        : pslots(pslots_)
+        , pcontrol(pcontrol_)
+        , number_of_slots(number_of_slots_)
+        , mask(number_of_slots_ - 1U)
+        , shift(size_t(etl::integral_limits<size_t>::bits) - size_t(etl::count_trailing_zeros(number_of_slots_)))
+        , maximum_size(maximum_size_)
+        , current_size(0U)
+        , origin(0U)
+        , key_hash_function(key_hash_function_)
+        , key_equal_function(key_equal_function_)
+      {
+        reset_control();
+      }
+
+      //*********************************************************************
+      /// Destroys all of the values and empties the slots.
+      //*********************************************************************
+      void initialise()
+      {
+        if (!empty())
+        {
+          for (size_t i = 0U; i < number_of_slots; ++i)
+          {
+            if (is_occupied(i))
+            {
+              pslots[i].~value_type();
+              ETL_DECREMENT_DEBUG_COUNT
+            }
+          }
+        }
+
+        reset_control();
+      }
+
+      //*********************************************************************
+      /// Finds the slot for the key, or the slot to insert it in.
+      //*********************************************************************
+      insert_position find_insert_position(key_parameter_t key) const
+      {
+        const size_t hash = spread(key_hash_function(key));
+
+        insert_position position;
+        position.fragment = fragment_of(hash);
+        position.index    = home_of(hash);
+        position.exists   = false;
+
+        while (true)
+        {
+          const group g(pcontrol + position.index);
+
+          typename group::mask_type empties = g.match_empty();
+          typename group::mask_type matches = g.match(position.fragment);
+
+          // Stop at the first empty slot.
+          const size_t limit = empties.any() ? empties.lowest() : size_t(Group_Width);
+
+          while (matches.any() && (matches.lowest() < limit))
+          {
+            const size_t index = (position.index + matches.lowest()) & mask;
+
+            if (key_equal_function(TKeyOf()(pslots[index]), key))
+            {
+              position.index  = index;
+              position.exists = true;
+
+              return position;
+            }
+
+            matches.clear_lowest();
+          }
+
+          if (empties.any())
+          {
+            position.index = (position.index + limit) & mask;
+
+            return position;
+          }
+
+          position.index = (position.index + Group_Width) & mask;
+        }
+      }
+
+      //*********************************************************************
+      /// Marks a slot as occupied, after a value has been constructed in it.
+      //*********************************************************************
+      iterator occupy(const insert_position& position)
+      {
+        set_control(position.index, position.fragment);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT
+
+        // Keep an empty slot as the start of iteration.
+        if (position.index == origin)
+        {
+          origin = find_empty((origin + 1U) & mask);
+        }
+
+        return iterator(this, position.index);
+      }
+
+      //*********************************************************************
+      /// Gets the address of a slot.
+      //*********************************************************************
+      TValue* slot_address(size_t index)
+      {
+        return pslots + index;
+      }
+
+      //*********************************************************************
+      /// Gets an iterator to a slot.
+      //*********************************************************************
+      iterator to_iterator(size_t index)
+      {
+        return iterator(this, index);
+      }
+
+      // Disable copy construction.
+      table(const table&);
+
+      TValue*  pslots;
+      uint8_t* pcontrol;
+
+    private:
+
+      //*********************************************************************
+      /// Returns the index of the key, or the number of slots if not found.
+      //*********************************************************************
+      size_t find_index(key_parameter_t key) const
+      {
+        insert_position position = find_insert_position(key);
+
+        return position.exists ? position.index : number_of_slots;
+      }
+
+      //*********************************************************************
+      /// Spreads the hash bits, so that the home slot and fragment both depend on all of them.
+      //*********************************************************************
+      static size_t spread(size_t hash)
+      {
+        return hash * hash_multiplier<>::value();
+      }
+
+      //*********************************************************************
+      /// The home slot is the top bits of the spread hash.
+      //*********************************************************************
+      size_t home_of(size_t hash) const
+      {
+        return hash >> shift;
+      }
+
+      //*********************************************************************
+      /// The fragment is the 7 bits below the home slot bits.
+      //*********************************************************************
+      uint8_t fragment_of(size_t hash) const
+      {
+        return (shift >= 7U) ? uint8_t((hash >> (shift - 7U)) & 0x7FU) : uint8_t(hash & 0x7FU);
+      }
+
+      //*********************************************************************
+      bool is_occupied(size_t index) const
+      {
+        return pcontrol[index] != uint8_t(control::Empty);
+      }
+
+      //*********************************************************************
+      /// Sets a control byte, and any copies of it past the end of the slots.
+      //*********************************************************************
+      void set_control(size_t index, uint8_t value)
+      {
+        pcontrol[index] = value;
+
+        for (size_t clone = index + number_of_slots; clone < control_size(number_of_slots); clone += number_of_slots)
+        {
+          pcontrol[clone] = value;
+        }
+      }
+
+      //*********************************************************************
+      void reset_control()
+      {
+        for (size_t i = 0U; i < control_size(number_of_slots); ++i)
+        {
+          pcontrol[i] = uint8_t(control::Empty);
+        }
+
+        current_size = 0U;
+        origin       = 0U;
+      }
+
+      //*********************************************************************
+      /// Finds the first empty slot, starting at 'index'.
+      //*********************************************************************
+      size_t find_empty(size_t index) const
+      {
+        while (true)
+        {
+          const typename group::mask_type empties = group(pcontrol + index).match_empty();
+
+          if (empties.any())
+          {
+            return (index + empties.lowest()) & mask;
+          }
+
+          index = (index + Group_Width) & mask;
+        }
+      }
+
+      //*********************************************************************
+      /// Iteration runs around the slots, starting after an empty slot.
+      /// As values never move across an empty slot, erasing while iterating
+      /// never moves an unvisited value to a visited slot.
+      //*********************************************************************
+      size_t first_occupied() const
+      {
+        return empty() ? number_of_slots : next_occupied_after(origin);
+      }
+
+      //*********************************************************************
+      size_t next_occupied(size_t index) const
+      {
+        return next_occupied_after(index);
+      }
+
+      //*********************************************************************
+      size_t next_occupied_after(size_t index) const
+      {
+        index = (index + 1U) & mask;
+
+        while (index != origin)
+        {
+          if (is_occupied(index))
+          {
+            return index;
+          }
+
+          index = (index + 1U) & mask;
+        }
+
+        return number_of_slots;
+      }
+
+      //*********************************************************************
+      /// Erases 'n' consecutive occupied slots starting at 'index', then moves
+      /// back any values following them that can now be closer to their home slot.
+      //*********************************************************************
+      void erase_slots(size_t index, size_t n)
+      {
+        size_t i = index;
+
+        for (size_t remaining = n; remaining != 0U; --remaining)
+        {
+          if (is_occupied(i))
+          {
+            pslots[i].~value_type();
+            set_control(i, uint8_t(control::Empty));
+            --current_size;
+            ETL_DECREMENT_DEBUG_COUNT
+          }
+
+          i = (i + 1U) & mask;
+        }
+
+        // Shift back the values in the rest of the run.
+        while (is_occupied(i))
+        {
+          const size_t hash = spread(key_hash_function(TKeyOf()(pslots[i])));
+          const size_t home = home_of(hash);
+
+          // Is there a free slot between home and here?
+          const size_t free_slot = find_empty(home);
+
+          if (((free_slot - home) & mask) < ((i - home) & mask))
+          {
+#if ETL_USING_CPP11
+            ::new (pslots + free_slot) value_type(etl::move(pslots[i]));
+#else
+            ::new (pslots + free_slot) value_type(pslots[i]);
+#endif
+            pslots[i].~value_type();
+
+            set_control(free_slot, pcontrol[i]);
+            set_control(i, uint8_t(control::Empty));
+          }
+
+          i = (i + 1U) & mask;
+        }
+      }
+
+      /// The number of slots. A power of 2.
+      const size_t number_of_slots;
+
+      /// The mask for slot indexes.
+      const size_t mask;
+
+      /// The shift to get the home slot from the spread hash.
+      const size_t shift;
+
+      /// The maximum number of values.
+      const size_t maximum_size;
+
+      /// The number of values.
+      size_t current_size;
+
+      /// An empty slot that iteration starts after.
+      size_t origin;
+
+      /// For library debugging purposes only.
+      ETL_DECLARE_DEBUG_COUNT
+
+    protected:
+
+      /// The function that creates the hashes.
+      hasher key_hash_function;
+
+      /// The function that compares the keys for equality.
+      key_equal key_equal_function;
+
+      //*********************************************************************
+      /// Destructor.
+      //*********************************************************************
+      ~table()
+      {
+      }
+    };
+  }
+}
+
+#endif
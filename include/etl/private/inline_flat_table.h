@@ -0,0 +1,1323 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INLINE_FLAT_TABLE_INCLUDED
+#define ETL_INLINE_FLAT_TABLE_INCLUDED
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../iterator.h"
+#include "../utility.h"
+#include "../span.h"
+#include "../placement_new.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+// The tables used by etl::inline_flat_map and etl::inline_flat_set.
+// The keys are held in order in a contiguous array, and the mapped values in a
+// second array at the same indexes, so that a search only touches keys.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_inline_flat
+  {
+    //*************************************************************************
+    /// Returns the index of the first key that is not less than 'key'.
+    /// The range is halved on every pass with a selection that the compiler
+    /// turns in to a conditional move, so the number of passes only depends
+    /// on the length and there are no mispredicted branches.
+    //*************************************************************************
+    template <typename TKey, typename TCompare>
+    size_t lower_bound_index(const TKey* keys, size_t length, const TKey& key, const TCompare& compare)
+    {
+      if (length == 0U)
+      {
+        return 0U;
+      }
+
+      const TKey* base = keys;
+
+      while (length > 1U)
+      {
+        const size_t half = length / 2U;
+
+        base    = compare(base[half], key) ? base + half : base;
+        length -= half;
+      }
+
+      return size_t(base - keys) + (compare(*base, key) ? 1U : 0U);
+    }
+
+    //*************************************************************************
+    /// Returns the index of the first key that is greater than 'key'.
+    //*************************************************************************
+    template <typename TKey, typename TCompare>
+    size_t upper_bound_index(const TKey* keys, size_t length, const TKey& key, const TCompare& compare)
+    {
+      if (length == 0U)
+      {
+        return 0U;
+      }
+
+      const TKey* base = keys;
+
+      while (length > 1U)
+      {
+        const size_t half = length / 2U;
+
+        base    = compare(key, base[half]) ? base : base + half;
+        length -= half;
+      }
+
+      return size_t(base - keys) + (compare(key, *base) ? 0U : 1U);
+    }
+
+    //*************************************************************************
+    /// Opens a gap at 'index' in an array of 'size' constructed elements.
+    /// Returns true if the element at 'index' is constructed (moved from) and
+    /// must be assigned, or false if it must be constructed.
+    //*************************************************************************
+    template <typename T>
+    bool open_gap(T* p, size_t size, size_t index)
+    {
+      if (index == size)
+      {
+        return false;
+      }
+
+      ::new (p + size) T(ETL_MOVE(p[size - 1U]));
+      etl::move_backward(p + index, p + size - 1U, p + size);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Closes a gap of 'count' elements at 'index' in an array of 'size'
+    /// constructed elements.
+    //*************************************************************************
+    template <typename T>
+    void close_gap(T* p, size_t size, size_t index, size_t count)
+    {
+      etl::move(p + index + count, p + size, p + index);
+
+      for (size_t i = size - count; i < size; ++i)
+      {
+        p[i].~T();
+      }
+    }
+
+    //*************************************************************************
+    /// Destroys 'size' elements.
+    //*************************************************************************
+    template <typename T>
+    void destroy_all(T* p, size_t size)
+    {
+      for (size_t i = 0U; i < size; ++i)
+      {
+        p[i].~T();
+      }
+    }
+
+    //*************************************************************************
+    /// The reference returned by the map iterators.
+    /// Refers to a key and the mapped value at the same index.
+    //*************************************************************************
+    template <typename TKey, typename TMapped>
+    struct pair_reference
+    {
+      typedef TKey    first_type;
+      typedef TMapped second_type;
+
+      pair_reference(const TKey& first_, TMapped& second_)
+        : first(first_)
+        , second(second_)
+      {
+      }
+
+      pair_reference(const pair_reference& other)
+        : first(other.first)
+        , second(other.second)
+      {
+      }
+
+      template <typename U1, typename U2>
+      operator ETL_OR_STD::pair<U1, U2>() const
+      {
+        return ETL_OR_STD::pair<U1, U2>(first, second);
+      }
+
+      const TKey& first;
+      TMapped&    second;
+
+    private:
+
+      pair_reference& operator =(const pair_reference&);
+    };
+
+    //*************************************************************************
+    /// The pointer returned by the map iterators.
+    //*************************************************************************
+    template <typename TReference>
+    struct arrow_proxy
+    {
+      explicit arrow_proxy(const TReference& reference_)
+        : reference(reference_)
+      {
+      }
+
+      const TReference* operator ->() const
+      {
+        return &reference;
+      }
+
+      TReference reference;
+    };
+
+    //*************************************************************************
+    /// The map iterator.
+    /// Holds a pointer in to each array.
+    ///\tparam TElement TMapped or const TMapped.
+    //*************************************************************************
+    template <typename TKey, typename TMapped, typename TElement>
+    class map_iterator
+    {
+    public:
+
+      typedef ETL_OR_STD::random_access_iterator_tag    iterator_category;
+      typedef ETL_OR_STD::pair<TKey, TMapped>           value_type;
+      typedef ptrdiff_t                                 difference_type;
+      typedef etl::private_inline_flat::pair_reference<TKey, TElement> reference;
+      typedef etl::private_inline_flat::arrow_proxy<reference>         pointer;
+
+      //*********************************
+      map_iterator()
+        : pkey(ETL_NULLPTR)
+        , pmapped(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      map_iterator(const TKey* pkey_, TElement* pmapped_)
+        : pkey(pkey_)
+        , pmapped(pmapped_)
+      {
+      }
+
+      //*********************************
+      /// Copy constructor, or conversion from a mutable iterator.
+      //*********************************
+      map_iterator(const map_iterator<TKey, TMapped, TMapped>& other)
+        : pkey(other.key_pointer())
+        , pmapped(other.mapped_pointer())
+      {
+      }
+
+      //*********************************
+      /// Copy assignment, or assignment from a mutable iterator.
+      //*********************************
+      map_iterator& operator =(const map_iterator<TKey, TMapped, TMapped>& other)
+      {
+        pkey    = other.key_pointer();
+        pmapped = other.mapped_pointer();
+        return *this;
+      }
+
+      //*********************************
+      reference operator *() const
+      {
+        return reference(*pkey, *pmapped);
+      }
+
+      //*********************************
+      pointer operator ->() const
+      {
+        return pointer(reference(*pkey, *pmapped));
+      }
+
+      //*********************************
+      reference operator [](difference_type n) const
+      {
+        return reference(pkey[n], pmapped[n]);
+      }
+
+      //*********************************
+      map_iterator& operator ++()
+      {
+        ++pkey;
+        ++pmapped;
+        return *this;
+      }
+
+      //*********************************
+      map_iterator operator ++(int)
+      {
+        map_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      //*********************************
+      map_iterator& operator --()
+      {
+        --pkey;
+        --pmapped;
+        return *this;
+      }
+
+      //*********************************
+      map_iterator operator --(int)
+      {
+        map_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      //*********************************
+      map_iterator& operator +=(difference_type n)
+      {
+        pkey    += n;
+        pmapped += n;
+        return *this;
+      }
+
+      //*********************************
+      map_iterator& operator -=(difference_type n)
+      {
+        pkey    -= n;
+        pmapped -= n;
+        return *this;
+      }
+
+      //*********************************
+      friend map_iterator operator +(map_iterator lhs, difference_type n)
+      {
+        return lhs += n;
+      }
+
+      //*********************************
+      friend map_iterator operator +(difference_type n, map_iterator rhs)
+      {
+        return rhs += n;
+      }
+
+      //*********************************
+      friend map_iterator operator -(map_iterator lhs, difference_type n)
+      {
+        return lhs -= n;
+      }
+
+      //*********************************
+      friend difference_type operator -(const map_iterator& lhs, const map_iterator& rhs)
+      {
+        return lhs.pkey - rhs.pkey;
+      }
+
+      //*********************************
+      friend bool operator ==(const map_iterator& lhs, const map_iterator& rhs)
+      {
+        return lhs.pkey == rhs.pkey;
+      }
+
+      //*********************************
+      friend bool operator !=(const map_iterator& lhs, const map_iterator& rhs)
+      {
+        return lhs.pkey != rhs.pkey;
+      }
+
+      //*********************************
+      friend bool operator <(const map_iterator& lhs, const map_iterator& rhs)
+      {
+        return lhs.pkey < rhs.pkey;
+      }
+
+      //*********************************
+      friend bool operator >(const map_iterator& lhs, const map_iterator& rhs)
+      {
+        return lhs.pkey > rhs.pkey;
+      }
+
+      //*********************************
+      friend bool operator <=(const map_iterator& lhs, const map_iterator& rhs)
+      {
+        return lhs.pkey <= rhs.pkey;
+      }
+
+      //*********************************
+      friend bool operator >=(const map_iterator& lhs, const map_iterator& rhs)
+      {
+        return lhs.pkey >= rhs.pkey;
+      }
+
+      //*********************************
+      const TKey* key_pointer() const
+      {
+        return pkey;
+      }
+
+      //*********************************
+      TElement* mapped_pointer() const
+      {
+        return pmapped;
+      }
+
+    private:
+
+      const TKey* pkey;
+      TElement*   pmapped;
+    };
+
+    //*************************************************************************
+    /// The table for the maps.
+    /// Holds the keys and the mapped values in two parallel arrays.
+    //*************************************************************************
+    template <typename TKey, typename TMapped, typename TKeyCompare>
+    class map_table
+    {
+    public:
+
+      typedef ETL_OR_STD::pair<TKey, TMapped> value_type;
+      typedef TKey                            key_type;
+      typedef TMapped                         mapped_type;
+      typedef TKeyCompare                     key_compare;
+      typedef size_t                          size_type;
+      typedef ptrdiff_t                       difference_type;
+
+      typedef etl::private_inline_flat::pair_reference<TKey, TMapped>       reference;
+      typedef etl::private_inline_flat::pair_reference<TKey, const TMapped> const_reference;
+
+      typedef etl::private_inline_flat::map_iterator<TKey, TMapped, TMapped>       iterator;
+      typedef etl::private_inline_flat::map_iterator<TKey, TMapped, const TMapped> const_iterator;
+      typedef ETL_OR_STD::reverse_iterator<iterator>                               reverse_iterator;
+      typedef ETL_OR_STD::reverse_iterator<const_iterator>                         const_reverse_iterator;
+
+      typedef const TKey& key_parameter_t;
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of the map.
+      //*********************************************************************
+      iterator begin()
+      {
+        return iterator(pkeys, pmapped);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the map.
+      //*********************************************************************
+      const_iterator begin() const
+      {
+        return const_iterator(pkeys, pmapped);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the map.
+      //*********************************************************************
+      const_iterator cbegin() const
+      {
+        return const_iterator(pkeys, pmapped);
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of the map.
+      //*********************************************************************
+      iterator end()
+      {
+        return iterator(pkeys + current_size, pmapped + current_size);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the map.
+      //*********************************************************************
+      const_iterator end() const
+      {
+        return const_iterator(pkeys + current_size, pmapped + current_size);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the map.
+      //*********************************************************************
+      const_iterator cend() const
+      {
+        return const_iterator(pkeys + current_size, pmapped + current_size);
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse beginning of the map.
+      //*********************************************************************
+      reverse_iterator rbegin()
+      {
+        return reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse beginning of the map.
+      //*********************************************************************
+      const_reverse_iterator rbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse beginning of the map.
+      //*********************************************************************
+      const_reverse_iterator crbegin() const
+      {
+        return const_reverse_iterator(cend());
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse end of the map.
+      //*********************************************************************
+      reverse_iterator rend()
+      {
+        return reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse end of the map.
+      //*********************************************************************
+      const_reverse_iterator rend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse end of the map.
+      //*********************************************************************
+      const_reverse_iterator crend() const
+      {
+        return const_reverse_iterator(cbegin());
+      }
+
+      //*********************************************************************
+      /// The keys, in order.
+      //*********************************************************************
+      etl::span<const TKey> keys() const
+      {
+        return etl::span<const TKey>(pkeys, current_size);
+      }
+
+      //*********************************************************************
+      /// The mapped values, in key order.
+      //*********************************************************************
+      etl::span<TMapped> values()
+      {
+        return etl::span<TMapped>(pmapped, current_size);
+      }
+
+      //*********************************************************************
+      /// The mapped values, in key order.
+      //*********************************************************************
+      etl::span<const TMapped> values() const
+      {
+        return etl::span<const TMapped>(pmapped, current_size);
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element, or end() if not found.
+      //*********************************************************************
+      iterator find(key_parameter_t key)
+      {
+        return make_iterator(find_index(key));
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element, or end() if not found.
+      //*********************************************************************
+      const_iterator find(key_parameter_t key) const
+      {
+        return make_iterator(find_index(key));
+      }
+
+      //*********************************************************************
+      /// Checks if the map contains an element with the key.
+      //*********************************************************************
+      bool contains(key_parameter_t key) const
+      {
+        return find_index(key) != current_size;
+      }
+
+      //*********************************************************************
+      /// Counts the number of elements with the key.
+      //*********************************************************************
+      size_t count(key_parameter_t key) const
+      {
+        return upper_bound_index(key) - lower_bound_index(key);
+      }
+
+      //*********************************************************************
+      /// Finds the lower bound of a key.
+      //*********************************************************************
+      iterator lower_bound(key_parameter_t key)
+      {
+        return make_iterator(lower_bound_index(key));
+      }
+
+      //*********************************************************************
+      /// Finds the lower bound of a key.
+      //*********************************************************************
+      const_iterator lower_bound(key_parameter_t key) const
+      {
+        return make_iterator(lower_bound_index(key));
+      }
+
+      //*********************************************************************
+      /// Finds the upper bound of a key.
+      //*********************************************************************
+      iterator upper_bound(key_parameter_t key)
+      {
+        return make_iterator(upper_bound_index(key));
+      }
+
+      //*********************************************************************
+      /// Finds the upper bound of a key.
+      //*********************************************************************
+      const_iterator upper_bound(key_parameter_t key) const
+      {
+        return make_iterator(upper_bound_index(key));
+      }
+
+      //*********************************************************************
+      /// Finds the range of equal elements of a key.
+      //*********************************************************************
+      ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+      {
+        return ETL_OR_STD::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+      }
+
+      //*********************************************************************
+      /// Finds the range of equal elements of a key.
+      //*********************************************************************
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+      {
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+      }
+
+      //*********************************************************************
+      /// Erases the elements with the key.
+      ///\return The number of elements erased.
+      //*********************************************************************
+      size_t erase(key_parameter_t key)
+      {
+        const size_t first = lower_bound_index(key);
+        const size_t n     = upper_bound_index(key) - first;
+
+        erase_range(first, n);
+
+        return n;
+      }
+
+      //*********************************************************************
+      /// Erases an element.
+      ///\return An iterator to the element after the one erased.
+      //*********************************************************************
+      iterator erase(const_iterator position)
+      {
+        const size_t index = index_of(position);
+
+        erase_range(index, 1U);
+
+        return make_iterator(index);
+      }
+
+      //*********************************************************************
+      /// Erases a range of elements.
+      ///\return An iterator to the element after the last one erased.
+      //*********************************************************************
+      iterator erase(const_iterator first, const_iterator last)
+      {
+        const size_t index = index_of(first);
+
+        erase_range(index, size_t(last - first));
+
+        return make_iterator(index);
+      }
+
+      //*********************************************************************
+      /// Clears the map.
+      //*********************************************************************
+      void clear()
+      {
+        etl::private_inline_flat::destroy_all(pkeys, current_size);
+        etl::private_inline_flat::destroy_all(pmapped, current_size);
+
+        current_size = 0U;
+      }
+
+      //*********************************************************************
+      /// Gets the size of the map.
+      //*********************************************************************
+      size_t size() const
+      {
+        return current_size;
+      }
+
+      //*********************************************************************
+      /// Checks the 'empty' state of the map.
+      //*********************************************************************
+      bool empty() const
+      {
+        return current_size == 0U;
+      }
+
+      //*********************************************************************
+      /// Checks the 'full' state of the map.
+      //*********************************************************************
+      bool full() const
+      {
+        return current_size == MAX_SIZE;
+      }
+
+      //*********************************************************************
+      /// Returns the capacity of the map.
+      //*********************************************************************
+      size_t capacity() const
+      {
+        return MAX_SIZE;
+      }
+
+      //*********************************************************************
+      /// Returns the maximum possible size of the map.
+      //*********************************************************************
+      size_t max_size() const
+      {
+        return MAX_SIZE;
+      }
+
+      //*********************************************************************
+      /// Returns the remaining capacity.
+      //*********************************************************************
+      size_t available() const
+      {
+        return MAX_SIZE - current_size;
+      }
+
+      //*********************************************************************
+      /// Gets the key comparison functor.
+      //*********************************************************************
+      key_compare key_comp() const
+      {
+        return compare;
+      }
+
+    protected:
+
+      //*********************************************************************
+      /// Constructor.
+      //*********************************************************************
+      map_table(TKey* pkeys_, TMapped* pmapped_, size_t max_size_, const TKeyCompare& compare_)
+        : pkeys(pkeys_)
+        , pmapped(pmapped_)
+        , current_size(0U)
+        , MAX_SIZE(max_size_)
+        , compare(compare_)
+      {
+      }
+
+      //*********************************************************************
+      /// Destructor.
+      //*********************************************************************
+      ~map_table()
+      {
+      }
+
+      //*********************************************************************
+      size_t lower_bound_index(key_parameter_t key) const
+      {
+        return etl::private_inline_flat::lower_bound_index(pkeys, current_size, key, compare);
+      }
+
+      //*********************************************************************
+      size_t upper_bound_index(key_parameter_t key) const
+      {
+        return etl::private_inline_flat::upper_bound_index(pkeys, current_size, key, compare);
+      }
+
+      //*********************************************************************
+      /// Returns the index of the key, or size() if not found.
+      //*********************************************************************
+      size_t find_index(key_parameter_t key) const
+      {
+        const size_t index = lower_bound_index(key);
+
+        return key_at_equals(index, key) ? index : current_size;
+      }
+
+      //*********************************************************************
+      /// Checks if the key at 'index' is equal to 'key'.
+      //*********************************************************************
+      bool key_at_equals(size_t index, key_parameter_t key) const
+      {
+        return (index != current_size) && !compare(key, pkeys[index]);
+      }
+
+#if ETL_USING_CPP11
+      //*********************************************************************
+      /// Inserts a key and mapped value at 'index'.
+      /// The map must not be full.
+      //*********************************************************************
+      template <typename TK, typename TM>
+      iterator insert_at(size_t index, TK&& key, TM&& mapped)
+      {
+        if (etl::private_inline_flat::open_gap(pkeys, current_size, index))
+        {
+          etl::private_inline_flat::open_gap(pmapped, current_size, index);
+          pkeys[index]   = etl::forward<TK>(key);
+          pmapped[index] = etl::forward<TM>(mapped);
+        }
+        else
+        {
+          ::new (pkeys + index) TKey(etl::forward<TK>(key));
+          ::new (pmapped + index) TMapped(etl::forward<TM>(mapped));
+        }
+
+        ++current_size;
+
+        return make_iterator(index);
+      }
+#else
+      //*********************************************************************
+      /// Inserts a key and mapped value at 'index'.
+      /// The map must not be full.
+      //*********************************************************************
+      iterator insert_at(size_t index, const TKey& key, const TMapped& mapped)
+      {
+        if (etl::private_inline_flat::open_gap(pkeys, current_size, index))
+        {
+          etl::private_inline_flat::open_gap(pmapped, current_size, index);
+          pkeys[index]   = key;
+          pmapped[index] = mapped;
+        }
+        else
+        {
+          ::new (pkeys + index) TKey(key);
+          ::new (pmapped + index) TMapped(mapped);
+        }
+
+        ++current_size;
+
+        return make_iterator(index);
+      }
+#endif
+
+      //*********************************************************************
+      /// Erases 'n' elements from 'index'.
+      //*********************************************************************
+      void erase_range(size_t index, size_t n)
+      {
+        if (n != 0U)
+        {
+          etl::private_inline_flat::close_gap(pkeys, current_size, index, n);
+          etl::private_inline_flat::close_gap(pmapped, current_size, index, n);
+
+          current_size -= n;
+        }
+      }
+
+      //*********************************************************************
+      /// Copies the elements of another table, which must fit.
+      //*********************************************************************
+      void copy_from(const map_table& other)
+      {
+        clear();
+
+        for (size_t i = 0U; i < other.current_size; ++i)
+        {
+          ::new (pkeys + i) TKey(other.pkeys[i]);
+          ::new (pmapped + i) TMapped(other.pmapped[i]);
+        }
+
+        current_size = other.current_size;
+      }
+
+#if ETL_USING_CPP11
+      //*********************************************************************
+      /// Moves the elements of another table, which must fit.
+      //*********************************************************************
+      void move_from(map_table& other)
+      {
+        clear();
+
+        for (size_t i = 0U; i < other.current_size; ++i)
+        {
+          ::new (pkeys + i) TKey(etl::move(other.pkeys[i]));
+          ::new (pmapped + i) TMapped(etl::move(other.pmapped[i]));
+        }
+
+        current_size = other.current_size;
+
+        other.clear();
+      }
+#endif
+
+      //*********************************************************************
+      iterator make_iterator(size_t index)
+      {
+        return iterator(pkeys + index, pmapped + index);
+      }
+
+      //*********************************************************************
+      const_iterator make_iterator(size_t index) const
+      {
+        return const_iterator(pkeys + index, pmapped + index);
+      }
+
+      //*********************************************************************
+      size_t index_of(const_iterator position) const
+      {
+        return size_t(position.key_pointer() - pkeys);
+      }
+
+      TKey*        pkeys;
+      TMapped*     pmapped;
+      size_t       current_size;
+      const size_t MAX_SIZE;
+      TKeyCompare  compare;
+
+    private:
+
+      // Disable copy construction.
+      map_table(const map_table&);
+    };
+
+    //*************************************************************************
+    /// The table for the sets.
+    /// Holds the keys in a contiguous array.
+    //*************************************************************************
+    template <typename TKey, typename TKeyCompare>
+    class set_table
+    {
+    public:
+
+      typedef TKey              key_type;
+      typedef TKey              value_type;
+      typedef TKeyCompare       key_compare;
+      typedef TKeyCompare       value_compare;
+      typedef const TKey&       reference;
+      typedef const TKey&       const_reference;
+      typedef const TKey*       pointer;
+      typedef const TKey*       const_pointer;
+      typedef size_t            size_type;
+      typedef ptrdiff_t         difference_type;
+
+      typedef const TKey*                                  iterator;
+      typedef const TKey*                                  const_iterator;
+      typedef ETL_OR_STD::reverse_iterator<const_iterator> reverse_iterator;
+      typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+      typedef const TKey& key_parameter_t;
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of the set.
+      //*********************************************************************
+      const_iterator begin() const
+      {
+        return pkeys;
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of the set.
+      //*********************************************************************
+      const_iterator cbegin() const
+      {
+        return pkeys;
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of the set.
+      //*********************************************************************
+      const_iterator end() const
+      {
+        return pkeys + current_size;
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of the set.
+      //*********************************************************************
+      const_iterator cend() const
+      {
+        return pkeys + current_size;
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse beginning of the set.
+      //*********************************************************************
+      const_reverse_iterator rbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse beginning of the set.
+      //*********************************************************************
+      const_reverse_iterator crbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse end of the set.
+      //*********************************************************************
+      const_reverse_iterator rend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse end of the set.
+      //*********************************************************************
+      const_reverse_iterator crend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// The keys, in order.
+      //*********************************************************************
+      etl::span<const TKey> keys() const
+      {
+        return etl::span<const TKey>(pkeys, current_size);
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element, or end() if not found.
+      //*********************************************************************
+      const_iterator find(key_parameter_t key) const
+      {
+        const size_t index = lower_bound_index(key);
+
+        return key_at_equals(index, key) ? pkeys + index : end();
+      }
+
+      //*********************************************************************
+      /// Checks if the set contains the key.
+      //*********************************************************************
+      bool contains(key_parameter_t key) const
+      {
+        return find(key) != end();
+      }
+
+      //*********************************************************************
+      /// Counts the number of elements with the key.
+      //*********************************************************************
+      size_t count(key_parameter_t key) const
+      {
+        return upper_bound_index(key) - lower_bound_index(key);
+      }
+
+      //*********************************************************************
+      /// Finds the lower bound of a key.
+      //*********************************************************************
+      const_iterator lower_bound(key_parameter_t key) const
+      {
+        return pkeys + lower_bound_index(key);
+      }
+
+      //*********************************************************************
+      /// Finds the upper bound of a key.
+      //*********************************************************************
+      const_iterator upper_bound(key_parameter_t key) const
+      {
+        return pkeys + upper_bound_index(key);
+      }
+
+      //*********************************************************************
+      /// Finds the range of equal elements of a key.
+      //*********************************************************************
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+      {
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+      }
+
+      //*********************************************************************
+      /// Erases the elements with the key.
+      ///\return The number of elements erased.
+      //*********************************************************************
+      size_t erase(key_parameter_t key)
+      {
+        const size_t first = lower_bound_index(key);
+        const size_t n     = upper_bound_index(key) - first;
+
+        erase_range(first, n);
+
+        return n;
+      }
+
+      //*********************************************************************
+      /// Erases an element.
+      ///\return An iterator to the element after the one erased.
+      //*********************************************************************
+      iterator erase(const_iterator position)
+      {
+        const size_t index = size_t(position - pkeys);
+
+        erase_range(index, 1U);
+
+        return pkeys + index;
+      }
+
+      //*********************************************************************
+      /// Erases a range of elements.
+      ///\return An iterator to the element after the last one erased.
+      //*********************************************************************
+      iterator erase(const_iterator first, const_iterator last)
+      {
+        const size_t index = size_t(first - pkeys);
+
+        erase_range(index, size_t(last - first));
+
+        return pkeys + index;
+      }
+
+      //*********************************************************************
+      /// Clears the set.
+      //*********************************************************************
+      void clear()
+      {
+        etl::private_inline_flat::destroy_all(pkeys, current_size);
+
+        current_size = 0U;
+      }
+
+      //*********************************************************************
+      /// Gets the size of the set.
+      //*********************************************************************
+      size_t size() const
+      {
+        return current_size;
+      }
+
+      //*********************************************************************
+      /// Checks the 'empty' state of the set.
+      //*********************************************************************
+      bool empty() const
+      {
+        return current_size == 0U;
+      }
+
+      //*********************************************************************
+      /// Checks the 'full' state of the set.
+      //*********************************************************************
+      bool full() const
+      {
+        return current_size == MAX_SIZE;
+      }
+
+      //*********************************************************************
+      /// Returns the capacity of the set.
+      //*********************************************************************
+      size_t capacity() const
+      {
+        return MAX_SIZE;
+      }
+
+      //*********************************************************************
+      /// Returns the maximum possible size of the set.
+      //*********************************************************************
+      size_t max_size() const
+      {
+        return MAX_SIZE;
+      }
+
+      //*********************************************************************
+      /// Returns the remaining capacity.
+      //*********************************************************************
+      size_t available() const
+      {
+        return MAX_SIZE - current_size;
+      }
+
+      //*********************************************************************
+      /// Gets the key comparison functor.
+      //*********************************************************************
+      key_compare key_comp() const
+      {
+        return compare;
+      }
+
+      //*********************************************************************
+      /// Gets the value comparison functor.
+      //*********************************************************************
+      value_compare value_comp() const
+      {
+        return compare;
+      }
+
+    protected:
+
+      //*********************************************************************
+      /// Constructor.
+      //*********************************************************************
+      set_table(TKey* pkeys_, size_t max_size_, const TKeyCompare& compare_)
+        : pkeys(pkeys_)
+        , current_size(0U)
+        , MAX_SIZE(max_size_)
+        , compare(compare_)
+      {
+      }
+
+      //*********************************************************************
+      /// Destructor.
+      //*********************************************************************
+      ~set_table()
+      {
+      }
+
+      //*********************************************************************
+      size_t lower_bound_index(key_parameter_t key) const
+      {
+        return etl::private_inline_flat::lower_bound_index(pkeys, current_size, key, compare);
+      }
+
+      //*********************************************************************
+      size_t upper_bound_index(key_parameter_t key) const
+      {
+        return etl::private_inline_flat::upper_bound_index(pkeys, current_size, key, compare);
+      }
+
+      //*********************************************************************
+      /// Checks if the key at 'index' is equal to 'key'.
+      //*********************************************************************
+      bool key_at_equals(size_t index, key_parameter_t key) const
+      {
+        return (index != current_size) && !compare(key, pkeys[index]);
+      }
+
+#if ETL_USING_CPP11
+      //*********************************************************************
+      /// Inserts a key at 'index'.
+      /// The set must not be full.
+      //*********************************************************************
+      template <typename TK>
+      iterator insert_at(size_t index, TK&& key)
+      {
+        if (etl::private_inline_flat::open_gap(pkeys, current_size, index))
+        {
+          pkeys[index] = etl::forward<TK>(key);
+        }
+        else
+        {
+          ::new (pkeys + index) TKey(etl::forward<TK>(key));
+        }
+
+        ++current_size;
+
+        return pkeys + index;
+      }
+#else
+      //*********************************************************************
+      /// Inserts a key at 'index'.
+      /// The set must not be full.
+      //*********************************************************************
+      iterator insert_at(size_t index, const TKey& key)
+      {
+        if (etl::private_inline_flat::open_gap(pkeys, current_size, index))
+        {
+          pkeys[index] = key;
+        }
+        else
+        {
+          ::new (pkeys + index) TKey(key);
+        }
+
+        ++current_size;
+
+        return pkeys + index;
+      }
+#endif
+
+      //*********************************************************************
+      /// Erases 'n' elements from 'index'.
+      //*********************************************************************
+      void erase_range(size_t index, size_t n)
+      {
+        if (n != 0U)
+        {
+          etl::private_inline_flat::close_gap(pkeys, current_size, index, n);
+
+          current_size -= n;
+        }
+      }
+
+      //*********************************************************************
+      /// Copies the elements of another table, which must fit.
+      //*********************************************************************
+      void copy_from(const set_table& other)
+      {
+        clear();
+
+        for (size_t i = 0U; i < other.current_size; ++i)
+        {
+          ::new (pkeys + i) TKey(other.pkeys[i]);
+        }
+
+        current_size = other.current_size;
+      }
+
+#if ETL_USING_CPP11
+      //*********************************************************************
+      /// Moves the elements of another table, which must fit.
+      //*********************************************************************
+      void move_from(set_table& other)
+      {
+        clear();
+
+        for (size_t i = 0U; i < other.current_size; ++i)
+        {
+          ::new (pkeys + i) TKey(etl::move(other.pkeys[i]));
+        }
+
+        current_size = other.current_size;
+
+        other.clear();
+      }
+#endif
+
+      TKey*        pkeys;
+      size_t       current_size;
+      const size_t MAX_SIZE;
+      TKeyCompare  compare;
+
+    private:
+
+      // Disable copy construction.
+      set_table(const set_table&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,1219 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../integral_limits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// The search algorithms shared by etl::char_traits, etl::basic_string_view and
+// etl::ibasic_string.
+//
+// Strings of byte sized characters are searched a block at a time.
+// Blocks are compared with AVX2 or SSE2 if available, otherwise a portable
+// word at a time (SWAR) implementation.
+// Define ETL_STRING_SEARCH_NO_SIMD to always use the portable implementation.
+//
+// Substrings are found by filtering on the first and last characters of the
+// needle for a whole block of positions at once, and only comparing the
+// remaining characters for the candidates that pass.
+// Sets of more than a few characters are searched for using a 256 bit bitmap.
+//
+// Wide characters, and searches during constant evaluation, use a simple
+// character at a time implementation.
+//*****************************************************************************
+
+#if !defined(ETL_STRING_SEARCH_NO_SIMD)
+  #if defined(__AVX2__)
+    #define ETL_STRING_SEARCH_USING_AVX2 1
+    #include <immintrin.h>
+  #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define ETL_STRING_SEARCH_USING_SSE2 1
+    #include <emmintrin.h>
+  #endif
+#endif
+
+#if !defined(ETL_STRING_SEARCH_USING_AVX2)
+  #define ETL_STRING_SEARCH_USING_AVX2 0
+#endif
+
+#if !defined(ETL_STRING_SEARCH_USING_SSE2)
+  #define ETL_STRING_SEARCH_USING_SSE2 0
+#endif
+
+namespace etl
+{
+  namespace private_string_search
+  {
+    //*************************************************************************
+    /// Returns true if the code is not being evaluated as a constant expression,
+    /// and so may use the block searches.
+    /// Before C++14 the search functions are never constexpr.
+    /// If the compiler cannot tell, the character at a time searches are used.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline bool is_runtime()
+    {
+#if ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+      return !__builtin_is_constant_evaluated();
+#elif ETL_USING_CPP14
+      return false;
+#else
+      return true;
+#endif
+    }
+
+    //*************************************************************************
+    /// Byte sized characters may use the block searches.
+    //*************************************************************************
+    template <typename T>
+    struct is_byte_char : etl::bool_constant<sizeof(T) == 1U>
+    {
+    };
+
+    //*************************************************************************
+    /// Bit scans for the block masks, which are never zero.
+    /// binary.h includes this header indirectly, so cannot be used here.
+    //*************************************************************************
+    template <typename TMask>
+    size_t lowest_set_bit(TMask mask)
+    {
+#if ETL_USING_BUILTIN_CTZ
+      return (sizeof(TMask) <= sizeof(unsigned int)) ? size_t(__builtin_ctz(static_cast<unsigned int>(mask)))
+                                                    : size_t(__builtin_ctzll(static_cast<unsigned long long>(mask)));
+#else
+      size_t index = 0U;
+
+      for (size_t shift = etl::integral_limits<TMask>::bits / 2U; shift != 0U; shift /= 2U)
+      {
+        if ((mask & TMask((TMask(1U) << shift) - 1U)) == 0U)
+        {
+          mask >>= shift;
+          index += shift;
+        }
+      }
+
+      return index;
+#endif
+    }
+
+    template <typename TMask>
+    size_t highest_set_bit(TMask mask)
+    {
+#if ETL_USING_BUILTIN_CLZ
+      return (sizeof(TMask) <= sizeof(unsigned int)) ? size_t(etl::integral_limits<unsigned int>::bits - 1 - __builtin_clz(static_cast<unsigned int>(mask)))
+                                                    : size_t(etl::integral_limits<unsigned long long>::bits - 1 - __builtin_clzll(static_cast<unsigned long long>(mask)));
+#else
+      size_t index = 0U;
+
+      for (size_t shift = etl::integral_limits<TMask>::bits / 2U; shift != 0U; shift /= 2U)
+      {
+        if ((mask >> shift) != 0U)
+        {
+          mask >>= shift;
+          index += shift;
+        }
+      }
+
+      return index;
+#endif
+    }
+
+    //*************************************************************************
+    /// A bitmask of the matching characters in a block.
+    /// Each character is represented by 2^SHIFT bits, the top one of which may be set.
+    //*************************************************************************
+    template <typename TMask, int SHIFT>
+    class block_mask
+    {
+    public:
+
+      explicit block_mask(TMask mask_)
+        : mask(mask_)
+      {
+      }
+
+      bool any() const
+      {
+        return mask != 0U;
+      }
+
+      size_t lowest() const
+      {
+        return lowest_set_bit(mask) >> SHIFT;
+      }
+
+      size_t highest() const
+      {
+        return highest_set_bit(mask) >> SHIFT;
+      }
+
+      void clear_lowest()
+      {
+        mask &= TMask(mask - 1U);
+      }
+
+      void clear_highest()
+      {
+        mask &= TMask(~(TMask(1U) << highest_set_bit(mask)));
+      }
+
+      friend block_mask operator &(const block_mask& lhs, const block_mask& rhs)
+      {
+        return block_mask(TMask(lhs.mask & rhs.mask));
+      }
+
+    private:
+
+      TMask mask;
+    };
+
+    //*************************************************************************
+    // Blocks are only loaded where the whole block lies within the string, but
+    // GCC cannot always prove that and warns when searching string literals.
+    //*************************************************************************
+#include "diagnostic_array_bounds_push.h"
+
+#if ETL_STRING_SEARCH_USING_AVX2
+    //*************************************************************************
+    /// A block of 32 characters, compared with AVX2.
+    //*************************************************************************
+    class block
+    {
+    public:
+
+      typedef block_mask<uint32_t, 0> mask_type;
+
+      enum
+      {
+        Width = 32U
+      };
+
+      explicit block(const unsigned char* p)
+        : bytes(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)))
+      {
+      }
+
+      mask_type match(unsigned char c) const
+      {
+        return mask_type(movemask(equal(c)));
+      }
+
+      mask_type match_not(unsigned char c) const
+      {
+        return mask_type(~movemask(equal(c)));
+      }
+
+      mask_type match_any(const unsigned char* set, size_t count) const
+      {
+        return mask_type(movemask(equal_any(set, count)));
+      }
+
+      mask_type match_none(const unsigned char* set, size_t count) const
+      {
+        return mask_type(~movemask(equal_any(set, count)));
+      }
+
+      mask_type mismatch(const block& other) const
+      {
+        return mask_type(~movemask(_mm256_cmpeq_epi8(bytes, other.bytes)));
+      }
+
+    private:
+
+      __m256i equal(unsigned char c) const
+      {
+        return _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(static_cast<char>(c)));
+      }
+
+      __m256i equal_any(const unsigned char* set, size_t count) const
+      {
+        __m256i result = equal(set[0]);
+
+        for (size_t i = 1U; i < count; ++i)
+        {
+          result = _mm256_or_si256(result, equal(set[i]));
+        }
+
+        return result;
+      }
+
+      static uint32_t movemask(__m256i value)
+      {
+        return uint32_t(_mm256_movemask_epi8(value));
+      }
+
+      __m256i bytes;
+    };
+
+#elif ETL_STRING_SEARCH_USING_SSE2
+    //*************************************************************************
+    /// A block of 16 characters, compared with SSE2.
+    //*************************************************************************
+    class block
+    {
+    public:
+
+      typedef block_mask<uint32_t, 0> mask_type;
+
+      enum
+      {
+        Width = 16U
+      };
+
+      explicit block(const unsigned char* p)
+        : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)))
+      {
+      }
+
+      mask_type match(unsigned char c) const
+      {
+        return mask_type(movemask(equal(c)));
+      }
+
+      mask_type match_not(unsigned char c) const
+      {
+        return mask_type(movemask(equal(c)) ^ 0xFFFFU);
+      }
+
+      mask_type match_any(const unsigned char* set, size_t count) const
+      {
+        return mask_type(movemask(equal_any(set, count)));
+      }
+
+      mask_type match_none(const unsigned char* set, size_t count) const
+      {
+        return mask_type(movemask(equal_any(set, count)) ^ 0xFFFFU);
+      }
+
+      mask_type mismatch(const block& other) const
+      {
+        return mask_type(movemask(_mm_cmpeq_epi8(bytes, other.bytes)) ^ 0xFFFFU);
+      }
+
+    private:
+
+      __m128i equal(unsigned char c) const
+      {
+        return _mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(c)));
+      }
+
+      __m128i equal_any(const unsigned char* set, size_t count) const
+      {
+        __m128i result = equal(set[0]);
+
+        for (size_t i = 1U; i < count; ++i)
+        {
+          result = _mm_or_si128(result, equal(set[i]));
+        }
+
+        return result;
+      }
+
+      static uint32_t movemask(__m128i value)
+      {
+        return uint32_t(_mm_movemask_epi8(value));
+      }
+
+      __m128i bytes;
+    };
+
+#else
+    //*************************************************************************
+    /// A block of characters, compared a word at a time.
+    /// The characters are loaded in little endian order on all platforms.
+    //*************************************************************************
+    class block
+    {
+    public:
+
+  #if ETL_USING_64BIT_TYPES
+      typedef uint64_t word_type;
+  #else
+      typedef uint32_t word_type;
+  #endif
+
+      typedef block_mask<word_type, 3> mask_type;
+
+      enum
+      {
+        Width = sizeof(word_type)
+      };
+
+      explicit block(const unsigned char* p)
+        : bytes(0U)
+      {
+        for (size_t i = 0U; i < Width; ++i)
+        {
+          bytes |= word_type(p[i]) << (8U * i);
+        }
+      }
+
+      mask_type match(unsigned char c) const
+      {
+        return mask_type(zero_bytes(bytes ^ word_type(Lsbs * c)));
+      }
+
+      mask_type match_not(unsigned char c) const
+      {
+        return mask_type(non_zero_bytes(bytes ^ word_type(Lsbs * c)));
+      }
+
+      mask_type match_any(const unsigned char* set, size_t count) const
+      {
+        return mask_type(zero_bytes_any(set, count));
+      }
+
+      mask_type match_none(const unsigned char* set, size_t count) const
+      {
+        return mask_type(word_type(zero_bytes_any(set, count) ^ Msbs));
+      }
+
+      mask_type mismatch(const block& other) const
+      {
+        return mask_type(non_zero_bytes(bytes ^ other.bytes));
+      }
+
+    private:
+
+      static ETL_CONSTANT word_type Lsbs  = word_type(etl::integral_limits<word_type>::max / 0xFFU);
+      static ETL_CONSTANT word_type Low7s = word_type(Lsbs * 0x7FU);
+      static ETL_CONSTANT word_type Msbs  = word_type(Lsbs * 0x80U);
+
+      //*******************************
+      /// Exact, with no false positives from carries.
+      //*******************************
+      static word_type non_zero_bytes(word_type x)
+      {
+        return word_type((((x & Low7s) + Low7s) | x) & Msbs);
+      }
+
+      static word_type zero_bytes(word_type x)
+      {
+        return word_type(non_zero_bytes(x) ^ Msbs);
+      }
+
+      word_type zero_bytes_any(const unsigned char* set, size_t count) const
+      {
+        word_type result = 0U;
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          result |= zero_bytes(bytes ^ word_type(Lsbs * set[i]));
+        }
+
+        return result;
+      }
+
+      word_type bytes;
+    };
+#endif
+
+#include "diagnostic_pop.h"
+
+    //*************************************************************************
+    /// Sets of up to this many characters are matched a block at a time.
+    //*************************************************************************
+    static ETL_CONSTANT size_t Max_Block_Set_Size = 4U;
+
+    //*************************************************************************
+    /// Block and character predicates.
+    //*************************************************************************
+    struct match_char
+    {
+      explicit match_char(unsigned char c_)
+        : c(c_)
+      {
+      }
+
+      block::mask_type operator()(const block& b) const
+      {
+        return b.match(c);
+      }
+
+      bool operator()(unsigned char value) const
+      {
+        return value == c;
+      }
+
+      unsigned char c;
+    };
+
+    struct match_not_char
+    {
+      explicit match_not_char(unsigned char c_)
+        : c(c_)
+      {
+      }
+
+      block::mask_type operator()(const block& b) const
+      {
+        return b.match_not(c);
+      }
+
+      bool operator()(unsigned char value) const
+      {
+        return value != c;
+      }
+
+      unsigned char c;
+    };
+
+    struct match_any_char
+    {
+      match_any_char(const unsigned char* set_, size_t count_)
+        : set(set_)
+        , count(count_)
+      {
+      }
+
+      block::mask_type operator()(const block& b) const
+      {
+        return b.match_any(set, count);
+      }
+
+      bool operator()(unsigned char value) const
+      {
+        for (size_t i = 0U; i < count; ++i)
+        {
+          if (value == set[i])
+          {
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      const unsigned char* set;
+      size_t count;
+    };
+
+    struct match_no_char
+    {
+      match_no_char(const unsigned char* set_, size_t count_)
+        : set(set_)
+        , count(count_)
+      {
+      }
+
+      block::mask_type operator()(const block& b) const
+      {
+        return b.match_none(set, count);
+      }
+
+      bool operator()(unsigned char value) const
+      {
+        for (size_t i = 0U; i < count; ++i)
+        {
+          if (value == set[i])
+          {
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+      const unsigned char* set;
+      size_t count;
+    };
+
+    //*************************************************************************
+    /// A set of characters as a 256 bit bitmap.
+    //*************************************************************************
+    class byte_set
+    {
+    public:
+
+      byte_set(const unsigned char* set, size_t count)
+      {
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          bits[i] = 0U;
+        }
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          bits[set[i] >> 5U] |= uint32_t(1U) << (set[i] & 0x1FU);
+        }
+      }
+
+      bool contains(unsigned char c) const
+      {
+        return ((bits[c >> 5U] >> (c & 0x1FU)) & 1U) != 0U;
+      }
+
+    private:
+
+      uint32_t bits[8];
+    };
+
+    //*************************************************************************
+    /// The index of the first character matching the predicate, or 'length' if none.
+    /// A final partial block is handled by overlapping it with the previous one.
+    //*************************************************************************
+    template <typename TPredicate>
+    size_t find_if(const unsigned char* p, size_t length, TPredicate predicate)
+    {
+      if (length < block::Width)
+      {
+        for (size_t i = 0U; i < length; ++i)
+        {
+          if (predicate(p[i]))
+          {
+            return i;
+          }
+        }
+
+        return length;
+      }
+
+      size_t i = 0U;
+
+      for (; (i + block::Width) <= length; i += block::Width)
+      {
+        const block::mask_type mask = predicate(block(p + i));
+
+        if (mask.any())
+        {
+          return i + mask.lowest();
+        }
+      }
+
+      if (i < length)
+      {
+        i = length - block::Width;
+
+        const block::mask_type mask = predicate(block(p + i));
+
+        if (mask.any())
+        {
+          return i + mask.lowest();
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// The index of the last character matching the predicate, or 'length' if none.
+    /// A final partial block is handled by overlapping it with the previous one.
+    //*************************************************************************
+    template <typename TPredicate>
+    size_t rfind_if(const unsigned char* p, size_t length, TPredicate predicate)
+    {
+      if (length < block::Width)
+      {
+        for (size_t i = length; i != 0U; --i)
+        {
+          if (predicate(p[i - 1U]))
+          {
+            return i - 1U;
+          }
+        }
+
+        return length;
+      }
+
+      size_t i = length;
+
+      while (i >= block::Width)
+      {
+        i -= block::Width;
+
+        const block::mask_type mask = predicate(block(p + i));
+
+        if (mask.any())
+        {
+          return i + mask.highest();
+        }
+      }
+
+      if (i != 0U)
+      {
+        const block::mask_type mask = predicate(block(p));
+
+        if (mask.any())
+        {
+          return mask.highest();
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// The index of the first character that is, or is not, in the set, or 'length' if none.
+    //*************************************************************************
+    inline size_t find_in_set(const unsigned char* p, size_t length, const byte_set& bitmap, bool in_set)
+    {
+      for (size_t i = 0U; i < length; ++i)
+      {
+        if (bitmap.contains(p[i]) == in_set)
+        {
+          return i;
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// The index of the first character in the set, or 'length' if none.
+    //*************************************************************************
+    inline size_t find_any_of(const unsigned char* p, size_t length, const unsigned char* set, size_t count, bool in_set)
+    {
+      return find_in_set(p, length, byte_set(set, count), in_set);
+    }
+
+    //*************************************************************************
+    /// The index of the last character in the set, or 'length' if none.
+    //*************************************************************************
+    inline size_t rfind_any_of(const unsigned char* p, size_t length, const unsigned char* set, size_t count, bool in_set)
+    {
+      const byte_set bitmap(set, count);
+
+      for (size_t i = length; i != 0U; --i)
+      {
+        if (bitmap.contains(p[i - 1U]) == in_set)
+        {
+          return i - 1U;
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// The index of the first position where the ranges differ, or 'length' if none.
+    //*************************************************************************
+    inline size_t mismatch(const unsigned char* p1, const unsigned char* p2, size_t length)
+    {
+      size_t i = 0U;
+
+      for (; (i + block::Width) <= length; i += block::Width)
+      {
+        const block::mask_type mask = block(p1 + i).mismatch(block(p2 + i));
+
+        if (mask.any())
+        {
+          return i + mask.lowest();
+        }
+      }
+
+      for (; i < length; ++i)
+      {
+        if (p1[i] != p2[i])
+        {
+          return i;
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// The first position of the needle in the haystack, or 'length' if not found.
+    /// The needle must be at least two characters, and no longer than the haystack.
+    //*************************************************************************
+    inline size_t find_substring(const unsigned char* p, size_t length, const unsigned char* needle, size_t needle_length)
+    {
+      const unsigned char first  = needle[0];
+      const unsigned char last   = needle[needle_length - 1U];
+      const size_t        middle = needle_length - 2U;
+      const size_t        end    = length - needle_length + 1U; // One past the last candidate position.
+
+      size_t i = 0U;
+
+      for (; (i + block::Width) <= end; i += block::Width)
+      {
+        block::mask_type mask = block(p + i).match(first) & block(p + i + needle_length - 1U).match(last);
+
+        while (mask.any())
+        {
+          const size_t position = i + mask.lowest();
+
+          if (memcmp(p + position + 1U, needle + 1U, middle) == 0)
+          {
+            return position;
+          }
+
+          mask.clear_lowest();
+        }
+      }
+
+      for (; i < end; ++i)
+      {
+        if ((p[i] == first) && (p[i + needle_length - 1U] == last) && (memcmp(p + i + 1U, needle + 1U, middle) == 0))
+        {
+          return i;
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// The last position of the needle in the haystack, or 'length' if not found.
+    /// The needle must be at least two characters, and no longer than the haystack.
+    //*************************************************************************
+    inline size_t rfind_substring(const unsigned char* p, size_t length, const unsigned char* needle, size_t needle_length)
+    {
+      const unsigned char first  = needle[0];
+      const unsigned char last   = needle[needle_length - 1U];
+      const size_t        middle = needle_length - 2U;
+
+      size_t i = length - needle_length + 1U; // One past the last unchecked candidate position.
+
+      while (i >= block::Width)
+      {
+        i -= block::Width;
+
+        block::mask_type mask = block(p + i).match(first) & block(p + i + needle_length - 1U).match(last);
+
+        while (mask.any())
+        {
+          const size_t position = i + mask.highest();
+
+          if (memcmp(p + position + 1U, needle + 1U, middle) == 0)
+          {
+            return position;
+          }
+
+          mask.clear_highest();
+        }
+      }
+
+      while (i != 0U)
+      {
+        --i;
+
+        if ((p[i] == first) && (p[i + needle_length - 1U] == last) && (memcmp(p + i + 1U, needle + 1U, middle) == 0))
+        {
+          return i;
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// Runtime searches for byte sized characters.
+    //*************************************************************************
+    template <typename T>
+    const unsigned char* as_bytes(const T* p)
+    {
+      return reinterpret_cast<const unsigned char*>(p);
+    }
+
+    template <typename T>
+    size_t length_bytes(const T* p)
+    {
+      return ::strlen(reinterpret_cast<const char*>(p));
+    }
+
+    template <typename T>
+    size_t find_char_bytes(const T* p, size_t length, T c, bool equal)
+    {
+      return equal ? find_if(as_bytes(p), length, match_char(static_cast<unsigned char>(c)))
+                   : find_if(as_bytes(p), length, match_not_char(static_cast<unsigned char>(c)));
+    }
+
+    template <typename T>
+    size_t rfind_char_bytes(const T* p, size_t length, T c, bool equal)
+    {
+      return equal ? rfind_if(as_bytes(p), length, match_char(static_cast<unsigned char>(c)))
+                   : rfind_if(as_bytes(p), length, match_not_char(static_cast<unsigned char>(c)));
+    }
+
+    template <typename T>
+    size_t find_of_bytes(const T* p, size_t length, const T* set, size_t count, bool in_set)
+    {
+      if (count > Max_Block_Set_Size)
+      {
+        return find_any_of(as_bytes(p), length, as_bytes(set), count, in_set);
+      }
+
+      return in_set ? find_if(as_bytes(p), length, match_any_char(as_bytes(set), count))
+                    : find_if(as_bytes(p), length, match_no_char(as_bytes(set), count));
+    }
+
+    template <typename T>
+    size_t rfind_of_bytes(const T* p, size_t length, const T* set, size_t count, bool in_set)
+    {
+      if (count > Max_Block_Set_Size)
+      {
+        return rfind_any_of(as_bytes(p), length, as_bytes(set), count, in_set);
+      }
+
+      return in_set ? rfind_if(as_bytes(p), length, match_any_char(as_bytes(set), count))
+                    : rfind_if(as_bytes(p), length, match_no_char(as_bytes(set), count));
+    }
+
+    template <typename T>
+    size_t find_substring_bytes(const T* p, size_t length, const T* needle, size_t needle_length)
+    {
+      return find_substring(as_bytes(p), length, as_bytes(needle), needle_length);
+    }
+
+    template <typename T>
+    size_t rfind_substring_bytes(const T* p, size_t length, const T* needle, size_t needle_length)
+    {
+      return rfind_substring(as_bytes(p), length, as_bytes(needle), needle_length);
+    }
+
+    template <typename T>
+    size_t mismatch_bytes(const T* p1, const T* p2, size_t length)
+    {
+      return mismatch(as_bytes(p1), as_bytes(p2), length);
+    }
+
+    //*************************************************************************
+    /// Searches for any character type.
+    /// Each returns the index of the match, or 'length' if there is none.
+    /// Byte sized characters use the block searches, except during constant evaluation.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_char(const T* p, size_t length, T c, bool equal = true)
+    {
+      if (is_byte_char<T>::value && is_runtime())
+      {
+        return find_char_bytes(p, length, c, equal);
+      }
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        if ((p[i] == c) == equal)
+        {
+          return i;
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t rfind_char(const T* p, size_t length, T c, bool equal = true)
+    {
+      if (is_byte_char<T>::value && is_runtime())
+      {
+        return rfind_char_bytes(p, length, c, equal);
+      }
+
+      for (size_t i = length; i != 0U; --i)
+      {
+        if ((p[i - 1U] == c) == equal)
+        {
+          return i - 1U;
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 bool contains(const T* set, size_t count, T c)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        if (set[i] == c)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_of(const T* p, size_t length, const T* set, size_t count, bool in_set)
+    {
+      if (count == 0U)
+      {
+        return (in_set || (length == 0U)) ? length : 0U;
+      }
+
+      if (is_byte_char<T>::value && is_runtime())
+      {
+        return find_of_bytes(p, length, set, count, in_set);
+      }
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        if (contains(set, count, p[i]) == in_set)
+        {
+          return i;
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t rfind_of(const T* p, size_t length, const T* set, size_t count, bool in_set)
+    {
+      if (count == 0U)
+      {
+        return (in_set || (length == 0U)) ? length : length - 1U;
+      }
+
+      if (is_byte_char<T>::value && is_runtime())
+      {
+        return rfind_of_bytes(p, length, set, count, in_set);
+      }
+
+      for (size_t i = length; i != 0U; --i)
+      {
+        if (contains(set, count, p[i - 1U]) == in_set)
+        {
+          return i - 1U;
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t mismatch(const T* p1, const T* p2, size_t length)
+    {
+      if (is_byte_char<T>::value && is_runtime())
+      {
+        return mismatch_bytes(p1, p2, length);
+      }
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        if (!(p1[i] == p2[i]))
+        {
+          return i;
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// The needle must be no longer than the haystack.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 bool matches_at(const T* p, const T* needle, size_t needle_length)
+    {
+      for (size_t i = 0U; i < needle_length; ++i)
+      {
+        if (!(p[i] == needle[i]))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_substring(const T* p, size_t length, const T* needle, size_t needle_length)
+    {
+      if (needle_length == 0U)
+      {
+        return 0U;
+      }
+
+      if (needle_length > length)
+      {
+        return length;
+      }
+
+      if (needle_length == 1U)
+      {
+        return find_char(p, length, needle[0]);
+      }
+
+      if (is_byte_char<T>::value && is_runtime())
+      {
+        return find_substring_bytes(p, length, needle, needle_length);
+      }
+
+      for (size_t i = 0U; i <= (length - needle_length); ++i)
+      {
+        if (matches_at(p + i, needle, needle_length))
+        {
+          return i;
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t rfind_substring(const T* p, size_t length, const T* needle, size_t needle_length)
+    {
+      if (needle_length > length)
+      {
+        return length;
+      }
+
+      if (needle_length == 0U)
+      {
+        return length;
+      }
+
+      if (needle_length == 1U)
+      {
+        return rfind_char(p, length, needle[0]);
+      }
+
+      if (is_byte_char<T>::value && is_runtime())
+      {
+        return rfind_substring_bytes(p, length, needle, needle_length);
+      }
+
+      for (size_t i = (length - needle_length + 1U); i != 0U; --i)
+      {
+        if (matches_at(p + i - 1U, needle, needle_length))
+        {
+          return i - 1U;
+        }
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// Searches with the position semantics of std::basic_string.
+    /// Each returns the index of the match, or npos if there is none.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find(const T* p, size_t length, size_t position, const T* needle, size_t needle_length)
+    {
+      if ((position > length) || (needle_length > (length - position)))
+      {
+        return etl::integral_limits<size_t>::max;
+      }
+
+      const size_t index = find_substring(p + position, length - position, needle, needle_length);
+
+      return ((index == (length - position)) && (needle_length != 0U)) ? etl::integral_limits<size_t>::max : position + index;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find(const T* p, size_t length, size_t position, T c)
+    {
+      if (position >= length)
+      {
+        return etl::integral_limits<size_t>::max;
+      }
+
+      const size_t index = find_char(p + position, length - position, c);
+
+      return (index == (length - position)) ? etl::integral_limits<size_t>::max : position + index;
+    }
+
+    //*************************************************************************
+    /// Finds the last occurrence that lies entirely before 'position'.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t rfind(const T* p, size_t length, size_t position, const T* needle, size_t needle_length)
+    {
+      const size_t end = (position < length) ? position : length;
+
+      if (needle_length > end)
+      {
+        return etl::integral_limits<size_t>::max;
+      }
+
+      const size_t index = rfind_substring(p, end, needle, needle_length);
+
+      return ((index == end) && (needle_length != 0U)) ? etl::integral_limits<size_t>::max : index;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t rfind(const T* p, size_t length, size_t position, T c)
+    {
+      const size_t end = (position < length) ? position : length;
+
+      const size_t index = rfind_char(p, end, c);
+
+      return (index == end) ? etl::integral_limits<size_t>::max : index;
+    }
+
+    //*************************************************************************
+    /// Finds the first character at or after 'position' that is, or is not, in the set.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t find_of(const T* p, size_t length, size_t position, const T* set, size_t count, bool in_set)
+    {
+      if (position >= length)
+      {
+        return etl::integral_limits<size_t>::max;
+      }
+
+      const size_t index = (count == 1U) ? find_char(p + position, length - position, set[0], in_set)
+                                         : find_of(p + position, length - position, set, count, in_set);
+
+      return (index == (length - position)) ? etl::integral_limits<size_t>::max : position + index;
+    }
+
+    //*************************************************************************
+    /// Finds the last character at or before 'position' that is, or is not, in the set.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t rfind_of(const T* p, size_t length, size_t position, const T* set, size_t count, bool in_set)
+    {
+      if (length == 0U)
+      {
+        return etl::integral_limits<size_t>::max;
+      }
+
+      const size_t end = (position < length) ? (position + 1U) : length;
+
+      const size_t index = (count == 1U) ? rfind_char(p, end, set[0], in_set)
+                                         : rfind_of(p, end, set, count, in_set);
+
+      return (index == end) ? etl::integral_limits<size_t>::max : index;
+    }
+  }
+}
+
+#endif
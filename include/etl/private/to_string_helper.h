@@ -43,6 +43,9 @@ SOFTWARE.
 #include "../algorithm.h"
 #include "../iterator.h"
 #include "../limits.h"
+#include "../integral_limits.h"
+#include "float_to_decimal.h"
+#include "decimal_to_float.h"
 
 #include <math.h>
 
@@ -136,87 +139,228 @@ namespace etl
     }
 
     //***************************************************************************
-    /// Helper function for integrals.
+    /// The decimal digit pairs "00" to "99".
     //***************************************************************************
-    template <typename T, typename TIString>
-    void add_integral(T value,
-                      TIString& str,
-                      const etl::basic_format_spec<TIString>& format,
-                      bool append,
-                      const bool negative)
+    inline const char* decimal_digit_pairs()
     {
-      typedef typename TIString::value_type type;
-      typedef typename TIString::iterator   iterator;
+      return "00010203040506070809"
+             "10111213141516171819"
+             "20212223242526272829"
+             "30313233343536373839"
+             "40414243444546474849"
+             "50515253545556575859"
+             "60616263646566676869"
+             "70717273747576777879"
+             "80818283848586878889"
+             "90919293949596979899";
+    }
 
-      if (!append)
+    //***************************************************************************
+    /// The number of decimal digits in a value.
+    //***************************************************************************
+    template <typename T>
+    uint32_t count_decimal_digits(T value)
+    {
+      uint32_t count = 1U;
+
+      while (true)
       {
-        str.clear();
+        if (value < 10U)    return count;
+        if (value < 100U)   return count + 1U;
+        if (value < 1000U)  return count + 2U;
+        if (value < 10000U) return count + 3U;
+
+        value /= 10000U;
+        count += 4U;
       }
+    }
 
-      iterator start = str.end();
+    //***************************************************************************
+    /// The number of digits in a value for any base.
+    //***************************************************************************
+    template <typename T>
+    uint32_t count_digits(T value, const uint32_t base)
+    {
+      uint32_t count = 1U;
 
-      if (value == 0)
+      switch (base)
       {
-        // If number is negative, append '-' (a negative zero might occur for fractional numbers > -1.0)
-        if ((format.get_base() == 10U) && negative)
+        case 10U:
         {
-          str.push_back(type('-'));
+          count = count_decimal_digits(value);
+          break;
         }
 
-        str.push_back(type('0'));
+        case 2U:
+        case 8U:
+        case 16U:
+        {
+          const uint32_t shift = (base == 2U) ? 1U : ((base == 8U) ? 3U : 4U);
+
+          while ((value >>= shift) != 0U)
+          {
+            ++count;
+          }
+          break;
+        }
+
+        default:
+        {
+          while ((value /= T(base)) != 0U)
+          {
+            ++count;
+          }
+          break;
+        }
       }
-      else
+
+      return count;
+    }
+
+    //***************************************************************************
+    /// Writes the digits of a value backwards from 'p'.
+    /// 'p' must point to one past the position of the last digit.
+    //***************************************************************************
+    template <typename T, typename TChar>
+    void write_digits(T value, TChar* p, const uint32_t base, const bool upper_case)
+    {
+      if (base == 10U)
       {
-        // Extract the digits, in reverse order.
-        while (value != 0)
+        const char* pairs = decimal_digit_pairs();
+
+        while (value >= 100U)
         {
-          T remainder = etl::absolute(value % T(format.get_base()));
-          str.push_back((remainder > 9) ? (format.is_upper_case() ? type('A' + (remainder - 10)) : type('a' + (remainder - 10))) : type('0' + remainder));
-          value = value / T(format.get_base());
+          const uint32_t index = static_cast<uint32_t>(value % 100U) * 2U;
+          value /= 100U;
+
+          *--p = TChar(pairs[index + 1U]);
+          *--p = TChar(pairs[index]);
         }
 
-        // If number is negative, append '-'
-        if ((format.get_base() == 10U) && negative)
+        if (value >= 10U)
         {
-          str.push_back(type('-'));
+          const uint32_t index = static_cast<uint32_t>(value) * 2U;
+
+          *--p = TChar(pairs[index + 1U]);
+          *--p = TChar(pairs[index]);
         }
+        else
+        {
+          *--p = TChar('0' + static_cast<char>(value));
+        }
+      }
+      else
+      {
+        const char* digits = upper_case ? "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ" : "0123456789abcdefghijklmnopqrstuvwxyz";
 
-        if (format.is_show_base())
+        if ((base == 2U) || (base == 8U) || (base == 16U))
         {
-          switch (format.get_base())
+          const uint32_t shift = (base == 2U) ? 1U : ((base == 8U) ? 3U : 4U);
+          const T        mask  = T(base - 1U);
+
+          do
           {
-            case 2U:
-            {
-              str.push_back(format.is_upper_case() ? type('B') : type('b'));
-              str.push_back(type('0'));
-              break;
-            }
+            *--p = TChar(digits[static_cast<size_t>(value & mask)]);
+            value >>= shift;
+          } while (value != 0U);
+        }
+        else
+        {
+          do
+          {
+            *--p = TChar(digits[static_cast<size_t>(value % T(base))]);
+            value /= T(base);
+          } while (value != 0U);
+        }
+      }
+    }
 
-            case 8U:
-            {
-              str.push_back(type('0'));
-              break;
-            }
+    //***************************************************************************
+    /// Helper function for integrals.
+    /// The digits are counted first, then written in to place, two at a time
+    /// for decimal, and appended to the string in one operation.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    void add_integral(T value,
+                      TIString& str,
+                      const etl::basic_format_spec<TIString>& format,
+                      bool append,
+                      const bool negative)
+    {
+      typedef typename TIString::value_type        type;
+      typedef typename etl::make_unsigned<T>::type utype;
 
-            case 16U:
-            {
-              str.push_back(format.is_upper_case() ? type('X') : type('x'));
-              str.push_back(type('0'));
-              break;
-            }
+      if (!append)
+      {
+        str.clear();
+      }
 
-            default:
-            {
-              break;
-            }
+      // Sign + base prefix + the digits of the largest value in binary.
+      static ETL_CONSTANT size_t Buffer_Size = 3U + etl::integral_limits<utype>::bits;
+
+      type  buffer[Buffer_Size];
+      type* pend   = buffer + Buffer_Size;
+      type* pbegin = pend;
+
+      const utype    magnitude = etl::is_negative(value) ? utype(utype(0U) - utype(value)) : utype(value);
+      const uint32_t base      = format.get_base();
+
+      // A negative zero might occur for fractional numbers > -1.0
+      const bool add_sign = (base == 10U) && negative;
+
+      etl::private_to_string::write_digits(magnitude, pend, base, format.is_upper_case());
+      pbegin -= etl::private_to_string::count_digits(magnitude, base);
+
+      if (format.is_show_base() && (magnitude != 0U))
+      {
+        switch (base)
+        {
+          case 2U:
+          {
+            *--pbegin = format.is_upper_case() ? type('B') : type('b');
+            *--pbegin = type('0');
+            break;
+          }
+
+          case 8U:
+          {
+            *--pbegin = type('0');
+            break;
+          }
+
+          case 16U:
+          {
+            *--pbegin = format.is_upper_case() ? type('X') : type('x');
+            *--pbegin = type('0');
+            break;
+          }
+
+          default:
+          {
+            break;
           }
         }
+      }
 
-        // Reverse the string we appended.
-        etl::reverse(start, str.end());
+      if (add_sign)
+      {
+        *--pbegin = type('-');
       }
 
-      etl::private_to_string::add_alignment(str, start, format);
+      const uint32_t length = static_cast<uint32_t>(pend - pbegin);
+      const uint32_t fill_length = (length < format.get_width()) ? format.get_width() - length : 0U;
+
+      if ((fill_length != 0U) && !format.is_left())
+      {
+        str.append(fill_length, format.get_fill());
+      }
+
+      str.append(pbegin, pend);
+
+      if ((fill_length != 0U) && format.is_left())
+      {
+        str.append(fill_length, format.get_fill());
+      }
     }
 
     //***************************************************************************
@@ -288,8 +432,394 @@ namespace etl
     }
 #endif
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// The decimal digits of a floating point value.
+    /// The value is digits * 10^exponent.
+    //***************************************************************************
+    template <size_t Capacity>
+    struct basic_floating_point_digits
+    {
+      //*************************************************************************
+      /// Returns true if the digits from 'index' onwards round up.
+      /// The digits are only a tie if they are exactly '5', as there are no
+      /// trailing zeros. A tie is decided by the exact binary value, and an
+      /// exact tie rounds away from zero.
+      //*************************************************************************
+      bool is_round_up(uint32_t index) const
+      {
+        if (digits[index] != '5')
+        {
+          return digits[index] > '5';
+        }
+
+        return ((index + 1U) < count) || (remainder_sign >= 0);
+      }
+
+      //*************************************************************************
+      /// Rounds to 'keep' significant digits.
+      //*************************************************************************
+      void round(int32_t keep)
+      {
+        if (keep >= int32_t(count))
+        {
+          return;
+        }
+
+        if (keep < 0)
+        {
+          set_zero();
+        }
+        else if (keep == 0)
+        {
+          if (is_round_up(0U))
+          {
+            // Rounds up to the next power of 10.
+            exponent += int32_t(count);
+            digits[0] = '1';
+            count     = 1U;
+          }
+          else
+          {
+            set_zero();
+          }
+        }
+        else
+        {
+          const bool round_up = is_round_up(uint32_t(keep));
+
+          exponent += int32_t(count) - keep;
+          count     = uint32_t(keep);
+
+          if (round_up)
+          {
+            int32_t i = keep - 1;
+
+            while ((i >= 0) && (digits[i] == '9'))
+            {
+              digits[i] = '0';
+              --i;
+            }
+
+            if (i >= 0)
+            {
+              ++digits[i];
+            }
+            else
+            {
+              // All nines, so rounds up to the next power of 10.
+              exponent += keep;
+              digits[0] = '1';
+              count     = 1U;
+            }
+          }
+        }
+      }
+
+      //*************************************************************************
+      /// The decimal exponent when written in scientific format.
+      //*************************************************************************
+      int32_t scientific_exponent() const
+      {
+        return exponent + int32_t(count) - 1;
+      }
+
+      //*************************************************************************
+      void set_zero()
+      {
+        digits[0] = '0';
+        count     = 1U;
+        exponent  = 0;
+      }
+
+      char     digits[Capacity];
+      uint32_t count;
+      int32_t  exponent;
+      int32_t  remainder_sign;
+      bool     negative;
+    };
+
+    //***************************************************************************
+    /// The shortest decimal digits that read back as the same value.
+    //***************************************************************************
+    struct floating_point_digits : public basic_floating_point_digits<24U>
+    {
+      //*************************************************************************
+      template <typename T>
+      explicit floating_point_digits(const T value)
+      {
+        const etl::private_float_to_decimal::decimal_float decimal = etl::private_float_to_decimal::to_decimal(value);
+
+        count          = etl::private_to_string::count_decimal_digits(decimal.significand);
+        exponent       = decimal.exponent;
+        remainder_sign = decimal.remainder_sign;
+        negative       = decimal.negative;
+
+        etl::private_to_string::write_digits(decimal.significand, digits + count, 10U, false);
+      }
+    };
+
+    //***************************************************************************
+    /// All of the decimal digits of the exact binary value.
+    /// A double has at most 767 significant digits.
+    //***************************************************************************
+    struct exact_floating_point_digits : public basic_floating_point_digits<768U>
+    {
+      //*************************************************************************
+      template <typename T>
+      explicit exact_floating_point_digits(const T value)
+      {
+        const etl::private_float_to_decimal::binary_float binary = etl::private_float_to_decimal::to_binary(value);
+
+        remainder_sign = 0;
+        negative       = etl::is_negative(value);
+
+        if (binary.significand == 0U)
+        {
+          set_zero();
+          return;
+        }
+
+        // The value is an integer times a power of 10.
+        // m * 2^e, or m * 5^-e * 10^e when e is negative.
+        etl::private_decimal_to_float::big_integer integer(binary.significand);
+
+        if (binary.exponent >= 0)
+        {
+          integer.shift_left(uint32_t(binary.exponent));
+          exponent = 0;
+        }
+        else
+        {
+          integer.multiply_pow5(uint32_t(-binary.exponent));
+          exponent = binary.exponent;
+        }
+
+        // Write the digits from the end of the buffer, nine at a time.
+        char* const end = digits + sizeof(digits);
+        char*       p   = end;
+
+        while (!integer.is_zero())
+        {
+          const uint32_t chunk = integer.divide(1000000000UL);
+
+          if (integer.is_zero())
+          {
+            etl::private_to_string::write_digits(chunk, p, 10U, false);
+            p -= etl::private_to_string::count_decimal_digits(chunk);
+          }
+          else
+          {
+            char* const pend = p;
+            p -= 9;
+            etl::fill(p, pend, '0');
+            etl::private_to_string::write_digits(chunk, pend, 10U, false);
+          }
+        }
+
+        count = uint32_t(end - p);
+        memmove(digits, p, count);
+
+        // Remove the trailing zeros, so that a tie is exactly '5'.
+        while (digits[count - 1U] == '0')
+        {
+          --count;
+          ++exponent;
+        }
+      }
+    };
+
+    //***************************************************************************
+    /// Appends the digits in fixed format, with 'precision' digits after the point.
+    //***************************************************************************
+    template <typename TDigits, typename TIString>
+    void add_fixed(const TDigits& fp, TIString& str, const uint32_t precision)
+    {
+      typedef typename TIString::value_type type;
+
+      const int32_t integral_digits = int32_t(fp.count) + fp.exponent;
+
+      // The integral part.
+      if (integral_digits > 0)
+      {
+        const uint32_t from_digits = (integral_digits < int32_t(fp.count)) ? uint32_t(integral_digits) : fp.count;
+
+        str.append(fp.digits, fp.digits + from_digits);
+        str.append(uint32_t(integral_digits) - from_digits, type('0'));
+      }
+      else
+      {
+        str.push_back(type('0'));
+      }
+
+      // The fractional part.
+      if (precision > 0U)
+      {
+        str.push_back(type('.'));
+
+        uint32_t remaining = precision;
+
+        // Zeros between the point and the first digit.
+        if (integral_digits < 0)
+        {
+          const uint32_t zeros = (uint32_t(-integral_digits) < remaining) ? uint32_t(-integral_digits) : remaining;
+
+          str.append(zeros, type('0'));
+          remaining -= zeros;
+        }
+
+        // The digits after the point.
+        const uint32_t first = (integral_digits > 0) ? uint32_t(integral_digits) : 0U;
+
+        if (first < fp.count)
+        {
+          uint32_t length = fp.count - first;
+          length = (length < remaining) ? length : remaining;
+
+          str.append(fp.digits + first, fp.digits + first + length);
+          remaining -= length;
+        }
+
+        str.append(remaining, type('0'));
+      }
+    }
+
+    //***************************************************************************
+    /// Appends the digits in scientific format, with 'precision' digits after the point.
+    /// The exponent has at least two digits.
+    //***************************************************************************
+    template <typename TDigits, typename TIString>
+    void add_scientific(const TDigits& fp, TIString& str, const uint32_t precision, const bool upper_case)
+    {
+      typedef typename TIString::value_type type;
+
+      str.push_back(type(fp.digits[0]));
+
+      if (precision > 0U)
+      {
+        str.push_back(type('.'));
+        str.append(fp.digits + 1, fp.digits + fp.count);
+
+        if ((fp.count - 1U) < precision)
+        {
+          str.append(precision - (fp.count - 1U), type('0'));
+        }
+      }
+
+      int32_t exponent = fp.scientific_exponent();
+
+      str.push_back(upper_case ? type('E') : type('e'));
+      str.push_back((exponent < 0) ? type('-') : type('+'));
+
+      exponent = (exponent < 0) ? -exponent : exponent;
+
+      if (exponent < 10)
+      {
+        str.push_back(type('0'));
+      }
+
+      type  buffer[4];
+      type* pend = buffer + 4;
+      const uint32_t length = etl::private_to_string::count_decimal_digits(uint32_t(exponent));
+
+      etl::private_to_string::write_digits(uint32_t(exponent), pend, 10U, false);
+      str.append(pend - length, pend);
+    }
+
+    //***************************************************************************
+    /// Appends the shortest text that reads back as the same value.
+    /// Fixed or scientific, whichever is shorter, preferring fixed.
+    //***************************************************************************
+    template <typename TDigits, typename TIString>
+    void add_shortest(const TDigits& fp, TIString& str, const bool upper_case)
+    {
+      const int32_t count           = int32_t(fp.count);
+      const int32_t integral_digits = count + fp.exponent;
+
+      // The length in each format.
+      int32_t fixed_length;
+
+      if (fp.exponent >= 0)
+      {
+        fixed_length = integral_digits;
+      }
+      else if (integral_digits > 0)
+      {
+        fixed_length = count + 1;
+      }
+      else
+      {
+        fixed_length = 2 - integral_digits + count;
+      }
+
+      const int32_t exponent = fp.scientific_exponent();
+      const int32_t exponent_digits = ((exponent >= 100) || (exponent <= -100)) ? 3 : 2;
+      const int32_t scientific_length = count + ((count > 1) ? 1 : 0) + 2 + exponent_digits;
+
+      if (fixed_length <= scientific_length)
+      {
+        etl::private_to_string::add_fixed(fp, str, (fp.exponent < 0) ? uint32_t(-fp.exponent) : 0U);
+      }
+      else
+      {
+        etl::private_to_string::add_scientific(fp, str, fp.count - 1U, upper_case);
+      }
+    }
+
+    //***************************************************************************
+    /// The number of significant digits that fixed or scientific format needs.
+    //***************************************************************************
+    template <typename TDigits, typename TIString>
+    int32_t get_significant_digits(const TDigits& fp, const etl::basic_format_spec<TIString>& format)
+    {
+      if (format.is_scientific())
+      {
+        return int32_t(format.get_precision()) + 1;
+      }
+      else
+      {
+        return int32_t(fp.count) + fp.exponent + int32_t(format.get_precision());
+      }
+    }
+
+    //***************************************************************************
+    /// Rounds the digits to the precision and appends them in fixed or scientific format.
+    //***************************************************************************
+    template <typename TDigits, typename T, typename TIString>
+    void add_fixed_or_scientific(TDigits& fp, const T value, TIString& str, const etl::basic_format_spec<TIString>& format)
+    {
+      typedef typename TIString::value_type type;
+
+      fp.round(etl::private_to_string::get_significant_digits(fp, format));
+
+      if (format.is_scientific())
+      {
+        if (fp.negative)
+        {
+          str.push_back(type('-'));
+        }
+
+        etl::private_to_string::add_scientific(fp, str, format.get_precision(), format.is_upper_case());
+      }
+      else
+      {
+        if (etl::is_negative(value))
+        {
+          str.push_back(type('-'));
+        }
+
+        etl::private_to_string::add_fixed(fp, str, format.get_precision());
+      }
+    }
+#endif
+
     //***************************************************************************
     /// Helper function for floating point.
+    /// With 64 bit types, the value is first converted to the shortest decimal
+    /// digits that round trip. Fixed and scientific formats round these digits
+    /// to the precision. If the precision needs more digits than the shortest,
+    /// and the shortest are not exact, the exact digits of the binary value are
+    /// used instead. Exact ties round away from zero.
     //***************************************************************************
     template <typename T, typename TIString>
     void add_floating_point(const T value,
@@ -313,15 +843,37 @@ namespace etl
       }
       else
       {
+#if ETL_USING_64BIT_TYPES
+        etl::private_to_string::floating_point_digits fp(value);
+
+        if (format.is_shortest())
+        {
+          if (fp.negative)
+          {
+            str.push_back(type('-'));
+          }
+
+          etl::private_to_string::add_shortest(fp, str, format.is_upper_case());
+        }
+        else if ((fp.remainder_sign != 0) && (etl::private_to_string::get_significant_digits(fp, format) > int32_t(fp.count)))
+        {
+          // The digits beyond the shortest are not zeros, so use the exact digits.
+          etl::private_to_string::exact_floating_point_digits exact(value);
+
+          etl::private_to_string::add_fixed_or_scientific(exact, value, str, format);
+        }
+        else
+        {
+          etl::private_to_string::add_fixed_or_scientific(fp, value, str, format);
+        }
+#else
         // Make sure we format the two halves correctly.
         uint32_t max_precision = etl::numeric_limits<T>::digits10;
 
-#if ETL_NOT_USING_64BIT_TYPES
         if (max_precision > 9)
         {
           max_precision = 9;
         }
-#endif
 
         etl::basic_format_spec<TIString> integral_format = format;
         integral_format.decimal().width(0).precision(format.get_precision() > max_precision ? max_precision : format.get_precision());
@@ -351,6 +903,7 @@ namespace etl
         }
 
         etl::private_to_string::add_integral_and_fractional(integral, fractional, str, integral_format, fractional_format, etl::is_negative(value));
+#endif
       }
 
       etl::private_to_string::add_alignment(str, start, format);
@@ -0,0 +1,197 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_HASH_POLICY_INCLUDED
+#define ETL_UNORDERED_HASH_POLICY_INCLUDED
+
+#include "../platform.h"
+#include "../power.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Bucket policies for the unordered containers.
+// A policy selects the number of buckets, how a hash is mapped to a bucket,
+// and whether each node stores its hash.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_unordered
+  {
+    //*************************************************************************
+    /// Mixes all of the bits of a hash in to the low bits.
+    /// Uses the MurmurHash3 finalisers.
+    //*************************************************************************
+    template <size_t SIZE = sizeof(size_t)>
+    struct hash_finaliser;
+
+    template <>
+    struct hash_finaliser<2U>
+    {
+      static size_t mix(size_t hash)
+      {
+        uint32_t h = uint32_t(hash);
+
+        h ^= h >> 8U;
+        h *= 0x85EBCA6BUL;
+        h ^= h >> 16U;
+
+        return size_t(h);
+      }
+    };
+
+    template <>
+    struct hash_finaliser<4U>
+    {
+      static size_t mix(size_t hash)
+      {
+        uint32_t h = uint32_t(hash);
+
+        h ^= h >> 16U;
+        h *= 0x85EBCA6BUL;
+        h ^= h >> 13U;
+        h *= 0xC2B2AE35UL;
+        h ^= h >> 16U;
+
+        return size_t(h);
+      }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct hash_finaliser<8U>
+    {
+      static size_t mix(size_t hash)
+      {
+        uint64_t h = uint64_t(hash);
+
+        h ^= h >> 33U;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33U;
+        h *= 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 33U;
+
+        return size_t(h);
+      }
+    };
+#endif
+  }
+
+  //***************************************************************************
+  /// The default bucket policy for the unordered containers.
+  /// The bucket index is the hash modulo the number of buckets.
+  /// The nodes do not store the hash.
+  //***************************************************************************
+  struct unordered_modulo_buckets
+  {
+    //*************************************************************************
+    /// The number of buckets for a requested number of buckets.
+    //*************************************************************************
+    template <size_t NBuckets>
+    struct bucket_count
+    {
+      static ETL_CONSTANT size_t value = NBuckets;
+    };
+
+    //*************************************************************************
+    /// Gets the bucket index for a hash.
+    //*************************************************************************
+    static size_t bucket_index(size_t hash, size_t number_of_buckets)
+    {
+      return hash % number_of_buckets;
+    }
+
+    //*************************************************************************
+    /// The hash storage added to each node. Stores nothing.
+    //*************************************************************************
+    struct node_hash
+    {
+      void store_hash(size_t)
+      {
+      }
+
+      bool hash_matches(size_t) const
+      {
+        return true;
+      }
+    };
+  };
+
+  //***************************************************************************
+  /// A bucket policy for the unordered containers that avoids division and
+  /// most key comparisons.
+  /// The number of buckets is rounded up to a power of 2, and the bucket index
+  /// is the mixed hash masked by the number of buckets.
+  /// Each node stores its full hash, so that keys are only compared when the
+  /// hashes are equal. This costs a size_t per element.
+  //***************************************************************************
+  struct unordered_power_of_2_buckets
+  {
+    //*************************************************************************
+    /// The number of buckets for a requested number of buckets.
+    //*************************************************************************
+    template <size_t NBuckets>
+    struct bucket_count
+    {
+      static ETL_CONSTANT size_t value = etl::power_of_2_round_up<NBuckets>::value;
+    };
+
+    //*************************************************************************
+    /// Gets the bucket index for a hash.
+    /// 'number_of_buckets' must be a power of 2.
+    //*************************************************************************
+    static size_t bucket_index(size_t hash, size_t number_of_buckets)
+    {
+      return etl::private_unordered::hash_finaliser<>::mix(hash) & (number_of_buckets - 1U);
+    }
+
+    //*************************************************************************
+    /// The hash storage added to each node.
+    //*************************************************************************
+    struct node_hash
+    {
+      void store_hash(size_t hash_)
+      {
+        hash = hash_;
+      }
+
+      bool hash_matches(size_t hash_) const
+      {
+        return hash == hash_;
+      }
+
+      size_t hash;
+    };
+  };
+}
+
+#endif
@@ -75,6 +75,65 @@ SOFTWARE.
   #endif
 #endif
 
+// Bit operation builtins, used by binary.h.
+// They may be disabled by defining the macro as 0.
+#if defined(__has_builtin)
+  #if !defined(ETL_USING_BUILTIN_POPCOUNT)
+    #define ETL_USING_BUILTIN_POPCOUNT (__has_builtin(__builtin_popcount) && __has_builtin(__builtin_popcountll))
+  #endif
+
+  #if !defined(ETL_USING_BUILTIN_PARITY)
+    #define ETL_USING_BUILTIN_PARITY (__has_builtin(__builtin_parity) && __has_builtin(__builtin_parityll))
+  #endif
+
+  #if !defined(ETL_USING_BUILTIN_CLZ)
+    #define ETL_USING_BUILTIN_CLZ (__has_builtin(__builtin_clz) && __has_builtin(__builtin_clzll))
+  #endif
+
+  #if !defined(ETL_USING_BUILTIN_CTZ)
+    #define ETL_USING_BUILTIN_CTZ (__has_builtin(__builtin_ctz) && __has_builtin(__builtin_ctzll))
+  #endif
+
+  #if !defined(ETL_USING_BUILTIN_BITREVERSE)
+    #define ETL_USING_BUILTIN_BITREVERSE (__has_builtin(__builtin_bitreverse8)  && __has_builtin(__builtin_bitreverse16) && \
+                                          __has_builtin(__builtin_bitreverse32) && __has_builtin(__builtin_bitreverse64))
+  #endif
+#endif
+
+// Constant evaluation detection, used by the string searches.
+// It may be disabled by defining the macro as 0.
+#if defined(__has_builtin)
+  #if !defined(ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+    #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED __has_builtin(__builtin_is_constant_evaluated)
+  #endif
+#elif defined(__GNUC__) && (__GNUC__ >= 9)
+  #if !defined(ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+    #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 1
+  #endif
+#elif defined(_MSC_VER) && (_MSC_VER >= 1925)
+  #if !defined(ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+    #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 1
+  #endif
+#endif
+
+#if defined(__GNUC__) && !defined(__has_builtin) // GCC before version 10 has the builtins, but not __has_builtin.
+  #if !defined(ETL_USING_BUILTIN_POPCOUNT)
+    #define ETL_USING_BUILTIN_POPCOUNT 1
+  #endif
+
+  #if !defined(ETL_USING_BUILTIN_PARITY)
+    #define ETL_USING_BUILTIN_PARITY 1
+  #endif
+
+  #if !defined(ETL_USING_BUILTIN_CLZ)
+    #define ETL_USING_BUILTIN_CLZ 1
+  #endif
+
+  #if !defined(ETL_USING_BUILTIN_CTZ)
+    #define ETL_USING_BUILTIN_CTZ 1
+  #endif
+#endif
+
 // The default. Set to 0, if not already set.
 #if !defined(ETL_USING_BUILTIN_IS_ASSIGNABLE)
   #define ETL_USING_BUILTIN_IS_ASSIGNABLE 0
@@ -96,6 +155,30 @@ SOFTWARE.
   #define ETL_USING_BUILTIN_IS_TRIVIALLY_COPYABLE 0
 #endif
 
+#if !defined(ETL_USING_BUILTIN_POPCOUNT)
+  #define ETL_USING_BUILTIN_POPCOUNT 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_PARITY)
+  #define ETL_USING_BUILTIN_PARITY 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_CLZ)
+  #define ETL_USING_BUILTIN_CLZ 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_CTZ)
+  #define ETL_USING_BUILTIN_CTZ 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_BITREVERSE)
+  #define ETL_USING_BUILTIN_BITREVERSE 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+  #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 0
+#endif
+
 namespace etl
 {
   namespace traits
@@ -107,6 +190,12 @@ namespace etl
     static ETL_CONSTANT bool using_builtin_is_trivially_constructible = (ETL_USING_BUILTIN_IS_TRIVIALLY_CONSTRUCTIBLE == 1);
     static ETL_CONSTANT bool using_builtin_is_trivially_destructible  = (ETL_USING_BUILTIN_IS_TRIVIALLY_DESTRUCTIBLE == 1);
     static ETL_CONSTANT bool using_builtin_is_trivially_copyable      = (ETL_USING_BUILTIN_IS_TRIVIALLY_COPYABLE == 1);
+    static ETL_CONSTANT bool using_builtin_popcount                   = (ETL_USING_BUILTIN_POPCOUNT == 1);
+    static ETL_CONSTANT bool using_builtin_parity                     = (ETL_USING_BUILTIN_PARITY == 1);
+    static ETL_CONSTANT bool using_builtin_clz                        = (ETL_USING_BUILTIN_CLZ == 1);
+    static ETL_CONSTANT bool using_builtin_ctz                        = (ETL_USING_BUILTIN_CTZ == 1);
+    static ETL_CONSTANT bool using_builtin_bitreverse                 = (ETL_USING_BUILTIN_BITREVERSE == 1);
+    static ETL_CONSTANT bool using_builtin_is_constant_evaluated      = (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1);
   }
 }
 
@@ -0,0 +1,672 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "atomic.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "power.h"
+#include "placement_new.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup queue_mpmc_atomic queue_mpmc_atomic
+/// A fixed capacity, lock free, multiple producer, multiple consumer queue.
+/// Each slot carries a sequence number that tells producers and consumers
+/// whether it is free or holds a value for the current lap of the ring.
+/// The capacity must be a power of 2.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception for a queue_mpmc_atomic.
+  ///\ingroup queue_mpmc_atomic
+  //***************************************************************************
+  class queue_mpmc_atomic_exception : public etl::exception
+  {
+  public:
+
+    queue_mpmc_atomic_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for a capacity that is not a power of 2.
+  ///\ingroup queue_mpmc_atomic
+  //***************************************************************************
+  class queue_mpmc_atomic_invalid_size : public etl::queue_mpmc_atomic_exception
+  {
+  public:
+
+    queue_mpmc_atomic_invalid_size(string_type file_name_, numeric_type line_number_)
+      : queue_mpmc_atomic_exception(ETL_ERROR_TEXT("queue_mpmc_atomic:size", ETL_QUEUE_MPMC_ATOMIC_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_queue_mpmc_atomic
+  {
+    //*************************************************************************
+    /// A slot in the queue.
+    //*************************************************************************
+    template <typename T, typename TSize>
+    struct slot
+    {
+      etl::atomic<TSize> sequence; ///< Equals the position when free, the position + 1 when holding a value.
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+    };
+  }
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  /// The base for all queue_mpmc_atomic.
+  //***************************************************************************
+  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      size_type read_position  = read.load(etl::memory_order_acquire);
+      size_type write_position = write.load(etl::memory_order_acquire);
+
+      size_type n = size_type(write_position - read_position);
+
+      // The read position may have moved on since it was loaded.
+      return (n > MAX_SIZE) ? MAX_SIZE : n;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    typedef typename etl::make_signed<size_type>::type difference_type;
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : write(0),
+        read(0),
+        MAX_SIZE(max_size_),
+        MASK(max_size_ - 1)
+    {
+      ETL_ASSERT((max_size_ != 0) && ((max_size_ & MASK) == 0) && (max_size_ <= ((etl::integral_limits<size_type>::max / 2U) + 1U)), ETL_ERROR(queue_mpmc_atomic_invalid_size));
+    }
+
+    char                   padding0[ETL_CACHE_LINE_SIZE];
+    etl::atomic<size_type> write; ///< The next position to push to.
+    char                   padding1[ETL_CACHE_LINE_SIZE];
+    etl::atomic<size_type> read;  ///< The next position to pop from.
+    char                   padding2[ETL_CACHE_LINE_SIZE];
+    const size_type        MAX_SIZE; ///< The maximum number of items in the queue.
+    const size_type        MASK;     ///< Maps a position to a slot index.
+
+  private:
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  ///\brief This is the base for all queue_mpmc_atomic that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 16> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::queue_mpmc_atomic_base<MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+#if ETL_USING_CPP11
+    typedef T&&                        rvalue_reference;///< An rvalue reference to the type used in the queue.
+#endif
+    typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the queue.
+
+    /// The type of a slot in the queue's buffer.
+    typedef private_queue_mpmc_atomic::slot<T, size_type> slot_type;
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      slot_type* p_slot = claim_write_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value);
+        publish_write_slot(p_slot);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      slot_type* p_slot = claim_write_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(etl::move(value));
+        publish_write_slot(p_slot);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      slot_type* p_slot = claim_write_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(etl::forward<Args>(args)...);
+        publish_write_slot(p_slot);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      slot_type* p_slot = claim_write_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1);
+        publish_write_slot(p_slot);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      slot_type* p_slot = claim_write_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1, value2);
+        publish_write_slot(p_slot);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      slot_type* p_slot = claim_write_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1, value2, value3);
+        publish_write_slot(p_slot);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      slot_type* p_slot = claim_write_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1, value2, value3, value4);
+        publish_write_slot(p_slot);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      slot_type* p_slot = claim_read_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        T& item = *reinterpret_cast<T*>(&p_slot->value);
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+        value = etl::move(item);
+#else
+        value = item;
+#endif
+        item.~T();
+        release_read_slot(p_slot);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      slot_type* p_slot = claim_read_slot();
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        reinterpret_cast<T*>(&p_slot->value)->~T();
+        release_read_slot(p_slot);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(slot_type* p_slots_, size_type max_size_)
+      : base_t(max_size_),
+        p_slots(p_slots_)
+    {
+      for (size_type i = 0; i < max_size_; ++i)
+      {
+        p_slots[i].sequence.store(i, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    typedef typename base_t::difference_type difference_type;
+
+    //*************************************************************************
+    /// Claims the slot at the write position.
+    /// Returns ETL_NULLPTR if the queue is full.
+    //*************************************************************************
+    slot_type* claim_write_slot()
+    {
+      size_type position = this->write.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot_type*      p_slot   = &p_slots[position & this->MASK];
+        size_type       sequence = p_slot->sequence.load(etl::memory_order_acquire);
+        difference_type delta    = difference_type(size_type(sequence - position));
+
+        if (delta == 0)
+        {
+          // The slot is free for this lap. Try to claim it.
+          if (this->write.compare_exchange_weak(position, size_type(position + 1), etl::memory_order_relaxed))
+          {
+            return p_slot;
+          }
+        }
+        else if (delta < 0)
+        {
+          // The slot still holds a value from the previous lap.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another producer got here first.
+          position = this->write.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Makes a claimed write slot visible to consumers.
+    //*************************************************************************
+    void publish_write_slot(slot_type* p_slot)
+    {
+      size_type sequence = p_slot->sequence.load(etl::memory_order_relaxed);
+
+      p_slot->sequence.store(size_type(sequence + 1), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Claims the slot at the read position.
+    /// Returns ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    slot_type* claim_read_slot()
+    {
+      size_type position = this->read.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot_type*      p_slot   = &p_slots[position & this->MASK];
+        size_type       sequence = p_slot->sequence.load(etl::memory_order_acquire);
+        difference_type delta    = difference_type(size_type(sequence - size_type(position + 1)));
+
+        if (delta == 0)
+        {
+          // The slot holds a value for this lap. Try to claim it.
+          if (this->read.compare_exchange_weak(position, size_type(position + 1), etl::memory_order_relaxed))
+          {
+            return p_slot;
+          }
+        }
+        else if (delta < 0)
+        {
+          // The slot has not been written for this lap.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another consumer got here first.
+          position = this->read.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Frees a claimed read slot for the producers' next lap.
+    //*************************************************************************
+    void release_read_slot(slot_type* p_slot)
+    {
+      size_type sequence = p_slot->sequence.load(etl::memory_order_relaxed);
+
+      // sequence == position + 1, so the next lap is position + MAX_SIZE.
+      p_slot->sequence.store(size_type(sequence + this->MASK), etl::memory_order_release);
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&) ETL_DELETE;
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    iqueue_mpmc_atomic(iqueue_mpmc_atomic&&) = delete;
+    iqueue_mpmc_atomic& operator =(iqueue_mpmc_atomic&&) = delete;
+#endif
+
+    slot_type* p_slots; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  /// A fixed capacity, lock free, mpmc queue.
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue. Must be a power of 2.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+    typedef typename base_t::slot_type slot_type;
+
+    ETL_STATIC_ASSERT((SIZE <= ((etl::integral_limits<size_type>::max / 2U) + 1U)), "Size too large for memory model");
+    ETL_STATIC_ASSERT(etl::is_power_of_2<SIZE>::value, "Size must be a power of 2");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(slots, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic(const queue_mpmc_atomic&) ETL_DELETE;
+    queue_mpmc_atomic& operator = (const queue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    queue_mpmc_atomic(queue_mpmc_atomic&&) = delete;
+    queue_mpmc_atomic& operator = (queue_mpmc_atomic&&) = delete;
+#endif
+
+    /// The slots used in the queue_mpmc_atomic.
+    slot_type slots[MAX_SIZE];
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  /// A fixed capacity, lock free, mpmc queue with an external buffer.
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  ///\code
+  /// etl::queue_mpmc_atomic_ext<int>::slot_type buffer[16];
+  /// etl::queue_mpmc_atomic_ext<int> myQueue(buffer, 16);
+  ///\endcode
+  /// \tparam T            The type this queue should support.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_ext : public etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+    typedef typename base_t::slot_type slot_type;
+
+    //*************************************************************************
+    /// Constructor.
+    /// The capacity must be a power of 2.
+    //*************************************************************************
+    queue_mpmc_atomic_ext(slot_type* buffer, size_t max_size)
+      : base_t(buffer, size_type(max_size))
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic_ext()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic_ext(const queue_mpmc_atomic_ext&) ETL_DELETE;
+    queue_mpmc_atomic_ext& operator = (const queue_mpmc_atomic_ext&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    queue_mpmc_atomic_ext(queue_mpmc_atomic_ext&&) = delete;
+    queue_mpmc_atomic_ext& operator = (queue_mpmc_atomic_ext&&) = delete;
+#endif
+  };
+}
+
+#endif
+
+#endif
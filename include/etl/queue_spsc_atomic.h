@@ -39,6 +39,8 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "user_type.h"
+#include "span.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -47,9 +49,167 @@ SOFTWARE.
 
 namespace etl
 {
-  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_spsc_atomic_base
+  //***************************************************************************
+  /// The layout of the read and write indexes of a queue_spsc_atomic.
+  /// COMPACT       The indexes are adjacent. Smallest footprint.
+  /// CACHE_ALIGNED The indexes are on separate cache lines and the producer and
+  ///               consumer each keep a local copy of the other's index, which is
+  ///               only reloaded when the queue appears to be full or empty.
+  ///               Reduces cache line traffic between cores at the cost of
+  ///               ETL_CACHE_LINE_SIZE * 3 bytes of padding.
+  //***************************************************************************
+  ETL_DECLARE_USER_TYPE(queue_spsc_atomic_layout, int)
+  ETL_USER_TYPE(COMPACT,       0)
+  ETL_USER_TYPE(CACHE_ALIGNED, 1)
+  ETL_END_USER_TYPE(queue_spsc_atomic_layout)
+
+  namespace private_queue_spsc_atomic
   {
+    //*************************************************************************
+    /// The read and write indexes.
+    /// Compact layout.
+    //*************************************************************************
+    template <typename TSize, const size_t LAYOUT>
+    class queue_indexes
+    {
+    protected:
+
+      queue_indexes(TSize reserved_)
+        : write(0),
+          read(0),
+          RESERVED(reserved_)
+      {
+      }
+
+      //***********************************************************************
+      /// Is there space to write at the current write index?
+      /// Called from the 'push' thread only.
+      //***********************************************************************
+      bool producer_has_space(TSize next_write_index)
+      {
+        return next_write_index != read.load(etl::memory_order_acquire);
+      }
+
+      //***********************************************************************
+      /// Is there data to read at the current read index?
+      /// Called from the 'pop' thread only.
+      //***********************************************************************
+      bool consumer_has_data(TSize read_index)
+      {
+        return read_index != write.load(etl::memory_order_acquire);
+      }
+
+      //***********************************************************************
+      /// Gets the current read index.
+      /// Called from the 'push' thread only.
+      //***********************************************************************
+      TSize producer_get_read_index()
+      {
+        return read.load(etl::memory_order_acquire);
+      }
+
+      //***********************************************************************
+      /// Gets the current write index.
+      /// Called from the 'pop' thread only.
+      //***********************************************************************
+      TSize consumer_get_write_index()
+      {
+        return write.load(etl::memory_order_acquire);
+      }
+
+      etl::atomic<TSize> write; ///< Where to input new data.
+      etl::atomic<TSize> read;  ///< Where to get the oldest data.
+      const TSize RESERVED;     ///< The maximum number of items in the queue.
+    };
+
+    //*************************************************************************
+    /// The read and write indexes.
+    /// Cache aligned layout.
+    //*************************************************************************
+    template <typename TSize>
+    class queue_indexes<TSize, etl::queue_spsc_atomic_layout::CACHE_ALIGNED>
+    {
+    protected:
+
+      queue_indexes(TSize reserved_)
+        : write(0),
+          read_cache(0),
+          read(0),
+          write_cache(0),
+          RESERVED(reserved_)
+      {
+      }
+
+      //***********************************************************************
+      /// Is there space to write at the current write index?
+      /// Only reloads 'read' if the cached copy indicates that the queue is full.
+      /// Called from the 'push' thread only.
+      //***********************************************************************
+      bool producer_has_space(TSize next_write_index)
+      {
+        if (next_write_index == read_cache)
+        {
+          read_cache = read.load(etl::memory_order_acquire);
+        }
+
+        return next_write_index != read_cache;
+      }
+
+      //***********************************************************************
+      /// Is there data to read at the current read index?
+      /// Only reloads 'write' if the cached copy indicates that the queue is empty.
+      /// Called from the 'pop' thread only.
+      //***********************************************************************
+      bool consumer_has_data(TSize read_index)
+      {
+        if (read_index == write_cache)
+        {
+          write_cache = write.load(etl::memory_order_acquire);
+        }
+
+        return read_index != write_cache;
+      }
+
+      //***********************************************************************
+      /// Gets the current read index and refreshes the cached copy.
+      /// Called from the 'push' thread only.
+      //***********************************************************************
+      TSize producer_get_read_index()
+      {
+        read_cache = read.load(etl::memory_order_acquire);
+
+        return read_cache;
+      }
+
+      //***********************************************************************
+      /// Gets the current write index and refreshes the cached copy.
+      /// Called from the 'pop' thread only.
+      //***********************************************************************
+      TSize consumer_get_write_index()
+      {
+        write_cache = write.load(etl::memory_order_acquire);
+
+        return write_cache;
+      }
+
+      char               padding0[ETL_CACHE_LINE_SIZE];
+      etl::atomic<TSize> write;       ///< Where to input new data.
+      TSize              read_cache;  ///< The producer's copy of 'read'.
+      char               padding1[ETL_CACHE_LINE_SIZE];
+      etl::atomic<TSize> read;        ///< Where to get the oldest data.
+      TSize              write_cache; ///< The consumer's copy of 'write'.
+      char               padding2[ETL_CACHE_LINE_SIZE];
+      const TSize        RESERVED;    ///< The maximum number of items in the queue.
+    };
+  }
+
+  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, const size_t LAYOUT = etl::queue_spsc_atomic_layout::COMPACT>
+  class queue_spsc_atomic_base : protected private_queue_spsc_atomic::queue_indexes<typename etl::size_type_lookup<MEMORY_MODEL>::type, LAYOUT>
+  {
+  private:
+
+    typedef private_queue_spsc_atomic::queue_indexes<typename etl::size_type_lookup<MEMORY_MODEL>::type, LAYOUT> indexes_t;
+
   public:
 
     /// The type used for determining the size of queue.
@@ -127,10 +287,16 @@ namespace etl
 
   protected:
 
+    using indexes_t::write;
+    using indexes_t::read;
+    using indexes_t::RESERVED;
+    using indexes_t::producer_has_space;
+    using indexes_t::consumer_has_data;
+    using indexes_t::producer_get_read_index;
+    using indexes_t::consumer_get_write_index;
+
     queue_spsc_atomic_base(size_type reserved_)
-      : write(0),
-        read(0),
-        RESERVED(reserved_)
+      : indexes_t(reserved_)
     {
     }
 
@@ -149,9 +315,33 @@ namespace etl
       return index;
     }
 
-    etl::atomic<size_type> write; ///< Where to input new data.
-    etl::atomic<size_type> read;  ///< Where to get the oldest data.
-    const size_type RESERVED;     ///< The maximum number of items in the queue.
+    //*************************************************************************
+    /// Calculate the index 'n' places after 'index'.
+    //*************************************************************************
+    static size_type get_next_index(size_type index, size_type n, size_type maximum)
+    {
+      // Avoid 'index + n' overflowing a narrow size_type.
+      const size_type remaining = size_type(maximum - index);
+
+      return (n >= remaining) ? size_type(n - remaining) : size_type(index + n);
+    }
+
+    //*************************************************************************
+    /// The number of items between the read and write indexes.
+    //*************************************************************************
+    size_type get_used(size_type write_index, size_type read_index) const
+    {
+      return (write_index >= read_index) ? size_type(write_index - read_index)
+                                         : size_type(RESERVED - read_index + write_index);
+    }
+
+    //*************************************************************************
+    /// The number of free slots between the write and read indexes.
+    //*************************************************************************
+    size_type get_free(size_type write_index, size_type read_index) const
+    {
+      return size_type(RESERVED - 1 - get_used(write_index, read_index));
+    }
 
   private:
 
@@ -180,14 +370,15 @@ namespace etl
   /// etl::iqueue_spsc_atomic<int>& iQueue = myQueue;
   ///\endcode
   /// This queue supports concurrent access by one producer and one consumer.
-  /// \tparam T The type of value that the queue_spsc_atomic holds.
+  /// \tparam T      The type of value that the queue_spsc_atomic holds.
+  /// \tparam LAYOUT The layout of the read and write indexes. See etl::queue_spsc_atomic_layout.
   //***************************************************************************
-  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class iqueue_spsc_atomic : public queue_spsc_atomic_base<MEMORY_MODEL>
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, const size_t LAYOUT = etl::queue_spsc_atomic_layout::COMPACT>
+  class iqueue_spsc_atomic : public queue_spsc_atomic_base<MEMORY_MODEL, LAYOUT>
   {
   private:
 
-    typedef typename etl::queue_spsc_atomic_base<MEMORY_MODEL> base_t;
+    typedef typename etl::queue_spsc_atomic_base<MEMORY_MODEL, LAYOUT> base_t;
 
   public:
 
@@ -203,6 +394,16 @@ namespace etl
     using base_t::read;
     using base_t::RESERVED;
     using base_t::get_next_index;
+    using base_t::producer_has_space;
+    using base_t::consumer_has_data;
+    using base_t::producer_get_read_index;
+    using base_t::consumer_get_write_index;
+    using base_t::get_used;
+    using base_t::get_free;
+
+    /// A pair of spans over a contiguous region of the queue's buffer.
+    /// 'second' is non-empty when the region wraps around the end of the buffer.
+    typedef etl::pair<etl::span<T>, etl::span<T> > span_pair;
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -212,7 +413,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value);
 
@@ -234,7 +435,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
@@ -248,6 +449,34 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Pushes as many values as will fit and publishes them with a single store.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type free_slots  = get_free(write_index, producer_get_read_index());
+      size_type count       = 0;
+
+      while ((first != last) && (count != free_slots))
+      {
+        ::new (&p_buffer[write_index]) T(*first);
+        write_index = get_next_index(write_index, RESERVED);
+        ++first;
+        ++count;
+      }
+
+      if (count != 0)
+      {
+        write.store(write_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
 #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
     //*************************************************************************
     /// Constructs a value in the queue 'in place'.
@@ -259,7 +488,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
@@ -282,7 +511,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1);
 
@@ -305,7 +534,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
@@ -328,7 +557,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
@@ -351,7 +580,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
@@ -372,7 +601,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!consumer_has_data(read_index))
       {
         // Queue is empty
         return false;
@@ -390,7 +619,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!consumer_has_data(read_index))
       {
         // Queue is empty
         return false;
@@ -411,6 +640,38 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Pop up to 'max_n' values from the queue to an output iterator.
+    /// Releases the popped slots with a single store.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator out, size_type max_n)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type used       = get_used(consumer_get_write_index(), read_index);
+      size_type count      = (max_n < used) ? max_n : used;
+
+      for (size_type i = 0; i < count; ++i)
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03_IMPLEMENTATION)
+        *out = etl::move(p_buffer[read_index]);
+#else
+        *out = p_buffer[read_index];
+#endif
+        ++out;
+        p_buffer[read_index].~T();
+        read_index = get_next_index(read_index, RESERVED);
+      }
+
+      if (count != 0)
+      {
+        read.store(read_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
     //*************************************************************************
     /// Pop a value from the queue and discard.
     //*************************************************************************
@@ -418,7 +679,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!consumer_has_data(read_index))
       {
         // Queue is empty
         return false;
@@ -453,6 +714,62 @@ namespace etl
       return p_buffer[read_index];
     }
 
+    //*************************************************************************
+    /// Reserves up to 'max_n' free slots for writing in place.
+    /// The slots are uninitialised storage. Values must be constructed or, for
+    /// trivial types, assigned before calling write_commit.
+    /// Must be called from the thread that pushes to the queue.
+    ///\return The reserved slots. The total size may be less than 'max_n'.
+    //*************************************************************************
+    span_pair write_reserve(size_type max_n)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type free_slots  = get_free(write_index, producer_get_read_index());
+
+      return make_span_pair(write_index, (max_n < free_slots) ? max_n : free_slots);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'n' slots of the last write reservation.
+    /// Must be called from the thread that pushes to the queue.
+    //*************************************************************************
+    void write_commit(size_type n)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+
+      write.store(get_next_index(write_index, n, RESERVED), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' values for reading in place.
+    /// Must be called from the thread that pops from the queue.
+    ///\return The reserved values. The total size may be less than 'max_n'.
+    //*************************************************************************
+    span_pair read_reserve(size_type max_n = etl::integral_limits<size_type>::max)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type used       = get_used(consumer_get_write_index(), read_index);
+
+      return make_span_pair(read_index, (max_n < used) ? max_n : used);
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'n' values of the last read reservation.
+    /// Must be called from the thread that pops from the queue.
+    //*************************************************************************
+    void read_commit(size_type n)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+
+      for (size_type i = 0; i < n; ++i)
+      {
+        p_buffer[read_index].~T();
+        read_index = get_next_index(read_index, RESERVED);
+      }
+
+      read.store(read_index, etl::memory_order_release);
+    }
+
     //*************************************************************************
     /// Clear the queue.
     /// Must be called from thread that pops the queue or when there is no
@@ -479,6 +796,23 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Makes a pair of spans covering 'n' slots starting at 'index'.
+    //*************************************************************************
+    span_pair make_span_pair(size_type index, size_type n) const
+    {
+      size_type to_end = size_type(RESERVED - index);
+
+      if (n <= to_end)
+      {
+        return span_pair(etl::span<T>(p_buffer + index, n), etl::span<T>());
+      }
+      else
+      {
+        return span_pair(etl::span<T>(p_buffer + index, to_end), etl::span<T>(p_buffer, n - to_end));
+      }
+    }
+
     // Disable copy construction and assignment.
     iqueue_spsc_atomic(const iqueue_spsc_atomic&) ETL_DELETE;
     iqueue_spsc_atomic& operator =(const iqueue_spsc_atomic&) ETL_DELETE;
@@ -498,13 +832,14 @@ namespace etl
   /// \tparam T            The type this queue should support.
   /// \tparam SIZE         The maximum capacity of the queue.
   /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam LAYOUT       The layout of the read and write indexes. See etl::queue_spsc_atomic_layout.
   //***************************************************************************
-  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_spsc_atomic : public iqueue_spsc_atomic<T, MEMORY_MODEL>
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, const size_t LAYOUT = etl::queue_spsc_atomic_layout::COMPACT>
+  class queue_spsc_atomic : public iqueue_spsc_atomic<T, MEMORY_MODEL, LAYOUT>
   {
   private:
 
-    typedef typename etl::iqueue_spsc_atomic<T, MEMORY_MODEL> base_t;
+    typedef typename etl::iqueue_spsc_atomic<T, MEMORY_MODEL, LAYOUT> base_t;
 
   public:
 
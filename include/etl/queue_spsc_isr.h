@@ -38,6 +38,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -59,6 +60,10 @@ namespace etl
     typedef T&&      rvalue_reference;///< An rvalue reference to the type used in the queue.
 #endif
 
+    /// A pair of spans over a contiguous region of the queue's buffer.
+    /// 'second' is non-empty when the region wraps around the end of the buffer.
+    typedef etl::pair<etl::span<T>, etl::span<T> > span_pair;
+
     //*************************************************************************
     /// Push a value to the queue from an ISR.
     //*************************************************************************
@@ -67,6 +72,16 @@ namespace etl
       return push_implementation(value);
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue from an ISR.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_from_isr(TIterator first, TIterator last)
+    {
+      return push_implementation(first, last);
+    }
+
 #if ETL_USING_CPP11
     //*************************************************************************
     /// Push a value to the queue from an ISR.
@@ -106,6 +121,50 @@ namespace etl
       return pop_implementation();
     }
 
+    //*************************************************************************
+    /// Pop up to 'max_n' values from the queue to an output iterator from an ISR.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_from_isr(TOutputIterator out, size_type max_n)
+    {
+      return pop_implementation(out, max_n);
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' free slots for writing in place from an ISR.
+    /// The slots are uninitialised storage. Values must be constructed or, for
+    /// trivial types, assigned before calling write_commit_from_isr.
+    //*************************************************************************
+    span_pair write_reserve_from_isr(size_type max_n)
+    {
+      return write_reserve_implementation(max_n);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'n' slots of the last write reservation from an ISR.
+    //*************************************************************************
+    void write_commit_from_isr(size_type n)
+    {
+      write_commit_implementation(n);
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' values for reading in place from an ISR.
+    //*************************************************************************
+    span_pair read_reserve_from_isr(size_type max_n = etl::integral_limits<size_type>::max)
+    {
+      return read_reserve_implementation(max_n);
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'n' values of the last read reservation from an ISR.
+    //*************************************************************************
+    void read_commit_from_isr(size_type n)
+    {
+      read_commit_implementation(n);
+    }
+
     //*************************************************************************
     /// Peek a value at the front of the queue from an ISR
     //*************************************************************************
@@ -238,6 +297,28 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_implementation(TIterator first, TIterator last)
+    {
+      size_type count = 0;
+
+      while ((first != last) && (current_size != MAX_SIZE))
+      {
+        ::new (&p_buffer[write_index]) T(*first);
+
+        write_index = get_next_index(write_index, MAX_SIZE);
+
+        ++current_size;
+        ++first;
+        ++count;
+      }
+
+      return count;
+    }
+
 #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ISR_FORCE_CPP03_IMPLEMENTATION)
     //*************************************************************************
     /// Constructs a value in the queue 'in place'.
@@ -378,6 +459,94 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Pop up to 'max_n' values from the queue to an output iterator.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_implementation(TOutputIterator out, size_type max_n)
+    {
+      size_type count = 0;
+
+      while ((count != max_n) && (current_size != 0))
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03_IMPLEMENTATION)
+        *out = etl::move(p_buffer[read_index]);
+#else
+        *out = p_buffer[read_index];
+#endif
+        ++out;
+
+        p_buffer[read_index].~T();
+
+        read_index = get_next_index(read_index, MAX_SIZE);
+
+        --current_size;
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' free slots for writing in place.
+    //*************************************************************************
+    span_pair write_reserve_implementation(size_type max_n)
+    {
+      size_type free_slots = MAX_SIZE - current_size;
+
+      return make_span_pair(write_index, (max_n < free_slots) ? max_n : free_slots);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'n' slots of the last write reservation.
+    //*************************************************************************
+    void write_commit_implementation(size_type n)
+    {
+      write_index = get_next_index(write_index, n, MAX_SIZE);
+
+      current_size += n;
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' values for reading in place.
+    //*************************************************************************
+    span_pair read_reserve_implementation(size_type max_n)
+    {
+      return make_span_pair(read_index, (max_n < current_size) ? max_n : current_size);
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'n' values of the last read reservation.
+    //*************************************************************************
+    void read_commit_implementation(size_type n)
+    {
+      for (size_type i = 0; i < n; ++i)
+      {
+        p_buffer[read_index].~T();
+
+        read_index = get_next_index(read_index, MAX_SIZE);
+      }
+
+      current_size -= n;
+    }
+
+    //*************************************************************************
+    /// Makes a pair of spans covering 'n' slots starting at 'index'.
+    //*************************************************************************
+    span_pair make_span_pair(size_type index, size_type n) const
+    {
+      size_type to_end = size_type(MAX_SIZE - index);
+
+      if (n <= to_end)
+      {
+        return span_pair(etl::span<T>(p_buffer + index, n), etl::span<T>());
+      }
+      else
+      {
+        return span_pair(etl::span<T>(p_buffer + index, to_end), etl::span<T>(p_buffer, n - to_end));
+      }
+    }
+
     //*************************************************************************
     /// Peek a value at the front of the queue.
     //*************************************************************************
@@ -429,6 +598,17 @@ namespace etl
       return index;
     }
 
+    //*************************************************************************
+    /// Calculate the index 'n' places after 'index'.
+    //*************************************************************************
+    static size_type get_next_index(size_type index, size_type n, size_type maximum)
+    {
+      // Avoid 'index + n' overflowing a narrow size_type.
+      const size_type remaining = size_type(maximum - index);
+
+      return (n >= remaining) ? size_type(n - remaining) : size_type(index + n);
+    }
+
     T* p_buffer;              ///< The internal buffer.
     size_type write_index;    ///< Where to input new data.
     size_type read_index;     ///< Where to get the oldest data.
@@ -480,6 +660,7 @@ namespace etl
     typedef typename base_t::rvalue_reference rvalue_reference;///< A const reference to the type used in the queue.
 #endif
     typedef typename base_t::size_type        size_type;       ///< The type used for determining the size of the queue.
+    typedef typename base_t::span_pair        span_pair;       ///< A pair of spans over a region of the queue's buffer.
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -495,6 +676,23 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Pushes as many values as will fit within a single lock.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      TAccess::lock();
+
+      size_type result = this->push_implementation(first, last);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
 #if ETL_USING_CPP11
     //*************************************************************************
     /// Push a value to the queue.
@@ -621,6 +819,81 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Pop up to 'max_n' values from the queue to an output iterator.
+    /// Pops within a single lock.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator out, size_type max_n)
+    {
+      TAccess::lock();
+
+      size_type result = this->pop_implementation(out, max_n);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' free slots for writing in place.
+    /// The slots are uninitialised storage. Values must be constructed or, for
+    /// trivial types, assigned before calling write_commit.
+    /// Must be called from the producer.
+    //*************************************************************************
+    span_pair write_reserve(size_type max_n)
+    {
+      TAccess::lock();
+
+      span_pair result = this->write_reserve_implementation(max_n);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'n' slots of the last write reservation.
+    /// Must be called from the producer.
+    //*************************************************************************
+    void write_commit(size_type n)
+    {
+      TAccess::lock();
+
+      this->write_commit_implementation(n);
+
+      TAccess::unlock();
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' values for reading in place.
+    /// Must be called from the consumer.
+    //*************************************************************************
+    span_pair read_reserve(size_type max_n = etl::integral_limits<size_type>::max)
+    {
+      TAccess::lock();
+
+      span_pair result = this->read_reserve_implementation(max_n);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'n' values of the last read reservation.
+    /// Must be called from the consumer.
+    //*************************************************************************
+    void read_commit(size_type n)
+    {
+      TAccess::lock();
+
+      this->read_commit_implementation(n);
+
+      TAccess::unlock();
+    }
+
     //*************************************************************************
     /// Peek a value at the front of the queue.
     //*************************************************************************
@@ -37,6 +37,7 @@ SOFTWARE.
 #include "memory_model.h"
 #include "integral_limits.h"
 #include "function.h"
+#include "span.h"
 #include "utility.h"
 #include "placement_new.h"
 
@@ -126,6 +127,17 @@ namespace etl
       return index;
     }
 
+    //*************************************************************************
+    /// Calculate the index 'n' places after 'index'.
+    //*************************************************************************
+    static size_type get_next_index(size_type index, size_type n, size_type maximum)
+    {
+      // Avoid 'index + n' overflowing a narrow size_type.
+      const size_type remaining = size_type(maximum - index);
+
+      return (n >= remaining) ? size_type(n - remaining) : size_type(index + n);
+    }
+
     size_type write_index;    ///< Where to input new data.
     size_type read_index;     ///< Where to get the oldest data.
     size_type current_size;   ///< The current size of the queue.
@@ -205,6 +217,10 @@ namespace etl
 #endif
     typedef typename base_t::size_type size_type;        ///< The type used for determining the size of the queue.
 
+    /// A pair of spans over a contiguous region of the queue's buffer.
+    /// 'second' is non-empty when the region wraps around the end of the buffer.
+    typedef etl::pair<etl::span<T>, etl::span<T> > span_pair;
+
     //*************************************************************************
     /// Push a value to the queue.
     //*************************************************************************
@@ -227,6 +243,34 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Unlocked.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_from_unlocked(TIterator first, TIterator last)
+    {
+      return push_implementation(first, last);
+    }
+
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Pushes as many values as will fit within a single lock.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      lock();
+
+      size_type result = push_implementation(first, last);
+
+      unlock();
+
+      return result;
+    }
+
 #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKED_FORCE_CPP03_IMPLEMENTATION)
     //*************************************************************************
     /// Push a value to the queue.
@@ -431,6 +475,130 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Pop up to 'max_n' values from the queue to an output iterator.
+    /// Unlocked.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_from_unlocked(TOutputIterator out, size_type max_n)
+    {
+      return pop_implementation(out, max_n);
+    }
+
+    //*************************************************************************
+    /// Pop up to 'max_n' values from the queue to an output iterator.
+    /// Pops within a single lock.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator out, size_type max_n)
+    {
+      lock();
+
+      size_type result = pop_implementation(out, max_n);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' free slots for writing in place.
+    /// The slots are uninitialised storage. Values must be constructed or, for
+    /// trivial types, assigned before calling write_commit.
+    /// Unlocked.
+    //*************************************************************************
+    span_pair write_reserve_from_unlocked(size_type max_n)
+    {
+      return write_reserve_implementation(max_n);
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' free slots for writing in place.
+    /// The slots are uninitialised storage. Values must be constructed or, for
+    /// trivial types, assigned before calling write_commit.
+    /// Must be called from the producer.
+    //*************************************************************************
+    span_pair write_reserve(size_type max_n)
+    {
+      lock();
+
+      span_pair result = write_reserve_implementation(max_n);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'n' slots of the last write reservation.
+    /// Unlocked.
+    //*************************************************************************
+    void write_commit_from_unlocked(size_type n)
+    {
+      write_commit_implementation(n);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'n' slots of the last write reservation.
+    /// Must be called from the producer.
+    //*************************************************************************
+    void write_commit(size_type n)
+    {
+      lock();
+
+      write_commit_implementation(n);
+
+      unlock();
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' values for reading in place.
+    /// Unlocked.
+    //*************************************************************************
+    span_pair read_reserve_from_unlocked(size_type max_n = etl::integral_limits<size_type>::max)
+    {
+      return read_reserve_implementation(max_n);
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' values for reading in place.
+    /// Must be called from the consumer.
+    //*************************************************************************
+    span_pair read_reserve(size_type max_n = etl::integral_limits<size_type>::max)
+    {
+      lock();
+
+      span_pair result = read_reserve_implementation(max_n);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'n' values of the last read reservation.
+    /// Unlocked.
+    //*************************************************************************
+    void read_commit_from_unlocked(size_type n)
+    {
+      read_commit_implementation(n);
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'n' values of the last read reservation.
+    /// Must be called from the consumer.
+    //*************************************************************************
+    void read_commit(size_type n)
+    {
+      lock();
+
+      read_commit_implementation(n);
+
+      unlock();
+    }
+
     //*************************************************************************
     /// Peek a value from the front of the queue.
     /// Unlocked
@@ -617,6 +785,29 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Unlocked.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_implementation(TIterator first, TIterator last)
+    {
+      size_type count = 0;
+
+      while ((first != last) && (this->current_size != this->MAX_SIZE))
+      {
+        ::new (&p_buffer[this->write_index]) T(*first);
+
+        this->write_index = this->get_next_index(this->write_index, this->MAX_SIZE);
+
+        ++this->current_size;
+        ++first;
+        ++count;
+      }
+
+      return count;
+    }
+
 #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKED_FORCE_CPP03_IMPLEMENTATION)
     //*************************************************************************
     /// Constructs a value in the queue 'in place'.
@@ -752,6 +943,99 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Pop up to 'max_n' values from the queue to an output iterator.
+    /// Unlocked
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_implementation(TOutputIterator out, size_type max_n)
+    {
+      size_type count = 0;
+
+      while ((count != max_n) && (this->current_size != 0))
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03_IMPLEMENTATION)
+        *out = etl::move(p_buffer[this->read_index]);
+#else
+        *out = p_buffer[this->read_index];
+#endif
+        ++out;
+
+        p_buffer[this->read_index].~T();
+
+        this->read_index = this->get_next_index(this->read_index, this->MAX_SIZE);
+
+        --this->current_size;
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' free slots for writing in place.
+    /// Unlocked
+    //*************************************************************************
+    span_pair write_reserve_implementation(size_type max_n)
+    {
+      size_type free_slots = this->MAX_SIZE - this->current_size;
+
+      return make_span_pair(this->write_index, (max_n < free_slots) ? max_n : free_slots);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'n' slots of the last write reservation.
+    /// Unlocked
+    //*************************************************************************
+    void write_commit_implementation(size_type n)
+    {
+      this->write_index = this->get_next_index(this->write_index, n, this->MAX_SIZE);
+
+      this->current_size += n;
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_n' values for reading in place.
+    /// Unlocked
+    //*************************************************************************
+    span_pair read_reserve_implementation(size_type max_n)
+    {
+      return make_span_pair(this->read_index, (max_n < this->current_size) ? max_n : this->current_size);
+    }
+
+    //*************************************************************************
+    /// Destroys and releases the first 'n' values of the last read reservation.
+    /// Unlocked
+    //*************************************************************************
+    void read_commit_implementation(size_type n)
+    {
+      for (size_type i = 0; i < n; ++i)
+      {
+        p_buffer[this->read_index].~T();
+
+        this->read_index = this->get_next_index(this->read_index, this->MAX_SIZE);
+      }
+
+      this->current_size -= n;
+    }
+
+    //*************************************************************************
+    /// Makes a pair of spans covering 'n' slots starting at 'index'.
+    //*************************************************************************
+    span_pair make_span_pair(size_type index, size_type n) const
+    {
+      size_type to_end = size_type(this->MAX_SIZE - index);
+
+      if (n <= to_end)
+      {
+        return span_pair(etl::span<T>(p_buffer + index, n), etl::span<T>());
+      }
+      else
+      {
+        return span_pair(etl::span<T>(p_buffer + index, to_end), etl::span<T>(p_buffer, n - to_end));
+      }
+    }
+
     //*************************************************************************
     /// Peek a value from the front of the queue.
     /// Unlocked
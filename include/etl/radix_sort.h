@@ -0,0 +1,466 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RADIX_SORT_INCLUDED
+#define ETL_RADIX_SORT_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "iterator.h"
+#include "integral_limits.h"
+#include "span.h"
+#include "utility.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup radix_sort radix_sort
+/// Non-comparison sorts for integral and floating point keys.
+/// The elements are distributed between the range and a caller supplied scratch
+/// buffer, so nothing is allocated.
+///\ingroup algorithm
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the radix sorts.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  class radix_sort_exception : public etl::exception
+  {
+  public:
+
+    radix_sort_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The scratch buffer is smaller than the range.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  class radix_sort_buffer_too_small : public etl::radix_sort_exception
+  {
+  public:
+
+    radix_sort_buffer_too_small(string_type file_name_, numeric_type line_number_)
+      : etl::radix_sort_exception(ETL_ERROR_TEXT("radix_sort:buffer too small", ETL_RADIX_SORT_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A key is outside of the range given to counting_sort.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  class radix_sort_key_out_of_range : public etl::radix_sort_exception
+  {
+  public:
+
+    radix_sort_key_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::radix_sort_exception(ETL_ERROR_TEXT("radix_sort:key out of range", ETL_RADIX_SORT_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_radix_sort
+  {
+    //*************************************************************************
+    /// Maps a key to an unsigned integral that has the same sort order.
+    //*************************************************************************
+    template <typename T, bool Is_Integral = etl::is_integral<T>::value, bool Is_Signed = etl::is_signed<T>::value>
+    struct key_traits;
+
+    //*************************************************************************
+    /// Unsigned integrals are used as they are.
+    //*************************************************************************
+    template <typename T>
+    struct key_traits<T, true, false>
+    {
+      typedef T type;
+
+      static type transform(T key)
+      {
+        return key;
+      }
+    };
+
+    //*************************************************************************
+    /// Signed integrals have the sign bit inverted.
+    //*************************************************************************
+    template <typename T>
+    struct key_traits<T, true, true>
+    {
+      typedef typename etl::make_unsigned<T>::type type;
+
+      static type transform(T key)
+      {
+        return type(type(key) ^ (type(1U) << (etl::integral_limits<type>::bits - 1U)));
+      }
+    };
+
+    //*************************************************************************
+    /// Floating point keys have the sign bit inverted if positive, or all of
+    /// the bits inverted if negative.
+    /// -0.0 sorts before +0.0. NaNs sort before -infinity or after +infinity,
+    /// depending on their sign.
+    //*************************************************************************
+    template <>
+    struct key_traits<float, false, true>
+    {
+      typedef uint32_t type;
+
+      static type transform(float key)
+      {
+        type bits;
+        memcpy(&bits, &key, sizeof(bits));
+
+        const type mask = type(type(0U) - (bits >> 31U)) | type(0x80000000UL);
+
+        return bits ^ mask;
+      }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct key_traits<double, false, true>
+    {
+      typedef uint64_t type;
+
+      static type transform(double key)
+      {
+        type bits;
+        memcpy(&bits, &key, sizeof(bits));
+
+        const type mask = type(type(0U) - (bits >> 63U)) | type(0x8000000000000000ULL);
+
+        return bits ^ mask;
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// The key of an element is the element.
+    //*************************************************************************
+    template <typename T>
+    struct identity_key
+    {
+      const T& operator()(const T& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Distributes the elements from 'source' to 'destination' by the byte of
+    /// the key at 'shift'.
+    /// Returns false, without moving anything, if all of the elements have
+    /// the same byte.
+    //*************************************************************************
+    template <typename TKey, typename TSource, typename TDestination, typename TKeyExtractor>
+    bool radix_pass(TSource source, TDestination destination, size_t length, size_t shift, TKeyExtractor& key)
+    {
+      typedef key_traits<TKey> traits;
+
+      size_t offsets[256];
+
+      for (size_t i = 0U; i < 256U; ++i)
+      {
+        offsets[i] = 0U;
+      }
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        ++offsets[size_t(traits::transform(key(source[i])) >> shift) & 0xFFU];
+      }
+
+      // Nothing to do if every element has the same byte.
+      if (offsets[size_t(traits::transform(key(source[0])) >> shift) & 0xFFU] == length)
+      {
+        return false;
+      }
+
+      // Convert the counts to offsets.
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < 256U; ++i)
+      {
+        const size_t count = offsets[i];
+        offsets[i] = total;
+        total += count;
+      }
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        const size_t digit = size_t(traits::transform(key(source[i])) >> shift) & 0xFFU;
+
+        destination[offsets[digit]++] = ETL_MOVE(source[i]);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// LSD radix sort, one byte of the key per pass.
+    //*************************************************************************
+    template <typename TKey, typename TIterator, typename TPointer, typename TKeyExtractor>
+    void radix_sort(TIterator first, size_t length, TPointer scratch, TKeyExtractor key)
+    {
+      typedef typename key_traits<TKey>::type unsigned_key_t;
+
+      const size_t Bits = etl::integral_limits<unsigned_key_t>::bits;
+
+      // Where the elements are currently.
+      bool in_scratch = false;
+
+      for (size_t shift = 0U; shift < Bits; shift += 8U)
+      {
+        const bool moved = in_scratch ? radix_pass<TKey>(scratch, first, length, shift, key)
+                                      : radix_pass<TKey>(first, scratch, length, shift, key);
+
+        if (moved)
+        {
+          in_scratch = !in_scratch;
+        }
+      }
+
+      if (in_scratch)
+      {
+        for (size_t i = 0U; i < length; ++i)
+        {
+          first[i] = ETL_MOVE(scratch[i]);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Counting sort of keys in the range [0, Key_Range).
+    //*************************************************************************
+    template <size_t Key_Range, typename TIterator, typename TPointer, typename TKeyExtractor>
+    void counting_sort(TIterator first, size_t length, TPointer scratch, TKeyExtractor key)
+    {
+      size_t offsets[Key_Range];
+
+      for (size_t i = 0U; i < Key_Range; ++i)
+      {
+        offsets[i] = 0U;
+      }
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        const size_t k = size_t(key(first[i]));
+
+        ETL_ASSERT_AND_RETURN(k < Key_Range, ETL_ERROR(radix_sort_key_out_of_range));
+
+        ++offsets[k];
+      }
+
+      // Convert the counts to offsets.
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < Key_Range; ++i)
+      {
+        const size_t count = offsets[i];
+        offsets[i] = total;
+        total += count;
+      }
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        scratch[offsets[size_t(key(first[i]))]++] = ETL_MOVE(first[i]);
+      }
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        first[i] = ETL_MOVE(scratch[i]);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts integral or floating point elements using an LSD radix sort.
+  /// One pass per byte of the key. Passes in which every element has the same
+  /// byte are skipped.
+  /// Stable. O(N * sizeof(key)).
+  /// Requires random access iterators.
+  ///\param first   The start of the range.
+  ///\param last    The end of the range.
+  ///\param scratch A buffer of at least the length of the range.
+  /// Emits etl::radix_sort_buffer_too_small if the scratch buffer is too small.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <typename TIterator>
+  void radix_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> scratch)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    const size_t length = size_t(etl::distance(first, last));
+
+    ETL_ASSERT_AND_RETURN(scratch.size() >= length, ETL_ERROR(radix_sort_buffer_too_small));
+
+    if (length < 2U)
+    {
+      return;
+    }
+
+    private_radix_sort::radix_sort<value_type>(first, length, scratch.data(), private_radix_sort::identity_key<value_type>());
+  }
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// Sorts elements by a key using an LSD radix sort.
+  /// The key extractor returns an integral or floating point key for an element.
+  /// It is called several times for each element, so should be cheap.
+  /// Stable. O(N * sizeof(key)).
+  /// Requires random access iterators.
+  ///\param first   The start of the range.
+  ///\param last    The end of the range.
+  ///\param scratch A buffer of at least the length of the range.
+  ///\param key     The key extractor.
+  /// Emits etl::radix_sort_buffer_too_small if the scratch buffer is too small.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <typename TIterator, typename TKeyExtractor>
+  void radix_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> scratch, TKeyExtractor key)
+  {
+    typedef typename etl::decay<decltype(key(*first))>::type key_type;
+
+    const size_t length = size_t(etl::distance(first, last));
+
+    ETL_ASSERT_AND_RETURN(scratch.size() >= length, ETL_ERROR(radix_sort_buffer_too_small));
+
+    if (length < 2U)
+    {
+      return;
+    }
+
+    private_radix_sort::radix_sort<key_type>(first, length, scratch.data(), key);
+  }
+#endif
+
+  //***************************************************************************
+  /// Sorts integral elements in the range [0, Key_Range) using a counting sort.
+  /// Equal values are indistinguishable, so they are counted and written back
+  /// and no scratch buffer is needed.
+  /// O(N + Key_Range). Uses Key_Range counters on the stack.
+  /// Requires random access iterators.
+  /// Emits etl::radix_sort_key_out_of_range, and leaves the range unchanged,
+  /// if a value is out of range.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <size_t Key_Range, typename TIterator>
+  void counting_sort(TIterator first, TIterator last)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    ETL_STATIC_ASSERT(etl::is_integral<value_type>::value, "counting_sort without a scratch buffer requires integral values");
+
+    size_t counts[Key_Range];
+
+    for (size_t i = 0U; i < Key_Range; ++i)
+    {
+      counts[i] = 0U;
+    }
+
+    for (TIterator itr = first; itr != last; ++itr)
+    {
+      const size_t k = size_t(*itr);
+
+      ETL_ASSERT_AND_RETURN(k < Key_Range, ETL_ERROR(radix_sort_key_out_of_range));
+
+      ++counts[k];
+    }
+
+    for (size_t k = 0U; k < Key_Range; ++k)
+    {
+      for (size_t count = counts[k]; count != 0U; --count)
+      {
+        *first = value_type(k);
+        ++first;
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts elements with values in the range [0, Key_Range) using a counting sort.
+  /// Stable. O(N + Key_Range). Uses Key_Range counters on the stack.
+  /// Requires random access iterators.
+  ///\param first   The start of the range.
+  ///\param last    The end of the range.
+  ///\param scratch A buffer of at least the length of the range.
+  /// Emits etl::radix_sort_buffer_too_small if the scratch buffer is too small.
+  /// Emits etl::radix_sort_key_out_of_range, and leaves the range unchanged,
+  /// if a value is out of range.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <size_t Key_Range, typename TIterator>
+  void counting_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> scratch)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    const size_t length = size_t(etl::distance(first, last));
+
+    ETL_ASSERT_AND_RETURN(scratch.size() >= length, ETL_ERROR(radix_sort_buffer_too_small));
+
+    private_radix_sort::counting_sort<Key_Range>(first, length, scratch.data(), private_radix_sort::identity_key<value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts elements by a key in the range [0, Key_Range) using a counting sort.
+  /// The key extractor returns a key that is convertible to size_t.
+  /// Stable. O(N + Key_Range). Uses Key_Range counters on the stack.
+  /// Requires random access iterators.
+  ///\param first   The start of the range.
+  ///\param last    The end of the range.
+  ///\param scratch A buffer of at least the length of the range.
+  ///\param key     The key extractor.
+  /// Emits etl::radix_sort_buffer_too_small if the scratch buffer is too small.
+  /// Emits etl::radix_sort_key_out_of_range, and leaves the range unchanged,
+  /// if a key is out of range.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <size_t Key_Range, typename TIterator, typename TKeyExtractor>
+  void counting_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> scratch, TKeyExtractor key)
+  {
+    const size_t length = size_t(etl::distance(first, last));
+
+    ETL_ASSERT_AND_RETURN(scratch.size() >= length, ETL_ERROR(radix_sort_buffer_too_small));
+
+    private_radix_sort::counting_sort<Key_Range>(first, length, scratch.data(), key);
+  }
+}
+
+#endif
@@ -34,6 +34,10 @@ SOFTWARE.
 #include "array.h"
 #include "array_view.h"
 #include "utility.h"
+#include "algorithm.h"
+#include "smallest.h"
+#include "static_assert.h"
+#include "type_traits.h"
 
 #include <stdint.h>
 
@@ -131,6 +135,11 @@ namespace etl
       const bool       from_any_state;
     };
 
+    //*************************************************************************
+    /// An entry in the index of a transition table.
+    //*************************************************************************
+    typedef uint32_t transition_index_t;
+
     //*************************************************************************
     /// State definition
     //*************************************************************************
@@ -152,6 +161,230 @@ namespace etl
     };
   }
 
+  namespace private_state_chart
+  {
+    //*************************************************************************
+    /// An index of a transition table, sorted by event, then state, then
+    /// position in the table. Transitions from any state sort after those from
+    /// a specific state, so the transitions for an event and state are found
+    /// with two binary searches, in table order.
+    /// Each entry packs the event, 'from any state' flag, state and position
+    /// into an integer, so that the searches compare the entries directly.
+    //*************************************************************************
+    template <typename TTransition>
+    class transition_index
+    {
+    public:
+
+      typedef state_chart_traits::state_id_t         state_id_t;
+      typedef state_chart_traits::event_id_t         event_id_t;
+      typedef state_chart_traits::transition_index_t entry_t;
+
+      //*******************************
+      /// Builds the index of the transition table.
+      //*******************************
+      static void build(const TTransition* table, entry_t* index, size_t size)
+      {
+        for (size_t i = 0U; i < size; ++i)
+        {
+          const TTransition& t = table[i];
+
+          index[i] = make_entry(t.event_id, t.from_any_state, t.from_any_state ? state_id_t(0U) : t.current_state_id, i);
+        }
+
+        etl::sort(index, index + size);
+      }
+
+      //*******************************
+      /// Finds the first transition, at or after 'position', for the event and state.
+      /// Returns 'size' if there are none.
+      //*******************************
+      static size_t find(const entry_t* index, size_t size, size_t position, event_id_t event_id, state_id_t state_id)
+      {
+        size_t result = size;
+
+        // From this state.
+        const entry_t state_entry = make_entry(event_id, false, state_id, position);
+        const entry_t* itr = lower_bound(index, size, state_entry);
+
+        if ((itr != (index + size)) && is_same_transition(*itr, state_entry))
+        {
+          result = get_position(*itr);
+        }
+
+        // From any state.
+        const entry_t any_entry = make_entry(event_id, true, 0U, position);
+        itr = lower_bound(index, size, any_entry);
+
+        if ((itr != (index + size)) && is_same_transition(*itr, any_entry) && (get_position(*itr) < result))
+        {
+          result = get_position(*itr);
+        }
+
+        return result;
+      }
+
+    private:
+
+      //*******************************
+      static entry_t make_entry(event_id_t event_id, bool from_any_state, state_id_t state_id, size_t position)
+      {
+        return (entry_t(event_id) << 17U) | (entry_t(from_any_state ? 1U : 0U) << 16U) | (entry_t(state_id) << 8U) | entry_t(position);
+      }
+
+      //*******************************
+      static bool is_same_transition(entry_t lhs, entry_t rhs)
+      {
+        return (lhs >> 8U) == (rhs >> 8U);
+      }
+
+      //*******************************
+      static size_t get_position(entry_t entry)
+      {
+        return size_t(entry & 0xFFU);
+      }
+
+      //*******************************
+      /// A lower bound search without data dependent branches.
+      //*******************************
+      static const entry_t* lower_bound(const entry_t* index, size_t size, entry_t value)
+      {
+        if (size == 0U)
+        {
+          return index;
+        }
+
+        while (size > 1U)
+        {
+          const size_t half = size / 2U;
+
+          index = (index[half] < value) ? index + half : index;
+          size -= half;
+        }
+
+        return (*index < value) ? index + 1U : index;
+      }
+    };
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    /// The number of states that the state chart may be in.
+    //*************************************************************************
+    template <typename TTransition>
+    constexpr size_t dense_number_of_states(const TTransition* table, size_t size, state_chart_traits::state_id_t initial_state)
+    {
+      size_t highest = initial_state;
+
+      for (size_t i = 0U; i < size; ++i)
+      {
+        if (!table[i].from_any_state && (table[i].current_state_id > highest))
+        {
+          highest = table[i].current_state_id;
+        }
+
+        if (table[i].next_state_id > highest)
+        {
+          highest = table[i].next_state_id;
+        }
+      }
+
+      return highest + 1U;
+    }
+
+    //*************************************************************************
+    /// The number of events that the transition table handles.
+    //*************************************************************************
+    template <typename TTransition>
+    constexpr size_t dense_number_of_events(const TTransition* table, size_t size)
+    {
+      size_t highest = 0U;
+
+      for (size_t i = 0U; i < size; ++i)
+      {
+        if (table[i].event_id > highest)
+        {
+          highest = table[i].event_id;
+        }
+      }
+
+      return highest + 1U;
+    }
+
+    //*************************************************************************
+    /// A table, built at compile time, of the first transition for each state
+    /// and event. The transition table must be constexpr.
+    /// The last row is for states that only have transitions from any state.
+    //*************************************************************************
+    template <typename TTransition, const TTransition* Table, size_t Size, state_chart_traits::state_id_t Initial_State>
+    class dense_transition_index
+    {
+    public:
+
+      typedef state_chart_traits::state_id_t state_id_t;
+      typedef state_chart_traits::event_id_t event_id_t;
+
+      //*******************************
+      /// Finds the first transition for the event and state.
+      /// Returns 'Size' if there are none.
+      //*******************************
+      static size_t find(event_id_t event_id, state_id_t state_id)
+      {
+        static constexpr entries_t entries = build();
+
+        if (event_id >= Number_Of_Events)
+        {
+          return Size;
+        }
+
+        const size_t row = (state_id < Number_Of_States) ? size_t(state_id) : size_t(Number_Of_States);
+
+        return entries.position[(row * Number_Of_Events) + event_id];
+      }
+
+    private:
+
+      typedef typename etl::smallest_uint_for_value<Size>::type position_t;
+
+      static constexpr size_t Number_Of_States = dense_number_of_states(Table, Size, Initial_State);
+      static constexpr size_t Number_Of_Events = dense_number_of_events(Table, Size);
+      static constexpr size_t Number_Of_Rows   = Number_Of_States + 1U;
+
+      //*******************************
+      struct entries_t
+      {
+        position_t position[Number_Of_Rows * Number_Of_Events];
+      };
+
+      //*******************************
+      static constexpr entries_t build()
+      {
+        entries_t entries = {};
+
+        for (size_t i = 0U; i < (Number_Of_Rows * Number_Of_Events); ++i)
+        {
+          entries.position[i] = static_cast<position_t>(Size);
+        }
+
+        // Work backwards, so that the first transition in the table wins.
+        for (size_t i = Size; i != 0U; --i)
+        {
+          const TTransition& t = Table[i - 1U];
+
+          for (size_t row = 0U; row < Number_Of_Rows; ++row)
+          {
+            if (t.from_any_state || (t.current_state_id == row))
+            {
+              entries.position[(row * Number_Of_Events) + t.event_id] = static_cast<position_t>(i - 1U);
+            }
+          }
+        }
+
+        return entries;
+      }
+    };
+#endif
+  }
+
   //***************************************************************************
   /// For non-void parameter types
   //***************************************************************************
@@ -226,6 +459,9 @@ namespace etl
   /// Simple Finite State Machine
   /// Compile time tables.
   /// Event has no parameter.
+  /// If Use_Transition_Index is true, a table of the first transition for each
+  /// state and event is built at compile time, and the transition table must be
+  /// constexpr. Requires C++14.
   //***************************************************************************
   template <typename                                                  TObject, 
             TObject&                                                  TObject_Ref,
@@ -233,11 +469,14 @@ namespace etl
             size_t                                                    Transition_Table_Size,
             const etl::state_chart_traits::state<TObject>*            State_Table_Begin,
             size_t                                                    State_Table_Size,
-            etl::state_chart_traits::state_id_t                       Initial_State>
+            etl::state_chart_traits::state_id_t                       Initial_State,
+            bool                                                      Use_Transition_Index = false>
   class state_chart_ct : public istate_chart<void>
   {
   public:  
 
+    ETL_STATIC_ASSERT(!Use_Transition_Index || ETL_USING_CPP14, "The transition index requires C++14");
+
     typedef void parameter_t;
     typedef state_chart_traits::state_id_t state_id_t;
     typedef state_chart_traits::event_id_t event_id_t;
@@ -304,7 +543,7 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = Transition_Table_Begin;
+        const transition* t = first_transition(event_id);
 
         // Keep looping until we execute a transition or reach the end of the table.
         while (t != (Transition_Table_Begin + Transition_Table_Size))
@@ -373,6 +612,30 @@ namespace etl
       return etl::find_if(State_Table_Begin, State_Table_Begin + State_Table_Size, is_state(state_id));
     }
 
+    //*************************************************************************
+    /// Gets the first transition in the table that may be for the event.
+    //*************************************************************************
+    const transition* first_transition(event_id_t event_id) const
+    {
+      return first_transition(event_id, etl::integral_constant<bool, Use_Transition_Index>());
+    }
+
+    //*************************************************************************
+    const transition* first_transition(event_id_t, etl::false_type) const
+    {
+      return Transition_Table_Begin;
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    const transition* first_transition(event_id_t event_id, etl::true_type) const
+    {
+      typedef private_state_chart::dense_transition_index<transition, Transition_Table_Begin, Transition_Table_Size, Initial_State> index;
+
+      return Transition_Table_Begin + index::find(event_id, this->current_state_id);
+    }
+#endif
+
     //*************************************************************************
     struct is_transition
     {
@@ -418,6 +681,9 @@ namespace etl
   /// Simple Finite State Machine
   /// Compile time tables.
   /// Event has parameter.
+  /// If Use_Transition_Index is true, a table of the first transition for each
+  /// state and event is built at compile time, and the transition table must be
+  /// constexpr. Requires C++14.
   //***************************************************************************
   template <typename                                                        TObject,
             typename                                                        TParameter,
@@ -426,11 +692,14 @@ namespace etl
             size_t                                                          Transition_Table_Size,
             const etl::state_chart_traits::state<TObject>*                  State_Table_Begin,
             size_t                                                          State_Table_Size,
-            etl::state_chart_traits::state_id_t                             Initial_State>
+            etl::state_chart_traits::state_id_t                             Initial_State,
+            bool                                                            Use_Transition_Index = false>
   class state_chart_ctp : public istate_chart<TParameter>
   {
   public:
 
+    ETL_STATIC_ASSERT(!Use_Transition_Index || ETL_USING_CPP14, "The transition index requires C++14");
+
     typedef TParameter parameter_t;
     typedef state_chart_traits::state_id_t state_id_t;
     typedef state_chart_traits::event_id_t event_id_t;
@@ -497,7 +766,7 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = Transition_Table_Begin;
+        const transition* t = first_transition(event_id);
 
         // Keep looping until we execute a transition or reach the end of the table.
         while (t != (Transition_Table_Begin + Transition_Table_Size))
@@ -570,6 +839,30 @@ namespace etl
       return etl::find_if(State_Table_Begin, State_Table_Begin + State_Table_Size, is_state(state_id));
     }
 
+    //*************************************************************************
+    /// Gets the first transition in the table that may be for the event.
+    //*************************************************************************
+    const transition* first_transition(event_id_t event_id) const
+    {
+      return first_transition(event_id, etl::integral_constant<bool, Use_Transition_Index>());
+    }
+
+    //*************************************************************************
+    const transition* first_transition(event_id_t, etl::false_type) const
+    {
+      return Transition_Table_Begin;
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    const transition* first_transition(event_id_t event_id, etl::true_type) const
+    {
+      typedef private_state_chart::dense_transition_index<transition, Transition_Table_Begin, Transition_Table_Size, Initial_State> index;
+
+      return Transition_Table_Begin + index::find(event_id, this->current_state_id);
+    }
+#endif
+
     //*************************************************************************
     struct is_transition
     {
@@ -646,8 +939,10 @@ namespace etl
       , object(object_)
       , transition_table_begin(transition_table_begin_)
       , state_table_begin(state_table_begin_)
+      , transition_index_begin(ETL_NULLPTR)
       , transition_table_size(transition_table_end_ - transition_table_begin_)
       , state_table_size(state_table_end_ - state_table_begin_)
+      , transition_index_size(0U)
       , started(false)
     {
     }
@@ -662,6 +957,26 @@ namespace etl
     {
       transition_table_begin = transition_table_begin_;
       transition_table_size = transition_table_end_ - transition_table_begin_;
+
+      build_transition_index();
+    }
+
+    //*************************************************************************
+    /// Sets a buffer for an index of the transition table, and builds the index.
+    /// Events are then found with a binary search of the index, rather than a
+    /// linear search of the table. The index is rebuilt if the transition table
+    /// is changed.
+    /// The buffer must have an entry for each transition, otherwise it is not used.
+    /// \param transition_index_begin_ The start of the index buffer.
+    /// \param transition_index_end_   The end of the index buffer.
+    //*************************************************************************
+    void set_transition_index(state_chart_traits::transition_index_t* transition_index_begin_,
+                              state_chart_traits::transition_index_t* transition_index_end_)
+    {
+      transition_index_begin = transition_index_begin_;
+      transition_index_size  = transition_index_end_ - transition_index_begin_;
+
+      build_transition_index();
     }
 
     //*************************************************************************
@@ -733,7 +1048,7 @@ namespace etl
         while (t != transition_table_end())
         {
           // Scan the transition table from the latest position.
-          t = etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+          t = find_transition(t, event_id);
 
           // Found an entry?
           if (t != transition_table_end())
@@ -807,6 +1122,44 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Finds the next transition for the event, starting at 't'.
+    //*************************************************************************
+    const transition* find_transition(const transition* t, event_id_t event_id) const
+    {
+      if (has_transition_index())
+      {
+        typedef private_state_chart::transition_index<transition> index;
+
+        return transition_table_begin + index::find(transition_index_begin,
+                                                    transition_table_size,
+                                                    size_t(t - transition_table_begin),
+                                                    event_id,
+                                                    this->current_state_id);
+      }
+      else
+      {
+        return etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+      }
+    }
+
+    //*************************************************************************
+    /// Builds the transition index, if there is one.
+    //*************************************************************************
+    void build_transition_index()
+    {
+      if (has_transition_index())
+      {
+        private_state_chart::transition_index<transition>::build(transition_table_begin, transition_index_begin, transition_table_size);
+      }
+    }
+
+    //*************************************************************************
+    bool has_transition_index() const
+    {
+      return (transition_index_begin != ETL_NULLPTR) && (transition_index_size >= transition_table_size);
+    }
+
     //*************************************************************************
     const transition* transition_table_end() const
     {
@@ -857,12 +1210,14 @@ namespace etl
     state_chart(const state_chart&) ETL_DELETE;
     state_chart& operator =(const state_chart&) ETL_DELETE;
 
-    TObject&          object;                 ///< The object that supplies guard and action member functions.
-    const transition* transition_table_begin; ///< The start of the table of transitions.
-    const state*      state_table_begin;      ///< The start of the table of states.
-    uint_least8_t     transition_table_size;  ///< The size of the table of transitions.
-    uint_least8_t     state_table_size;       ///< The size of the table of states.
-    bool              started;                ///< Set if the state chart has been started.
+    TObject&                                object;                 ///< The object that supplies guard and action member functions.
+    const transition*                       transition_table_begin; ///< The start of the table of transitions.
+    const state*                            state_table_begin;      ///< The start of the table of states.
+    state_chart_traits::transition_index_t* transition_index_begin; ///< The start of the index of the transitions, or null.
+    uint_least8_t                           transition_table_size;  ///< The size of the table of transitions.
+    uint_least8_t                           state_table_size;       ///< The size of the table of states.
+    size_t                                  transition_index_size;  ///< The size of the index of the transitions.
+    bool                                    started;                ///< Set if the state chart has been started.
   };
 
   //***************************************************************************
@@ -900,8 +1255,10 @@ namespace etl
       , object(object_)
       , transition_table_begin(transition_table_begin_)
       , state_table_begin(state_table_begin_)
+      , transition_index_begin(ETL_NULLPTR)
       , transition_table_size(transition_table_end_ - transition_table_begin_)
       , state_table_size(state_table_end_ - state_table_begin_)
+      , transition_index_size(0U)
       , started(false)
     {
     }
@@ -916,6 +1273,26 @@ namespace etl
     {
       transition_table_begin = transition_table_begin_;
       transition_table_size  = transition_table_end_ - transition_table_begin_;
+
+      build_transition_index();
+    }
+
+    //*************************************************************************
+    /// Sets a buffer for an index of the transition table, and builds the index.
+    /// Events are then found with a binary search of the index, rather than a
+    /// linear search of the table. The index is rebuilt if the transition table
+    /// is changed.
+    /// The buffer must have an entry for each transition, otherwise it is not used.
+    /// \param transition_index_begin_ The start of the index buffer.
+    /// \param transition_index_end_   The end of the index buffer.
+    //*************************************************************************
+    void set_transition_index(state_chart_traits::transition_index_t* transition_index_begin_,
+                              state_chart_traits::transition_index_t* transition_index_end_)
+    {
+      transition_index_begin = transition_index_begin_;
+      transition_index_size  = transition_index_end_ - transition_index_begin_;
+
+      build_transition_index();
     }
 
     //*************************************************************************
@@ -987,7 +1364,7 @@ namespace etl
         while (t != transition_table_end())
         {
           // Scan the transition table from the latest position.
-          t = etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+          t = find_transition(t, event_id);
 
           // Found an entry?
           if (t != transition_table_end())
@@ -1057,6 +1434,44 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Finds the next transition for the event, starting at 't'.
+    //*************************************************************************
+    const transition* find_transition(const transition* t, event_id_t event_id) const
+    {
+      if (has_transition_index())
+      {
+        typedef private_state_chart::transition_index<transition> index;
+
+        return transition_table_begin + index::find(transition_index_begin,
+                                                    transition_table_size,
+                                                    size_t(t - transition_table_begin),
+                                                    event_id,
+                                                    this->current_state_id);
+      }
+      else
+      {
+        return etl::find_if(t, transition_table_end(), is_transition(event_id, this->current_state_id));
+      }
+    }
+
+    //*************************************************************************
+    /// Builds the transition index, if there is one.
+    //*************************************************************************
+    void build_transition_index()
+    {
+      if (has_transition_index())
+      {
+        private_state_chart::transition_index<transition>::build(transition_table_begin, transition_index_begin, transition_table_size);
+      }
+    }
+
+    //*************************************************************************
+    bool has_transition_index() const
+    {
+      return (transition_index_begin != ETL_NULLPTR) && (transition_index_size >= transition_table_size);
+    }
+
     //*************************************************************************
     const transition* transition_table_end() const
     {
@@ -1107,12 +1522,14 @@ namespace etl
     state_chart(const state_chart&) ETL_DELETE;
     state_chart& operator =(const state_chart&) ETL_DELETE;
 
-    TObject&          object;                 ///< The object that supplies guard and action member functions.
-    const transition* transition_table_begin; ///< The start of the table of transitions.
-    const state*      state_table_begin;      ///< The start of the table of states.
-    uint_least8_t     transition_table_size;  ///< The size of the table of transitions.
-    uint_least8_t     state_table_size;       ///< The size of the table of states.
-    bool              started;                ///< Set if the state chart has been started.
+    TObject&                                object;                 ///< The object that supplies guard and action member functions.
+    const transition*                       transition_table_begin; ///< The start of the table of transitions.
+    const state*                            state_table_begin;      ///< The start of the table of states.
+    state_chart_traits::transition_index_t* transition_index_begin; ///< The start of the index of the transitions, or null.
+    uint_least8_t                           transition_table_size;  ///< The size of the table of transitions.
+    uint_least8_t                           state_table_size;       ///< The size of the table of states.
+    size_t                                  transition_index_size;  ///< The size of the index of the transitions.
+    bool                                    started;                ///< Set if the state chart has been started.
   };
 }
 
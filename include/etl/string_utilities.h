@@ -37,6 +37,7 @@ SOFTWARE.
 #include "memory.h"
 #include "char_traits.h"
 #include "optional.h"
+#include "private/string_search.h"
 
 #include <ctype.h>
 #include <stdint.h>
@@ -719,6 +720,8 @@ namespace etl
 
     const_pointer end_ptr   = begin_ptr + input.size();
 
+    const size_t delimiters_length = etl::strlen(delimiters);
+
     while (!token_found)
     {
       // Does the last view have valid data?
@@ -735,7 +738,7 @@ namespace etl
 
       // Look for the next token.
       const_pointer first_ptr = begin_ptr + position;
-      const_pointer last_ptr  = find_first_of(first_ptr, end_ptr, delimiters);
+      const_pointer last_ptr  = first_ptr + etl::private_string_search::find_of(first_ptr, size_t(end_ptr - first_ptr), delimiters, delimiters_length, true);
 
       view = TStringView(first_ptr, etl::distance(first_ptr, last_ptr));
 
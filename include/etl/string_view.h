@@ -41,6 +41,7 @@ SOFTWARE.
 #include "hash.h"
 #include "basic_string.h"
 #include "algorithm.h"
+#include "private/string_search.h"
 #include "private/minmax_push.h"
 
 #include <stdint.h>
@@ -479,26 +480,12 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      if ((size() < view.size()))
-      {
-        return npos;
-      }
-
-      const_iterator iposition = etl::search(begin() + position, end(), view.begin(), view.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return etl::private_string_search::find(mbegin, size(), position, view.data(), view.size());
     }
 
     ETL_CONSTEXPR14 size_type find(T c, size_type position = 0) const
     {
-      return find(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      return etl::private_string_search::find(mbegin, size(), position, c);
     }
 
     ETL_CONSTEXPR14 size_type find(const T* text, size_type position, size_type count) const
@@ -516,31 +503,12 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type rfind(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if ((size() < view.size()))
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size());
-
-      const_iterator iposition = etl::find_end(begin(),
-        begin() + position,
-        view.begin(),
-        view.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return etl::private_string_search::rfind(mbegin, size(), position, view.data(), view.size());
     }
 
     ETL_CONSTEXPR14 size_type rfind(T c, size_type position = npos) const
     {
-      return rfind(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      return etl::private_string_search::rfind(mbegin, size(), position, c);
     }
 
     ETL_CONSTEXPR14 size_type rfind(const T* text, size_type position, size_type count) const
@@ -558,25 +526,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0UL; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
-        }
-      }
-
-      return npos;
+      return etl::private_string_search::find_of(mbegin, size(), position, view.data(), view.size(), true);
     }
 
     ETL_CONSTEXPR14 size_type find_first_of(T c, size_type position = 0) const
@@ -599,32 +549,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_last_of(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return etl::private_string_search::rfind_of(mbegin, size(), position, view.data(), view.size(), true);
     }
 
     ETL_CONSTEXPR14 size_type find_last_of(T c, size_type position = npos) const
@@ -647,32 +572,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_first_not_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0UL; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return etl::private_string_search::find_of(mbegin, size(), position, view.data(), view.size(), false);
     }
 
     ETL_CONSTEXPR14 size_type find_first_not_of(T c, size_type position = 0) const
@@ -695,39 +595,7 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_type find_last_not_of(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = etl::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0UL; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return etl::private_string_search::rfind_of(mbegin, size(), position, view.data(), view.size(), false);
     }
 
     ETL_CONSTEXPR14 size_type find_last_not_of(T c, size_type position = npos) const
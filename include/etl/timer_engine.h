@@ -0,0 +1,559 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMER_ENGINE_INCLUDED
+#define ETL_TIMER_ENGINE_INCLUDED
+
+#include "platform.h"
+#include "timer.h"
+#include "binary.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Engines that order the active timers of the timer framework.
+//
+// An engine is selected by the TEngine template parameter of the
+// callback and message timers. Each engine exposes a nested 'engine'
+// template that is instantiated with the timer's data type.
+// The timer data type must have the members 'id', 'delta', 'previous' and 'next'.
+//
+// Engine interface.
+//   engine(TTimerData* ptimers)
+//   bool empty() const
+//   void insert(etl::timer::id::type id)  : Inserts a timer that expires in 'delta' ticks.
+//   void remove(etl::timer::id::type id)  : Removes an active timer.
+//   etl::timer::id::type next_expired(uint32_t& count)
+//                                         : Removes and returns the next timer that expires within 'count' ticks,
+//                                         : deducting the ticks used from 'count'.
+//                                         : Returns etl::timer::id::NO_TIMER when there are none, having used all of 'count'.
+//   void clear()
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Orders active timers in a delta list.
+  /// Expiry is O(1), start and stop are O(N) in the number of active timers.
+  /// The default engine.
+  //***************************************************************************
+  struct timer_delta_list
+  {
+    //*************************************************************************
+    /// A specialised intrusive linked list for timer data.
+    //*************************************************************************
+    template <typename TTimerData>
+    class engine
+    {
+    public:
+
+      //*******************************
+      engine(TTimerData* ptimers_)
+        : head(etl::timer::id::NO_TIMER)
+        , tail(etl::timer::id::NO_TIMER)
+        , ptimers(ptimers_)
+      {
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return head == etl::timer::id::NO_TIMER;
+      }
+
+      //*******************************
+      // Inserts the timer at the correct delta position
+      //*******************************
+      void insert(etl::timer::id::type id_)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        if (head == etl::timer::id::NO_TIMER)
+        {
+          // No entries yet.
+          head = id_;
+          tail = id_;
+          timer.previous = etl::timer::id::NO_TIMER;
+          timer.next     = etl::timer::id::NO_TIMER;
+        }
+        else
+        {
+          // We already have entries.
+          etl::timer::id::type test_id = head;
+
+          while (test_id != etl::timer::id::NO_TIMER)
+          {
+            TTimerData& test = ptimers[test_id];
+
+            // Find the correct place to insert.
+            if (timer.delta <= test.delta)
+            {
+              if (test.id == head)
+              {
+                head = timer.id;
+              }
+
+              // Insert before test.
+              timer.previous = test.previous;
+              test.previous  = timer.id;
+              timer.next     = test.id;
+
+              // Adjust the next delta to compensate.
+              test.delta -= timer.delta;
+
+              if (timer.previous != etl::timer::id::NO_TIMER)
+              {
+                ptimers[timer.previous].next = timer.id;
+              }
+              break;
+            }
+            else
+            {
+              timer.delta -= test.delta;
+            }
+
+            test_id = test.next;
+          }
+
+          // Reached the end?
+          if (test_id == etl::timer::id::NO_TIMER)
+          {
+            // Tag on to the tail.
+            ptimers[tail].next = timer.id;
+            timer.previous     = tail;
+            timer.next         = etl::timer::id::NO_TIMER;
+            tail               = timer.id;
+          }
+        }
+      }
+
+      //*******************************
+      void remove(etl::timer::id::type id_)
+      {
+        unlink(id_, false);
+      }
+
+      //*******************************
+      etl::timer::id::type next_expired(uint32_t& count)
+      {
+        if (head != etl::timer::id::NO_TIMER)
+        {
+          TTimerData& timer = ptimers[head];
+
+          if (count >= timer.delta)
+          {
+            count -= timer.delta;
+            unlink(timer.id, true);
+
+            return timer.id;
+          }
+
+          // Subtract any remainder from the next due timeout.
+          timer.delta -= count;
+        }
+
+        count = 0U;
+
+        return etl::timer::id::NO_TIMER;
+      }
+
+      //*******************************
+      void clear()
+      {
+        etl::timer::id::type id = head;
+
+        while (id != etl::timer::id::NO_TIMER)
+        {
+          TTimerData& timer = ptimers[id];
+          id = timer.next;
+          timer.next = etl::timer::id::NO_TIMER;
+        }
+
+        head = etl::timer::id::NO_TIMER;
+        tail = etl::timer::id::NO_TIMER;
+      }
+
+    private:
+
+      //*******************************
+      void unlink(etl::timer::id::type id_, bool has_expired)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        if (head == id_)
+        {
+          head = timer.next;
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+        }
+
+        if (tail == id_)
+        {
+          tail = timer.previous;
+        }
+        else
+        {
+          ptimers[timer.next].previous = timer.previous;
+        }
+
+        if (!has_expired)
+        {
+          // Adjust the next delta.
+          if (timer.next != etl::timer::id::NO_TIMER)
+          {
+            ptimers[timer.next].delta += timer.delta;
+          }
+        }
+
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = etl::timer::id::NO_TIMER;
+        timer.delta    = etl::timer::state::INACTIVE;
+      }
+
+      etl::timer::id::type head;
+      etl::timer::id::type tail;
+
+      TTimerData* const ptimers;
+    };
+  };
+
+  //***************************************************************************
+  /// Orders active timers in a hierarchical timing wheel.
+  /// Start, stop and expiry are O(1) in the number of active timers.
+  /// Each level has 2^BITS_PER_LEVEL slots, and enough levels are used to cover
+  /// the 32 bit timer period. Idle ticks are skipped using a per level
+  /// occupancy bitmap, so the cost of 'tick' does not depend on the tick count.
+  /// Timers that expire on the same tick are called in an unspecified order.
+  ///\tparam BITS_PER_LEVEL The number of slot bits per level. 1 to 5.
+  //***************************************************************************
+  template <size_t BITS_PER_LEVEL = 5U>
+  struct timer_wheel
+  {
+    ETL_STATIC_ASSERT((BITS_PER_LEVEL >= 1U) && (BITS_PER_LEVEL <= 5U), "BITS_PER_LEVEL must be 1 to 5");
+
+    static ETL_CONSTANT size_t Bits_Per_Level  = BITS_PER_LEVEL;
+    static ETL_CONSTANT size_t Slots_Per_Level = 1U << BITS_PER_LEVEL;
+    static ETL_CONSTANT size_t Levels          = (32U + BITS_PER_LEVEL - 1U) / BITS_PER_LEVEL;
+
+    //*************************************************************************
+    /// The timing wheel.
+    /// A timer in level L expires when the wheel time reaches the start of its
+    /// slot, when it is cascaded to a lower level, or, for level 0, expires.
+    /// The 'delta' member holds the expiry time's bits needed to find its slot
+    /// and cascade it, which is always less than etl::timer::state::INACTIVE.
+    //*************************************************************************
+    template <typename TTimerData>
+    class engine
+    {
+    public:
+
+      //*******************************
+      engine(TTimerData* ptimers_)
+        : now(0U)
+        , ptimers(ptimers_)
+      {
+        clear();
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        for (size_t level = 0U; level < Levels; ++level)
+        {
+          if (occupied[level] != 0U)
+          {
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+      //*******************************
+      // Inserts the timer in the slot for its expiry time.
+      //*******************************
+      void insert(etl::timer::id::type id_)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        place(timer, timer.delta);
+      }
+
+      //*******************************
+      void remove(etl::timer::id::type id_)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        size_t level = 0U;
+        size_t slot  = 0U;
+
+        if (timer.previous == etl::timer::id::NO_TIMER)
+        {
+          // The head of a slot, so find it.
+          find_slot(timer, level, slot);
+        }
+
+        unlink(timer, level, slot);
+      }
+
+      //*******************************
+      etl::timer::id::type next_expired(uint32_t& count)
+      {
+        while (true)
+        {
+          // Any timers due now?
+          const size_t slot = static_cast<size_t>(now & (Slots_Per_Level - 1U));
+
+          etl::timer::id::type id = heads[0][slot];
+
+          if (id != etl::timer::id::NO_TIMER)
+          {
+            unlink(ptimers[id], 0U, slot);
+            return id;
+          }
+
+          // Skip to the next occupied slot.
+          uint32_t distance;
+
+          if (!next_event(distance) || (distance > count))
+          {
+            now  += count;
+            count = 0U;
+
+            return etl::timer::id::NO_TIMER;
+          }
+
+          now   += distance;
+          count -= distance;
+
+          cascade();
+        }
+      }
+
+      //*******************************
+      void clear()
+      {
+        for (size_t level = 0U; level < Levels; ++level)
+        {
+          occupied[level] = 0U;
+
+          for (size_t slot = 0U; slot < Slots_Per_Level; ++slot)
+          {
+            heads[level][slot] = etl::timer::id::NO_TIMER;
+          }
+        }
+      }
+
+    private:
+
+      static ETL_CONSTANT size_t   Top_Level       = Levels - 1U;
+      static ETL_CONSTANT size_t   Top_Level_Shift = Bits_Per_Level * Top_Level;
+      static ETL_CONSTANT size_t   Top_Level_Slots = size_t(1U) << (32U - Top_Level_Shift);
+      static ETL_CONSTANT uint32_t Stored_Mask     = (uint32_t(1U) << Top_Level_Shift) - 1U;
+
+      //*******************************
+      /// The number of slots in a level.
+      //*******************************
+      static size_t level_slots(size_t level)
+      {
+        return (level == Top_Level) ? Top_Level_Slots : Slots_Per_Level;
+      }
+
+      //*******************************
+      /// The expiry time bits that are kept for a timer in a level.
+      //*******************************
+      static uint32_t stored_mask(size_t level)
+      {
+        return (level == Top_Level) ? Stored_Mask : (uint32_t(1U) << (Bits_Per_Level * (level + 1U))) - 1U;
+      }
+
+      //*******************************
+      /// Adds a timer to the slot for an expiry of 'now + ticks'.
+      //*******************************
+      void place(TTimerData& timer, uint32_t ticks)
+      {
+        const uint32_t expiry = now + ticks;
+
+        size_t level = 0U;
+
+        while ((level < Top_Level) && ((ticks >> (Bits_Per_Level * (level + 1U))) != 0U))
+        {
+          ++level;
+        }
+
+        const size_t slot = static_cast<size_t>((expiry >> (Bits_Per_Level * level)) & (level_slots(level) - 1U));
+
+        timer.delta    = expiry & stored_mask(level);
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = heads[level][slot];
+
+        if (timer.next != etl::timer::id::NO_TIMER)
+        {
+          ptimers[timer.next].previous = timer.id;
+        }
+
+        heads[level][slot] = timer.id;
+        occupied[level]   |= uint32_t(1U) << slot;
+      }
+
+      //*******************************
+      /// Removes a timer from its slot.
+      /// 'level' and 'slot' are only used if the timer is the head of the slot.
+      //*******************************
+      void unlink(TTimerData& timer, size_t level, size_t slot)
+      {
+        if (timer.previous == etl::timer::id::NO_TIMER)
+        {
+          heads[level][slot] = timer.next;
+
+          if (timer.next == etl::timer::id::NO_TIMER)
+          {
+            occupied[level] &= ~(uint32_t(1U) << slot);
+          }
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+        }
+
+        if (timer.next != etl::timer::id::NO_TIMER)
+        {
+          ptimers[timer.next].previous = timer.previous;
+        }
+
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = etl::timer::id::NO_TIMER;
+        timer.delta    = etl::timer::state::INACTIVE;
+      }
+
+      //*******************************
+      /// Finds the slot that a timer is the head of.
+      //*******************************
+      void find_slot(const TTimerData& timer, size_t& level, size_t& slot) const
+      {
+        for (level = 0U; level < Top_Level; ++level)
+        {
+          slot = static_cast<size_t>((timer.delta >> (Bits_Per_Level * level)) & (Slots_Per_Level - 1U));
+
+          if (heads[level][slot] == timer.id)
+          {
+            return;
+          }
+        }
+
+        // The top level does not keep the slot bits.
+        for (slot = 0U; slot < Top_Level_Slots; ++slot)
+        {
+          if (heads[Top_Level][slot] == timer.id)
+          {
+            return;
+          }
+        }
+      }
+
+      //*******************************
+      /// Gets the number of ticks to the next occupied slot.
+      /// Returns false if there are no active timers.
+      //*******************************
+      bool next_event(uint32_t& distance) const
+      {
+        bool found = false;
+
+        for (size_t level = 0U; level < Levels; ++level)
+        {
+          const uint32_t bits = occupied[level];
+
+          if (bits != 0U)
+          {
+            const size_t   shift   = Bits_Per_Level * level;
+            const size_t   n_slots = level_slots(level);
+            const uint32_t all     = (n_slots == 32U) ? 0xFFFFFFFFUL : ((uint32_t(1U) << n_slots) - 1U);
+            const size_t   first   = static_cast<size_t>(((now >> shift) + 1U) & (n_slots - 1U));
+
+            // Rotate the bitmap so that the slot after the current one is bit 0.
+            const uint32_t rotated = (first == 0U) ? bits : (((bits >> first) | (bits << (n_slots - first))) & all);
+            const uint32_t slots   = uint32_t(etl::count_trailing_zeros(rotated)) + 1U;
+
+            // Ticks to the start of the slot. Wraps correctly for the top level.
+            const uint32_t ticks = uint32_t(slots << shift) - (now & ((uint32_t(1U) << shift) - 1U));
+
+            if (!found || (ticks < distance))
+            {
+              distance = ticks;
+              found    = true;
+            }
+          }
+        }
+
+        return found;
+      }
+
+      //*******************************
+      /// Moves the timers in the slots that start now to lower levels.
+      //*******************************
+      void cascade()
+      {
+        for (size_t level = Top_Level; level > 0U; --level)
+        {
+          const size_t   shift   = Bits_Per_Level * level;
+          const uint32_t lower   = (uint32_t(1U) << shift) - 1U;
+
+          if ((now & lower) == 0U)
+          {
+            const size_t slot = static_cast<size_t>((now >> shift) & (level_slots(level) - 1U));
+
+            etl::timer::id::type id = heads[level][slot];
+
+            heads[level][slot] = etl::timer::id::NO_TIMER;
+            occupied[level]   &= ~(uint32_t(1U) << slot);
+
+            while (id != etl::timer::id::NO_TIMER)
+            {
+              TTimerData& timer = ptimers[id];
+              id = timer.next;
+
+              place(timer, timer.delta & lower);
+            }
+          }
+        }
+      }
+
+      uint32_t             now;
+      uint32_t             occupied[Levels];
+      etl::timer::id::type heads[Levels][Slots_Per_Level];
+
+      TTimerData* const ptimers;
+    };
+  };
+}
+
+#endif
@@ -45,6 +45,8 @@ SOFTWARE.
 #include "absolute.h"
 #include "expected.h"
 
+#include "private/decimal_to_float.h"
+
 namespace etl
 {
   //***************************************************************************
@@ -548,6 +550,7 @@ namespace etl
               const char digit = digit_value(c, etl::radix::decimal);
               exponent_value *= etl::radix::decimal;
               is_negative_exponent ? exponent_value -= digit : exponent_value += digit;
+              expecting_sign = false;
             }
             else
             {
@@ -651,6 +654,222 @@ namespace etl
     };
 #endif
 
+    //***************************************************************************
+    /// Returns the value of a decimal digit, or a value greater than 9 if the
+    /// character is not a decimal digit.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    uint32_t decimal_digit_value(TChar c)
+    {
+      return static_cast<uint32_t>(static_cast<uint8_t>(static_cast<char>(c))) - static_cast<uint32_t>('0');
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Loads eight characters into a word, the first in the lowest byte.
+    /// Only used for single byte character types.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    uint64_t load_eight_chars(const TChar* p)
+    {
+      return  static_cast<uint64_t>(static_cast<uint8_t>(p[0]))         |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[1])) << 8U)  |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[2])) << 16U) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[3])) << 24U) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[4])) << 32U) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[5])) << 40U) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[6])) << 48U) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[7])) << 56U);
+    }
+
+    //***************************************************************************
+    /// Returns the number of decimal digits at the start of the word, 0 to 8.
+    /// A byte is a digit if its high nibble is 3 both before and after adding 6.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    uint32_t leading_digit_count(uint64_t word)
+    {
+      const uint64_t non_digits = ((word & 0xF0F0F0F0F0F0F0F0ULL) | (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4U)) ^ 0x3333333333333333ULL;
+
+      return (non_digits == 0U) ? 8U : static_cast<uint32_t>(etl::countr_zero(non_digits)) / 8U;
+    }
+
+    //***************************************************************************
+    /// Converts the first 'count' (1 to 8) decimal digits in a word to their value.
+    /// The digits are moved to the top and padded with leading '0's, then
+    /// combined in pairs, pairs of pairs, then pairs of quads.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    uint32_t parse_leading_digits(uint64_t word, uint32_t count)
+    {
+      if (count < 8U)
+      {
+        word = (word << (8U * (8U - count))) | (0x3030303030303030ULL >> (8U * count));
+      }
+
+      word -= 0x3030303030303030ULL;
+      word = (word * 10U) + (word >> 8U);
+      word = (((word & 0x000000FF000000FFULL) * 0x000F424000000064ULL) + (((word >> 16U) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32U;
+
+      return static_cast<uint32_t>(word);
+    }
+
+    //***************************************************************************
+    /// Returns 10^count, for count 0 to 8.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    uint32_t decimal_scale(uint32_t count)
+    {
+      const uint32_t scale[9] = { 1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL };
+
+      return scale[count];
+    }
+#endif
+
+    //***************************************************************************
+    /// Accumulates a run of decimal digits, without overflow checks.
+    /// Single byte characters are read eight at a time when the text is long
+    /// enough. 'p_begin' is the start of the text and allows the last
+    /// characters to be read as a word.
+    /// Returns a pointer to the first character that is not a digit.
+    //***************************************************************************
+    template <typename TChar, typename TValue>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    const TChar* scan_decimal_digits(const TChar* const p_begin, const TChar* p, const TChar* const p_end, TValue& value)
+    {
+#if ETL_USING_64BIT_TYPES
+      if ((sizeof(TChar) == 1U) && ((p_end - p_begin) >= 8))
+      {
+        while ((p_end - p) >= 8)
+        {
+          const uint64_t word  = load_eight_chars(p);
+          const uint32_t count = leading_digit_count(word);
+
+          if (count != 0U)
+          {
+            value = (value * decimal_scale(count)) + parse_leading_digits(word, count);
+            p += count;
+          }
+
+          if (count != 8U)
+          {
+            return p;
+          }
+        }
+
+        const uint32_t remaining = static_cast<uint32_t>(p_end - p);
+
+        if (remaining != 0U)
+        {
+          // Move the remaining characters to the bottom of the last eight.
+          // The vacated top bytes are zero, so are not digits.
+          const uint64_t word  = load_eight_chars(p_end - 8) >> (8U * (8U - remaining));
+          const uint32_t count = leading_digit_count(word);
+
+          if (count != 0U)
+          {
+            value = (value * decimal_scale(count)) + parse_leading_digits(word, count);
+            p += count;
+          }
+        }
+
+        return p;
+      }
+#else
+      (void)p_begin;
+#endif
+
+      while (p != p_end)
+      {
+        const uint32_t digit = decimal_digit_value(*p);
+
+        if (digit > 9U)
+        {
+          break;
+        }
+
+        value = (value * 10U) + digit;
+        ++p;
+      }
+
+      return p;
+    }
+
+    //***************************************************************************
+    /// Text to decimal integral from pointers and maximum.
+    /// The leading digits that cannot overflow the accumulator are converted
+    /// without checks.
+    //***************************************************************************
+    template <typename TChar, typename TAccumulatorType>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    etl::to_arithmetic_result<TAccumulatorType> to_arithmetic_decimal(const TChar*           p,
+                                                                      const TChar* const     p_end,
+                                                                      const TAccumulatorType maximum)
+    {
+      etl::to_arithmetic_result<TAccumulatorType>   accumulator_result;
+      typedef typename etl::unexpected<etl::to_arithmetic_status> unexpected_type;
+
+      // The number of digits that always fit in the accumulator.
+      const size_t safe_digits = (etl::integral_limits<TAccumulatorType>::bits == 64) ? 19U : 9U;
+      const size_t length      = static_cast<size_t>(p_end - p);
+
+      const TChar* const p_safe_end = p + ((length < safe_digits) ? length : safe_digits);
+
+      TAccumulatorType value = 0;
+
+      p = scan_decimal_digits(p, p, p_safe_end, value);
+
+      // Each digit can only increase the value, so any overflow happened before an invalid character.
+      if (value > maximum)
+      {
+        accumulator_result = unexpected_type(to_arithmetic_status::Overflow);
+        return accumulator_result;
+      }
+
+      if (p != p_safe_end)
+      {
+        accumulator_result = unexpected_type(to_arithmetic_status::Invalid_Format);
+        return accumulator_result;
+      }
+
+      // Any remaining digits are checked for overflow.
+      while (p != p_end)
+      {
+        const uint32_t digit = decimal_digit_value(*p);
+
+        if (digit > 9U)
+        {
+          accumulator_result = unexpected_type(to_arithmetic_status::Invalid_Format);
+          return accumulator_result;
+        }
+
+        if (value > ((maximum - static_cast<TAccumulatorType>(digit)) / 10U))
+        {
+          accumulator_result = unexpected_type(to_arithmetic_status::Overflow);
+          return accumulator_result;
+        }
+
+        value = (value * 10U) + digit;
+        ++p;
+      }
+
+      accumulator_result = value;
+
+      return accumulator_result;
+    }
+
     //***************************************************************************
     /// Text to integral from view, radix value and maximum.
     //***************************************************************************
@@ -661,6 +880,11 @@ namespace etl
                                                                        const etl::radix::value_type         radix,
                                                                        const TAccumulatorType               maximum)
     {
+      if (radix == etl::radix::decimal)
+      {
+        return to_arithmetic_decimal<TChar>(view.data(), view.data() + view.size(), maximum);
+      }
+
       etl::to_arithmetic_result<TAccumulatorType>   accumulator_result;
       typedef typename etl::unexpected<etl::to_arithmetic_status> unexpected_type;
 
@@ -686,6 +910,318 @@ namespace etl
 
       return accumulator_result;
     }
+
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// A decimal number, (-1)^negative * significand * 10^exponent.
+    /// 'many_digits' is set if non-zero digits were dropped from the significand.
+    /// The digit ranges and explicit exponent are kept for exact rounding.
+    //***************************************************************************
+    template <typename TChar>
+    struct decimal_number
+    {
+      uint64_t     significand;
+      int32_t      exponent;
+      bool         negative;
+      bool         many_digits;
+      const TChar* p_integral;
+      const TChar* p_integral_end;
+      const TChar* p_fractional;
+      const TChar* p_fractional_end;
+      int32_t      explicit_exponent;
+    };
+
+    //***************************************************************************
+    /// Scans the text of a floating point number.
+    /// Accepts the same format as floating_point_accumulator.
+    //***************************************************************************
+    template <typename TChar>
+    to_arithmetic_status scan_decimal_number(const TChar* const p_begin, const TChar* const p_end, decimal_number<TChar>& number)
+    {
+      static const int32_t Max_Significand_Digits = 19;
+      static const int32_t Max_Exponent_Value     = 100000;
+
+      number.significand = 0U;
+      number.exponent    = 0;
+      number.negative    = false;
+      number.many_digits = false;
+
+      const TChar* p = p_begin;
+
+      // Sign.
+      if ((p != p_end) && ((convert(*p) == Positive_Char) || (convert(*p) == Negative_Char)))
+      {
+        number.negative = (convert(*p) == Negative_Char);
+        ++p;
+      }
+
+      // Integral digits.
+      // The significand wraps if there are more than 19 digits, and is found again below.
+      number.p_integral     = p;
+      p                     = scan_decimal_digits(p_begin, p, p_end, number.significand);
+      number.p_integral_end = p;
+
+      // Fractional digits.
+      number.p_fractional     = p;
+      number.p_fractional_end = p;
+
+      if ((p != p_end) && ((convert(*p) == Radix_Point1_Char) || (convert(*p) == Radix_Point2_Char)))
+      {
+        ++p;
+        number.p_fractional     = p;
+        p                       = scan_decimal_digits(p_begin, p, p_end, number.significand);
+        number.p_fractional_end = p;
+      }
+
+      // Exponent.
+      int32_t exponent_value = 0;
+
+      if ((p != p_end) && (convert(*p) == Exponential_Char))
+      {
+        ++p;
+
+        bool is_negative_exponent = false;
+
+        if ((p != p_end) && ((convert(*p) == Positive_Char) || (convert(*p) == Negative_Char)))
+        {
+          is_negative_exponent = (convert(*p) == Negative_Char);
+          ++p;
+        }
+
+        while ((p != p_end) && (decimal_digit_value(*p) <= 9U))
+        {
+          // Saturate; the result is zero or infinity long before this.
+          if (exponent_value < Max_Exponent_Value)
+          {
+            exponent_value = (exponent_value * 10) + static_cast<int32_t>(decimal_digit_value(*p));
+          }
+
+          ++p;
+        }
+
+        if (is_negative_exponent)
+        {
+          exponent_value = -exponent_value;
+        }
+      }
+
+      if (p != p_end)
+      {
+        return to_arithmetic_status::Invalid_Format;
+      }
+
+      number.explicit_exponent = exponent_value;
+
+      const int32_t integral_digits   = static_cast<int32_t>(number.p_integral_end - number.p_integral);
+      const int32_t fractional_digits = static_cast<int32_t>(number.p_fractional_end - number.p_fractional);
+
+      if ((integral_digits + fractional_digits) <= Max_Significand_Digits)
+      {
+        number.exponent = exponent_value - fractional_digits;
+      }
+      else
+      {
+        // Too many digits for the significand, so take the leading significant ones.
+        number.significand = 0U;
+
+        int32_t significand_digits = 0;
+        int32_t exponent_adjust    = 0;
+
+        for (p = number.p_integral; p != number.p_integral_end; ++p)
+        {
+          const uint64_t digit = decimal_digit_value(*p);
+
+          if (significand_digits < Max_Significand_Digits)
+          {
+            if ((number.significand != 0U) || (digit != 0U))
+            {
+              number.significand = (number.significand * 10U) + digit;
+              ++significand_digits;
+            }
+          }
+          else
+          {
+            ++exponent_adjust;
+            number.many_digits = number.many_digits || (digit != 0U);
+          }
+        }
+
+        for (p = number.p_fractional; p != number.p_fractional_end; ++p)
+        {
+          const uint64_t digit = decimal_digit_value(*p);
+
+          if (significand_digits < Max_Significand_Digits)
+          {
+            if ((number.significand != 0U) || (digit != 0U))
+            {
+              number.significand = (number.significand * 10U) + digit;
+              ++significand_digits;
+            }
+
+            --exponent_adjust;
+          }
+          else
+          {
+            number.many_digits = number.many_digits || (digit != 0U);
+          }
+        }
+
+        number.exponent = exponent_value + exponent_adjust;
+      }
+
+      return to_arithmetic_status::Valid;
+    }
+
+    //***************************************************************************
+    /// Decides between two adjacent values by comparing all of the significant
+    /// digits with the value half way between them.
+    //***************************************************************************
+    template <typename TValue, typename TChar>
+    etl::private_decimal_to_float::adjusted_mantissa round_exactly(const decimal_number<TChar>&                            number,
+                                                                   const etl::private_decimal_to_float::adjusted_mantissa& lower,
+                                                                   const etl::private_decimal_to_float::adjusted_mantissa& upper)
+    {
+      // Digits beyond this cannot change the rounding, except to break a tie.
+      static const int32_t Max_Digits = 800;
+
+      etl::private_decimal_to_float::big_integer digits;
+
+      int32_t  exponent     = number.explicit_exponent;
+      int32_t  digit_count  = 0;
+      bool     is_truncated = false;
+      uint32_t chunk        = 0U;
+      uint32_t chunk_scale  = 1U;
+
+      const TChar* ranges[2][2] = { { number.p_integral,   number.p_integral_end },
+                                    { number.p_fractional, number.p_fractional_end } };
+
+      for (int range = 0; range < 2; ++range)
+      {
+        const bool is_fractional = (range == 1);
+
+        for (const TChar* p = ranges[range][0]; p != ranges[range][1]; ++p)
+        {
+          const uint32_t digit = decimal_digit_value(*p);
+
+          if ((digit_count == 0) && (digit == 0U))
+          {
+            // Leading zero.
+            exponent -= is_fractional ? 1 : 0;
+          }
+          else if (digit_count < Max_Digits)
+          {
+            chunk        = (chunk * 10U) + digit;
+            chunk_scale *= 10U;
+            ++digit_count;
+            exponent    -= is_fractional ? 1 : 0;
+
+            if (chunk_scale == 1000000000UL)
+            {
+              digits.multiply_add(chunk_scale, chunk);
+              chunk       = 0U;
+              chunk_scale = 1U;
+            }
+          }
+          else
+          {
+            exponent    += is_fractional ? 0 : 1;
+            is_truncated = is_truncated || (digit != 0U);
+          }
+        }
+      }
+
+      digits.multiply_add(chunk_scale, chunk);
+
+      int comparison = etl::private_decimal_to_float::compare_with_half_way<TValue>(digits, exponent, lower);
+
+      if ((comparison == 0) && is_truncated)
+      {
+        comparison = 1;
+      }
+
+      if (comparison == 0)
+      {
+        // A tie, so round to even.
+        return ((lower.mantissa & 1U) == 0U) ? lower : upper;
+      }
+
+      return (comparison < 0) ? lower : upper;
+    }
+
+    //***************************************************************************
+    /// Correctly rounded conversion of text to float or double.
+    //***************************************************************************
+    template <typename TValue, typename TChar>
+    void to_binary_floating_point(const etl::basic_string_view<TChar>& view, etl::to_arithmetic_result<TValue>& result)
+    {
+      typedef typename etl::to_arithmetic_result<TValue>::unexpected_type unexpected_type;
+      typedef etl::private_decimal_to_float::adjusted_mantissa             adjusted_mantissa;
+
+      decimal_number<TChar> number;
+
+      const to_arithmetic_status status = scan_decimal_number(view.data(), view.data() + view.size(), number);
+
+      if (status != to_arithmetic_status::Valid)
+      {
+        result = unexpected_type(status);
+        return;
+      }
+
+      adjusted_mantissa am = etl::private_decimal_to_float::compute_float<TValue>(number.exponent, number.significand);
+
+      if (number.many_digits)
+      {
+        // The exact value lies between the truncated significand and the next.
+        // If both round to the same value then that is the answer.
+        const adjusted_mantissa am_upper = etl::private_decimal_to_float::compute_float<TValue>(number.exponent, number.significand + 1U);
+
+        if ((am.mantissa != am_upper.mantissa) || (am.power2 != am_upper.power2))
+        {
+          am = round_exactly<TValue>(number, am, am_upper);
+        }
+      }
+
+      if (etl::private_decimal_to_float::is_infinite<TValue>(am))
+      {
+        result = unexpected_type(to_arithmetic_status::Overflow);
+      }
+      else
+      {
+        result = etl::private_decimal_to_float::to_float<TValue>(am, number.negative);
+      }
+    }
+
+    //***************************************************************************
+    /// No fast conversion for other floating point types.
+    //***************************************************************************
+    template <typename TValue, typename TChar>
+    bool to_floating_point_fast(const etl::basic_string_view<TChar>&, etl::to_arithmetic_result<TValue>&)
+    {
+      return false;
+    }
+
+    //***************************************************************************
+    /// Fast conversion to float.
+    //***************************************************************************
+    template <typename TChar>
+    bool to_floating_point_fast(const etl::basic_string_view<TChar>& view, etl::to_arithmetic_result<float>& result)
+    {
+      to_binary_floating_point<float>(view, result);
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Fast conversion to double.
+    //***************************************************************************
+    template <typename TChar>
+    bool to_floating_point_fast(const etl::basic_string_view<TChar>& view, etl::to_arithmetic_result<double>& result)
+    {
+      to_binary_floating_point<double>(view, result);
+
+      return true;
+    }
+#endif
   }
 
   //***************************************************************************
@@ -875,40 +1411,50 @@ namespace etl
     }
     else
     {
-      floating_point_accumulator accumulator;
-
-      typename etl::basic_string_view<TChar>::const_iterator itr           = view.begin();
-      const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
+      bool is_converted = false;
 
-      while ((itr != itr_end) && accumulator.add(convert(*itr)))
-      {
-        // Keep looping until done or an error occurs.
-        ++itr;
-      }
-
-      result = unexpected_type(accumulator.status());
+#if ETL_USING_64BIT_TYPES
+      // Try the correctly rounded conversion first.
+      is_converted = to_floating_point_fast(view, result);
+#endif
 
-      if (result.has_value())
+      if (!is_converted)
       {
-        TValue value = static_cast<TValue>(accumulator.value());
-        int exponent = accumulator.exponent();
+        floating_point_accumulator accumulator;
 
-        value *= pow(static_cast<TValue>(10.0), static_cast<TValue>(exponent));
+        typename etl::basic_string_view<TChar>::const_iterator itr           = view.begin();
+        const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
 
-        // Check that the result is a valid floating point number.
-        if ((value == etl::numeric_limits<TValue>::infinity()) ||
-            (value == -etl::numeric_limits<TValue>::infinity()))
+        while ((itr != itr_end) && accumulator.add(convert(*itr)))
         {
-          result = unexpected_type(to_arithmetic_status::Overflow);
+          // Keep looping until done or an error occurs.
+          ++itr;
         }
-        // Check for NaN.
-        else if (value != value)
-        {
-          result = unexpected_type(to_arithmetic_status::Invalid_Float);
-        }
-        else
+
+        result = unexpected_type(accumulator.status());
+
+        if (result.has_value())
         {
-          result = value;
+          TValue value = static_cast<TValue>(accumulator.value());
+          int exponent = accumulator.exponent();
+
+          value *= pow(static_cast<TValue>(10.0), static_cast<TValue>(exponent));
+
+          // Check that the result is a valid floating point number.
+          if ((value == etl::numeric_limits<TValue>::infinity()) ||
+              (value == -etl::numeric_limits<TValue>::infinity()))
+          {
+            result = unexpected_type(to_arithmetic_status::Overflow);
+          }
+          // Check for NaN.
+          else if (value != value)
+          {
+            result = unexpected_type(to_arithmetic_status::Invalid_Float);
+          }
+          else
+          {
+            result = value;
+          }
         }
       }
     }
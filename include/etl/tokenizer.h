@@ -0,0 +1,507 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TOKENIZER_INCLUDED
+#define ETL_TOKENIZER_INCLUDED
+
+#include "platform.h"
+#include "iterator.h"
+#include "integral_limits.h"
+#include "char_traits.h"
+#include "string_view.h"
+#include "private/string_search.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup tokenizer tokenizer
+/// Splits a string into tokens, without copying.
+/// etl::basic_tokenizer splits at any one of a set of delimiter characters.
+/// etl::basic_split_view splits at each occurrence of a delimiter string.
+/// Tokens are returned as views of the input, so the input must outlive them.
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_tokenizer
+  {
+    //*************************************************************************
+    /// Finds any one of a set of delimiter characters.
+    //*************************************************************************
+    template <typename T, bool Is_Byte = etl::private_string_search::is_byte_char<T>::value>
+    class any_of_delimiter
+    {
+    public:
+
+      any_of_delimiter(const T* delimiters_, size_t count_)
+        : delimiters(delimiters_)
+        , count(count_)
+      {
+      }
+
+      size_t find(const T* p, size_t length) const
+      {
+        return etl::private_string_search::find_of(p, length, delimiters, count, true);
+      }
+
+      size_t size() const
+      {
+        return 1U;
+      }
+
+    private:
+
+      const T* delimiters;
+      size_t   count;
+    };
+
+    //*************************************************************************
+    /// Finds any one of a set of byte sized delimiter characters.
+    /// Small sets are matched a block at a time, larger ones with a table
+    /// that is built once, rather than for each search.
+    //*************************************************************************
+    template <typename T>
+    class any_of_delimiter<T, true>
+    {
+    public:
+
+      any_of_delimiter(const T* delimiters, size_t count_)
+        : table(etl::private_string_search::as_bytes(delimiters), count_)
+        , count(count_)
+      {
+        for (size_t i = 0U; (i < count) && (i < etl::private_string_search::Max_Block_Set_Size); ++i)
+        {
+          small_set[i] = static_cast<unsigned char>(delimiters[i]);
+        }
+      }
+
+      size_t find(const T* p, size_t length) const
+      {
+        if (count == 0U)
+        {
+          return length;
+        }
+        else if (count == 1U)
+        {
+          return etl::private_string_search::find_if(etl::private_string_search::as_bytes(p), length,
+                                                      etl::private_string_search::match_char(small_set[0]));
+        }
+        else if (count <= etl::private_string_search::Max_Block_Set_Size)
+        {
+          return etl::private_string_search::find_if(etl::private_string_search::as_bytes(p), length,
+                                                      etl::private_string_search::match_any_char(small_set, count));
+        }
+        else
+        {
+          return etl::private_string_search::find_in_set(etl::private_string_search::as_bytes(p), length, table, true);
+        }
+      }
+
+      size_t size() const
+      {
+        return 1U;
+      }
+
+    private:
+
+      etl::private_string_search::byte_set table;
+      unsigned char small_set[etl::private_string_search::Max_Block_Set_Size];
+      size_t count;
+    };
+
+    //*************************************************************************
+    /// Finds a delimiter string.
+    /// An empty delimiter is never found.
+    //*************************************************************************
+    template <typename T>
+    class string_delimiter
+    {
+    public:
+
+      string_delimiter(const T* delimiter_, size_t length_)
+        : delimiter(delimiter_)
+        , length(length_)
+      {
+      }
+
+      size_t find(const T* p, size_t text_length) const
+      {
+        if (length == 0U)
+        {
+          return text_length;
+        }
+
+        return etl::private_string_search::find_substring(p, text_length, delimiter, length);
+      }
+
+      size_t size() const
+      {
+        return length;
+      }
+
+    private:
+
+      const T* delimiter;
+      size_t   length;
+    };
+
+    //*************************************************************************
+    /// The common implementation of the tokenizers.
+    //*************************************************************************
+    template <typename T, typename TTraits, typename TDelimiter>
+    class tokenizer_base
+    {
+    public:
+
+      typedef etl::basic_string_view<T, TTraits> view_type;
+      typedef T                                  value_type;
+      typedef size_t                             size_type;
+
+      //*************************************************************************
+      /// Iterates the tokens.
+      /// Each iterator keeps its own position, so does not affect next().
+      //*************************************************************************
+      class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const view_type>
+      {
+      public:
+
+        friend class tokenizer_base;
+
+        //*******************************
+        iterator()
+          : p_tokenizer(ETL_NULLPTR)
+          , position(Finished)
+          , token()
+          , valid(false)
+        {
+        }
+
+        //*******************************
+        const view_type& operator *() const
+        {
+          return token;
+        }
+
+        //*******************************
+        const view_type* operator ->() const
+        {
+          return &token;
+        }
+
+        //*******************************
+        iterator& operator ++()
+        {
+          valid = p_tokenizer->next_token(position, token);
+
+          return *this;
+        }
+
+        //*******************************
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+
+          ++(*this);
+
+          return temp;
+        }
+
+        //*******************************
+        friend bool operator ==(const iterator& lhs, const iterator& rhs)
+        {
+          return (lhs.valid == rhs.valid) && (!lhs.valid || (lhs.position == rhs.position));
+        }
+
+        //*******************************
+        friend bool operator !=(const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*******************************
+        explicit iterator(const tokenizer_base* p_tokenizer_)
+          : p_tokenizer(p_tokenizer_)
+          , position(0U)
+          , token()
+          , valid(false)
+        {
+          valid = p_tokenizer->next_token(position, token);
+        }
+
+        const tokenizer_base* p_tokenizer;
+        size_type             position;
+        view_type             token;
+        bool                  valid;
+      };
+
+      typedef iterator const_iterator;
+
+      //*************************************************************************
+      /// Gets the next token.
+      /// Returns false, and leaves 'token' unchanged, if there are no more.
+      //*************************************************************************
+      bool next(view_type& token)
+      {
+        return next_token(cursor, token);
+      }
+
+      //*************************************************************************
+      /// Restarts next() from the beginning of the input.
+      //*************************************************************************
+      void reset()
+      {
+        cursor = 0U;
+      }
+
+      //*************************************************************************
+      /// Returns true if next() has returned all of the tokens.
+      //*************************************************************************
+      bool finished() const
+      {
+        return cursor == Finished;
+      }
+
+      //*************************************************************************
+      /// Gets the input.
+      //*************************************************************************
+      view_type input() const
+      {
+        return view_type(p_input, input_length);
+      }
+
+      //*************************************************************************
+      /// Gets an iterator to the first token.
+      //*************************************************************************
+      iterator begin() const
+      {
+        return iterator(this);
+      }
+
+      //*************************************************************************
+      /// Gets an iterator to the end of the tokens.
+      //*************************************************************************
+      iterator end() const
+      {
+        return iterator();
+      }
+
+    protected:
+
+      //*************************************************************************
+      /// Constructor.
+      //*************************************************************************
+      tokenizer_base(view_type input_, const TDelimiter& delimiter_, bool ignore_empty_tokens_, bool use_quote_, T quote_)
+        : p_input(input_.data())
+        , input_length(input_.size())
+        , cursor(0U)
+        , delimiter(delimiter_)
+        , ignore_empty_tokens(ignore_empty_tokens_)
+        , use_quote(use_quote_)
+        , quote(quote_)
+      {
+      }
+
+    private:
+
+      static ETL_CONSTANT size_type Finished = etl::integral_limits<size_type>::max;
+
+      //*************************************************************************
+      /// Finds the token starting at 'position' and moves 'position' past its delimiter.
+      /// 'position' becomes Finished after the last token.
+      //*************************************************************************
+      bool next_token(size_type& position, view_type& token) const
+      {
+        while (position != Finished)
+        {
+          const size_type first = position;
+          const size_type last  = find_delimiter(first);
+
+          if (last == input_length)
+          {
+            position = Finished;
+          }
+          else
+          {
+            position = last + delimiter.size();
+          }
+
+          if (!ignore_empty_tokens || (last != first))
+          {
+            token = view_type(p_input + first, last - first);
+
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      //*************************************************************************
+      /// Finds the next delimiter at or after 'position' that is not quoted.
+      /// An unterminated quote extends to the end of the input.
+      //*************************************************************************
+      size_type find_delimiter(size_type position) const
+      {
+        size_type next_delimiter = position + delimiter.find(p_input + position, input_length - position);
+
+        if (use_quote)
+        {
+          size_type open_quote = position + etl::private_string_search::find_char(p_input + position, next_delimiter - position, quote);
+
+          while (open_quote != next_delimiter)
+          {
+            const size_type after_open  = open_quote + 1U;
+            const size_type close_quote = after_open + etl::private_string_search::find_char(p_input + after_open, input_length - after_open, quote);
+
+            if (close_quote == input_length)
+            {
+              return input_length;
+            }
+
+            position = close_quote + 1U;
+
+            // The delimiter found earlier may have been inside the quotes.
+            if (next_delimiter < position)
+            {
+              next_delimiter = position + delimiter.find(p_input + position, input_length - position);
+            }
+
+            open_quote = position + etl::private_string_search::find_char(p_input + position, next_delimiter - position, quote);
+          }
+        }
+
+        return next_delimiter;
+      }
+
+      const T*   p_input;
+      size_type  input_length;
+      size_type  cursor;
+      TDelimiter delimiter;
+      bool       ignore_empty_tokens;
+      bool       use_quote;
+      T          quote;
+    };
+  }
+
+  //***************************************************************************
+  /// Splits a string at any one of a set of delimiter characters.
+  /// If a quote character is given, delimiters between pairs of quotes do not
+  /// split, and the quotes are kept in the tokens.
+  ///\code
+  /// etl::tokenizer tokens(line, ",;", '"');
+  ///
+  /// for (etl::tokenizer::iterator itr = tokens.begin(); itr != tokens.end(); ++itr)
+  /// {
+  ///   use(*itr);
+  /// }
+  ///\endcode
+  ///\ingroup tokenizer
+  //***************************************************************************
+  template <typename T, typename TTraits = etl::char_traits<T> >
+  class basic_tokenizer : public private_tokenizer::tokenizer_base<T, TTraits, private_tokenizer::any_of_delimiter<T> >
+  {
+  private:
+
+    typedef private_tokenizer::tokenizer_base<T, TTraits, private_tokenizer::any_of_delimiter<T> > base_t;
+    typedef private_tokenizer::any_of_delimiter<T>                                                 delimiter_type;
+
+  public:
+
+    typedef typename base_t::view_type view_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    basic_tokenizer(view_type input, view_type delimiters, bool ignore_empty_tokens = false)
+      : base_t(input, delimiter_type(delimiters.data(), delimiters.size()), ignore_empty_tokens, false, T())
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, with a quote character.
+    //*************************************************************************
+    basic_tokenizer(view_type input, view_type delimiters, T quote, bool ignore_empty_tokens = false)
+      : base_t(input, delimiter_type(delimiters.data(), delimiters.size()), ignore_empty_tokens, true, quote)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Splits a string at each occurrence of a delimiter string.
+  /// If a quote character is given, delimiters between pairs of quotes do not
+  /// split, and the quotes are kept in the tokens.
+  /// An empty delimiter does not split the string.
+  ///\ingroup tokenizer
+  //***************************************************************************
+  template <typename T, typename TTraits = etl::char_traits<T> >
+  class basic_split_view : public private_tokenizer::tokenizer_base<T, TTraits, private_tokenizer::string_delimiter<T> >
+  {
+  private:
+
+    typedef private_tokenizer::tokenizer_base<T, TTraits, private_tokenizer::string_delimiter<T> > base_t;
+    typedef private_tokenizer::string_delimiter<T>                                                 delimiter_type;
+
+  public:
+
+    typedef typename base_t::view_type view_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    basic_split_view(view_type input, view_type delimiter, bool ignore_empty_tokens = false)
+      : base_t(input, delimiter_type(delimiter.data(), delimiter.size()), ignore_empty_tokens, false, T())
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, with a quote character.
+    //*************************************************************************
+    basic_split_view(view_type input, view_type delimiter, T quote, bool ignore_empty_tokens = false)
+      : base_t(input, delimiter_type(delimiter.data(), delimiter.size()), ignore_empty_tokens, true, quote)
+    {
+    }
+  };
+
+  typedef etl::basic_tokenizer<char>      tokenizer;
+  typedef etl::basic_tokenizer<wchar_t>   wtokenizer;
+  typedef etl::basic_tokenizer<char16_t>  u16tokenizer;
+  typedef etl::basic_tokenizer<char32_t>  u32tokenizer;
+
+  typedef etl::basic_split_view<char>     split_view;
+  typedef etl::basic_split_view<wchar_t>  wsplit_view;
+  typedef etl::basic_split_view<char16_t> u16split_view;
+  typedef etl::basic_split_view<char32_t> u32split_view;
+}
+
+#endif
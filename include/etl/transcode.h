@@ -0,0 +1,718 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TRANSCODE_INCLUDED
+#define ETL_TRANSCODE_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "enum_type.h"
+#include "algorithm.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "span.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup transcode transcode
+/// Converts text between UTF-8, UTF-16 and UTF-32.
+/// The encoding is chosen by the size of the character type; 8 bit types are
+/// UTF-8, 16 bit types are UTF-16 and 32 bit types are UTF-32.
+/// So etl::istring is UTF-8, etl::iu16string is UTF-16, etl::iu32string is
+/// UTF-32 and etl::iwstring is UTF-16 or UTF-32 depending on the platform.
+///
+/// The input is validated as it is converted. Conversion stops at the first
+/// invalid or incomplete sequence, or at the first character that will not
+/// completely fit in the output.
+///
+/// Runs of ASCII characters are converted a block at a time, with SSE2 if
+/// available. Define ETL_TRANSCODE_NO_SIMD to always use the portable code.
+///\ingroup string
+//*****************************************************************************
+
+#if !defined(ETL_TRANSCODE_NO_SIMD)
+  #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define ETL_TRANSCODE_USING_SSE2 1
+    #include <emmintrin.h>
+  #endif
+#endif
+
+#if !defined(ETL_TRANSCODE_USING_SSE2)
+  #define ETL_TRANSCODE_USING_SSE2 0
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Status values for transcode.
+  ///\ingroup transcode
+  //***************************************************************************
+  struct transcode_status
+  {
+    enum enum_type
+    {
+      Valid,
+      Invalid_Sequence,
+      Incomplete_Sequence,
+      Truncated
+    };
+
+    ETL_DECLARE_ENUM_TYPE(transcode_status, int)
+    ETL_ENUM_TYPE(Valid,               "Valid")
+    ETL_ENUM_TYPE(Invalid_Sequence,    "Invalid Sequence")
+    ETL_ENUM_TYPE(Incomplete_Sequence, "Incomplete Sequence")
+    ETL_ENUM_TYPE(Truncated,           "Truncated")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The result of transcode.
+  /// 'read' is the number of input characters converted. If the status is not
+  /// Valid, it is the index of the character that stopped the conversion.
+  /// 'written' is the number of output characters written.
+  /// Incomplete_Sequence means that the input ends part way through a
+  /// character. The remainder may be converted when the rest of the input is
+  /// available.
+  ///\ingroup transcode
+  //***************************************************************************
+  struct transcode_result
+  {
+    transcode_result(etl::transcode_status status_, size_t read_, size_t written_)
+      : status(status_)
+      , read(read_)
+      , written(written_)
+    {
+    }
+
+    //*******************************************
+    /// Returns <b>true</b> if all of the input was converted.
+    //*******************************************
+    bool is_valid() const
+    {
+      return status == etl::transcode_status::Valid;
+    }
+
+    etl::transcode_status status;
+    size_t                read;
+    size_t                written;
+  };
+
+  namespace private_transcode
+  {
+    static ETL_CONSTANT uint32_t Max_Code_Point  = 0x10FFFFUL;
+    static ETL_CONSTANT uint32_t Surrogate_First = 0xD800UL;
+    static ETL_CONSTANT uint32_t Surrogate_Low   = 0xDC00UL;
+    static ETL_CONSTANT uint32_t Surrogate_Last  = 0xDFFFUL;
+
+    //*************************************************************************
+    /// The unsigned code unit of a character type.
+    //*************************************************************************
+    template <size_t Size>
+    struct code_unit;
+
+    template <>
+    struct code_unit<1U>
+    {
+      typedef uint8_t type;
+    };
+
+    template <>
+    struct code_unit<2U>
+    {
+      typedef uint16_t type;
+    };
+
+    template <>
+    struct code_unit<4U>
+    {
+      typedef uint32_t type;
+    };
+
+    template <typename T>
+    uint32_t to_unit(T c)
+    {
+      return static_cast<uint32_t>(static_cast<typename code_unit<sizeof(T)>::type>(c));
+    }
+
+    //*************************************************************************
+    /// Decodes and encodes one character.
+    /// decode returns the number of input characters used, or 0 if the status
+    /// is not Valid.
+    //*************************************************************************
+    template <size_t Size>
+    struct utf;
+
+    //*************************************************************************
+    /// UTF-8
+    //*************************************************************************
+    template <>
+    struct utf<1U>
+    {
+      template <typename T>
+      static size_t decode(const T* p, size_t length, uint32_t& code_point, etl::transcode_status& status)
+      {
+        const uint32_t first = to_unit(p[0]);
+
+        size_t   count;
+        uint32_t lowest;  // The lowest valid second byte.
+        uint32_t highest; // The highest valid second byte.
+
+        if (first < 0x80U)
+        {
+          code_point = first;
+          return 1U;
+        }
+        else if (first < 0xC2U)
+        {
+          // A continuation byte, or an overlong two byte sequence.
+          status = etl::transcode_status::Invalid_Sequence;
+          return 0U;
+        }
+        else if (first < 0xE0U)
+        {
+          count      = 2U;
+          code_point = first & 0x1FU;
+          lowest     = 0x80U;
+          highest    = 0xBFU;
+        }
+        else if (first < 0xF0U)
+        {
+          // Excludes overlong sequences and surrogates.
+          count      = 3U;
+          code_point = first & 0x0FU;
+          lowest     = (first == 0xE0U) ? 0xA0U : 0x80U;
+          highest    = (first == 0xEDU) ? 0x9FU : 0xBFU;
+        }
+        else if (first < 0xF5U)
+        {
+          // Excludes overlong sequences and code points above U+10FFFF.
+          count      = 4U;
+          code_point = first & 0x07U;
+          lowest     = (first == 0xF0U) ? 0x90U : 0x80U;
+          highest    = (first == 0xF4U) ? 0x8FU : 0xBFU;
+        }
+        else
+        {
+          status = etl::transcode_status::Invalid_Sequence;
+          return 0U;
+        }
+
+        for (size_t i = 1U; i < count; ++i)
+        {
+          if (i == length)
+          {
+            status = etl::transcode_status::Incomplete_Sequence;
+            return 0U;
+          }
+
+          const uint32_t next = to_unit(p[i]);
+
+          if ((next < lowest) || (next > highest))
+          {
+            status = etl::transcode_status::Invalid_Sequence;
+            return 0U;
+          }
+
+          code_point = (code_point << 6U) | (next & 0x3FU);
+          lowest     = 0x80U;
+          highest    = 0xBFU;
+        }
+
+        return count;
+      }
+
+      static size_t encoded_length(uint32_t code_point)
+      {
+        return (code_point < 0x80U) ? 1U : (code_point < 0x800U) ? 2U : (code_point < 0x10000UL) ? 3U : 4U;
+      }
+
+      template <typename T>
+      static void encode(uint32_t code_point, size_t length, T* p)
+      {
+        switch (length)
+        {
+          case 1U:
+          {
+            p[0] = static_cast<T>(code_point);
+            break;
+          }
+
+          case 2U:
+          {
+            p[0] = static_cast<T>(0xC0U | (code_point >> 6U));
+            p[1] = static_cast<T>(0x80U | (code_point & 0x3FU));
+            break;
+          }
+
+          case 3U:
+          {
+            p[0] = static_cast<T>(0xE0U | (code_point >> 12U));
+            p[1] = static_cast<T>(0x80U | ((code_point >> 6U) & 0x3FU));
+            p[2] = static_cast<T>(0x80U | (code_point & 0x3FU));
+            break;
+          }
+
+          default:
+          {
+            p[0] = static_cast<T>(0xF0U | (code_point >> 18U));
+            p[1] = static_cast<T>(0x80U | ((code_point >> 12U) & 0x3FU));
+            p[2] = static_cast<T>(0x80U | ((code_point >> 6U) & 0x3FU));
+            p[3] = static_cast<T>(0x80U | (code_point & 0x3FU));
+            break;
+          }
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// UTF-16
+    //*************************************************************************
+    template <>
+    struct utf<2U>
+    {
+      template <typename T>
+      static size_t decode(const T* p, size_t length, uint32_t& code_point, etl::transcode_status& status)
+      {
+        const uint32_t first = to_unit(p[0]);
+
+        if ((first < Surrogate_First) || (first > Surrogate_Last))
+        {
+          code_point = first;
+          return 1U;
+        }
+        else if (first >= Surrogate_Low)
+        {
+          // A low surrogate without a high surrogate.
+          status = etl::transcode_status::Invalid_Sequence;
+          return 0U;
+        }
+        else if (length == 1U)
+        {
+          status = etl::transcode_status::Incomplete_Sequence;
+          return 0U;
+        }
+
+        const uint32_t second = to_unit(p[1]);
+
+        if ((second < Surrogate_Low) || (second > Surrogate_Last))
+        {
+          status = etl::transcode_status::Invalid_Sequence;
+          return 0U;
+        }
+
+        code_point = 0x10000UL + ((first - Surrogate_First) << 10U) + (second - Surrogate_Low);
+
+        return 2U;
+      }
+
+      static size_t encoded_length(uint32_t code_point)
+      {
+        return (code_point < 0x10000UL) ? 1U : 2U;
+      }
+
+      template <typename T>
+      static void encode(uint32_t code_point, size_t length, T* p)
+      {
+        if (length == 1U)
+        {
+          p[0] = static_cast<T>(code_point);
+        }
+        else
+        {
+          code_point -= 0x10000UL;
+          p[0] = static_cast<T>(Surrogate_First + (code_point >> 10U));
+          p[1] = static_cast<T>(Surrogate_Low + (code_point & 0x3FFU));
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// UTF-32
+    //*************************************************************************
+    template <>
+    struct utf<4U>
+    {
+      template <typename T>
+      static size_t decode(const T* p, size_t /*length*/, uint32_t& code_point, etl::transcode_status& status)
+      {
+        code_point = to_unit(p[0]);
+
+        if ((code_point > Max_Code_Point) || ((code_point >= Surrogate_First) && (code_point <= Surrogate_Last)))
+        {
+          status = etl::transcode_status::Invalid_Sequence;
+          return 0U;
+        }
+
+        return 1U;
+      }
+
+      static size_t encoded_length(uint32_t /*code_point*/)
+      {
+        return 1U;
+      }
+
+      template <typename T>
+      static void encode(uint32_t code_point, size_t /*length*/, T* p)
+      {
+        p[0] = static_cast<T>(code_point);
+      }
+    };
+
+    //*************************************************************************
+    /// Copies the leading run of ASCII characters, up to 'length'.
+    /// Returns the number copied.
+    /// ASCII is the same in every encoding, so needs no conversion.
+    //*************************************************************************
+    template <typename TIn, typename TOut>
+    size_t copy_ascii(const TIn* input, size_t length, TOut* output)
+    {
+      size_t i = 0U;
+
+      // Eight at a time, to keep the test out of the copy loop.
+      while ((length - i) >= 8U)
+      {
+        uint32_t bits = 0U;
+
+        for (size_t j = 0U; j < 8U; ++j)
+        {
+          bits |= to_unit(input[i + j]);
+        }
+
+        if (bits >= 0x80U)
+        {
+          break;
+        }
+
+        for (size_t j = 0U; j < 8U; ++j)
+        {
+          output[i + j] = static_cast<TOut>(to_unit(input[i + j]));
+        }
+
+        i += 8U;
+      }
+
+      while ((i < length) && (to_unit(input[i]) < 0x80U))
+      {
+        output[i] = static_cast<TOut>(to_unit(input[i]));
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Copies ASCII characters a block at a time, where SIMD is available for
+    /// the pair of encodings.
+    //*************************************************************************
+    template <size_t In_Size, size_t Out_Size>
+    struct ascii
+    {
+      template <typename TIn, typename TOut>
+      static size_t copy(const TIn* input, size_t length, TOut* output)
+      {
+        return copy_ascii(input, length, output);
+      }
+    };
+
+#if ETL_TRANSCODE_USING_SSE2
+    //*************************************************************************
+    /// UTF-8 to UTF-8
+    //*************************************************************************
+    template <>
+    struct ascii<1U, 1U>
+    {
+      template <typename TIn, typename TOut>
+      static size_t copy(const TIn* input, size_t length, TOut* output)
+      {
+        size_t i = 0U;
+
+        while ((length - i) >= 16U)
+        {
+          const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+          if (_mm_movemask_epi8(block) != 0)
+          {
+            break;
+          }
+
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), block);
+          i += 16U;
+        }
+
+        return i + copy_ascii(input + i, length - i, output + i);
+      }
+    };
+
+    //*************************************************************************
+    /// UTF-8 to UTF-16
+    //*************************************************************************
+    template <>
+    struct ascii<1U, 2U>
+    {
+      template <typename TIn, typename TOut>
+      static size_t copy(const TIn* input, size_t length, TOut* output)
+      {
+        const __m128i zero = _mm_setzero_si128();
+
+        size_t i = 0U;
+
+        while ((length - i) >= 16U)
+        {
+          const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+          if (_mm_movemask_epi8(block) != 0)
+          {
+            break;
+          }
+
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),      _mm_unpacklo_epi8(block, zero));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8U), _mm_unpackhi_epi8(block, zero));
+          i += 16U;
+        }
+
+        return i + copy_ascii(input + i, length - i, output + i);
+      }
+    };
+
+    //*************************************************************************
+    /// UTF-8 to UTF-32
+    //*************************************************************************
+    template <>
+    struct ascii<1U, 4U>
+    {
+      template <typename TIn, typename TOut>
+      static size_t copy(const TIn* input, size_t length, TOut* output)
+      {
+        const __m128i zero = _mm_setzero_si128();
+
+        size_t i = 0U;
+
+        while ((length - i) >= 16U)
+        {
+          const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+          if (_mm_movemask_epi8(block) != 0)
+          {
+            break;
+          }
+
+          const __m128i low  = _mm_unpacklo_epi8(block, zero);
+          const __m128i high = _mm_unpackhi_epi8(block, zero);
+
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),       _mm_unpacklo_epi16(low, zero));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 4U),  _mm_unpackhi_epi16(low, zero));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 8U),  _mm_unpacklo_epi16(high, zero));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 12U), _mm_unpackhi_epi16(high, zero));
+          i += 16U;
+        }
+
+        return i + copy_ascii(input + i, length - i, output + i);
+      }
+    };
+
+    //*************************************************************************
+    /// UTF-16 to UTF-8
+    //*************************************************************************
+    template <>
+    struct ascii<2U, 1U>
+    {
+      template <typename TIn, typename TOut>
+      static size_t copy(const TIn* input, size_t length, TOut* output)
+      {
+        const __m128i zero      = _mm_setzero_si128();
+        const __m128i non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+
+        size_t i = 0U;
+
+        while ((length - i) >= 16U)
+        {
+          const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+          const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 8U));
+          const __m128i bits = _mm_and_si128(_mm_or_si128(low, high), non_ascii);
+
+          if (_mm_movemask_epi8(_mm_cmpeq_epi16(bits, zero)) != 0xFFFF)
+          {
+            break;
+          }
+
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(low, high));
+          i += 16U;
+        }
+
+        return i + copy_ascii(input + i, length - i, output + i);
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// Converts the input to the output encoding.
+    //*************************************************************************
+    template <typename TIn, typename TOut>
+    etl::transcode_result transcode(const TIn* input, size_t input_length, TOut* output, size_t output_length)
+    {
+      typedef etl::private_transcode::utf<sizeof(TIn)>                 decoder;
+      typedef etl::private_transcode::utf<sizeof(TOut)>                encoder;
+      typedef etl::private_transcode::ascii<sizeof(TIn), sizeof(TOut)> ascii_copier;
+
+      size_t read    = 0U;
+      size_t written = 0U;
+
+      while (read < input_length)
+      {
+        if (to_unit(input[read]) < 0x80U)
+        {
+          const size_t length = etl::min(input_length - read, output_length - written);
+
+          if (length != 0U)
+          {
+            const size_t count = ascii_copier::copy(input + read, length, output + written);
+
+            read    += count;
+            written += count;
+            continue;
+          }
+        }
+
+        etl::transcode_status status = etl::transcode_status::Valid;
+        uint32_t code_point = 0U;
+
+        const size_t in_count = decoder::decode(input + read, input_length - read, code_point, status);
+
+        if (in_count == 0U)
+        {
+          return etl::transcode_result(status, read, written);
+        }
+
+        const size_t out_count = encoder::encoded_length(code_point);
+
+        if (out_count > (output_length - written))
+        {
+          return etl::transcode_result(etl::transcode_status::Truncated, read, written);
+        }
+
+        encoder::encode(code_point, out_count, output + written);
+
+        read    += in_count;
+        written += out_count;
+      }
+
+      return etl::transcode_result(etl::transcode_status::Valid, read, written);
+    }
+
+    //*************************************************************************
+    /// Sets the truncated flag of the string, without changing its contents.
+    /// Asserts if ETL_HAS_ERROR_ON_STRING_TRUNCATION is defined.
+    //*************************************************************************
+    template <typename T>
+    void set_truncated(etl::ibasic_string<T>& s)
+    {
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+      s.set_truncated(true);
+
+#if ETL_HAS_ERROR_ON_STRING_TRUNCATION
+      ETL_ASSERT_FAIL(ETL_ERROR(string_truncation));
+#endif
+#else
+      (void)s;
+#endif
+    }
+  }
+
+  //***************************************************************************
+  /// Converts the input characters to the output encoding.
+  ///\param input         The characters to convert.
+  ///\param input_length  The number of input characters.
+  ///\param output        Where to write the converted characters.
+  ///\param output_length The maximum number of characters to write.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TIn, typename TOut>
+  etl::transcode_result transcode(const TIn* input, size_t input_length, TOut* output, size_t output_length)
+  {
+    ETL_STATIC_ASSERT((sizeof(TIn) == 1U) || (sizeof(TIn) == 2U) || (sizeof(TIn) == 4U), "Input must be 8, 16 or 32 bit characters");
+    ETL_STATIC_ASSERT((sizeof(TOut) == 1U) || (sizeof(TOut) == 2U) || (sizeof(TOut) == 4U), "Output must be 8, 16 or 32 bit characters");
+
+    return etl::private_transcode::transcode(input, input_length, output, output_length);
+  }
+
+  //***************************************************************************
+  /// Converts a span of characters to the output encoding.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TIn, size_t In_Extent, typename TOut, size_t Out_Extent>
+  etl::transcode_result transcode(const etl::span<TIn, In_Extent>& input, const etl::span<TOut, Out_Extent>& output)
+  {
+    return etl::transcode(input.data(), input.size(), output.data(), output.size());
+  }
+
+  //***************************************************************************
+  /// Converts a string view to the encoding of the output string.
+  /// The characters are assigned to the string, or appended if 'append' is true.
+  /// The string's truncated flag is set if the output did not fit.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TIn, typename TTraits, typename TOut>
+  etl::transcode_result transcode(const etl::basic_string_view<TIn, TTraits>& input, etl::ibasic_string<TOut>& output, bool append = false)
+  {
+    if (!append)
+    {
+      output.clear();
+    }
+
+    const size_t size = output.size();
+
+    etl::transcode_result result = etl::transcode(input.data(), input.size(), output.data() + size, output.available());
+
+    output.uninitialized_resize(size + result.written);
+
+    if (result.status == etl::transcode_status::Truncated)
+    {
+      etl::private_transcode::set_truncated(output);
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Converts a string to the encoding of the output string.
+  /// The characters are assigned to the string, or appended if 'append' is true.
+  /// The string's truncated flag is set if the output did not fit.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TIn, typename TOut>
+  etl::transcode_result transcode(const etl::ibasic_string<TIn>& input, etl::ibasic_string<TOut>& output, bool append = false)
+  {
+    return etl::transcode(etl::basic_string_view<TIn>(input.data(), input.size()), output, append);
+  }
+}
+
+#endif
@@ -599,6 +599,19 @@ namespace etl
     };
   };
 
+  //***************************************************************************
+  /// Is T an etl::unaligned_type?
+  //***************************************************************************
+  template <typename T>
+  struct is_unaligned_type : public etl::false_type
+  {
+  };
+
+  template <typename T, int Endian_>
+  struct is_unaligned_type<etl::unaligned_type<T, Endian_> > : public etl::true_type
+  {
+  };
+
 #if ETL_HAS_CONSTEXPR_ENDIANNESS
   // Host order
   typedef unaligned_type<char, etl::endianness::value()> host_char_t;
@@ -721,6 +734,9 @@ namespace etl
 #if ETL_USING_CPP17
   template <typename T, int Endian>
   constexpr size_t unaligned_type_v = etl::unaligned_type<T, Endian>::Size;
+
+  template <typename T>
+  inline constexpr bool is_unaligned_type_v = etl::is_unaligned_type<T>::value;
 #endif
 }
 
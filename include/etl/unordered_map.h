@@ -52,6 +52,8 @@ SOFTWARE.
 #include "placement_new.h"
 #include "initializer_list.h"
 
+#include "private/unordered_hash_policy.h"
+
 #include <stddef.h>
 
 //*****************************************************************************
@@ -122,7 +124,7 @@ namespace etl
   /// Can be used as a reference type for all unordered_map containing a specific type.
   ///\ingroup unordered_map
   //***************************************************************************
-  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TPolicy = etl::unordered_modulo_buckets>
   class iunordered_map
   {
   public:
@@ -148,7 +150,7 @@ namespace etl
 
     // The nodes that store the elements.
     // The nodes that store the elements.
-    struct node_t : public link_t
+    struct node_t : public link_t, public TPolicy::node_hash
     {
       node_t(const_reference key_value_pair_)
         : key_value_pair(key_value_pair_)
@@ -590,7 +592,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return TPolicy::bucket_index(key_hash_function(key), number_of_buckets);
     }
 
     //*********************************************************************
@@ -630,7 +632,8 @@ namespace etl
     mapped_type& operator [](key_parameter_t key)
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + TPolicy::bucket_index(key_hash, number_of_buckets);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -639,7 +642,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (inode->hash_matches(key_hash) && key_equal_function(key, inode->key_value_pair.first))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -654,6 +657,7 @@ namespace etl
       // Get a new node.
       node_t& node = create_data_node();
       ::new (&node.key_value_pair) value_type(key, T());
+      node.store_hash(key_hash);
       ETL_INCREMENT_DEBUG_COUNT
 
       pbucket->insert_after(pbucket->before_begin(), node);
@@ -672,7 +676,8 @@ namespace etl
     mapped_type& at(key_parameter_t key)
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + TPolicy::bucket_index(key_hash, number_of_buckets);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -681,7 +686,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (inode->hash_matches(key_hash) && key_equal_function(key, inode->key_value_pair.first))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -707,7 +712,8 @@ namespace etl
     const mapped_type& at(key_parameter_t key) const
     {
       // Find the bucket.
-      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      bucket_t* pbucket = pbuckets + TPolicy::bucket_index(key_hash, number_of_buckets);
 
       // Find the first node in the bucket.
       local_iterator inode = pbucket->begin();
@@ -716,7 +722,7 @@ namespace etl
       while (inode != pbucket->end())
       {
         // Equal keys?
-        if (key_equal_function(key, inode->key_value_pair.first))
+        if (inode->hash_matches(key_hash) && key_equal_function(key, inode->key_value_pair.first))
         {
           // Found a match.
           return inode->key_value_pair.second;
@@ -772,7 +778,8 @@ namespace etl
       const key_type&    key = key_value_pair.first;
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -784,6 +791,7 @@ namespace etl
         // Get a new node.
         node_t& node = create_data_node();
         ::new (&node.key_value_pair) value_type(key_value_pair);
+        node.store_hash(key_hash);
         ETL_INCREMENT_DEBUG_COUNT
 
         // Just add the pointer to the bucket;
@@ -803,7 +811,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key_value_pair.first, key))
+          if (inode->hash_matches(key_hash) && key_equal_function(inode->key_value_pair.first, key))
           {
             break;
           }
@@ -818,6 +826,7 @@ namespace etl
           // Get a new node.
           node_t& node = create_data_node();
           ::new (&node.key_value_pair) value_type(key_value_pair);
+          node.store_hash(key_hash);
           ETL_INCREMENT_DEBUG_COUNT
 
           // Add the node to the end of the bucket;
@@ -848,7 +857,8 @@ namespace etl
       const key_type&    key = key_value_pair.first;
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -860,6 +870,7 @@ namespace etl
         // Get a new node.
         node_t& node = create_data_node();
         ::new (&node.key_value_pair) value_type(etl::move(key_value_pair));
+        node.store_hash(key_hash);
         ETL_INCREMENT_DEBUG_COUNT
 
         // Just add the pointer to the bucket;
@@ -879,7 +890,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key_value_pair.first, key))
+          if (inode->hash_matches(key_hash) && key_equal_function(inode->key_value_pair.first, key))
           {
             break;
           }
@@ -894,6 +905,7 @@ namespace etl
           // Get a new node.
           node_t& node = create_data_node();
           ::new (&node.key_value_pair) value_type(etl::move(key_value_pair));
+          node.store_hash(key_hash);
           ETL_INCREMENT_DEBUG_COUNT
 
           // Add the node to the end of the bucket;
@@ -959,7 +971,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0UL;
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       bucket_t& bucket = pbuckets[index];
 
@@ -967,7 +980,7 @@ namespace etl
       local_iterator icurrent = bucket.begin();
 
       // Search for the key, if we have it.
-      while ((icurrent != bucket.end()) && (!key_equal_function(icurrent->key_value_pair.first, key)))
+      while ((icurrent != bucket.end()) && (!(icurrent->hash_matches(key_hash) && key_equal_function(icurrent->key_value_pair.first, key))))
       {
         ++iprevious;
         ++icurrent;
@@ -1102,7 +1115,8 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1117,7 +1131,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (inode->hash_matches(key_hash) && key_equal_function(key, inode->key_value_pair.first))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1136,7 +1150,8 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1151,7 +1166,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (inode->hash_matches(key_hash) && key_equal_function(key, inode->key_value_pair.first))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1509,8 +1524,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
   ///\ingroup unordered_map
   //***************************************************************************
-  template <typename TKey, typename T, typename TKeyCompare>
-  bool operator ==(const etl::iunordered_map<TKey, T, TKeyCompare>& lhs, const etl::iunordered_map<TKey, T, TKeyCompare>& rhs)
+  template <typename TKey, typename T, typename THash, typename TKeyEqual, typename TPolicy>
+  bool operator ==(const etl::iunordered_map<TKey, T, THash, TKeyEqual, TPolicy>& lhs, const etl::iunordered_map<TKey, T, THash, TKeyEqual, TPolicy>& rhs)
   {
     const bool sizes_match = (lhs.size() == rhs.size());
     bool elements_match = true;
@@ -1536,8 +1551,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
   ///\ingroup unordered_map
   //***************************************************************************
-  template <typename TKey, typename T, typename TKeyCompare>
-  bool operator !=(const etl::iunordered_map<TKey, T, TKeyCompare>& lhs, const etl::iunordered_map<TKey, T, TKeyCompare>& rhs)
+  template <typename TKey, typename T, typename THash, typename TKeyEqual, typename TPolicy>
+  bool operator !=(const etl::iunordered_map<TKey, T, THash, TKeyEqual, TPolicy>& lhs, const etl::iunordered_map<TKey, T, THash, TKeyEqual, TPolicy>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -1545,23 +1560,23 @@ namespace etl
   //*************************************************************************
   /// A templated unordered_map implementation that uses a fixed size buffer.
   //*************************************************************************
-  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
-  class unordered_map : public etl::iunordered_map<TKey, TValue, THash, TKeyEqual>
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TPolicy = etl::unordered_modulo_buckets>
+  class unordered_map : public etl::iunordered_map<TKey, TValue, THash, TKeyEqual, TPolicy>
   {
   private:
 
-    typedef iunordered_map<TKey, TValue, THash, TKeyEqual> base;
+    typedef etl::iunordered_map<TKey, TValue, THash, TKeyEqual, TPolicy> base;
 
   public:
 
     static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
-    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = TPolicy::template bucket_count<MAX_BUCKETS_>::value;
 
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
     unordered_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
     {
     }
 
@@ -1569,7 +1584,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_map(const unordered_map& other)
-      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS, other.hash_function(), other.key_eq())
     {
       base::assign(other.cbegin(), other.cend());
     }
@@ -1579,7 +1594,7 @@ namespace etl
     /// Move constructor.
     //*************************************************************************
     unordered_map(unordered_map&& other)
-      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS, other.hash_function(), other.key_eq())
     {
       if (this != &other)
       {
@@ -1596,7 +1611,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
     {
       base::assign(first_, last_);
     }
@@ -1606,7 +1621,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
     {
       base::assign(init.begin(), init.end());
     }
@@ -1646,7 +1661,7 @@ namespace etl
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    typename base::bucket_t buckets[MAX_BUCKETS_];
+    typename base::bucket_t buckets[MAX_BUCKETS];
   };
 
   //*************************************************************************
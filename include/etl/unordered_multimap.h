@@ -52,6 +52,8 @@ SOFTWARE.
 #include "placement_new.h"
 #include "initializer_list.h"
 
+#include "private/unordered_hash_policy.h"
+
 #include <stddef.h>
 
 //*****************************************************************************
@@ -122,7 +124,7 @@ namespace etl
   /// Can be used as a reference type for all unordered_multimap containing a specific type.
   ///\ingroup unordered_multimap
   //***************************************************************************
-  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TPolicy = etl::unordered_modulo_buckets>
   class iunordered_multimap
   {
   public:
@@ -148,7 +150,7 @@ namespace etl
 
     //*********************************************************************
     // The nodes that store the elements.
-    struct node_t : public link_t
+    struct node_t : public link_t, public TPolicy::node_hash
     {
       node_t(const_reference key_value_pair_)
         : key_value_pair(key_value_pair_)
@@ -591,7 +593,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return TPolicy::bucket_index(key_hash_function(key), number_of_buckets);
     }
 
     //*********************************************************************
@@ -662,7 +664,8 @@ namespace etl
       const key_type&    key = key_value_pair.first;
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -674,6 +677,7 @@ namespace etl
         // Get a new node.
         node_t& node = create_data_node();
         ::new (&node.key_value_pair) value_type(key_value_pair);
+        node.store_hash(key_hash);
         ETL_INCREMENT_DEBUG_COUNT
 
         // Just add the pointer to the bucket;
@@ -691,7 +695,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key_value_pair.first, key))
+          if (inode->hash_matches(key_hash) && key_equal_function(inode->key_value_pair.first, key))
           {
             break;
           }
@@ -703,6 +707,7 @@ namespace etl
         // Get a new node.
         node_t& node = create_data_node();
         ::new (&node.key_value_pair) value_type(key_value_pair);
+        node.store_hash(key_hash);
         ETL_INCREMENT_DEBUG_COUNT
 
         // Add the node to the end of the bucket;
@@ -731,7 +736,8 @@ namespace etl
       const key_type&    key = key_value_pair.first;
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -743,6 +749,7 @@ namespace etl
         // Get a new node.
         node_t& node = create_data_node();
         ::new (&node.key_value_pair) value_type(etl::move(key_value_pair));
+        node.store_hash(key_hash);
         ETL_INCREMENT_DEBUG_COUNT
 
           // Just add the pointer to the bucket;
@@ -760,7 +767,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key_value_pair.first, key))
+          if (inode->hash_matches(key_hash) && key_equal_function(inode->key_value_pair.first, key))
           {
             break;
           }
@@ -772,6 +779,7 @@ namespace etl
         // Get a new node.
         node_t& node = create_data_node();
         ::new (&node.key_value_pair) value_type(etl::move(key_value_pair));
+        node.store_hash(key_hash);
         ETL_INCREMENT_DEBUG_COUNT
 
           // Add the node to the end of the bucket;
@@ -835,7 +843,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0UL;
-      size_t bucket_id = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t bucket_id = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       bucket_t& bucket = pbuckets[bucket_id];
 
@@ -844,7 +853,7 @@ namespace etl
 
       while (icurrent != bucket.end())
       {
-        if (key_equal_function(icurrent->key_value_pair.first, key))
+        if (icurrent->hash_matches(key_hash) && key_equal_function(icurrent->key_value_pair.first, key))
         {
           bucket.erase_after(iprevious);          // Unlink from the bucket.
           icurrent->key_value_pair.~value_type(); // Destroy the value.
@@ -1000,7 +1009,8 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1015,7 +1025,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (inode->hash_matches(key_hash) && key_equal_function(key, inode->key_value_pair.first))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1034,7 +1044,8 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1049,7 +1060,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (inode->hash_matches(key_hash) && key_equal_function(key, inode->key_value_pair.first))
           {
             return const_iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1417,8 +1428,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
   ///\ingroup unordered_multimap
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator ==(const etl::iunordered_multimap<TKey, TMapped, TKeyCompare>& lhs, const etl::iunordered_multimap<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual, typename TPolicy>
+  bool operator ==(const etl::iunordered_multimap<TKey, TMapped, THash, TKeyEqual, TPolicy>& lhs, const etl::iunordered_multimap<TKey, TMapped, THash, TKeyEqual, TPolicy>& rhs)
   {
     const bool sizes_match = (lhs.size() == rhs.size());
     bool elements_match = true;
@@ -1444,8 +1455,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
   ///\ingroup unordered_multimap
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator !=(const etl::iunordered_multimap<TKey, TMapped, TKeyCompare>& lhs, const etl::iunordered_multimap<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual, typename TPolicy>
+  bool operator !=(const etl::iunordered_multimap<TKey, TMapped, THash, TKeyEqual, TPolicy>& lhs, const etl::iunordered_multimap<TKey, TMapped, THash, TKeyEqual, TPolicy>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -1453,17 +1464,17 @@ namespace etl
   //*************************************************************************
   /// A templated unordered_multimap implementation that uses a fixed size buffer.
   //*************************************************************************
-  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
-  class unordered_multimap : public etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual>
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TPolicy = etl::unordered_modulo_buckets>
+  class unordered_multimap : public etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual, TPolicy>
   {
   private:
 
-    typedef etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual> base;
+    typedef etl::iunordered_multimap<TKey, TValue, THash, TKeyEqual, TPolicy> base;
 
   public:
 
     static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
-    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = TPolicy::template bucket_count<MAX_BUCKETS_>::value;
 
     //*************************************************************************
     /// Default constructor.
@@ -1519,7 +1530,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_multimap(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
     {
       base::assign(init.begin(), init.end());
     }
@@ -1561,7 +1572,7 @@ namespace etl
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    typename base::bucket_t buckets[MAX_BUCKETS_];
+    typename base::bucket_t buckets[MAX_BUCKETS];
   };
 
   //*************************************************************************
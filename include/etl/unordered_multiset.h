@@ -51,6 +51,8 @@ SOFTWARE.
 #include "placement_new.h"
 #include "initializer_list.h"
 
+#include "private/unordered_hash_policy.h"
+
 #include <stddef.h>
 
 //*****************************************************************************
@@ -121,7 +123,7 @@ namespace etl
   /// Can be used as a reference type for all unordered_multiset containing a specific type.
   ///\ingroup unordered_multiset
   //***************************************************************************
-  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TPolicy = etl::unordered_modulo_buckets>
   class iunordered_multiset
   {
   public:
@@ -145,7 +147,7 @@ namespace etl
 
     //*********************************************************************
     // The nodes that store the elements.
-    struct node_t : public link_t
+    struct node_t : public link_t, public TPolicy::node_hash
     {
       node_t(const_reference key_)
         : key(key_)
@@ -585,7 +587,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return TPolicy::bucket_index(key_hash_function(key), number_of_buckets);
     }
 
     //*********************************************************************
@@ -654,7 +656,8 @@ namespace etl
       ETL_ASSERT(!full(), ETL_ERROR(unordered_multiset_full));
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -666,6 +669,7 @@ namespace etl
         // Get a new node.
         node_t& node = create_data_node();
         ::new (&node.key) value_type(key);
+        node.store_hash(key_hash);
         ETL_INCREMENT_DEBUG_COUNT
 
         // Just add the pointer to the bucket;
@@ -684,7 +688,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key, key))
+          if (inode->hash_matches(key_hash) && key_equal_function(inode->key, key))
           {
             break;
           }
@@ -696,6 +700,7 @@ namespace etl
         // Get a new node.
         node_t& node = create_data_node();
         ::new (&node.key) value_type(key);
+        node.store_hash(key_hash);
         ETL_INCREMENT_DEBUG_COUNT
 
         // Add the node to the end of the bucket;
@@ -723,7 +728,8 @@ namespace etl
       ETL_ASSERT(!full(), ETL_ERROR(unordered_multiset_full));
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -735,6 +741,7 @@ namespace etl
         // Get a new node.
         node_t& node = create_data_node();
         ::new (&node.key) value_type(etl::move(key));
+        node.store_hash(key_hash);
         ETL_INCREMENT_DEBUG_COUNT
 
         // Just add the pointer to the bucket;
@@ -753,7 +760,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key, key))
+          if (inode->hash_matches(key_hash) && key_equal_function(inode->key, key))
           {
             break;
           }
@@ -765,6 +772,7 @@ namespace etl
         // Get a new node.
         node_t& node = create_data_node();
         ::new (&node.key) value_type(etl::move(key));
+        node.store_hash(key_hash);
         ETL_INCREMENT_DEBUG_COUNT
 
           // Add the node to the end of the bucket;
@@ -816,7 +824,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0UL;
-      size_t bucket_id = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t bucket_id = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       bucket_t& bucket = pbuckets[bucket_id];
 
@@ -825,7 +834,7 @@ namespace etl
 
       while (icurrent != bucket.end())
       {
-        if (key_equal_function(icurrent->key, key))
+        if (icurrent->hash_matches(key_hash) && key_equal_function(icurrent->key, key))
         {
           bucket.erase_after(iprevious);  // Unlink from the bucket.
           icurrent->key.~value_type();    // Destroy the value.
@@ -981,7 +990,8 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -996,7 +1006,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (inode->hash_matches(key_hash) && key_equal_function(key, inode->key))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1015,7 +1025,8 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1030,7 +1041,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (inode->hash_matches(key_hash) && key_equal_function(key, inode->key))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1398,8 +1409,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
   ///\ingroup unordered_multiset
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator ==(const etl::iunordered_multiset<TKey, TMapped, TKeyCompare>& lhs, const etl::iunordered_multiset<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename THash, typename TKeyEqual, typename TPolicy>
+  bool operator ==(const etl::iunordered_multiset<TKey, THash, TKeyEqual, TPolicy>& lhs, const etl::iunordered_multiset<TKey, THash, TKeyEqual, TPolicy>& rhs)
   {
     const bool sizes_match = (lhs.size() == rhs.size());
     bool elements_match = true;
@@ -1425,8 +1436,8 @@ namespace etl
   ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
   ///\ingroup unordered_multiset
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator !=(const etl::iunordered_multiset<TKey, TMapped, TKeyCompare>& lhs, const etl::iunordered_multiset<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename THash, typename TKeyEqual, typename TPolicy>
+  bool operator !=(const etl::iunordered_multiset<TKey, THash, TKeyEqual, TPolicy>& lhs, const etl::iunordered_multiset<TKey, THash, TKeyEqual, TPolicy>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -1434,17 +1445,17 @@ namespace etl
   //*************************************************************************
   /// A templated unordered_multiset implementation that uses a fixed size buffer.
   //*************************************************************************
-  template <typename TKey, const size_t MAX_SIZE_, size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
-  class unordered_multiset : public etl::iunordered_multiset<TKey, THash, TKeyEqual>
+  template <typename TKey, const size_t MAX_SIZE_, size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TPolicy = etl::unordered_modulo_buckets>
+  class unordered_multiset : public etl::iunordered_multiset<TKey, THash, TKeyEqual, TPolicy>
   {
   private:
 
-    typedef etl::iunordered_multiset<TKey, THash, TKeyEqual> base;
+    typedef etl::iunordered_multiset<TKey, THash, TKeyEqual, TPolicy> base;
 
   public:
 
     static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
-    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = TPolicy::template bucket_count<MAX_BUCKETS_>::value;
 
 
     //*************************************************************************
@@ -1544,7 +1555,7 @@ namespace etl
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    typename base::bucket_t buckets[MAX_BUCKETS_];
+    typename base::bucket_t buckets[MAX_BUCKETS];
   };
 
   //*************************************************************************
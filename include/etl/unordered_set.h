@@ -52,6 +52,8 @@ SOFTWARE.
 #include "placement_new.h"
 #include "initializer_list.h"
 
+#include "private/unordered_hash_policy.h"
+
 #include <stddef.h>
 
 //*****************************************************************************
@@ -122,7 +124,7 @@ namespace etl
   /// Can be used as a reference type for all unordered_set containing a specific type.
   ///\ingroup unordered_set
   //***************************************************************************
-  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TPolicy = etl::unordered_modulo_buckets>
   class iunordered_set
   {
   public:
@@ -146,7 +148,7 @@ namespace etl
 
     //*********************************************************************
     // The nodes that store the elements.
-    struct node_t : public link_t
+    struct node_t : public link_t, public TPolicy::node_hash
     {
       node_t(const_reference key_)
         : key(key_)
@@ -586,7 +588,7 @@ namespace etl
     //*********************************************************************
     size_type get_bucket_index(key_parameter_t key) const
     {
-      return key_hash_function(key) % number_of_buckets;
+      return TPolicy::bucket_index(key_hash_function(key), number_of_buckets);
     }
 
     //*********************************************************************
@@ -655,7 +657,8 @@ namespace etl
       ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -667,6 +670,7 @@ namespace etl
         // Get a new node.
         node_t& node = create_data_node();
         ::new (&node.key) value_type(key);
+        node.store_hash(key_hash);
         ETL_INCREMENT_DEBUG_COUNT
 
         // Just add the pointer to the bucket;
@@ -685,7 +689,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key, key))
+          if (inode->hash_matches(key_hash) && key_equal_function(inode->key, key))
           {
             break;
           }
@@ -700,6 +704,7 @@ namespace etl
           // Get a new node.
           node_t& node = create_data_node();
           ::new (&node.key) value_type(key);
+          node.store_hash(key_hash);
           ETL_INCREMENT_DEBUG_COUNT
 
           // Add the node to the end of the bucket;
@@ -728,7 +733,8 @@ namespace etl
       ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
 
       // Get the hash index.
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
@@ -740,6 +746,7 @@ namespace etl
         // Get a new node.
         node_t& node = create_data_node();
         ::new (&node.key) value_type(etl::move(key));
+        node.store_hash(key_hash);
         ETL_INCREMENT_DEBUG_COUNT
 
           // Just add the pointer to the bucket;
@@ -758,7 +765,7 @@ namespace etl
         while (inode != bucket.end())
         {
           // Do we already have this key?
-          if (key_equal_function(inode->key, key))
+          if (inode->hash_matches(key_hash) && key_equal_function(inode->key, key))
           {
             break;
           }
@@ -773,6 +780,7 @@ namespace etl
           // Get a new node.
           node_t& node = create_data_node();
           ::new (&node.key) value_type(etl::move(key));
+          node.store_hash(key_hash);
           ETL_INCREMENT_DEBUG_COUNT
 
             // Add the node to the end of the bucket;
@@ -838,7 +846,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0UL;
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       bucket_t& bucket = pbuckets[index];
 
@@ -846,7 +855,7 @@ namespace etl
       local_iterator icurrent = bucket.begin();
 
       // Search for the key, if we have it.
-      while ((icurrent != bucket.end()) && (!key_equal_function(icurrent->key, key)))
+      while ((icurrent != bucket.end()) && (!(icurrent->hash_matches(key_hash) && key_equal_function(icurrent->key, key))))
       {
         ++iprevious;
         ++icurrent;
@@ -985,7 +994,8 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1000,7 +1010,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (inode->hash_matches(key_hash) && key_equal_function(key, inode->key))
           {
             return iterator(pbuckets + number_of_buckets, pbucket, inode);
           }
@@ -1019,7 +1029,8 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      const size_t key_hash = key_hash_function(key);
+      size_t index = TPolicy::bucket_index(key_hash, number_of_buckets);
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1034,7 +1045,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (inode->hash_matches(key_hash) && key_equal_function(key, inode->key))
           {
             return iterator(pbuckets + number_of_buckets, pbucket, inode);
           }
@@ -1398,8 +1409,8 @@ else
   ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
   ///\ingroup unordered_set
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator ==(const etl::iunordered_set<TKey, TMapped, TKeyCompare>& lhs, const etl::iunordered_set<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename THash, typename TKeyEqual, typename TPolicy>
+  bool operator ==(const etl::iunordered_set<TKey, THash, TKeyEqual, TPolicy>& lhs, const etl::iunordered_set<TKey, THash, TKeyEqual, TPolicy>& rhs)
   {
     const bool sizes_match = (lhs.size() == rhs.size());
     bool elements_match = true;
@@ -1425,8 +1436,8 @@ else
   ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
   ///\ingroup unordered_set
   //***************************************************************************
-  template <typename TKey, typename TMapped, typename TKeyCompare>
-  bool operator !=(const etl::iunordered_set<TKey, TMapped, TKeyCompare>& lhs, const etl::iunordered_set<TKey, TMapped, TKeyCompare>& rhs)
+  template <typename TKey, typename THash, typename TKeyEqual, typename TPolicy>
+  bool operator !=(const etl::iunordered_set<TKey, THash, TKeyEqual, TPolicy>& lhs, const etl::iunordered_set<TKey, THash, TKeyEqual, TPolicy>& rhs)
   {
     return !(lhs == rhs);
   }
@@ -1434,17 +1445,17 @@ else
   //*************************************************************************
   /// A templated unordered_set implementation that uses a fixed size buffer.
   //*************************************************************************
-  template <typename TKey, const size_t MAX_SIZE_, size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
-  class unordered_set : public etl::iunordered_set<TKey, THash, TKeyEqual>
+  template <typename TKey, const size_t MAX_SIZE_, size_t MAX_BUCKETS_ = MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TPolicy = etl::unordered_modulo_buckets>
+  class unordered_set : public etl::iunordered_set<TKey, THash, TKeyEqual, TPolicy>
   {
   private:
 
-    typedef etl::iunordered_set<TKey, THash, TKeyEqual> base;
+    typedef etl::iunordered_set<TKey, THash, TKeyEqual, TPolicy> base;
 
   public:
 
     static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
-    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = TPolicy::template bucket_count<MAX_BUCKETS_>::value;
 
     //*************************************************************************
     /// Default constructor.
@@ -1542,7 +1553,7 @@ else
     etl::pool<typename base::node_t, MAX_SIZE> node_pool;
 
     /// The buckets of node lists.
-    typename base::bucket_t buckets[MAX_BUCKETS_];
+    typename base::bucket_t buckets[MAX_BUCKETS];
   };
 
   //*************************************************************************
@@ -0,0 +1,259 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WYHASH_INCLUDED
+#define ETL_WYHASH_INCLUDED
+
+#include "platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_64BIT_TYPES
+
+#if defined(ETL_COMPILER_MICROSOFT) && defined(_M_X64)
+  #include <intrin.h>
+  #pragma intrinsic(_umul128)
+#endif
+
+///\defgroup wyhash wyhash 64 bit hash calculation
+/// A fast non-cryptographic hash, based on the 'final 4' version of wyhash by Wang Yi.
+/// See https://github.com/wangyi-fudan/wyhash
+/// The input is read a 64 bit word at a time, 48 bytes per loop for long inputs.
+/// The result does not depend on the endianness or alignment of the data.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_wyhash
+  {
+    //*************************************************************************
+    /// The default secret.
+    //*************************************************************************
+    struct secret
+    {
+      static ETL_CONSTANT uint64_t S0 = 0x2D358DCCAA6C78A5ULL;
+      static ETL_CONSTANT uint64_t S1 = 0x8BB84B93962EACC9ULL;
+      static ETL_CONSTANT uint64_t S2 = 0x4B33A62ED433D4A3ULL;
+      static ETL_CONSTANT uint64_t S3 = 0x4D5A2DA51DE1AA47ULL;
+    };
+
+    //*************************************************************************
+    /// 64 x 64 => 128 bit multiply.
+    /// Returns the low 64 bits in 'a' and the high 64 bits in 'b'.
+    //*************************************************************************
+    inline void multiply(uint64_t& a, uint64_t& b)
+    {
+#if defined(__SIZEOF_INT128__)
+      __extension__ typedef unsigned __int128 uint128_t;
+
+      const uint128_t r = uint128_t(a) * b;
+
+      a = uint64_t(r);
+      b = uint64_t(r >> 64U);
+#elif defined(ETL_COMPILER_MICROSOFT) && defined(_M_X64)
+      a = _umul128(a, b, &b);
+#else
+      const uint64_t ha = a >> 32U;
+      const uint64_t hb = b >> 32U;
+      const uint64_t la = uint32_t(a);
+      const uint64_t lb = uint32_t(b);
+
+      const uint64_t rh  = ha * hb;
+      const uint64_t rm0 = ha * lb;
+      const uint64_t rm1 = hb * la;
+      const uint64_t rl  = la * lb;
+
+      const uint64_t t  = rl + (rm0 << 32U);
+      uint64_t       c  = (t < rl) ? 1U : 0U;
+      const uint64_t lo = t + (rm1 << 32U);
+
+      c += (lo < t) ? 1U : 0U;
+
+      a = lo;
+      b = rh + (rm0 >> 32U) + (rm1 >> 32U) + c;
+#endif
+    }
+
+    //*************************************************************************
+    /// Multiplies and folds the 128 bit result to 64 bits.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+      multiply(a, b);
+
+      return a ^ b;
+    }
+
+    //*************************************************************************
+    /// Reads little endian values.
+    /// Compilers recognise these as single loads on little endian targets.
+    //*************************************************************************
+    inline uint64_t read64(const uint8_t* p)
+    {
+      return  uint64_t(p[0])         | (uint64_t(p[1]) << 8U)  | (uint64_t(p[2]) << 16U) | (uint64_t(p[3]) << 24U) |
+             (uint64_t(p[4]) << 32U) | (uint64_t(p[5]) << 40U) | (uint64_t(p[6]) << 48U) | (uint64_t(p[7]) << 56U);
+    }
+
+    inline uint64_t read32(const uint8_t* p)
+    {
+      return uint64_t(p[0]) | (uint64_t(p[1]) << 8U) | (uint64_t(p[2]) << 16U) | (uint64_t(p[3]) << 24U);
+    }
+
+    inline uint64_t read_1_to_3(const uint8_t* p, size_t length)
+    {
+      return (uint64_t(p[0]) << 16U) | (uint64_t(p[length >> 1U]) << 8U) | uint64_t(p[length - 1U]);
+    }
+  }
+
+  //***************************************************************************
+  /// Calculates the 64 bit wyhash of a block of memory.
+  ///\param begin Pointer to the start of the data.
+  ///\param end   Pointer to the end of the data.
+  ///\param seed  The seed value. Default = 0.
+  ///\ingroup wyhash
+  //***************************************************************************
+  inline uint64_t wyhash_64(const uint8_t* begin, const uint8_t* end, uint64_t seed = 0U)
+  {
+    using namespace etl::private_wyhash;
+
+    const uint8_t* p      = begin;
+    const size_t   length = size_t(end - begin);
+
+    seed ^= mix(seed ^ secret::S0, secret::S1);
+
+    uint64_t a;
+    uint64_t b;
+
+    if (length <= 16U)
+    {
+      if (length >= 4U)
+      {
+        const size_t offset = (length >> 3U) << 2U;
+
+        a = (read32(p) << 32U) | read32(p + offset);
+        b = (read32(p + length - 4U) << 32U) | read32(p + length - 4U - offset);
+      }
+      else if (length > 0U)
+      {
+        a = read_1_to_3(p, length);
+        b = 0U;
+      }
+      else
+      {
+        a = 0U;
+        b = 0U;
+      }
+    }
+    else
+    {
+      size_t remaining = length;
+
+      if (remaining > 48U)
+      {
+        // Three independent lanes.
+        uint64_t seed1 = seed;
+        uint64_t seed2 = seed;
+
+        do
+        {
+          seed  = mix(read64(p)      ^ secret::S1, read64(p + 8U)  ^ seed);
+          seed1 = mix(read64(p + 16U) ^ secret::S2, read64(p + 24U) ^ seed1);
+          seed2 = mix(read64(p + 32U) ^ secret::S3, read64(p + 40U) ^ seed2);
+
+          p         += 48U;
+          remaining -= 48U;
+        } while (remaining > 48U);
+
+        seed ^= seed1 ^ seed2;
+      }
+
+      while (remaining > 16U)
+      {
+        seed = mix(read64(p) ^ secret::S1, read64(p + 8U) ^ seed);
+
+        p         += 16U;
+        remaining -= 16U;
+      }
+
+      // The last 16 bytes, which may overlap those already read.
+      a = read64(p + remaining - 16U);
+      b = read64(p + remaining - 8U);
+    }
+
+    a ^= secret::S1;
+    b ^= seed;
+
+    multiply(a, b);
+
+    return mix(a ^ secret::S0 ^ uint64_t(length), b ^ secret::S1);
+  }
+
+  //***************************************************************************
+  /// Calculates the 32 bit wyhash of a block of memory.
+  /// The 64 bit hash folded to 32 bits.
+  ///\param begin Pointer to the start of the data.
+  ///\param end   Pointer to the end of the data.
+  ///\param seed  The seed value. Default = 0.
+  ///\ingroup wyhash
+  //***************************************************************************
+  inline uint32_t wyhash_32(const uint8_t* begin, const uint8_t* end, uint64_t seed = 0U)
+  {
+    const uint64_t h = etl::wyhash_64(begin, end, seed);
+
+    return uint32_t(h ^ (h >> 32U));
+  }
+
+  //***************************************************************************
+  /// Hash policy that uses wyhash.
+  /// May be used to select the algorithm for etl::contiguous_hash.
+  ///\ingroup wyhash
+  //***************************************************************************
+  struct hash_policy_wyhash
+  {
+    static size_t hash(const uint8_t* begin, const uint8_t* end)
+    {
+      const uint64_t h = etl::wyhash_64(begin, end);
+
+      if ETL_IF_CONSTEXPR(sizeof(size_t) >= sizeof(uint64_t))
+      {
+        return size_t(h);
+      }
+      else
+      {
+        return size_t(h ^ (h >> 32U));
+      }
+    }
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,134 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// CRC, checksum and hash benchmarks.
+// The operation is one byte.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/crc16_ccitt.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/crc64_ecma.h"
+#include "etl/checksum.h"
+#include "etl/fnv_1.h"
+#include "etl/hash.h"
+#include "etl/wyhash.h"
+#include "etl/string.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace etl_benchmark
+{
+  namespace
+  {
+    const size_t Size = 4096U;
+
+    //*************************************************************************
+    const std::vector<uint8_t>& data()
+    {
+      static std::vector<uint8_t> values;
+
+      if (values.empty())
+      {
+        random rng;
+
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          values.push_back(static_cast<uint8_t>(rng()));
+        }
+      }
+
+      return values;
+    }
+
+    //*************************************************************************
+    template <typename TCheck>
+    void check_benchmark(runner& r, const char* suite, const char* name)
+    {
+      r.run(suite, name, "etl", Size, []()
+      {
+        const std::vector<uint8_t>& d = data();
+
+        do_not_optimise(TCheck(d.data(), d.data() + d.size()).value());
+      });
+    }
+  }
+
+  //***************************************************************************
+  void run_check_benchmarks(runner& r)
+  {
+    check_benchmark<etl::crc16_ccitt_t256>(r, "crc", "crc16_ccitt_t256");
+    check_benchmark<etl::crc16_ccitt_t4096>(r, "crc", "crc16_ccitt_t4096");
+    check_benchmark<etl::crc32_t256>(r, "crc", "crc32_t256");
+    check_benchmark<etl::crc32_t2048>(r, "crc", "crc32_t2048");
+    check_benchmark<etl::crc32_t4096>(r, "crc", "crc32_t4096");
+    check_benchmark<etl::crc32_c_t256>(r, "crc", "crc32_c_t256");
+    check_benchmark<etl::crc32_c_t4096>(r, "crc", "crc32_c_t4096");
+    check_benchmark<etl::crc64_ecma_t256>(r, "crc", "crc64_ecma_t256");
+    check_benchmark<etl::crc64_ecma_t4096>(r, "crc", "crc64_ecma_t4096");
+
+    check_benchmark<etl::checksum<uint32_t> >(r, "checksum", "sum32");
+    check_benchmark<etl::xor_checksum<uint8_t> >(r, "checksum", "xor8");
+    check_benchmark<etl::parity_checksum<uint8_t> >(r, "checksum", "parity");
+
+    check_benchmark<etl::fnv_1a_32>(r, "hash", "fnv_1a_32");
+    check_benchmark<etl::fnv_1a_64>(r, "hash", "fnv_1a_64");
+
+    r.run("hash", "wyhash_64", "etl", Size, []()
+    {
+      const std::vector<uint8_t>& d = data();
+
+      do_not_optimise(etl::wyhash_64(d.data(), d.data() + d.size()));
+    });
+
+    // String hashes.
+    std::unique_ptr<etl::string<Size> > etl_text(new etl::string<Size>(data().begin(), data().end()));
+    const std::string std_text(data().begin(), data().end());
+
+    r.run("hash", "string", "etl", Size, [&etl_text]()
+    {
+      do_not_optimise(etl::hash<etl::istring>()(*etl_text));
+    });
+
+    r.run("hash", "string_wyhash", "etl", Size, [&etl_text]()
+    {
+      do_not_optimise(etl::contiguous_hash<etl::istring, etl::hash_policy_wyhash>()(*etl_text));
+    });
+
+    r.run("hash", "string", "std", Size, [&std_text]()
+    {
+      do_not_optimise(std::hash<std::string>()(std_text));
+    });
+  }
+}
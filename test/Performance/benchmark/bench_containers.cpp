@@ -0,0 +1,369 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Container benchmarks.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/list.h"
+#include "etl/map.h"
+#include "etl/set.h"
+#include "etl/flat_map.h"
+#include "etl/inline_flat_map.h"
+#include "etl/inline_flat_set.h"
+#include "etl/unordered_map.h"
+#include "etl/flat_hash_map.h"
+#include "etl/bitset.h"
+
+#include <vector>
+#include <deque>
+#include <list>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <memory>
+#include <utility>
+
+namespace etl_benchmark
+{
+  namespace
+  {
+    const size_t Size = 1024U;
+
+    //*************************************************************************
+    /// Random keys, with every key present once.
+    //*************************************************************************
+    const std::vector<int>& keys()
+    {
+      static std::vector<int> values;
+
+      if (values.empty())
+      {
+        random rng;
+        std::set<int> unique;
+
+        while (unique.size() < Size)
+        {
+          const int value = static_cast<int>(rng() & 0x7FFFFFFFUL);
+
+          if (unique.insert(value).second)
+          {
+            values.push_back(value);
+          }
+        }
+      }
+
+      return values;
+    }
+
+    //*************************************************************************
+    template <typename TContainer>
+    void sequence_benchmarks(runner& r, const char* suite, const char* library, TContainer& container)
+    {
+      r.run(suite, "push_back", library, Size, [&container]()
+      {
+        container.clear();
+
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          container.push_back(static_cast<int>(i));
+        }
+
+        do_not_optimise(container.back());
+      });
+
+      r.run(suite, "iterate", library, Size, [&container]()
+      {
+        int sum = 0;
+
+        for (typename TContainer::const_iterator itr = container.begin(); itr != container.end(); ++itr)
+        {
+          sum += *itr;
+        }
+
+        do_not_optimise(sum);
+      });
+    }
+
+    //*************************************************************************
+    template <typename TContainer>
+    void fifo_benchmarks(runner& r, const char* suite, const char* library, TContainer& container)
+    {
+      r.run(suite, "push_back_pop_front", library, Size * 2U, [&container]()
+      {
+        container.clear();
+
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          container.push_back(static_cast<int>(i));
+        }
+
+        int sum = 0;
+
+        while (!container.empty())
+        {
+          sum += container.front();
+          container.pop_front();
+        }
+
+        do_not_optimise(sum);
+      });
+    }
+
+    //*************************************************************************
+    template <typename TMap>
+    void map_benchmarks(runner& r, const char* suite, const char* library, TMap& map)
+    {
+      r.run(suite, "insert", library, Size, [&map]()
+      {
+        map.clear();
+
+        const std::vector<int>& k = keys();
+
+        for (size_t i = 0U; i < k.size(); ++i)
+        {
+          map.insert(typename TMap::value_type(k[i], k[i]));
+        }
+
+        do_not_optimise(map.size());
+      });
+
+      r.run(suite, "find", library, Size, [&map]()
+      {
+        const std::vector<int>& k = keys();
+
+        int sum = 0;
+
+        for (size_t i = 0U; i < k.size(); ++i)
+        {
+          sum += map.find(k[i])->second;
+        }
+
+        do_not_optimise(sum);
+      });
+
+      r.run(suite, "iterate", library, Size, [&map]()
+      {
+        int sum = 0;
+
+        for (typename TMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+        {
+          sum += itr->second;
+        }
+
+        do_not_optimise(sum);
+      });
+    }
+
+    //*************************************************************************
+    template <typename TSet>
+    void set_benchmarks(runner& r, const char* suite, const char* library, TSet& set)
+    {
+      r.run(suite, "insert", library, Size, [&set]()
+      {
+        set.clear();
+
+        const std::vector<int>& k = keys();
+
+        for (size_t i = 0U; i < k.size(); ++i)
+        {
+          set.insert(k[i]);
+        }
+
+        do_not_optimise(set.size());
+      });
+
+      r.run(suite, "find", library, Size, [&set]()
+      {
+        const std::vector<int>& k = keys();
+
+        size_t found = 0U;
+
+        for (size_t i = 0U; i < k.size(); ++i)
+        {
+          found += (set.find(k[i]) != set.end()) ? 1U : 0U;
+        }
+
+        do_not_optimise(found);
+      });
+    }
+
+    //*************************************************************************
+    /// A slot allocator. Finds and claims the first free slot, then frees a
+    /// random slot, so the bitset stays almost full.
+    //*************************************************************************
+    template <typename TBitset>
+    void bitset_benchmarks(runner& r, const char* suite, const char* library, TBitset& slots)
+    {
+      r.run(suite, "find_first_free", library, Size, [&slots]()
+      {
+        slots.set();
+
+        const std::vector<int>& k = keys();
+
+        size_t sum = 0U;
+
+        for (size_t i = 0U; i < k.size(); ++i)
+        {
+          slots.reset(size_t(k[i]) % slots.size());
+
+          const size_t slot = slots.find_first(false);
+          slots.set(slot);
+          sum += slot;
+        }
+
+        do_not_optimise(sum);
+      });
+
+      r.run(suite, "for_each_set_bit", library, Size, [&slots]()
+      {
+        slots.reset();
+
+        const std::vector<int>& k = keys();
+
+        for (size_t i = 0U; i < k.size(); ++i)
+        {
+          slots.set(size_t(k[i]) % slots.size());
+        }
+
+        size_t sum = 0U;
+
+        slots.for_each_set_bit([&sum](size_t position) { sum += position; });
+
+        do_not_optimise(sum);
+      });
+    }
+  }
+
+  //***************************************************************************
+  void run_container_benchmarks(runner& r)
+  {
+    {
+      std::unique_ptr<etl::vector<int, Size> > etl_vector(new etl::vector<int, Size>);
+      std::vector<int> std_vector;
+      std_vector.reserve(Size);
+
+      sequence_benchmarks(r, "vector", "etl", *etl_vector);
+      sequence_benchmarks(r, "vector", "std", std_vector);
+    }
+
+    {
+      std::unique_ptr<etl::deque<int, Size> > etl_deque(new etl::deque<int, Size>);
+      std::deque<int> std_deque;
+
+      sequence_benchmarks(r, "deque", "etl", *etl_deque);
+      sequence_benchmarks(r, "deque", "std", std_deque);
+      fifo_benchmarks(r, "deque", "etl", *etl_deque);
+      fifo_benchmarks(r, "deque", "std", std_deque);
+    }
+
+    {
+      std::unique_ptr<etl::list<int, Size> > etl_list(new etl::list<int, Size>);
+      std::list<int> std_list;
+
+      sequence_benchmarks(r, "list", "etl", *etl_list);
+      sequence_benchmarks(r, "list", "std", std_list);
+      fifo_benchmarks(r, "list", "etl", *etl_list);
+      fifo_benchmarks(r, "list", "std", std_list);
+    }
+
+    {
+      std::unique_ptr<etl::map<int, int, Size> > etl_map(new etl::map<int, int, Size>);
+      std::map<int, int> std_map;
+
+      map_benchmarks(r, "map", "etl", *etl_map);
+      map_benchmarks(r, "map", "std", std_map);
+    }
+
+    {
+      std::unique_ptr<etl::set<int, Size> > etl_set(new etl::set<int, Size>);
+      std::set<int> std_set;
+
+      set_benchmarks(r, "set", "etl", *etl_set);
+      set_benchmarks(r, "set", "std", std_set);
+    }
+
+    {
+      // std::map is the nearest std:: equivalent before C++23.
+      std::unique_ptr<etl::flat_map<int, int, Size> > etl_flat_map(new etl::flat_map<int, int, Size>);
+      std::map<int, int> std_map;
+
+      map_benchmarks(r, "flat_map", "etl", *etl_flat_map);
+      map_benchmarks(r, "flat_map", "std", std_map);
+    }
+
+    {
+      std::unique_ptr<etl::inline_flat_map<int, int, Size> > etl_inline_flat_map(new etl::inline_flat_map<int, int, Size>);
+      std::map<int, int> std_map;
+
+      map_benchmarks(r, "inline_flat_map", "etl", *etl_inline_flat_map);
+      map_benchmarks(r, "inline_flat_map", "std", std_map);
+    }
+
+    {
+      std::unique_ptr<etl::inline_flat_set<int, Size> > etl_inline_flat_set(new etl::inline_flat_set<int, Size>);
+      std::set<int> std_set;
+
+      set_benchmarks(r, "inline_flat_set", "etl", *etl_inline_flat_set);
+      set_benchmarks(r, "inline_flat_set", "std", std_set);
+    }
+
+    {
+      std::unique_ptr<etl::unordered_map<int, int, Size> > etl_unordered_map(new etl::unordered_map<int, int, Size>);
+      std::unique_ptr<etl::unordered_map<int, int, Size, Size, etl::hash<int>, etl::equal_to<int>, etl::unordered_power_of_2_buckets> > etl_unordered_map_pow2(new etl::unordered_map<int, int, Size, Size, etl::hash<int>, etl::equal_to<int>, etl::unordered_power_of_2_buckets>);
+      std::unordered_map<int, int> std_unordered_map;
+      std_unordered_map.reserve(Size);
+
+      map_benchmarks(r, "unordered_map", "etl", *etl_unordered_map);
+      map_benchmarks(r, "unordered_map_p2", "etl", *etl_unordered_map_pow2);
+      map_benchmarks(r, "unordered_map", "std", std_unordered_map);
+    }
+
+    {
+      std::unique_ptr<etl::flat_hash_map<int, int, Size> > etl_flat_hash_map(new etl::flat_hash_map<int, int, Size>);
+      std::unordered_map<int, int> std_unordered_map;
+      std_unordered_map.reserve(Size);
+
+      map_benchmarks(r, "flat_hash_map", "etl", *etl_flat_hash_map);
+      map_benchmarks(r, "flat_hash_map", "std", std_unordered_map);
+    }
+
+    {
+      // 64k slots, with the default and 64 bit elements.
+      std::unique_ptr<etl::bitset<65536U> >           etl_bitset(new etl::bitset<65536U>);
+      std::unique_ptr<etl::bitset<65536U, uint64_t> > etl_bitset_64(new etl::bitset<65536U, uint64_t>);
+
+      bitset_benchmarks(r, "bitset", "etl", *etl_bitset);
+      bitset_benchmarks(r, "bitset_64", "etl", *etl_bitset_64);
+    }
+  }
+}
@@ -0,0 +1,171 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Message benchmarks.
+// 50 message types, sent to a router that handles all of them, and to a bus
+// of 20 routers that each handle 10 of them.
+// The operation is one message.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/message_bus.h"
+#include "etl/message_router.h"
+
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace etl_benchmark
+{
+  namespace
+  {
+    const size_t Size                = 4096U;
+    const size_t Number_Of_Messages  = 50U;
+    const size_t Number_Of_Routers   = 20U;
+    const size_t Messages_Per_Router = 10U;
+
+    uint32_t received = 0U;
+
+    //*************************************************************************
+    template <size_t Id>
+    struct Message : public etl::message<Id>
+    {
+    };
+
+    //*************************************************************************
+    template <typename TSequence>
+    struct all_messages;
+
+    template <size_t... Id>
+    struct all_messages<std::index_sequence<Id...>>
+    {
+      static const etl::imessage* get(size_t id)
+      {
+        static const etl::imessage* const values[] = { &instance<Id>... };
+
+        return values[id];
+      }
+
+      template <size_t I>
+      static const Message<I> instance;
+    };
+
+    template <size_t... Id>
+    template <size_t I>
+    const Message<I> all_messages<std::index_sequence<Id...>>::instance;
+
+    typedef all_messages<std::make_index_sequence<Number_Of_Messages>> messages;
+
+    //*************************************************************************
+    /// A router for messages I * Step + Offset.
+    //*************************************************************************
+    template <typename TSequence, size_t Step, size_t Offset>
+    class Router;
+
+    template <size_t... I, size_t Step, size_t Offset>
+    class Router<std::index_sequence<I...>, Step, Offset>
+      : public etl::message_router<Router<std::index_sequence<I...>, Step, Offset>, Message<((I * Step) + Offset) % Number_Of_Messages>...>
+    {
+    public:
+
+      template <size_t Id>
+      void on_receive(const Message<Id>&)
+      {
+        received += Id;
+      }
+
+      void on_receive_unknown(const etl::imessage&)
+      {
+        ++received;
+      }
+    };
+
+    typedef Router<std::make_index_sequence<Number_Of_Messages>, 1U, 0U> all_router;
+
+    template <size_t Offset>
+    using bus_router = Router<std::make_index_sequence<Messages_Per_Router>, 5U, Offset>;
+
+    //*************************************************************************
+    // Random messages.
+    const std::vector<const etl::imessage*>& events()
+    {
+      static std::vector<const etl::imessage*> values;
+
+      if (values.empty())
+      {
+        random rng;
+
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          values.push_back(messages::get(rng() % Number_Of_Messages));
+        }
+      }
+
+      return values;
+    }
+
+    //*************************************************************************
+    void message_benchmark(runner& r, const char* name, etl::imessage_router& router)
+    {
+      r.run("message", name, "etl", Size, [&router]()
+      {
+        const std::vector<const etl::imessage*>& e = events();
+
+        for (size_t i = 0U; i < e.size(); ++i)
+        {
+          router.receive(*e[i]);
+        }
+
+        do_not_optimise(received);
+      });
+    }
+
+    //*************************************************************************
+    template <size_t... Offset>
+    void bus_benchmark(runner& r, std::index_sequence<Offset...>)
+    {
+      static etl::message_bus<Number_Of_Routers> bus;
+      static std::tuple<bus_router<Offset>...>   routers;
+
+      (bus.subscribe(std::get<Offset>(routers)), ...);
+
+      message_benchmark(r, "bus_20_routers", bus);
+    }
+  }
+
+  //***************************************************************************
+  void run_message_benchmarks(runner& r)
+  {
+    static all_router router;
+    message_benchmark(r, "router_50_messages", router);
+
+    bus_benchmark(r, std::make_index_sequence<Number_Of_Routers>());
+  }
+}
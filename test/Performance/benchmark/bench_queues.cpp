@@ -0,0 +1,204 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Queue benchmarks.
+// 'burst' fills and then empties the queue on one thread.
+// 'transfer' passes values from a producer thread to a consumer thread, and
+// is only run when there is more than one hardware thread.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/queue.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/queue_mpmc_atomic.h"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace etl_benchmark
+{
+  namespace
+  {
+    const size_t Size           = 1024U;
+    const size_t Transfer_Items = 1000000U;
+
+    //*************************************************************************
+    /// std::deque guarded by a mutex, as the std:: equivalent of the
+    /// concurrent queues.
+    //*************************************************************************
+    class locked_std_queue
+    {
+    public:
+
+      bool push(int value)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (queue.size() == Size)
+        {
+          return false;
+        }
+
+        queue.push_back(value);
+
+        return true;
+      }
+
+      bool pop(int& value)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (queue.empty())
+        {
+          return false;
+        }
+
+        value = queue.front();
+        queue.pop_front();
+
+        return true;
+      }
+
+    private:
+
+      std::mutex      mutex;
+      std::deque<int> queue;
+    };
+
+    //*************************************************************************
+    template <typename TQueue>
+    void concurrent_queue_benchmarks(runner& r, const char* suite, const char* library, TQueue& queue)
+    {
+      r.run(suite, "burst", library, Size * 2U, [&queue]()
+      {
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          queue.push(static_cast<int>(i));
+        }
+
+        int sum = 0;
+        int value;
+
+        while (queue.pop(value))
+        {
+          sum += value;
+        }
+
+        do_not_optimise(sum);
+      });
+
+      if (std::thread::hardware_concurrency() > 1U)
+      {
+        r.run(suite, "transfer", library, Transfer_Items, [&queue]()
+        {
+          std::thread producer([&queue]()
+          {
+            for (size_t i = 0U; i < Transfer_Items; ++i)
+            {
+              while (!queue.push(static_cast<int>(i)))
+              {
+              }
+            }
+          });
+
+          int sum = 0;
+          int value;
+
+          for (size_t i = 0U; i < Transfer_Items; ++i)
+          {
+            while (!queue.pop(value))
+            {
+            }
+
+            sum += value;
+          }
+
+          producer.join();
+
+          do_not_optimise(sum);
+        });
+      }
+    }
+
+    //*************************************************************************
+    template <typename TQueue>
+    void queue_benchmarks(runner& r, const char* suite, const char* library, TQueue& queue)
+    {
+      r.run(suite, "burst", library, Size * 2U, [&queue]()
+      {
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          queue.push(static_cast<int>(i));
+        }
+
+        int sum = 0;
+
+        while (!queue.empty())
+        {
+          sum += queue.front();
+          queue.pop();
+        }
+
+        do_not_optimise(sum);
+      });
+    }
+  }
+
+  //***************************************************************************
+  void run_queue_benchmarks(runner& r)
+  {
+    {
+      std::unique_ptr<etl::queue<int, Size> > etl_queue(new etl::queue<int, Size>);
+      std::queue<int> std_queue;
+
+      queue_benchmarks(r, "queue", "etl", *etl_queue);
+      queue_benchmarks(r, "queue", "std", std_queue);
+    }
+
+    {
+      std::unique_ptr<etl::queue_spsc_atomic<int, Size> > etl_queue(new etl::queue_spsc_atomic<int, Size>);
+      locked_std_queue std_queue;
+
+      concurrent_queue_benchmarks(r, "queue_spsc", "etl", *etl_queue);
+      concurrent_queue_benchmarks(r, "queue_spsc", "std", std_queue);
+    }
+
+    {
+      std::unique_ptr<etl::queue_mpmc_atomic<int, Size> > etl_queue(new etl::queue_mpmc_atomic<int, Size>);
+      locked_std_queue std_queue;
+
+      concurrent_queue_benchmarks(r, "queue_mpmc", "etl", *etl_queue);
+      concurrent_queue_benchmarks(r, "queue_mpmc", "std", std_queue);
+    }
+  }
+}
@@ -0,0 +1,162 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Sort benchmarks.
+// Each sample sorts a copy of the same random data.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+#include "etl/radix_sort.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace etl_benchmark
+{
+  namespace
+  {
+    const size_t Size = 1024U;
+
+    //*************************************************************************
+    const std::vector<int>& data()
+    {
+      static std::vector<int> values;
+
+      if (values.empty())
+      {
+        random rng;
+
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          values.push_back(static_cast<int>(rng() % 1000U));
+        }
+      }
+
+      return values;
+    }
+  }
+
+  //***************************************************************************
+  void run_sort_benchmarks(runner& r)
+  {
+    std::vector<int> work(Size);
+
+    r.run("sort", "sort", "etl", Size, [&work]()
+    {
+      work = data();
+      etl::sort(work.begin(), work.end());
+      do_not_optimise(work[0]);
+    });
+
+    r.run("sort", "sort", "std", Size, [&work]()
+    {
+      work = data();
+      std::sort(work.begin(), work.end());
+      do_not_optimise(work[0]);
+    });
+
+    r.run("sort", "stable_sort", "etl", Size, [&work]()
+    {
+      work = data();
+      etl::stable_sort(work.begin(), work.end());
+      do_not_optimise(work[0]);
+    });
+
+    r.run("sort", "stable_sort", "std", Size, [&work]()
+    {
+      work = data();
+      std::stable_sort(work.begin(), work.end());
+      do_not_optimise(work[0]);
+    });
+
+    r.run("sort", "shell_sort", "etl", Size, [&work]()
+    {
+      work = data();
+      etl::shell_sort(work.begin(), work.end());
+      do_not_optimise(work[0]);
+    });
+
+    r.run("sort", "intro_sort", "etl", Size, [&work]()
+    {
+      work = data();
+      etl::intro_sort(work.begin(), work.end());
+      do_not_optimise(work[0]);
+    });
+
+    r.run("sort", "merge_sort", "etl", Size, [&work]()
+    {
+      work = data();
+      etl::merge_sort(work.begin(), work.end());
+      do_not_optimise(work[0]);
+    });
+
+    std::vector<int> buffer(Size / 2U);
+
+    r.run("sort", "merge_sort_buffer", "etl", Size, [&work, &buffer]()
+    {
+      work = data();
+      etl::merge_sort(work.begin(), work.end(), buffer.begin(), buffer.end());
+      do_not_optimise(work[0]);
+    });
+
+    std::vector<int> scratch(Size);
+
+    r.run("sort", "radix_sort", "etl", Size, [&work, &scratch]()
+    {
+      work = data();
+      etl::radix_sort(work.begin(), work.end(), scratch);
+      do_not_optimise(work[0]);
+    });
+
+    r.run("sort", "counting_sort", "etl", Size, [&work]()
+    {
+      work = data();
+      etl::counting_sort<1000>(work.begin(), work.end());
+      do_not_optimise(work[0]);
+    });
+
+    r.run("sort", "heap_sort", "etl", Size, [&work]()
+    {
+      work = data();
+      etl::make_heap(work.begin(), work.end());
+      etl::sort_heap(work.begin(), work.end());
+      do_not_optimise(work[0]);
+    });
+
+    r.run("sort", "heap_sort", "std", Size, [&work]()
+    {
+      work = data();
+      std::make_heap(work.begin(), work.end());
+      std::sort_heap(work.begin(), work.end());
+      do_not_optimise(work[0]);
+    });
+  }
+}
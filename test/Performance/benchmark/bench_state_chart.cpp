@@ -0,0 +1,171 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// State chart benchmarks.
+// A protocol state machine with 200 transitions, processing an event per byte.
+// The operation is one event.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/state_chart.h"
+
+#include <utility>
+#include <vector>
+
+namespace etl_benchmark
+{
+  namespace
+  {
+    const size_t Size                  = 4096U;
+    const size_t Number_Of_States      = 20U;
+    const size_t Events_Per_State      = 10U;
+    const size_t Number_Of_Transitions = Number_Of_States * Events_Per_State;
+
+    typedef etl::state_chart_traits::state_id_t state_id_t;
+    typedef etl::state_chart_traits::event_id_t event_id_t;
+
+    //*************************************************************************
+    struct Protocol
+    {
+      void on_byte()
+      {
+        ++count;
+      }
+
+      uint32_t count = 0U;
+    };
+
+    Protocol protocol;
+
+    typedef etl::state_chart_traits::transition<Protocol> transition;
+
+    //*************************************************************************
+    constexpr state_id_t state_of(size_t i)
+    {
+      return static_cast<state_id_t>(i / Events_Per_State);
+    }
+
+    constexpr event_id_t event_of(size_t i)
+    {
+      return static_cast<event_id_t>(((i % Events_Per_State) * 25U) + (i / Events_Per_State));
+    }
+
+    constexpr state_id_t next_state_of(size_t i)
+    {
+      return static_cast<state_id_t>((state_of(i) + 1U + (i % 3U)) % Number_Of_States);
+    }
+
+    //*************************************************************************
+    template <typename TSequence>
+    struct transitions;
+
+    template <size_t... I>
+    struct transitions<std::index_sequence<I...>>
+    {
+      static constexpr transition table[sizeof...(I)] = { transition(state_of(I), event_of(I), next_state_of(I), &Protocol::on_byte)... };
+    };
+
+    typedef transitions<std::make_index_sequence<Number_Of_Transitions>> protocol_transitions;
+
+    //*************************************************************************
+    // Bytes that mostly follow the protocol, with some that are not expected.
+    const std::vector<event_id_t>& events()
+    {
+      static std::vector<event_id_t> values;
+
+      if (values.empty())
+      {
+        random     rng;
+        state_id_t state = 0U;
+
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          const uint32_t choice = rng() % 12U;
+
+          const event_id_t event_id = (choice < Events_Per_State) ? event_of((state * Events_Per_State) + choice)
+                                                                  : static_cast<event_id_t>(rng());
+
+          for (size_t t = 0U; t < Number_Of_Transitions; ++t)
+          {
+            if ((state_of(t) == state) && (event_of(t) == event_id))
+            {
+              state = next_state_of(t);
+              break;
+            }
+          }
+
+          values.push_back(event_id);
+        }
+      }
+
+      return values;
+    }
+
+    //*************************************************************************
+    template <typename TStateChart>
+    void state_chart_benchmark(runner& r, const char* name, TStateChart& chart)
+    {
+      chart.start();
+
+      r.run("state_chart", name, "etl", Size, [&chart]()
+      {
+        const std::vector<event_id_t>& e = events();
+
+        for (size_t i = 0U; i < e.size(); ++i)
+        {
+          chart.process_event(e[i]);
+        }
+
+        do_not_optimise(protocol.count);
+      });
+    }
+  }
+
+  //***************************************************************************
+  void run_state_chart_benchmarks(runner& r)
+  {
+    const transition* const table_begin = protocol_transitions::table;
+    const transition* const table_end   = protocol_transitions::table + Number_Of_Transitions;
+
+    static etl::state_chart<Protocol> linear(protocol, table_begin, table_end, nullptr, nullptr, 0U);
+    state_chart_benchmark(r, "linear", linear);
+
+    static etl::state_chart_traits::transition_index_t transition_index[Number_Of_Transitions];
+    static etl::state_chart<Protocol> indexed(protocol, table_begin, table_end, nullptr, nullptr, 0U);
+    indexed.set_transition_index(transition_index, transition_index + Number_Of_Transitions);
+    state_chart_benchmark(r, "index", indexed);
+
+    static etl::state_chart_ct<Protocol, protocol, protocol_transitions::table, Number_Of_Transitions, nullptr, 0U, 0U> ct_linear;
+    state_chart_benchmark(r, "ct_linear", ct_linear);
+
+    static etl::state_chart_ct<Protocol, protocol, protocol_transitions::table, Number_Of_Transitions, nullptr, 0U, 0U, true> ct_indexed;
+    state_chart_benchmark(r, "ct_index", ct_indexed);
+  }
+}
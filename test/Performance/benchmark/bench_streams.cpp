@@ -0,0 +1,214 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Stream benchmarks.
+// The operation is one field.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/bit_stream.h"
+#include "etl/byte_stream.h"
+#include "etl/span.h"
+#include "etl/unaligned_type.h"
+
+#include <vector>
+
+namespace etl_benchmark
+{
+  namespace
+  {
+    const size_t  Size       = 4096U;
+    const uint8_t Field_Bits = 13U;
+
+    //*************************************************************************
+    const std::vector<uint16_t>& fields()
+    {
+      static std::vector<uint16_t> values;
+
+      if (values.empty())
+      {
+        random rng;
+
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          values.push_back(static_cast<uint16_t>(rng() & ((1U << Field_Bits) - 1U)));
+        }
+      }
+
+      return values;
+    }
+
+    //*************************************************************************
+    void bit_stream_benchmarks(runner& r, const char* suite, etl::endian endianness)
+    {
+      static std::vector<char> buffer((Size * Field_Bits) / CHAR_BIT + 1U);
+      static std::vector<uint16_t> result(Size);
+
+      r.run(suite, "write", "etl", Size, [endianness]()
+      {
+        const std::vector<uint16_t>& f = fields();
+        etl::bit_stream_writer writer(buffer.data(), buffer.size(), endianness);
+
+        for (size_t i = 0U; i < f.size(); ++i)
+        {
+          writer.write_unchecked(f[i], Field_Bits);
+        }
+
+        do_not_optimise(buffer[0]);
+      });
+
+      r.run(suite, "write_span", "etl", Size, [endianness]()
+      {
+        const std::vector<uint16_t>& f = fields();
+        etl::bit_stream_writer writer(buffer.data(), buffer.size(), endianness);
+
+        writer.write_unchecked(etl::span<const uint16_t>(f.data(), f.size()), Field_Bits);
+
+        do_not_optimise(buffer[0]);
+      });
+
+      r.run(suite, "read", "etl", Size, [endianness]()
+      {
+        etl::bit_stream_reader reader(buffer.data(), buffer.size(), endianness);
+
+        for (size_t i = 0U; i < result.size(); ++i)
+        {
+          result[i] = reader.read_unchecked<uint16_t>(Field_Bits);
+        }
+
+        do_not_optimise(result[0]);
+      });
+
+      r.run(suite, "read_span", "etl", Size, [endianness]()
+      {
+        etl::bit_stream_reader reader(buffer.data(), buffer.size(), endianness);
+
+        reader.read_unchecked(etl::span<uint16_t>(result.data(), result.size()), Field_Bits);
+
+        do_not_optimise(result[0]);
+      });
+    }
+
+    //*************************************************************************
+    const std::vector<int32_t>& samples()
+    {
+      static std::vector<int32_t> values;
+
+      if (values.empty())
+      {
+        random rng;
+
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          values.push_back(static_cast<int32_t>(rng()));
+        }
+      }
+
+      return values;
+    }
+
+    //*************************************************************************
+    template <typename TView>
+    void byte_stream_benchmarks(runner& r, const char* suite, etl::endian endianness)
+    {
+      static std::vector<char> buffer(Size * sizeof(int32_t));
+      static std::vector<int32_t> result(Size);
+
+      r.run(suite, "write", "etl", Size, [endianness]()
+      {
+        const std::vector<int32_t>& s = samples();
+        etl::byte_stream_writer writer(buffer.data(), buffer.size(), endianness);
+
+        for (size_t i = 0U; i < s.size(); ++i)
+        {
+          writer.write_unchecked(s[i]);
+        }
+
+        do_not_optimise(buffer[0]);
+      });
+
+      r.run(suite, "write_span", "etl", Size, [endianness]()
+      {
+        const std::vector<int32_t>& s = samples();
+        etl::byte_stream_writer writer(buffer.data(), buffer.size(), endianness);
+
+        writer.write_unchecked(etl::span<const int32_t>(s.data(), s.size()));
+
+        do_not_optimise(buffer[0]);
+      });
+
+      r.run(suite, "read", "etl", Size, [endianness]()
+      {
+        etl::byte_stream_reader reader(buffer.data(), buffer.size(), endianness);
+
+        for (size_t i = 0U; i < result.size(); ++i)
+        {
+          result[i] = reader.read_unchecked<int32_t>();
+        }
+
+        do_not_optimise(result[0]);
+      });
+
+      r.run(suite, "read_span", "etl", Size, [endianness]()
+      {
+        etl::byte_stream_reader reader(buffer.data(), buffer.size(), endianness);
+
+        reader.read_unchecked(etl::span<int32_t>(result.data(), result.size()));
+
+        do_not_optimise(result[0]);
+      });
+
+      r.run(suite, "read_view_sum", "etl", Size, [endianness]()
+      {
+        etl::byte_stream_reader reader(buffer.data(), buffer.size(), endianness);
+
+        etl::span<const TView> view = reader.read_view_unchecked<TView>(Size);
+
+        int32_t sum = 0;
+
+        for (size_t i = 0U; i < view.size(); ++i)
+        {
+          sum += view[i];
+        }
+
+        do_not_optimise(sum);
+      });
+    }
+  }
+
+  //***************************************************************************
+  void run_stream_benchmarks(runner& r)
+  {
+    bit_stream_benchmarks(r, "bit_stream_be", etl::endian::big);
+    bit_stream_benchmarks(r, "bit_stream_le", etl::endian::little);
+    byte_stream_benchmarks<etl::be_int32_t>(r, "byte_stream_be", etl::endian::big);
+    byte_stream_benchmarks<etl::le_int32_t>(r, "byte_stream_le", etl::endian::little);
+  }
+}
@@ -0,0 +1,456 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// String benchmarks.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/string.h"
+#include "etl/to_string.h"
+#include "etl/to_arithmetic.h"
+#include "etl/format_spec.h"
+#include "etl/string_utilities.h"
+#include "etl/tokenizer.h"
+#include "etl/transcode.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace etl_benchmark
+{
+  namespace
+  {
+    const size_t Size        = 1024U;
+    const size_t Repetitions = 256U;
+
+    const char* const Short_Text = "The quick brown fox jumps over the lazy dog";
+
+    //*************************************************************************
+    template <typename TString>
+    void string_benchmarks(runner& r, const char* library, TString& text, TString& other)
+    {
+      r.run("string", "push_back", library, Size, [&text]()
+      {
+        text.clear();
+
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          text.push_back(static_cast<char>('a' + (i % 26U)));
+        }
+
+        do_not_optimise(text[0]);
+      });
+
+      r.run("string", "assign", library, Repetitions, [&other]()
+      {
+        for (size_t i = 0U; i < Repetitions; ++i)
+        {
+          other.assign(Short_Text);
+          do_not_optimise(other[0]);
+        }
+      });
+
+      r.run("string", "append", library, Size / 8U, [&other]()
+      {
+        other.clear();
+
+        for (size_t i = 0U; i < (Size / 8U); ++i)
+        {
+          other.append("01234567");
+        }
+
+        do_not_optimise(other[0]);
+      });
+
+      // Make the text searchable, with the pattern only at the end.
+      text.assign(Size - 6U, 'a');
+      text.append("needle");
+
+      r.run("string", "find", library, Size, [&text]()
+      {
+        do_not_optimise(text.find("needle"));
+      });
+
+      r.run("string", "find_char", library, Size, [&text]()
+      {
+        do_not_optimise(text.find('n'));
+      });
+
+      r.run("string", "find_first_of", library, Size, [&text]()
+      {
+        do_not_optimise(text.find_first_of("xyzn"));
+      });
+
+      r.run("string", "rfind", library, Size, [&text]()
+      {
+        do_not_optimise(text.rfind("aaaaab"));
+      });
+
+      other.assign(text.begin(), text.end());
+
+      r.run("string", "compare", library, Size, [&text, &other]()
+      {
+        do_not_optimise(text.compare(other));
+      });
+    }
+
+    //*************************************************************************
+    template <typename T>
+    const std::vector<T>& integers()
+    {
+      static std::vector<T> values;
+
+      if (values.empty())
+      {
+        random rng;
+
+        for (size_t i = 0U; i < Size; ++i)
+        {
+          // A spread of digit counts.
+          values.push_back(static_cast<T>((uint64_t(rng()) << 32U | rng()) >> (rng() % 64U)));
+        }
+      }
+
+      return values;
+    }
+
+    //*************************************************************************
+    void to_string_benchmarks(runner& r)
+    {
+      static etl::string<32> text;
+
+      r.run("to_string", "uint32_t", "etl", Size, []()
+      {
+        const std::vector<uint32_t>& values = integers<uint32_t>();
+
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          etl::to_string(values[i], text);
+          do_not_optimise(text[0]);
+        }
+      });
+
+      r.run("to_string", "int64_t", "etl", Size, []()
+      {
+        const std::vector<int64_t>& values = integers<int64_t>();
+
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          etl::to_string(values[i], text);
+          do_not_optimise(text[0]);
+        }
+      });
+
+      r.run("to_string", "hex_width", "etl", Size, []()
+      {
+        const std::vector<uint32_t>& values = integers<uint32_t>();
+        const etl::format_spec format = etl::format_spec().hex().width(8).fill('0');
+
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          etl::to_string(values[i], text, format);
+          do_not_optimise(text[0]);
+        }
+      });
+
+      r.run("to_string", "double_fixed_6", "etl", Size, []()
+      {
+        const std::vector<int64_t>& values = integers<int64_t>();
+        const etl::format_spec format = etl::format_spec().precision(6);
+
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          etl::to_string(double(values[i] % 1000000) / 1024.0, text, format);
+          do_not_optimise(text[0]);
+        }
+      });
+
+      r.run("to_string", "double_shortest", "etl", Size, []()
+      {
+        const std::vector<int64_t>& values = integers<int64_t>();
+        const etl::format_spec format = etl::format_spec().shortest();
+
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          etl::to_string(double(values[i]) / 1e6, text, format);
+          do_not_optimise(text[0]);
+        }
+      });
+
+      r.run("to_string", "uint32_t", "std", Size, []()
+      {
+        const std::vector<uint32_t>& values = integers<uint32_t>();
+
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          std::string s = std::to_string(values[i]);
+          do_not_optimise(s[0]);
+        }
+      });
+
+      r.run("to_string", "int64_t", "std", Size, []()
+      {
+        const std::vector<int64_t>& values = integers<int64_t>();
+
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          std::string s = std::to_string(values[i]);
+          do_not_optimise(s[0]);
+        }
+      });
+    }
+  }
+
+  namespace
+  {
+    //*************************************************************************
+    const std::vector<std::string>& integer_texts()
+    {
+      static std::vector<std::string> texts;
+
+      if (texts.empty())
+      {
+        const std::vector<int64_t>& values = integers<int64_t>();
+
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          texts.push_back(std::to_string(values[i]));
+        }
+      }
+
+      return texts;
+    }
+
+    //*************************************************************************
+    // Fixed point fields, as found in CSV and NMEA sentences.
+    const std::vector<std::string>& floating_point_texts()
+    {
+      static std::vector<std::string> texts;
+
+      if (texts.empty())
+      {
+        const std::vector<int64_t>& values = integers<int64_t>();
+
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          char buffer[32];
+          snprintf(buffer, sizeof(buffer), "%.6f", double(values[i] % 100000000) / 1e4);
+          texts.push_back(buffer);
+        }
+      }
+
+      return texts;
+    }
+
+    //*************************************************************************
+    void to_arithmetic_benchmarks(runner& r)
+    {
+      r.run("to_arithmetic", "int64_t", "etl", Size, []()
+      {
+        const std::vector<std::string>& texts = integer_texts();
+
+        for (size_t i = 0U; i < texts.size(); ++i)
+        {
+          do_not_optimise(etl::to_arithmetic<int64_t>(texts[i].data(), texts[i].size()).value());
+        }
+      });
+
+      r.run("to_arithmetic", "double", "etl", Size, []()
+      {
+        const std::vector<std::string>& texts = floating_point_texts();
+
+        for (size_t i = 0U; i < texts.size(); ++i)
+        {
+          do_not_optimise(etl::to_arithmetic<double>(texts[i].data(), texts[i].size()).value());
+        }
+      });
+
+      r.run("to_arithmetic", "int64_t", "std", Size, []()
+      {
+        const std::vector<std::string>& texts = integer_texts();
+
+        for (size_t i = 0U; i < texts.size(); ++i)
+        {
+          do_not_optimise(strtoll(texts[i].c_str(), ETL_NULLPTR, 10));
+        }
+      });
+
+      r.run("to_arithmetic", "double", "std", Size, []()
+      {
+        const std::vector<std::string>& texts = floating_point_texts();
+
+        for (size_t i = 0U; i < texts.size(); ++i)
+        {
+          do_not_optimise(strtod(texts[i].c_str(), ETL_NULLPTR));
+        }
+      });
+    }
+  }
+
+  namespace
+  {
+    //*************************************************************************
+    // One line of comma separated fields.
+    const std::string& csv_text()
+    {
+      static std::string text;
+
+      if (text.empty())
+      {
+        const std::vector<std::string>& texts = floating_point_texts();
+
+        for (size_t i = 0U; i < texts.size(); ++i)
+        {
+          text += texts[i];
+          text += ',';
+        }
+
+        text.erase(text.size() - 1U);
+      }
+
+      return text;
+    }
+
+    //*************************************************************************
+    void tokenizer_benchmarks(runner& r)
+    {
+      r.run("tokenizer", "csv", "etl", Size, []()
+      {
+        const std::string& text = csv_text();
+
+        etl::tokenizer tokens(etl::string_view(text.data(), text.size()), etl::string_view(","));
+
+        for (etl::tokenizer::iterator itr = tokens.begin(); itr != tokens.end(); ++itr)
+        {
+          do_not_optimise(itr->size());
+        }
+      });
+
+      r.run("tokenizer", "csv_quoted", "etl", Size, []()
+      {
+        const std::string& text = csv_text();
+
+        etl::tokenizer tokens(etl::string_view(text.data(), text.size()), etl::string_view(","), '"');
+
+        for (etl::tokenizer::iterator itr = tokens.begin(); itr != tokens.end(); ++itr)
+        {
+          do_not_optimise(itr->size());
+        }
+      });
+
+      r.run("tokenizer", "csv_get_token", "etl", Size, []()
+      {
+        const std::string& text = csv_text();
+
+        etl::string_view input(text.data(), text.size());
+        etl::optional<etl::string_view> token;
+
+        while ((token = etl::get_token(input, ",", token, false)))
+        {
+          do_not_optimise(token.value().size());
+        }
+      });
+    }
+  }
+
+  namespace
+  {
+    //*************************************************************************
+    // UTF-8 text, either all ASCII or with a multi-byte character every few words.
+    const std::string& utf8_text(bool ascii)
+    {
+      static std::string ascii_text;
+      static std::string mixed_text;
+
+      std::string& text = ascii ? ascii_text : mixed_text;
+
+      while (text.size() < Size)
+      {
+        text += Short_Text;
+        text += ascii ? " " : " \xC3\xA9\xE2\x82\xAC ";
+      }
+
+      return text;
+    }
+
+    //*************************************************************************
+    void transcode_benchmarks(runner& r)
+    {
+      static char     utf8[Size * 2U];
+      static char16_t utf16[Size];
+
+      r.run("transcode", "utf8_to_utf16_ascii", "etl", Size, []()
+      {
+        const std::string& text = utf8_text(true);
+
+        do_not_optimise(etl::transcode(text.data(), Size, utf16, Size).written);
+      });
+
+      r.run("transcode", "utf8_to_utf16_mixed", "etl", Size, []()
+      {
+        const std::string& text = utf8_text(false);
+
+        do_not_optimise(etl::transcode(text.data(), Size, utf16, Size).written);
+      });
+
+      static char16_t utf16_ascii[Size];
+
+      etl::transcode(utf8_text(true).data(), Size, utf16_ascii, Size);
+
+      r.run("transcode", "utf16_to_utf8_ascii", "etl", Size, []()
+      {
+        do_not_optimise(etl::transcode(utf16_ascii, Size, utf8, Size * 2U).written);
+      });
+    }
+  }
+
+  //***************************************************************************
+  void run_string_benchmarks(runner& r)
+  {
+    std::unique_ptr<etl::string<Size> > etl_text(new etl::string<Size>);
+    std::unique_ptr<etl::string<Size> > etl_other(new etl::string<Size>);
+    std::string std_text;
+    std::string std_other;
+
+    std_text.reserve(Size);
+    std_other.reserve(Size);
+
+    string_benchmarks(r, "etl", *etl_text, *etl_other);
+    string_benchmarks(r, "std", std_text, std_other);
+
+    to_string_benchmarks(r);
+    to_arithmetic_benchmarks(r);
+    tokenizer_benchmarks(r);
+    transcode_benchmarks(r);
+  }
+}
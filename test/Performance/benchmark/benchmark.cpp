@@ -0,0 +1,366 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Benchmarks of ETL containers and algorithms against their std:: equivalents.
+//
+// Usage: etl_benchmark [--format=table|csv|json] [--output=<file>]
+//                      [--samples=<n>] [--filter=<text>] [--warm-only] [--cold-only]
+//
+// --filter runs only the benchmarks whose "suite/name" contains the text.
+// The JSON and CSV output are intended to be stored and compared between
+// ETL releases.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/version.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+namespace etl_benchmark
+{
+  namespace
+  {
+    FILE* output = stdout;
+
+    //*************************************************************************
+    double median(std::vector<double> values)
+    {
+      std::sort(values.begin(), values.end());
+
+      const size_t middle = values.size() / 2U;
+
+      return ((values.size() % 2U) == 0U) ? (values[middle - 1U] + values[middle]) / 2.0
+                                          : values[middle];
+    }
+
+    //*************************************************************************
+    /// Writes a string with JSON escapes.
+    //*************************************************************************
+    void write_json_string(const std::string& text)
+    {
+      std::fputc('"', output);
+
+      for (size_t i = 0U; i < text.size(); ++i)
+      {
+        const char c = text[i];
+
+        if ((c == '"') || (c == '\\'))
+        {
+          std::fputc('\\', output);
+          std::fputc(c, output);
+        }
+        else if (static_cast<unsigned char>(c) < 0x20U)
+        {
+          std::fprintf(output, "\\u%04X", static_cast<unsigned>(c));
+        }
+        else
+        {
+          std::fputc(c, output);
+        }
+      }
+
+      std::fputc('"', output);
+    }
+
+    //*************************************************************************
+    const char* compiler()
+    {
+#if defined(__clang__)
+      return "clang " __clang_version__;
+#elif defined(__GNUC__)
+      return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+      return "msvc";
+#else
+      return "unknown";
+#endif
+    }
+  }
+
+  //***************************************************************************
+  const char* to_string(cache_state state)
+  {
+    return (state == cache_state::Warm) ? "warm" : "cold";
+  }
+
+  //***************************************************************************
+  runner::runner(const options& options_)
+    : config(options_)
+  {
+  }
+
+  //***************************************************************************
+  void runner::run(const char* suite, const char* name, const char* library, size_t operations, const std::function<void()>& function)
+  {
+    if (!config.filter.empty())
+    {
+      const std::string full_name = std::string(suite) + "/" + name;
+
+      if (full_name.find(config.filter) == std::string::npos)
+      {
+        return;
+      }
+    }
+
+    if (config.warm)
+    {
+      results_.push_back(measure(suite, name, library, operations, function, cache_state::Warm));
+    }
+
+    if (config.cold)
+    {
+      results_.push_back(measure(suite, name, library, operations, function, cache_state::Cold));
+    }
+
+    std::fprintf(stderr, ".");
+    std::fflush(stderr);
+  }
+
+  //***************************************************************************
+  result runner::measure(const char* suite, const char* name, const char* library, size_t operations, const std::function<void()>& function, cache_state cache)
+  {
+    typedef std::chrono::steady_clock clock;
+
+    std::vector<double> times;
+    times.reserve(config.samples);
+
+    // Untimed run, to fault in memory and warm the caches.
+    function();
+
+    for (size_t i = 0U; i < config.samples; ++i)
+    {
+      if (cache == cache_state::Cold)
+      {
+        flush_caches();
+      }
+
+      const clock::time_point start = clock::now();
+      function();
+      const clock::time_point stop  = clock::now();
+
+      const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+
+      times.push_back(ns / static_cast<double>(operations));
+    }
+
+    result r;
+
+    r.suite                   = suite;
+    r.name                    = name;
+    r.library                 = library;
+    r.cache                   = cache;
+    r.operations              = operations;
+    r.samples                 = config.samples;
+    r.median_ns_per_operation = median(times);
+    r.min_ns_per_operation    = *std::min_element(times.begin(), times.end());
+
+    return r;
+  }
+
+  //***************************************************************************
+  void flush_caches()
+  {
+    static const size_t Buffer_Size = 64U * 1024U * 1024U;
+    static std::vector<uint8_t> buffer(Buffer_Size);
+
+    for (size_t i = 0U; i < buffer.size(); i += 64U)
+    {
+      buffer[i] = static_cast<uint8_t>(buffer[i] + 1U);
+    }
+
+    do_not_optimise(buffer[0]);
+  }
+
+  //***************************************************************************
+  void write_table(const std::vector<result>& results)
+  {
+    std::fprintf(output, "%-16s %-28s %-4s %-5s %12s %14s %14s\n", "suite", "name", "lib", "cache", "operations", "median ns/op", "min ns/op");
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const result& r = results[i];
+
+      std::fprintf(output, "%-16s %-28s %-4s %-5s %12zu %14.3f %14.3f\n",
+                   r.suite.c_str(), r.name.c_str(), r.library.c_str(), to_string(r.cache),
+                   r.operations, r.median_ns_per_operation, r.min_ns_per_operation);
+    }
+  }
+
+  //***************************************************************************
+  void write_csv(const std::vector<result>& results)
+  {
+    std::fprintf(output, "suite,name,library,cache,operations,samples,median_ns_per_operation,min_ns_per_operation\n");
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const result& r = results[i];
+
+      std::fprintf(output, "%s,%s,%s,%s,%zu,%zu,%.3f,%.3f\n",
+                   r.suite.c_str(), r.name.c_str(), r.library.c_str(), to_string(r.cache),
+                   r.operations, r.samples, r.median_ns_per_operation, r.min_ns_per_operation);
+    }
+  }
+
+  //***************************************************************************
+  void write_json(const std::vector<result>& results)
+  {
+    char date[32];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    std::fprintf(output, "{\n  \"context\": {\n");
+    std::fprintf(output, "    \"date\": \"%s\",\n", date);
+    std::fprintf(output, "    \"etl_version\": \"%s\",\n", ETL_VERSION);
+    std::fprintf(output, "    \"compiler\": ");
+    write_json_string(compiler());
+    std::fprintf(output, ",\n    \"cplusplus\": %ld\n  },\n", static_cast<long>(__cplusplus));
+    std::fprintf(output, "  \"benchmarks\": [\n");
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const result& r = results[i];
+
+      std::fprintf(output, "    { \"suite\": ");
+      write_json_string(r.suite);
+      std::fprintf(output, ", \"name\": ");
+      write_json_string(r.name);
+      std::fprintf(output, ", \"library\": ");
+      write_json_string(r.library);
+      std::fprintf(output, ", \"cache\": \"%s\", \"operations\": %zu, \"samples\": %zu, \"median_ns_per_operation\": %.3f, \"min_ns_per_operation\": %.3f }%s\n",
+                   to_string(r.cache), r.operations, r.samples, r.median_ns_per_operation, r.min_ns_per_operation,
+                   (i + 1U < results.size()) ? "," : "");
+    }
+
+    std::fprintf(output, "  ]\n}\n");
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  using namespace etl_benchmark;
+
+  options     opts;
+  std::string format = "table";
+  const char* output_file = nullptr;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const char* arg = argv[i];
+
+    if (std::strncmp(arg, "--format=", 9) == 0)
+    {
+      format = arg + 9;
+    }
+    else if (std::strncmp(arg, "--output=", 9) == 0)
+    {
+      output_file = arg + 9;
+    }
+    else if (std::strncmp(arg, "--samples=", 10) == 0)
+    {
+      opts.samples = static_cast<size_t>(std::strtoul(arg + 10, nullptr, 10));
+    }
+    else if (std::strncmp(arg, "--filter=", 9) == 0)
+    {
+      opts.filter = arg + 9;
+    }
+    else if (std::strcmp(arg, "--warm-only") == 0)
+    {
+      opts.cold = false;
+    }
+    else if (std::strcmp(arg, "--cold-only") == 0)
+    {
+      opts.warm = false;
+    }
+    else
+    {
+      std::fprintf(stderr, "Usage: %s [--format=table|csv|json] [--output=<file>] [--samples=<n>] [--filter=<text>] [--warm-only] [--cold-only]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if ((format != "table") && (format != "csv") && (format != "json"))
+  {
+    std::fprintf(stderr, "Unknown format '%s'\n", format.c_str());
+    return EXIT_FAILURE;
+  }
+
+  if (opts.samples == 0U)
+  {
+    opts.samples = 1U;
+  }
+
+  runner r(opts);
+
+  run_container_benchmarks(r);
+  run_queue_benchmarks(r);
+  run_string_benchmarks(r);
+  run_check_benchmarks(r);
+  run_sort_benchmarks(r);
+  run_stream_benchmarks(r);
+  run_state_chart_benchmarks(r);
+  run_message_benchmarks(r);
+
+  std::fprintf(stderr, "\n");
+
+  if (output_file != nullptr)
+  {
+    output = std::fopen(output_file, "w");
+
+    if (output == nullptr)
+    {
+      std::fprintf(stderr, "Unable to open '%s'\n", output_file);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (format == "csv")
+  {
+    write_csv(r.results());
+  }
+  else if (format == "json")
+  {
+    write_json(r.results());
+  }
+  else
+  {
+    write_table(r.results());
+  }
+
+  if (output != stdout)
+  {
+    std::fclose(output);
+  }
+
+  return EXIT_SUCCESS;
+}
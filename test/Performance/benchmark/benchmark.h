@@ -0,0 +1,194 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BENCHMARK_INCLUDED
+#define ETL_BENCHMARK_INCLUDED
+
+//*****************************************************************************
+// A minimal benchmark harness.
+// Each benchmark is a function that performs a number of operations.
+// It is timed over a number of samples, with the caches either warm (the
+// function has just been run) or cold (the caches are flushed before each
+// sample). The median and minimum times per operation are reported.
+//*****************************************************************************
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace etl_benchmark
+{
+  //***************************************************************************
+  /// Prevents the compiler from optimising away a value.
+  //***************************************************************************
+  template <typename T>
+  inline void do_not_optimise(const T& value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* volatile sink;
+    sink = &value;
+#endif
+  }
+
+  //***************************************************************************
+  /// Cache states.
+  //***************************************************************************
+  enum class cache_state
+  {
+    Warm,
+    Cold
+  };
+
+  const char* to_string(cache_state state);
+
+  //***************************************************************************
+  /// The result of one benchmark in one cache state.
+  //***************************************************************************
+  struct result
+  {
+    std::string suite;
+    std::string name;
+    std::string library;
+    cache_state cache;
+    size_t      operations;
+    size_t      samples;
+    double      median_ns_per_operation;
+    double      min_ns_per_operation;
+  };
+
+  //***************************************************************************
+  /// Options that control the run.
+  //***************************************************************************
+  struct options
+  {
+    options()
+      : samples(15U)
+      , cold(true)
+      , warm(true)
+    {
+    }
+
+    size_t      samples;
+    bool        cold;
+    bool        warm;
+    std::string filter;
+  };
+
+  //***************************************************************************
+  /// Runs benchmarks and collects the results.
+  //***************************************************************************
+  class runner
+  {
+  public:
+
+    explicit runner(const options& options_);
+
+    //*************************************************************************
+    /// Runs a benchmark.
+    ///\param suite      The suite, such as "vector".
+    ///\param name       The operation, such as "push_back".
+    ///\param library    "etl" or "std".
+    ///\param operations The number of operations performed by each call of 'function'.
+    ///\param function   The benchmark.
+    //*************************************************************************
+    void run(const char* suite, const char* name, const char* library, size_t operations, const std::function<void()>& function);
+
+    const std::vector<result>& results() const
+    {
+      return results_;
+    }
+
+  private:
+
+    result measure(const char* suite, const char* name, const char* library, size_t operations, const std::function<void()>& function, cache_state cache);
+
+    options             config;
+    std::vector<result> results_;
+  };
+
+  //***************************************************************************
+  /// Flushes the data caches by streaming through a buffer larger than the
+  /// last level cache.
+  //***************************************************************************
+  void flush_caches();
+
+  //***************************************************************************
+  /// Writes the results.
+  //***************************************************************************
+  void write_table(const std::vector<result>& results);
+  void write_csv(const std::vector<result>& results);
+  void write_json(const std::vector<result>& results);
+
+  //***************************************************************************
+  /// The benchmark groups.
+  //***************************************************************************
+  void run_container_benchmarks(runner& r);
+  void run_queue_benchmarks(runner& r);
+  void run_string_benchmarks(runner& r);
+  void run_check_benchmarks(runner& r);
+  void run_sort_benchmarks(runner& r);
+  void run_stream_benchmarks(runner& r);
+  void run_state_chart_benchmarks(runner& r);
+  void run_message_benchmarks(runner& r);
+
+  //***************************************************************************
+  /// Repeatable pseudo random numbers.
+  //***************************************************************************
+  class random
+  {
+  public:
+
+    explicit random(uint32_t seed = 0x12345678UL)
+      : state(seed)
+    {
+    }
+
+    uint32_t operator()()
+    {
+      // xorshift32
+      state ^= state << 13U;
+      state ^= state >> 17U;
+      state ^= state << 5U;
+
+      return state;
+    }
+
+  private:
+
+    uint32_t state;
+  };
+}
+
+#endif
@@ -0,0 +1,206 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Throughput and latency comparison of the queue_spsc_atomic index layouts.
+// Linux only. The producer and consumer are pinned to separate cores.
+//
+// Usage: queue_spsc_atomic_benchmark [producer_cpu] [consumer_cpu]
+//*****************************************************************************
+
+#include "etl/queue_spsc_atomic.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+namespace
+{
+  const size_t Queue_Size  = 1024U;
+  const size_t Throughput_Items = 50000000U;
+  const size_t Latency_Items    = 1000000U;
+
+  int producer_cpu = 0;
+  int consumer_cpu = 1;
+
+  typedef etl::queue_spsc_atomic<uint64_t, Queue_Size, etl::memory_model::MEMORY_MODEL_LARGE, etl::queue_spsc_atomic_layout::COMPACT>       CompactQueue;
+  typedef etl::queue_spsc_atomic<uint64_t, Queue_Size, etl::memory_model::MEMORY_MODEL_LARGE, etl::queue_spsc_atomic_layout::CACHE_ALIGNED> CacheAlignedQueue;
+
+  //***************************************************************************
+  void pin_to_cpu(int cpu)
+  {
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) != 0)
+    {
+      std::fprintf(stderr, "Warning: Unable to pin thread to cpu %d\n", cpu);
+    }
+  }
+
+  //***************************************************************************
+  /// Items per second from one producer to one consumer.
+  //***************************************************************************
+  template <typename TQueue>
+  double throughput()
+  {
+    static TQueue queue;
+
+    std::thread producer([]()
+    {
+      pin_to_cpu(producer_cpu);
+
+      for (uint64_t i = 0U; i < Throughput_Items; ++i)
+      {
+        while (!queue.push(i))
+        {
+        }
+      }
+    });
+
+    pin_to_cpu(consumer_cpu);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    uint64_t value;
+    uint64_t check = 0U;
+
+    for (uint64_t i = 0U; i < Throughput_Items; ++i)
+    {
+      while (!queue.pop(value))
+      {
+      }
+
+      check += (value != i) ? 1U : 0U;
+    }
+
+    std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    producer.join();
+
+    if (check != 0U)
+    {
+      std::fprintf(stderr, "Error: Items received out of order\n");
+      std::exit(EXIT_FAILURE);
+    }
+
+    std::chrono::duration<double> elapsed = finish - start;
+
+    return double(Throughput_Items) / elapsed.count();
+  }
+
+  //***************************************************************************
+  /// Average round trip time in nanoseconds, using a pair of queues.
+  //***************************************************************************
+  template <typename TQueue>
+  double latency()
+  {
+    static TQueue ping;
+    static TQueue pong;
+
+    std::thread echo([]()
+    {
+      pin_to_cpu(producer_cpu);
+
+      uint64_t value;
+
+      for (size_t i = 0U; i < Latency_Items; ++i)
+      {
+        while (!ping.pop(value))
+        {
+        }
+
+        while (!pong.push(value))
+        {
+        }
+      }
+    });
+
+    pin_to_cpu(consumer_cpu);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    uint64_t value;
+
+    for (uint64_t i = 0U; i < Latency_Items; ++i)
+    {
+      while (!ping.push(i))
+      {
+      }
+
+      while (!pong.pop(value))
+      {
+      }
+    }
+
+    std::chrono::steady_clock::time_point finish = std::chrono::steady_clock::now();
+
+    echo.join();
+
+    std::chrono::duration<double, std::nano> elapsed = finish - start;
+
+    return elapsed.count() / double(Latency_Items);
+  }
+
+  //***************************************************************************
+  template <typename TQueue>
+  void run(const char* name)
+  {
+    double items_per_second = throughput<TQueue>();
+    double round_trip_ns    = latency<TQueue>();
+
+    std::printf("%-14s %10zu %16.0f %16.1f\n", name, sizeof(TQueue), items_per_second, round_trip_ns);
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  if (argc > 1)
+  {
+    producer_cpu = std::atoi(argv[1]);
+  }
+
+  if (argc > 2)
+  {
+    consumer_cpu = std::atoi(argv[2]);
+  }
+
+  std::printf("Producer cpu %d, consumer cpu %d\n", producer_cpu, consumer_cpu);
+  std::printf("%-14s %10s %16s %16s\n", "Layout", "Bytes", "Items/s", "Round trip ns");
+
+  run<CompactQueue>("COMPACT");
+  run<CacheAlignedQueue>("CACHE_ALIGNED");
+
+  return EXIT_SUCCESS;
+}
@@ -131,6 +131,77 @@ namespace
     return os;
   }
 
+#if ETL_USING_CPP20 || (ETL_USING_CPP17 && !ETL_USING_STD_NAMESPACE)
+  //***********************************
+  // Sorts an array at compile time.
+  template <typename TSort>
+  constexpr std::array<int, 40> sort_at_compile_time(TSort sort_function)
+  {
+    std::array<int, 40> data{};
+
+    for (size_t i = 0UL; i < data.size(); ++i)
+    {
+      data[i] = int((i * 37UL) % 41UL);
+    }
+
+    sort_function(data.begin(), data.end());
+
+    return data;
+  }
+#endif
+
+  //***********************************
+  // Test data patterns that are known to be difficult for quicksort.
+  std::vector<std::vector<int>> make_sort_patterns()
+  {
+    std::vector<std::vector<int>> patterns;
+
+    for (size_t length : { 0U, 1U, 2U, 3U, 15U, 16U, 17U, 33U, 100U, 1000U })
+    {
+      std::vector<int> ascending(length);
+      std::iota(ascending.begin(), ascending.end(), 0);
+
+      std::vector<int> descending(ascending.rbegin(), ascending.rend());
+
+      std::vector<int> equal(length, 5);
+
+      std::vector<int> organ_pipe(ascending);
+      std::reverse(organ_pipe.begin() + (length / 2), organ_pipe.end());
+
+      std::vector<int> few_unique(length);
+      std::vector<int> random(length);
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        few_unique[i] = int(urng() % 4U);
+        random[i]     = int(urng());
+      }
+
+      patterns.push_back(ascending);
+      patterns.push_back(descending);
+      patterns.push_back(equal);
+      patterns.push_back(organ_pipe);
+      patterns.push_back(few_unique);
+      patterns.push_back(random);
+    }
+
+    return patterns;
+  }
+
+  //***********************************
+  // Data with many duplicate keys, indexed by original position.
+  std::vector<NDC> make_stable_sort_data(size_t length)
+  {
+    std::vector<NDC> data;
+
+    for (size_t i = 0U; i < length; ++i)
+    {
+      data.push_back(NDC(int(urng() % 8U), int(i)));
+    }
+
+    return data;
+  }
+
   SUITE(test_algorithm)
   {
     //*************************************************************************
@@ -2074,6 +2145,193 @@ namespace
       CHECK(is_same);
     }
 
+    //*************************************************************************
+    TEST(intro_sort_default)
+    {
+      std::vector<std::vector<int>> patterns = make_sort_patterns();
+
+      for (const std::vector<int>& pattern : patterns)
+      {
+        std::vector<int> data1 = pattern;
+        std::vector<int> data2 = pattern;
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_greater)
+    {
+      std::vector<std::vector<int>> patterns = make_sort_patterns();
+
+      for (const std::vector<int>& pattern : patterns)
+      {
+        std::vector<int> data1 = pattern;
+        std::vector<int> data2 = pattern;
+
+        std::sort(data1.begin(), data1.end(), std::greater<int>());
+        etl::intro_sort(data2.begin(), data2.end(), std::greater<int>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_pointers)
+    {
+      std::vector<int> data1(dataA, dataA + SIZE);
+      int data2[SIZE];
+      std::copy(dataA, dataA + SIZE, data2);
+
+      std::sort(data1.begin(), data1.end());
+      etl::intro_sort(data2, data2 + SIZE);
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_default)
+    {
+      for (size_t length : { 0U, 1U, 2U, 16U, 17U, 100U, 1000U })
+      {
+        std::vector<NDC> initial_data = make_stable_sort_data(length);
+
+        std::vector<NDC> data1(initial_data);
+        std::vector<NDC> data2(initial_data);
+
+        std::stable_sort(data1.begin(), data1.end());
+        etl::merge_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_greater)
+    {
+      for (size_t length : { 0U, 1U, 2U, 16U, 17U, 100U, 1000U })
+      {
+        std::vector<NDC> initial_data = make_stable_sort_data(length);
+
+        std::vector<NDC> data1(initial_data);
+        std::vector<NDC> data2(initial_data);
+
+        std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+        etl::merge_sort(data2.begin(), data2.end(), std::greater<NDC>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_with_buffer)
+    {
+      const size_t Length = 1000U;
+
+      std::vector<NDC> initial_data = make_stable_sort_data(Length);
+
+      std::vector<NDC> data1(initial_data);
+      std::stable_sort(data1.begin(), data1.end());
+
+      // Buffers that are empty, too small for any merge, too small for the
+      // final merge, and large enough for all merges.
+      for (size_t buffer_size : { size_t(0U), size_t(5U), size_t(100U), Length / 2U, Length })
+      {
+        std::vector<NDC> buffer(buffer_size, NDC(0));
+        std::vector<NDC> data2(initial_data);
+
+        etl::merge_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_with_buffer_greater)
+    {
+      const size_t Length = 1000U;
+
+      std::vector<NDC> initial_data = make_stable_sort_data(Length);
+
+      std::vector<NDC> data1(initial_data);
+      std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+
+      for (size_t buffer_size : { size_t(0U), size_t(5U), size_t(100U), Length / 2U, Length })
+      {
+        std::vector<NDC> buffer(buffer_size, NDC(0));
+        std::vector<NDC> data2(initial_data);
+
+        etl::merge_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end(), std::greater<NDC>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_patterns)
+    {
+      std::vector<std::vector<int>> patterns = make_sort_patterns();
+
+      for (const std::vector<int>& pattern : patterns)
+      {
+        std::vector<int> data1 = pattern;
+        std::vector<int> data2 = pattern;
+        std::vector<int> data3 = pattern;
+        std::vector<int> buffer(pattern.size() / 2U);
+
+        std::stable_sort(data1.begin(), data1.end());
+        etl::merge_sort(data2.begin(), data2.end());
+        etl::merge_sort(data3.begin(), data3.end(), buffer.begin(), buffer.end());
+
+        CHECK(std::equal(data1.begin(), data1.end(), data2.begin()));
+        CHECK(std::equal(data1.begin(), data1.end(), data3.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(stable_sort_with_buffer)
+    {
+      std::vector<NDC> initial_data = make_stable_sort_data(100U);
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+      std::vector<NDC> data3(initial_data);
+      std::vector<NDC> buffer(50U, NDC(0));
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::stable_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end());
+      etl::stable_sort(data3.begin(), data3.end(), buffer.begin(), buffer.end(), std::greater<NDC>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+
+      std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+      is_same = std::equal(data1.begin(), data1.end(), data3.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+#if ETL_USING_CPP20 || (ETL_USING_CPP17 && !ETL_USING_STD_NAMESPACE)
+    //*************************************************************************
+    TEST(intro_sort_and_merge_sort_constexpr)
+    {
+      constexpr std::array<int, 40> data1 = sort_at_compile_time([](std::array<int, 40>::iterator b, std::array<int, 40>::iterator e) { etl::intro_sort(b, e); });
+      constexpr std::array<int, 40> data2 = sort_at_compile_time([](std::array<int, 40>::iterator b, std::array<int, 40>::iterator e) { etl::merge_sort(b, e); });
+
+      CHECK(std::is_sorted(data1.begin(), data1.end()));
+      CHECK(std::is_sorted(data2.begin(), data2.end()));
+    }
+#endif
+
     //*************************************************************************
     TEST(multimax)
     {
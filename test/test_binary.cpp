@@ -2268,6 +2268,22 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_count_leading_zeros_64_highest_bit)
+    {
+      // Random values rarely have many leading zeros, so check each highest bit position.
+      for (int bit = 0; bit < 64; ++bit)
+      {
+        uint64_t value = uint64_t(1U) << bit;
+
+        CHECK_EQUAL(int(test_leading_zeros(value)), int(etl::count_leading_zeros(value)));
+
+        value |= 1U;
+
+        CHECK_EQUAL(int(test_leading_zeros(value)), int(etl::count_leading_zeros(value)));
+      }
+    }
+
 #if !defined(ETL_FORCE_NO_ADVANCED_CPP)
     //*************************************************************************
     TEST(test_count_leading_zeros_64_constexpr)
@@ -2278,6 +2294,67 @@ namespace
     }
 #endif
 
+    //*************************************************************************
+    TEST(test_count_leading_zeros_signed)
+    {
+      CHECK_EQUAL(8,  int(etl::count_leading_zeros(int8_t(0))));
+      CHECK_EQUAL(0,  int(etl::count_leading_zeros(int8_t(-1))));
+      CHECK_EQUAL(1,  int(etl::count_leading_zeros(int8_t(0x40))));
+      CHECK_EQUAL(15, int(etl::count_leading_zeros(int16_t(1))));
+      CHECK_EQUAL(4,  int(etl::count_leading_zeros(int32_t(0x08000000))));
+      CHECK_EQUAL(63, int(etl::count_leading_zeros(int64_t(1))));
+      CHECK_EQUAL(0,  int(etl::count_leading_zeros(int64_t(-1))));
+    }
+
+    //*************************************************************************
+    // The compiler builtins are undefined for zero, so check the limits of each size.
+    template <typename T>
+    void check_bit_counts_at_limits()
+    {
+      const int Bits = etl::integral_limits<T>::bits;
+      const T   Zero = T(0);
+      const T   Ones = T(~T(0));
+
+      CHECK_EQUAL(0,    int(etl::count_bits(Zero)));
+      CHECK_EQUAL(Bits, int(etl::count_bits(Ones)));
+      CHECK_EQUAL(0,    int(etl::parity(Zero)));
+      CHECK_EQUAL(0,    int(etl::parity(Ones)));
+      CHECK_EQUAL(1,    int(etl::parity(T(Ones >> 1U))));
+      CHECK_EQUAL(Bits, int(etl::count_trailing_zeros(Zero)));
+      CHECK_EQUAL(0,    int(etl::count_trailing_zeros(Ones)));
+      CHECK_EQUAL(Bits, int(etl::count_trailing_ones(Ones)));
+      CHECK_EQUAL(0,    int(etl::count_trailing_ones(Zero)));
+      CHECK_EQUAL(Bits, int(etl::count_leading_zeros(Zero)));
+      CHECK_EQUAL(0,    int(etl::count_leading_zeros(Ones)));
+      CHECK_EQUAL(Bits, int(etl::count_leading_ones(Ones)));
+      CHECK_EQUAL(0,    int(etl::count_leading_ones(Zero)));
+      CHECK_EQUAL(1,    int(etl::count_leading_zeros(T(Ones >> 1U))));
+      CHECK_EQUAL(Bits - 1, int(etl::count_trailing_zeros(T(T(1U) << (Bits - 1)))));
+      CHECK_EQUAL(Bits - 1, int(etl::count_leading_zeros(T(1U))));
+      CHECK(etl::reverse_bits(T(1U)) == T(T(1U) << (Bits - 1)));
+
+      // Runs of ones from each end.
+      for (int n = 0; n <= Bits; ++n)
+      {
+        const T low  = (n == Bits) ? Ones : T((T(1U) << n) - 1U);
+        const T high = (n == Bits) ? Ones : T(~T(Ones >> n));
+
+        CHECK_EQUAL(n, int(etl::count_bits(low)));
+        CHECK_EQUAL(n, int(etl::count_trailing_ones(low)));
+        CHECK_EQUAL(Bits - n, int(etl::count_leading_zeros(low)));
+        CHECK_EQUAL(n, int(etl::count_leading_ones(high)));
+        CHECK_EQUAL(Bits - n, int(etl::count_trailing_zeros(high)));
+      }
+    }
+
+    TEST(test_bit_counts_at_limits)
+    {
+      check_bit_counts_at_limits<uint8_t>();
+      check_bit_counts_at_limits<uint16_t>();
+      check_bit_counts_at_limits<uint32_t>();
+      check_bit_counts_at_limits<uint64_t>();
+    }
+
     //*************************************************************************
     TEST(test_count_leading_ones_8)
     {
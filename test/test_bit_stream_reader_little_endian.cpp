@@ -32,6 +32,7 @@ SOFTWARE.
 
 #include <array>
 #include <numeric>
+#include <vector>
 
 namespace
 {
@@ -93,6 +94,50 @@ namespace etl
 
 namespace
 {
+  //***********************************
+  // Writes 'count' values after 'offset' bits, then reads them singly and as a span.
+  template <typename T>
+  bool read_span_matches_single_reads(uint_least8_t nbits, uint_least8_t offset)
+  {
+    const size_t count = 37U;
+
+    std::array<char, 512> storage;
+    storage.fill(0);
+
+    etl::bit_stream_writer writer(storage.data(), storage.size(), etl::endian::little);
+
+    writer.write(uint8_t(0x55U), offset);
+
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+      writer.write(static_cast<T>(seed >> 7U), nbits);
+    }
+
+    etl::bit_stream_reader single_stream(storage.data(), storage.size(), etl::endian::little);
+    etl::bit_stream_reader span_stream(storage.data(), storage.size(), etl::endian::little);
+
+    single_stream.skip(offset);
+    span_stream.skip(offset);
+
+    std::vector<T> single_values;
+    std::vector<T> span_values(count);
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      single_values.push_back(single_stream.read_unchecked<T>(nbits));
+    }
+
+    bool success = span_stream.read(etl::span<T>(span_values.data(), span_values.size()), nbits);
+
+    // Both streams should continue from the same position.
+    return success &&
+           (single_values == span_values) &&
+           (single_stream.read_unchecked<uint8_t>(5U) == span_stream.read_unchecked<uint8_t>(5U));
+  }
+
   SUITE(test_bit_stream_reader)
   {
     //*************************************************************************
@@ -1151,6 +1196,75 @@ namespace
       CHECK_EQUAL(object2.i, result2.i);
       CHECK_EQUAL(object2.c, result2.c);
     }
+
+    //*************************************************************************
+    TEST(test_read_span)
+    {
+      for (uint_least8_t offset = 0U; offset < 8U; offset += 3U)
+      {
+        for (uint_least8_t nbits = 0U; nbits <= 8U; ++nbits)
+        {
+          CHECK(read_span_matches_single_reads<uint8_t>(nbits, offset));
+          CHECK(read_span_matches_single_reads<int8_t>(nbits, offset));
+        }
+
+        for (uint_least8_t nbits = 0U; nbits <= 16U; ++nbits)
+        {
+          CHECK(read_span_matches_single_reads<uint16_t>(nbits, offset));
+          CHECK(read_span_matches_single_reads<int16_t>(nbits, offset));
+        }
+
+        for (uint_least8_t nbits = 0U; nbits <= 32U; ++nbits)
+        {
+          CHECK(read_span_matches_single_reads<int32_t>(nbits, offset));
+        }
+
+        for (uint_least8_t nbits = 0U; nbits <= 64U; ++nbits)
+        {
+          CHECK(read_span_matches_single_reads<uint64_t>(nbits, offset));
+          CHECK(read_span_matches_single_reads<int64_t>(nbits, offset));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_read_span_sign_extended)
+    {
+      std::array<int16_t, 4> values = { -1, 2047, -2048, 1234 };
+
+      std::array<char, 8> storage;
+      storage.fill(0);
+
+      etl::bit_stream_writer writer(storage.data(), storage.size(), etl::endian::little);
+      writer.write(etl::span<const int16_t>(values.data(), values.size()), 12U);
+
+      etl::bit_stream_reader bit_stream(storage.data(), storage.size(), etl::endian::little);
+
+      std::array<int16_t, 4> result;
+      result.fill(0);
+
+      CHECK(bit_stream.read(etl::span<int16_t, 4>(result), 12U));
+      CHECK(values == result);
+      CHECK_EQUAL(16U, bit_stream.size_bits() - 48U);
+    }
+
+    //*************************************************************************
+    TEST(test_read_span_overflow)
+    {
+      std::array<char, 4> storage;
+      storage.fill(0);
+
+      etl::bit_stream_reader bit_stream(storage.data(), storage.size(), etl::endian::little);
+
+      std::array<uint16_t, 3> result;
+      result.fill(0);
+
+      // 33 bits are not available in 32.
+      CHECK_THROW(bit_stream.read(etl::span<uint16_t, 3>(result), 11U), etl::bit_stream_overflow);
+
+      CHECK(bit_stream.read(etl::span<uint16_t, 3>(result), 10U));
+      CHECK_EQUAL(0U, bit_stream.read_unchecked<uint8_t>(2U));
+    }
   };
 }
 
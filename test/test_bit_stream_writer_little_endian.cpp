@@ -112,6 +112,54 @@ namespace
     std::vector<char> data;
   };
 
+  //***********************************
+  template <typename T>
+  std::vector<T> make_span_values(size_t count)
+  {
+    std::vector<T> values;
+
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+      values.push_back(static_cast<T>(seed >> 7U));
+    }
+
+    return values;
+  }
+
+  //***********************************
+  // Writes the values singly and as a span, after 'offset' bits, and compares the streams.
+  template <typename T>
+  bool write_span_matches_single_writes(uint_least8_t nbits, uint_least8_t offset)
+  {
+    std::vector<T> values = make_span_values<T>(37U);
+
+    std::array<char, 512> single_storage;
+    std::array<char, 512> span_storage;
+    single_storage.fill(0);
+    span_storage.fill(0);
+
+    etl::bit_stream_writer single_stream(single_storage.data(), single_storage.size(), etl::endian::little);
+    etl::bit_stream_writer span_stream(span_storage.data(), span_storage.size(), etl::endian::little);
+
+    single_stream.write(uint8_t(0x55U), offset);
+    span_stream.write(uint8_t(0x55U), offset);
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      single_stream.write(values[i], nbits);
+    }
+
+    bool success = span_stream.write(etl::span<const T>(values.data(), values.size()), nbits);
+
+    return success &&
+           (single_stream.size_bits() == span_stream.size_bits()) &&
+           (single_stream.size_bytes() == span_stream.size_bytes()) &&
+           (single_storage == span_storage);
+  }
+
   SUITE(test_bit_stream_little_endian)
   {
     //*************************************************************************
@@ -879,5 +927,99 @@ namespace
       CHECK_EQUAL((int)expected[10], (int)storage[10]);
       CHECK_EQUAL((int)expected[11], (int)storage[11]);
     }
+
+    //*************************************************************************
+    TEST(test_write_span)
+    {
+      for (uint_least8_t offset = 0U; offset < 8U; offset += 3U)
+      {
+        for (uint_least8_t nbits = 0U; nbits <= 8U; ++nbits)
+        {
+          CHECK(write_span_matches_single_writes<uint8_t>(nbits, offset));
+        }
+
+        for (uint_least8_t nbits = 0U; nbits <= 16U; ++nbits)
+        {
+          CHECK(write_span_matches_single_writes<uint16_t>(nbits, offset));
+          CHECK(write_span_matches_single_writes<int16_t>(nbits, offset));
+        }
+
+        for (uint_least8_t nbits = 0U; nbits <= 32U; ++nbits)
+        {
+          CHECK(write_span_matches_single_writes<uint32_t>(nbits, offset));
+        }
+
+        for (uint_least8_t nbits = 0U; nbits <= 64U; ++nbits)
+        {
+          CHECK(write_span_matches_single_writes<uint64_t>(nbits, offset));
+          CHECK(write_span_matches_single_writes<int64_t>(nbits, offset));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_write_span_non_const)
+    {
+      std::array<uint16_t, 3> values = { 0x1234U, 0x0567U, 0x1ABCU };
+
+      std::array<char, 8> storage;
+      storage.fill(0);
+
+      etl::bit_stream_writer bit_stream(storage.data(), storage.size(), etl::endian::little);
+
+      CHECK(bit_stream.write(etl::span<uint16_t, 3>(values), 13U));
+      CHECK_EQUAL(39U, bit_stream.size_bits());
+
+      etl::bit_stream_reader reader(storage.data(), storage.size(), etl::endian::little);
+
+      CHECK_EQUAL(0x1234U, reader.read_unchecked<uint16_t>(13U));
+      CHECK_EQUAL(0x0567U, reader.read_unchecked<uint16_t>(13U));
+      CHECK_EQUAL(0x1ABCU, reader.read_unchecked<uint16_t>(13U));
+    }
+
+    //*************************************************************************
+    TEST(test_write_span_with_callback)
+    {
+      std::vector<uint16_t> values = make_span_values<uint16_t>(25U);
+
+      std::array<char, 512> expected;
+      expected.fill(0);
+
+      etl::bit_stream_writer expected_stream(expected.data(), expected.size(), etl::endian::little);
+      expected_stream.write(etl::span<const uint16_t>(values.data(), values.size()), 11U);
+
+      // The buffer is smaller than the data.
+      std::array<char, 4> storage;
+      storage.fill(0);
+
+      Accumulator accumulator;
+      auto callback = etl::bit_stream_writer::callback_type::create<Accumulator, &Accumulator::Add>(accumulator);
+
+      etl::bit_stream_writer bit_stream(storage.data(), storage.size(), etl::endian::little, callback);
+
+      CHECK(bit_stream.write(etl::span<const uint16_t>(values.data(), values.size()), 11U));
+      bit_stream.flush();
+
+      CHECK_EQUAL(expected_stream.size_bytes(), accumulator.GetData().size());
+      CHECK(std::equal(accumulator.GetData().begin(), accumulator.GetData().end(), expected.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_write_span_overflow)
+    {
+      std::array<uint16_t, 3> values = { 1U, 2U, 3U };
+
+      std::array<char, 4> storage;
+      storage.fill(0);
+
+      etl::bit_stream_writer bit_stream(storage.data(), storage.size(), etl::endian::little);
+
+      // 33 bits will not fit in 32.
+      CHECK_THROW(bit_stream.write(etl::span<const uint16_t>(values.data(), values.size()), 11U), etl::bit_stream_overflow);
+      CHECK_EQUAL(0U, bit_stream.size_bits());
+
+      CHECK(bit_stream.write(etl::span<const uint16_t>(values.data(), values.size()), 10U));
+      CHECK_EQUAL(30U, bit_stream.size_bits());
+    }
   };
 }
@@ -31,6 +31,8 @@ SOFTWARE.
 #include <limits>
 #include <type_traits>
 #include <bitset>
+#include <vector>
+#include <random>
 
 #include "etl/private/bitset_new.h"
 #include "etl/string.h"
@@ -100,6 +102,62 @@ namespace
     return data2;
   }
 
+  //*************************************************************************
+  // Checks the word scanning searches against a bit by bit search.
+  template <typename TBitset>
+  bool check_find_against_test(const TBitset& data)
+  {
+    const size_t npos = TBitset::npos;
+    const size_t size = data.size();
+
+    for (size_t state = 0U; state < 2U; ++state)
+    {
+      for (size_t position = 0U; position <= size; ++position)
+      {
+        size_t next = npos;
+
+        for (size_t i = position; i < size; ++i)
+        {
+          if (data.test(i) == (state != 0U))
+          {
+            next = i;
+            break;
+          }
+        }
+
+        size_t prev = npos;
+
+        for (size_t i = ((position < size) ? position + 1U : size); i > 0U; --i)
+        {
+          if (data.test(i - 1U) == (state != 0U))
+          {
+            prev = i - 1U;
+            break;
+          }
+        }
+
+        if ((data.find_next(state != 0U, position) != next) || (data.find_prev(state != 0U, position) != prev))
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //*************************************************************************
+  template <typename TBitset>
+  std::vector<size_t> set_bit_positions(const TBitset& data)
+  {
+    std::vector<size_t> positions;
+
+    data.for_each_set_bit([&positions](size_t position) { positions.push_back(position); });
+
+    return positions;
+  }
+
+
   SUITE(test_bitset_new_default_element_type)
   {
     //*************************************************************************
@@ -1975,6 +2033,114 @@ namespace
     }
 
     //*************************************************************************
+
+    //*************************************************************************
+    TEST(test_find_prev_and_find_last)
+    {
+      constexpr etl::bitset<9> bs1(ull(0x0000));
+      constexpr size_t bs1flt = bs1.find_last(true);
+      constexpr size_t bs1flf = bs1.find_last(false);
+      CHECK_EQUAL(etl::bitset<>::npos, bs1flt);
+      CHECK_EQUAL(8U, bs1flf);
+
+      constexpr etl::bitset<9> bs2(ull(0x01FF));
+      constexpr size_t bs2flt = bs2.find_last(true);
+      constexpr size_t bs2flf = bs2.find_last(false);
+      CHECK_EQUAL(8U, bs2flt);
+      CHECK_EQUAL(etl::bitset<>::npos, bs2flf);
+
+      constexpr etl::bitset<9> bs3(ull(0x0031));
+      constexpr size_t bs3fpt3   = bs3.find_prev(true, 3);
+      constexpr size_t bs3fpt4   = bs3.find_prev(true, 4);
+      constexpr size_t bs3fpf5   = bs3.find_prev(false, 5);
+      constexpr size_t bs3fpf0   = bs3.find_prev(false, 0);
+      constexpr size_t bs3fpt100 = bs3.find_prev(true, 100);
+      CHECK_EQUAL(0U, bs3fpt3);
+      CHECK_EQUAL(4U, bs3fpt4);
+      CHECK_EQUAL(3U, bs3fpf5);
+      CHECK_EQUAL(etl::bitset<>::npos, bs3fpf0);
+      CHECK_EQUAL(5U, bs3fpt100);
+
+      constexpr etl::bitset<64, uint32_t> bs32(ull(0xC000'0000'0000'0031));
+      constexpr size_t bs32flt    = bs32.find_last(true);
+      constexpr size_t bs32fpt61  = bs32.find_prev(true, 61);
+      constexpr size_t bs32fpf63  = bs32.find_prev(false, 63);
+      CHECK_EQUAL(63U, bs32flt);
+      CHECK_EQUAL(5U, bs32fpt61);
+      CHECK_EQUAL(61U, bs32fpf63);
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_set_bit)
+    {
+      etl::bitset<100> bs;
+
+      CHECK(set_bit_positions(bs).empty());
+
+      bs.set(size_t(0));
+      bs.set(9);
+      bs.set(31);
+      bs.set(32);
+      bs.set(63);
+      bs.set(64);
+      bs.set(99);
+
+      CHECK((set_bit_positions(bs) == std::vector<size_t>{ 0, 9, 31, 32, 63, 64, 99 }));
+
+      // The function is returned.
+      struct Counter
+      {
+        void operator ()(size_t) { ++n; }
+        size_t n = 0U;
+      };
+
+      CHECK_EQUAL(7U, bs.for_each_set_bit(Counter()).n);
+    }
+
+    //*************************************************************************
+    TEST(test_find_against_test)
+    {
+      std::mt19937 generator(1234);
+
+      etl::bitset<1000, uint8_t>  bs8;
+      etl::bitset<1000, uint32_t> bs32;
+      etl::bitset<1000, uint64_t> bs64;
+
+      CHECK(check_find_against_test(bs8));
+      CHECK(check_find_against_test(bs32));
+      CHECK(check_find_against_test(bs64));
+
+      // Sparse, then dense, so that both all clear and all set runs are skipped.
+      for (size_t i = 0U; i < 20U; ++i)
+      {
+        const size_t position = generator() % 1000U;
+
+        bs8.set(position);
+        bs32.set(position);
+        bs64.set(position);
+      }
+
+      CHECK(check_find_against_test(bs8));
+      CHECK(check_find_against_test(bs32));
+      CHECK(check_find_against_test(bs64));
+
+      bs8.flip();
+      bs32.flip();
+      bs64.flip();
+
+      CHECK(check_find_against_test(bs8));
+      CHECK(check_find_against_test(bs32));
+      CHECK(check_find_against_test(bs64));
+
+      bs8.set();
+      bs32.set();
+      bs64.set();
+
+      CHECK(check_find_against_test(bs8));
+      CHECK(check_find_against_test(bs32));
+      CHECK(check_find_against_test(bs64));
+    }
+
     //*************************************************************************
     TEST(test_swap)
     {
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <limits>
 #include <type_traits>
 #include <bitset>
+#include <vector>
 
 #include "etl/private/bitset_new.h"
 #include "etl/string.h"
@@ -117,6 +118,62 @@ namespace
     return data2;
   }
 
+  //*************************************************************************
+  // Checks the word scanning searches against a bit by bit search.
+  template <typename TBitset>
+  bool check_find_against_test(const TBitset& data)
+  {
+    const size_t npos = TBitset::npos;
+    const size_t size = data.size();
+
+    for (size_t state = 0U; state < 2U; ++state)
+    {
+      for (size_t position = 0U; position <= size; ++position)
+      {
+        size_t next = npos;
+
+        for (size_t i = position; i < size; ++i)
+        {
+          if (data.test(i) == (state != 0U))
+          {
+            next = i;
+            break;
+          }
+        }
+
+        size_t prev = npos;
+
+        for (size_t i = ((position < size) ? position + 1U : size); i > 0U; --i)
+        {
+          if (data.test(i - 1U) == (state != 0U))
+          {
+            prev = i - 1U;
+            break;
+          }
+        }
+
+        if ((data.find_next(state != 0U, position) != next) || (data.find_prev(state != 0U, position) != prev))
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //*************************************************************************
+  template <typename TBitset>
+  std::vector<size_t> set_bit_positions(const TBitset& data)
+  {
+    std::vector<size_t> positions;
+
+    data.for_each_set_bit([&positions](size_t position) { positions.push_back(position); });
+
+    return positions;
+  }
+
+
   SUITE(test_bitset_new_implicit_element_type)
   {
     //*************************************************************************
@@ -1475,6 +1532,65 @@ namespace
       CHECK(swapped.second == compare1);
     }
 
+
+    //*************************************************************************
+    TEST(test_find_prev_and_find_last)
+    {
+      constexpr etl::bitset<8, int8_t> bs1(ull(0x00));
+      constexpr size_t bs1flt = bs1.find_last(true);
+      constexpr size_t bs1flf = bs1.find_last(false);
+      CHECK_EQUAL(etl::bitset<>::npos, bs1flt);
+      CHECK_EQUAL(7U, bs1flf);
+
+      constexpr etl::bitset<8, int8_t> bs2(ull(0xFF));
+      constexpr size_t bs2flt = bs2.find_last(true);
+      constexpr size_t bs2flf = bs2.find_last(false);
+      CHECK_EQUAL(7U, bs2flt);
+      CHECK_EQUAL(etl::bitset<>::npos, bs2flf);
+
+      constexpr etl::bitset<8, int8_t> bs3(ull(0x31));
+      constexpr size_t bs3fpt3   = bs3.find_prev(true, 3);
+      constexpr size_t bs3fpt4   = bs3.find_prev(true, 4);
+      constexpr size_t bs3fpf5   = bs3.find_prev(false, 5);
+      constexpr size_t bs3fpf0   = bs3.find_prev(false, 0);
+      constexpr size_t bs3fpt100 = bs3.find_prev(true, 100);
+      CHECK_EQUAL(0U, bs3fpt3);
+      CHECK_EQUAL(4U, bs3fpt4);
+      CHECK_EQUAL(3U, bs3fpf5);
+      CHECK_EQUAL(etl::bitset<>::npos, bs3fpf0);
+      CHECK_EQUAL(5U, bs3fpt100);
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_set_bit)
+    {
+      etl::bitset<32, uint32_t> bs;
+
+      CHECK(set_bit_positions(bs).empty());
+
+      bs.set(size_t(0));
+      bs.set(size_t(9));
+      bs.set(size_t(31));
+
+      CHECK((set_bit_positions(bs) == std::vector<size_t>{ 0, 9, 31 }));
+    }
+
+    //*************************************************************************
+    TEST(test_find_against_test)
+    {
+      etl::bitset<8, uint8_t>   bs8(ull(0x5A));
+      etl::bitset<64, uint64_t> bs64(ull(0x8000'0300'0000'1001));
+
+      CHECK(check_find_against_test(bs8));
+      CHECK(check_find_against_test(bs64));
+
+      bs8.flip();
+      bs64.flip();
+
+      CHECK(check_find_against_test(bs8));
+      CHECK(check_find_against_test(bs64));
+    }
+
     //*************************************************************************
     TEST(test_span)
     {
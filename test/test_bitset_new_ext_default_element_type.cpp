@@ -31,6 +31,8 @@ SOFTWARE.
 #include <limits>
 #include <type_traits>
 #include <bitset>
+#include <vector>
+#include <random>
 
 #include "etl/private/bitset_new.h"
 #include "etl/string.h"
@@ -42,6 +44,62 @@ namespace
 {
   using ull = unsigned long long;
 
+  //*************************************************************************
+  // Checks the word scanning searches against a bit by bit search.
+  template <typename TBitset>
+  bool check_find_against_test(const TBitset& data)
+  {
+    const size_t npos = TBitset::npos;
+    const size_t size = data.size();
+
+    for (size_t state = 0U; state < 2U; ++state)
+    {
+      for (size_t position = 0U; position <= size; ++position)
+      {
+        size_t next = npos;
+
+        for (size_t i = position; i < size; ++i)
+        {
+          if (data.test(i) == (state != 0U))
+          {
+            next = i;
+            break;
+          }
+        }
+
+        size_t prev = npos;
+
+        for (size_t i = ((position < size) ? position + 1U : size); i > 0U; --i)
+        {
+          if (data.test(i - 1U) == (state != 0U))
+          {
+            prev = i - 1U;
+            break;
+          }
+        }
+
+        if ((data.find_next(state != 0U, position) != next) || (data.find_prev(state != 0U, position) != prev))
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //*************************************************************************
+  template <typename TBitset>
+  std::vector<size_t> set_bit_positions(const TBitset& data)
+  {
+    std::vector<size_t> positions;
+
+    data.for_each_set_bit([&positions](size_t position) { positions.push_back(position); });
+
+    return positions;
+  }
+
+
   SUITE(test_bitset_new_ext_default_element_type)
   {
     //*************************************************************************
@@ -1815,6 +1873,87 @@ namespace
       CHECK_EQUAL(62U, bs2fnf2);
     }
 
+
+    //*************************************************************************
+    TEST(test_find_prev_and_find_last)
+    {
+      etl::bitset_ext<9>::buffer_type buffer;
+
+      etl::bitset_ext<9> bs1(ull(0x0000), buffer);
+      CHECK_EQUAL(etl::bitset_ext<>::npos, bs1.find_last(true));
+      CHECK_EQUAL(8U, bs1.find_last(false));
+
+      etl::bitset_ext<9> bs2(ull(0x01FF), buffer);
+      CHECK_EQUAL(8U, bs2.find_last(true));
+      CHECK_EQUAL(etl::bitset_ext<>::npos, bs2.find_last(false));
+
+      etl::bitset_ext<9> bs3(ull(0x0031), buffer);
+      CHECK_EQUAL(0U, bs3.find_prev(true, 3));
+      CHECK_EQUAL(4U, bs3.find_prev(true, 4));
+      CHECK_EQUAL(3U, bs3.find_prev(false, 5));
+      CHECK_EQUAL(etl::bitset_ext<>::npos, bs3.find_prev(false, 0));
+      CHECK_EQUAL(5U, bs3.find_prev(true, 100));
+
+      etl::bitset_ext<64, uint32_t>::buffer_type buffer32;
+
+      etl::bitset_ext<64, uint32_t> bs32(ull(0xC000'0000'0000'0031), buffer32);
+      CHECK_EQUAL(63U, bs32.find_last(true));
+      CHECK_EQUAL(5U, bs32.find_prev(true, 61));
+      CHECK_EQUAL(61U, bs32.find_prev(false, 63));
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_set_bit)
+    {
+      etl::bitset_ext<100>::buffer_type buffer;
+
+      etl::bitset_ext<100> bs(buffer);
+
+      CHECK(set_bit_positions(bs).empty());
+
+      bs.set(size_t(0));
+      bs.set(9);
+      bs.set(31);
+      bs.set(32);
+      bs.set(63);
+      bs.set(64);
+      bs.set(99);
+
+      CHECK((set_bit_positions(bs) == std::vector<size_t>{ 0, 9, 31, 32, 63, 64, 99 }));
+    }
+
+    //*************************************************************************
+    TEST(test_find_against_test)
+    {
+      std::mt19937 generator(1234);
+
+      etl::bitset_ext<1000, uint8_t>::buffer_type  buffer8;
+      etl::bitset_ext<1000, uint64_t>::buffer_type buffer64;
+
+      etl::bitset_ext<1000, uint8_t>  bs8(buffer8);
+      etl::bitset_ext<1000, uint64_t> bs64(buffer64);
+
+      CHECK(check_find_against_test(bs8));
+      CHECK(check_find_against_test(bs64));
+
+      for (size_t i = 0U; i < 20U; ++i)
+      {
+        const size_t position = generator() % 1000U;
+
+        bs8.set(position);
+        bs64.set(position);
+      }
+
+      CHECK(check_find_against_test(bs8));
+      CHECK(check_find_against_test(bs64));
+
+      bs8.flip();
+      bs64.flip();
+
+      CHECK(check_find_against_test(bs8));
+      CHECK(check_find_against_test(bs64));
+    }
+
     //*************************************************************************
     TEST(test_swap)
     {
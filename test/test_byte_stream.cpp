@@ -1333,5 +1333,163 @@ namespace
         CHECK_EQUAL(expected[i], result[i]);
       }
     }
+
+    //*************************************************************************
+    template <typename T>
+    void check_span_matches_single_values(etl::endian endianness)
+    {
+      std::vector<T> put_data;
+
+      for (int i = 0; i < 33; ++i)
+      {
+        put_data.push_back(static_cast<T>((i * 0x9E3779B1UL) >> (i % 5)));
+      }
+
+      std::vector<char> storage_span(put_data.size() * sizeof(T));
+      std::vector<char> storage_single(put_data.size() * sizeof(T));
+
+      etl::byte_stream_writer writer_span(storage_span.data(), storage_span.size(), endianness);
+      etl::byte_stream_writer writer_single(storage_single.data(), storage_single.size(), endianness);
+
+      CHECK(writer_span.write(etl::span<const T>(put_data.data(), put_data.size())));
+      CHECK(writer_span.full());
+
+      for (size_t i = 0U; i < put_data.size(); ++i)
+      {
+        CHECK(writer_single.write(put_data[i]));
+      }
+
+      CHECK(storage_single == storage_span);
+
+      std::vector<T> get_data(put_data.size());
+
+      etl::byte_stream_reader reader(storage_span.data(), storage_span.size(), endianness);
+      etl::optional<etl::span<const T> > result = reader.read(etl::span<T>(get_data.data(), get_data.size()));
+
+      CHECK(result.has_value());
+      CHECK(reader.empty());
+      CHECK(put_data == get_data);
+    }
+
+    //*************************************************************************
+    TEST(write_read_span_matches_single_values)
+    {
+      check_span_matches_single_values<int8_t>(etl::endian::big);
+      check_span_matches_single_values<uint16_t>(etl::endian::big);
+      check_span_matches_single_values<int32_t>(etl::endian::big);
+      check_span_matches_single_values<uint64_t>(etl::endian::big);
+      check_span_matches_single_values<float>(etl::endian::big);
+      check_span_matches_single_values<double>(etl::endian::big);
+
+      check_span_matches_single_values<int8_t>(etl::endian::little);
+      check_span_matches_single_values<uint16_t>(etl::endian::little);
+      check_span_matches_single_values<int32_t>(etl::endian::little);
+      check_span_matches_single_values<uint64_t>(etl::endian::little);
+      check_span_matches_single_values<float>(etl::endian::little);
+      check_span_matches_single_values<double>(etl::endian::little);
+    }
+
+    //*************************************************************************
+    TEST(write_read_bool_span)
+    {
+      std::array<char, 4> storage = { char(0), char(1), char(2), char(0) };
+      std::array<bool, 4> get_data;
+
+      etl::byte_stream_reader reader(storage.data(), storage.size(), etl::endian::big);
+
+      CHECK(reader.read(etl::span<bool>(get_data.data(), get_data.size())).has_value());
+      CHECK(!get_data[0]);
+      CHECK(get_data[1]);
+      CHECK(get_data[2]);
+      CHECK(!get_data[3]);
+    }
+
+    //*************************************************************************
+    TEST(write_span_byte_stream_callback)
+    {
+      std::array<char, 4 * sizeof(int32_t)> storage;
+      std::array<int32_t, 4> put_data = { int32_t(0x00000001), int32_t(0xA55AA55A), int32_t(0x5AA55AA5), int32_t(0xFFFFFFFF) };
+      std::vector<char> expected = { char(0x00), char(0x00), char(0x00), char(0x01),
+                                     char(0xA5), char(0x5A), char(0xA5), char(0x5A),
+                                     char(0x5A), char(0xA5), char(0x5A), char(0xA5),
+                                     char(0xFF), char(0xFF), char(0xFF), char(0xFF) };
+
+      std::vector<char> result;
+      size_t calls = 0U;
+
+      auto lambda = [&](etl::byte_stream_writer::callback_parameter_type sp)
+                    {
+                      CHECK_EQUAL(sizeof(int32_t), sp.size());
+                      std::copy(sp.begin(), sp.end(), std::back_inserter(result));
+                      ++calls;
+                    };
+
+      etl::byte_stream_writer::callback_type callback(lambda);
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big, callback);
+
+      CHECK(writer.write(etl::span<int32_t>(put_data.begin(), put_data.end())));
+
+      CHECK_EQUAL(put_data.size(), calls);
+      CHECK(expected == result);
+    }
+
+    //*************************************************************************
+    TEST(read_view_unaligned)
+    {
+      std::array<char, 9> storage;
+      std::array<uint16_t, 4> put_data = { uint16_t(0x0001), uint16_t(0xA55A), uint16_t(0x1234), uint16_t(0xFFFE) };
+
+      // Offset the data by one byte to make it unaligned.
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big);
+      CHECK(writer.write(uint8_t(0x5A)));
+      CHECK(writer.write(etl::span<uint16_t>(put_data.begin(), put_data.end())));
+
+      etl::byte_stream_reader reader(storage.data(), storage.size(), etl::endian::big);
+      CHECK_EQUAL(0x5A, reader.read<uint8_t>().value());
+
+      etl::optional<etl::span<const etl::be_uint16_t> > result = reader.read_view<etl::be_uint16_t>(put_data.size());
+
+      CHECK(result.has_value());
+      CHECK(reader.empty());
+      CHECK_EQUAL(put_data.size(), result.value().size());
+      CHECK(static_cast<const void*>(result.value().data()) == static_cast<const void*>(storage.data() + 1));
+
+      for (size_t i = 0U; i < put_data.size(); ++i)
+      {
+        CHECK_EQUAL(put_data[i], uint16_t(result.value()[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(read_view_unaligned_little_endian)
+    {
+      std::array<char, 2 * sizeof(uint32_t)> storage;
+      std::array<uint32_t, 2> put_data = { uint32_t(0x12345678), uint32_t(0xA55AA55A) };
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::little);
+      CHECK(writer.write(etl::span<uint32_t>(put_data.begin(), put_data.end())));
+
+      etl::byte_stream_reader reader(storage.data(), storage.size(), etl::endian::little);
+
+      etl::span<const etl::le_uint32_t> view = reader.read_view_unchecked<etl::le_uint32_t>(put_data.size());
+
+      CHECK_EQUAL(put_data[0], uint32_t(view[0]));
+      CHECK_EQUAL(put_data[1], uint32_t(view[1]));
+    }
+
+    //*************************************************************************
+    TEST(read_view_overflow)
+    {
+      std::array<char, 7> storage = { 0 };
+
+      etl::byte_stream_reader reader(storage.data(), storage.size(), etl::endian::big);
+
+      CHECK(!reader.read_view<etl::be_uint16_t>(4U).has_value());
+      CHECK_EQUAL(0U, reader.used_data().size());
+
+      CHECK(reader.read_view<etl::be_uint16_t>(3U).has_value());
+      CHECK_EQUAL(6U, reader.used_data().size());
+    }
   };
 }
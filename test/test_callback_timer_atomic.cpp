@@ -38,6 +38,8 @@ SOFTWARE.
 #include <thread>
 #include <chrono>
 #include <atomic>
+#include <algorithm>
+#include <random>
 
 #if defined(ETL_COMPILER_MICROSOFT)
   #include <Windows.h>
@@ -684,6 +686,288 @@ namespace
         CHECK(test_obj.called == 1);
     }
 
+    //*************************************************************************
+    using wheel_timer = etl::callback_timer_atomic<3, std::atomic_uint32_t, etl::timer_wheel<>>;
+
+    TEST(callback_timer_atomic_wheel_repeating_bigger_step)
+    {
+      wheel_timer timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback1,        37, etl::timer::mode::REPEATING);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback1, 23, etl::timer::mode::REPEATING);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_function_callback2, 11, etl::timer::mode::REPEATING);
+
+      test.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      const uint32_t step = 5U;
+
+      while (ticks <= 100U)
+      {
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 40, 75 };
+      std::vector<uint64_t> compare2 = { 25, 50, 70, 95 };
+      std::vector<uint64_t> compare3 = { 15, 25, 35, 45, 55, 70, 80, 90, 100 };
+
+      CHECK_EQUAL(compare1.size(), test.tick_list.size());
+      CHECK_EQUAL(compare2.size(), free_tick_list1.size());
+      CHECK_EQUAL(compare3.size(), free_tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), test.tick_list.data(),  compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_atomic_wheel_delayed_immediate_stop_start)
+    {
+      wheel_timer timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback1,        37, etl::timer::mode::REPEATING);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback1, 23, etl::timer::mode::REPEATING);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_function_callback2, 11, etl::timer::mode::REPEATING);
+
+      test.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.enable(true);
+
+      ticks = 5;
+      timer_controller.tick(uint32_t(ticks));
+
+      timer_controller.start(id1, etl::timer::start::IMMEDIATE);
+      timer_controller.start(id2, etl::timer::start::IMMEDIATE);
+      timer_controller.start(id3, etl::timer::start::DELAYED);
+
+      const uint32_t step = 1U;
+
+      while (ticks <= 100U)
+      {
+        if (ticks == 60)
+        {
+          timer_controller.stop(id2);
+        }
+
+        if (ticks == 90)
+        {
+          timer_controller.unregister_timer(id1);
+        }
+
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 6, 42, 79 };
+      std::vector<uint64_t> compare2 = { 6, 28, 51 };
+      std::vector<uint64_t> compare3 = { 16, 27, 38, 49, 60, 71, 82, 93 };
+
+      CHECK_EQUAL(compare1.size(), test.tick_list.size());
+      CHECK_EQUAL(compare2.size(), free_tick_list1.size());
+      CHECK_EQUAL(compare3.size(), free_tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), test.tick_list.data(),  compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_atomic_wheel_long_periods)
+    {
+      wheel_timer timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback1,        100000UL,     etl::timer::mode::REPEATING);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback1, 3000000000UL, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_function_callback2, 0xFFFFFFFEUL, etl::timer::mode::SINGLE_SHOT);
+
+      test.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.enable(true);
+
+      // Start part way through a cycle of every level.
+      ticks = 12345;
+      timer_controller.tick(uint32_t(ticks));
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.start(id3);
+
+      const uint32_t step = 7777777UL;
+
+      while (ticks < 12345ULL + 0xFFFFFFFFULL)
+      {
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      // Expiry is reported at the end of the tick in which it occurred.
+      auto at_tick_end = [step](uint64_t expiry)
+      {
+        return 12345ULL + (((expiry - 12345ULL) + step - 1U) / step) * step;
+      };
+
+      const uint64_t repeats = (ticks - 12345ULL) / 100000ULL;
+
+      CHECK_EQUAL(repeats, test.tick_list.size());
+      CHECK_EQUAL(at_tick_end(12345ULL + 100000ULL), test.tick_list.front());
+      CHECK_EQUAL(at_tick_end(12345ULL + (repeats * 100000ULL)), test.tick_list.back());
+
+      CHECK_EQUAL(1U, free_tick_list1.size());
+      CHECK_EQUAL(at_tick_end(12345ULL + 3000000000ULL), free_tick_list1.front());
+
+      CHECK_EQUAL(1U, free_tick_list2.size());
+      CHECK_EQUAL(at_tick_end(12345ULL + 0xFFFFFFFEULL), free_tick_list2.front());
+    }
+
+    //*************************************************************************
+    template <typename TController>
+    struct engine_recorder
+    {
+      struct fire
+      {
+        void operator()()
+        {
+          p_recorder->expired.push_back(id);
+        }
+
+        engine_recorder* p_recorder;
+        int              id;
+      };
+
+      engine_recorder()
+      {
+        controller.enable(true);
+
+        for (int i = 0; i < 16; ++i)
+        {
+          fires[i].p_recorder = this;
+          fires[i].id         = i;
+          callbacks[i]        = callback_type(fires[i]);
+        }
+      }
+
+      // The expired ids for each call to 'tick', sorted, as the order of timers that expire together may differ.
+      std::vector<int> tick(uint32_t count)
+      {
+        expired.clear();
+        controller.tick(count);
+        std::sort(expired.begin(), expired.end());
+        return expired;
+      }
+
+      TController      controller;
+      fire             fires[16];
+      callback_type    callbacks[16];
+      std::vector<int> expired;
+    };
+
+    // Runs random operations on timers using each engine and compares the expired timers.
+    template <typename TList, typename TWheel5, typename TWheel2>
+    void compare_engines(TList& list, TWheel5& wheel5, TWheel2& wheel2, uint32_t max_period, uint32_t min_repeating_period, uint32_t max_count, int steps)
+    {
+      std::mt19937 random(12345);
+
+      auto random_value = [&](uint32_t max_value)
+      {
+        return uint32_t(random() % (uint64_t(max_value) + 1U));
+      };
+
+      for (int i = 0; i < 16; ++i)
+      {
+        const uint32_t period    = random_value(max_period);
+        const bool     repeating = ((random() % 2) == 0) && (period >= min_repeating_period);
+
+        list.controller.register_timer(list.callbacks[i], period, repeating);
+        wheel5.controller.register_timer(wheel5.callbacks[i], period, repeating);
+        wheel2.controller.register_timer(wheel2.callbacks[i], period, repeating);
+      }
+
+      for (int step = 0; step < steps; ++step)
+      {
+        const etl::timer::id::type id = etl::timer::id::type(random() % 16);
+
+        switch (random() % 8)
+        {
+          case 0:
+          {
+            const bool immediate = (random() % 4) == 0;
+            CHECK_EQUAL(list.controller.start(id, immediate), wheel5.controller.start(id, immediate));
+            CHECK_EQUAL(list.controller.start(id, immediate), wheel2.controller.start(id, immediate));
+            break;
+          }
+
+          case 1:
+          {
+            list.controller.stop(id);
+            wheel5.controller.stop(id);
+            wheel2.controller.stop(id);
+            break;
+          }
+
+          case 2:
+          {
+            const uint32_t period    = random_value(max_period);
+            const bool     repeating = ((random() % 2) == 0) && (period >= min_repeating_period);
+            list.controller.set_period(id, period);
+            wheel5.controller.set_period(id, period);
+            wheel2.controller.set_period(id, period);
+            list.controller.set_mode(id, repeating);
+            wheel5.controller.set_mode(id, repeating);
+            wheel2.controller.set_mode(id, repeating);
+            break;
+          }
+
+          default:
+          {
+            const uint32_t count = random_value(((random() % 16) == 0) ? max_count : (max_count / 100U));
+            std::vector<int> expected = list.tick(count);
+            CHECK(expected == wheel5.tick(count));
+            CHECK(expected == wheel2.tick(count));
+            break;
+          }
+        }
+      }
+    }
+
+    TEST(callback_timer_atomic_wheel_matches_delta_list)
+    {
+      using list_timer   = etl::callback_timer_atomic<16, std::atomic_uint32_t>;
+      using wheel5_timer = etl::callback_timer_atomic<16, std::atomic_uint32_t, etl::timer_wheel<5>>;
+      using wheel2_timer = etl::callback_timer_atomic<16, std::atomic_uint32_t, etl::timer_wheel<2>>;
+
+      // Short periods.
+      {
+        engine_recorder<list_timer>   list;
+        engine_recorder<wheel5_timer> wheel5;
+        engine_recorder<wheel2_timer> wheel2;
+
+        compare_engines(list, wheel5, wheel2, 5000U, 20U, 20000U, 5000);
+      }
+
+      // Long periods.
+      {
+        engine_recorder<list_timer>   list;
+        engine_recorder<wheel5_timer> wheel5;
+        engine_recorder<wheel2_timer> wheel2;
+
+        compare_engines(list, wheel5, wheel2, 0xFFFFFFFEUL, 0x100000UL, 0xFFFFFFFFUL, 5000);
+      }
+    }
+
     //*************************************************************************
 #if REALTIME_TEST
 
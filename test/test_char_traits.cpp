@@ -120,6 +120,56 @@ namespace
       CHECK(int_type(char_traits::eof() + 1) == char_traits::not_eof(char_traits::eof() + 1));
     }
 
+    //*************************************************************************
+    TEST(test_char_traits_char_long_text)
+    {
+      using char_traits = etl::char_traits<char>;
+
+      // Long enough to cover whole and partial blocks.
+      char text1[100];
+      char text2[100];
+
+      for (size_t i = 0U; i < std::size(text1); ++i)
+      {
+        text1[i] = char('A' + (i % 26U));
+        text2[i] = text1[i];
+      }
+
+      text1[std::size(text1) - 1U] = 0;
+      text2[std::size(text2) - 1U] = 0;
+
+      for (size_t i = 0U; i < (std::size(text1) - 1U); ++i)
+      {
+        CHECK_EQUAL(i, char_traits::length(text1 + std::size(text1) - 1U - i));
+        CHECK(char_traits::find(text1, std::size(text1), text1[i]) == (text1 + (i % 26U)));
+        CHECK(char_traits::find(text1, i, '~') == nullptr);
+
+        // Compares as char, which may be signed.
+        text2[i] = char(0x80);
+        CHECK_EQUAL((char(0x80) < text1[i]) ? -1 : 1, char_traits::compare(text2, text1, std::size(text1)));
+        CHECK_EQUAL((char(0x80) < text1[i]) ? 1 : -1, char_traits::compare(text1, text2, std::size(text1)));
+        CHECK_EQUAL(0, char_traits::compare(text1, text2, i));
+        text2[i] = text1[i];
+      }
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_char_traits_char_constexpr)
+    {
+      using char_traits = etl::char_traits<char>;
+
+      constexpr size_t      length  = char_traits::length("ABCDEF");
+      constexpr int         compare = char_traits::compare("ABCDEE", "ABCDEF", 6U);
+      constexpr const char* text    = "ABCDEF";
+      constexpr const char* found   = char_traits::find(text, 6U, 'D');
+
+      CHECK_EQUAL(6U, length);
+      CHECK_EQUAL(-1, compare);
+      CHECK(found == (text + 3));
+    }
+#endif
+
     //*************************************************************************
     TEST(test_char_traits_wchar_t_template)
     {
@@ -181,6 +181,35 @@ namespace
       uint32_t hash3 = etl::checksum<uint32_t>(data3.rbegin(), data3.rend());
       CHECK_EQUAL(int(hash1), int(hash3));
     }
+
+    //*************************************************************************
+    TEST(test_checksum_add_range_blocks)
+    {
+      // Long runs of 0xFF check that the partial sums do not overflow.
+      std::vector<uint8_t> data(3000U, 0xFFU);
+
+      for (size_t i = 0UL; i < data.size(); i += 3U)
+      {
+        data[i] = uint8_t(i);
+      }
+
+      for (size_t length = 0UL; length <= data.size(); length += 7U)
+      {
+        uint32_t compare = 0U;
+
+        for (size_t i = 0UL; i < length; ++i)
+        {
+          compare += data[i];
+        }
+
+        uint32_t sum32 = etl::checksum<uint32_t>(data.data(), data.data() + length);
+        uint16_t sum16 = etl::checksum<uint16_t>(data.data() + 1U, data.data() + 1U + (length / 2U));
+        uint16_t compare16 = uint16_t(etl::checksum<uint16_t>(data.begin() + 1U, data.begin() + 1U + (length / 2U)));
+
+        CHECK_EQUAL(compare, sum32);
+        CHECK_EQUAL(compare16, sum16);
+      }
+    }
   };
 }
 
@@ -258,6 +258,186 @@ namespace
       uint16_t crc3 = etl::crc16_profibus_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+    //*************************************************************************
+    // Table size 2048 (slice by 8)
+    //*************************************************************************
+    TEST(test_crc16_profibus_2048)
+    {
+      std::string data("123456789");
+
+      uint16_t crc = etl::crc16_profibus_t2048(data.begin(), data.end());
+
+      CHECK_EQUAL(0xA819U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_profibus_2048_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc16_profibus_t2048 crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint16_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xA819U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_profibus_2048_add_range)
+    {
+      std::string data("123456789");
+
+      etl::crc16_profibus_t2048 crc_calculator;
+
+      crc_calculator.add(data.begin(), data.end());
+
+      uint16_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xA819U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_profibus_2048_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::crc16_profibus_t2048 crc_calculator;
+
+      std::copy(data.begin(), data.end(), crc_calculator.input());
+
+      uint16_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xA819U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_profibus_2048_add_range_endian)
+    {
+      std::vector<uint8_t>  data1 = { 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U };
+      std::vector<uint32_t> data2 = { 0x04030201UL, 0x08070605UL };
+      std::vector<uint8_t>  data3 = { 0x08U, 0x07U, 0x06U, 0x05U, 0x04U, 0x03U, 0x02U, 0x01U };
+
+      uint16_t crc1 = etl::crc16_profibus_t2048(data1.begin(), data1.end());
+      uint16_t crc2 = etl::crc16_profibus_t2048((uint8_t*)&data2[0], (uint8_t*)(&data2[0] + data2.size()));
+      CHECK_EQUAL(crc1, crc2);
+
+      uint16_t crc3 = etl::crc16_profibus_t2048(data3.rbegin(), data3.rend());
+      CHECK_EQUAL(crc1, crc3);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_profibus_2048_add_range_blocks)
+    {
+      std::vector<uint8_t> data(100U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 7U) + 1U);
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        uint16_t crc1 = etl::crc16_profibus_t256(data.begin(), data.begin() + length);
+        uint16_t crc2 = etl::crc16_profibus_t2048(data.data(), data.data() + length);
+        CHECK_EQUAL(crc1, crc2);
+      }
+    }
+
+    //*************************************************************************
+    // Table size 4096 (slice by 16)
+    //*************************************************************************
+    TEST(test_crc16_profibus_4096)
+    {
+      std::string data("123456789");
+
+      uint16_t crc = etl::crc16_profibus_t4096(data.begin(), data.end());
+
+      CHECK_EQUAL(0xA819U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_profibus_4096_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc16_profibus_t4096 crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint16_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xA819U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_profibus_4096_add_range)
+    {
+      std::string data("123456789");
+
+      etl::crc16_profibus_t4096 crc_calculator;
+
+      crc_calculator.add(data.begin(), data.end());
+
+      uint16_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xA819U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_profibus_4096_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::crc16_profibus_t4096 crc_calculator;
+
+      std::copy(data.begin(), data.end(), crc_calculator.input());
+
+      uint16_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xA819U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_profibus_4096_add_range_endian)
+    {
+      std::vector<uint8_t>  data1 = { 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U };
+      std::vector<uint32_t> data2 = { 0x04030201UL, 0x08070605UL };
+      std::vector<uint8_t>  data3 = { 0x08U, 0x07U, 0x06U, 0x05U, 0x04U, 0x03U, 0x02U, 0x01U };
+
+      uint16_t crc1 = etl::crc16_profibus_t4096(data1.begin(), data1.end());
+      uint16_t crc2 = etl::crc16_profibus_t4096((uint8_t*)&data2[0], (uint8_t*)(&data2[0] + data2.size()));
+      CHECK_EQUAL(crc1, crc2);
+
+      uint16_t crc3 = etl::crc16_profibus_t4096(data3.rbegin(), data3.rend());
+      CHECK_EQUAL(crc1, crc3);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_profibus_4096_add_range_blocks)
+    {
+      std::vector<uint8_t> data(100U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 7U) + 1U);
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        uint16_t crc1 = etl::crc16_profibus_t256(data.begin(), data.begin() + length);
+        uint16_t crc2 = etl::crc16_profibus_t4096(data.data(), data.data() + length);
+        CHECK_EQUAL(crc1, crc2);
+      }
+    }
+
   };
 }
 
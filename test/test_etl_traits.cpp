@@ -82,6 +82,7 @@ namespace
       CHECK_EQUAL(ETL_VERSION_PATCH,                           etl::traits::version_patch);
       CHECK_EQUAL(ETL_VERSION_VALUE,                           etl::traits::version);
       CHECK_EQUAL(17,                                          etl::traits::language_standard);
+      CHECK_EQUAL(ETL_CACHE_LINE_SIZE,                         etl::traits::cache_line_size);
 
       CHECK_ARRAY_EQUAL(ETL_VERSION, etl::traits::version_string,    etl::strlen(ETL_VERSION));
       CHECK_ARRAY_EQUAL(ETL_VERSION, etl::traits::version_wstring,   etl::strlen(ETL_VERSION_W));
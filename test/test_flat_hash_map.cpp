@@ -0,0 +1,668 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <random>
+#include <functional>
+#include <unordered_map>
+
+#include "data.h"
+
+#include "etl/flat_hash_map.h"
+
+namespace
+{
+  //*************************************************************************
+  struct string_hash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      return std::hash<std::string>()(text);
+    }
+  };
+
+  //*************************************************************************
+  // Hasher that forces many collisions, to create long probe runs.
+  struct colliding_hash
+  {
+    size_t operator ()(int value) const
+    {
+      return size_t(value % 5);
+    }
+  };
+
+  //*************************************************************************
+  struct CustomHashFunction
+  {
+    CustomHashFunction()
+      : id(0)
+    {
+    }
+
+    CustomHashFunction(int id_)
+      : id(id_)
+    {
+    }
+
+    size_t operator ()(int e) const
+    {
+      return size_t(e);
+    }
+
+    int id;
+  };
+
+  //*************************************************************************
+  struct CustomKeyEq
+  {
+    CustomKeyEq()
+      : id(0)
+    {
+    }
+
+    CustomKeyEq(int id_)
+      : id(id_)
+    {
+    }
+
+    bool operator ()(int lhs, int rhs) const
+    {
+      return (lhs == rhs);
+    }
+
+    int id;
+  };
+
+  //*************************************************************************
+  template <typename TMap, typename TCompare>
+  bool Check_Equal(const TMap& map, const TCompare& compare)
+  {
+    if (map.size() != compare.size())
+    {
+      return false;
+    }
+
+    size_t count = 0U;
+
+    for (typename TMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+    {
+      typename TCompare::const_iterator other = compare.find(itr->first);
+
+      if ((other == compare.end()) || (other->second != itr->second))
+      {
+        return false;
+      }
+
+      ++count;
+    }
+
+    return count == compare.size();
+  }
+
+  SUITE(test_flat_hash_map)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::flat_hash_map<std::string, int, SIZE, string_hash> Data;
+    typedef etl::iflat_hash_map<std::string, int, string_hash>      IData;
+    typedef std::unordered_map<std::string, int>                    Compare_Data;
+
+    using ItemM = TestDataM<int>;
+    using DataM = etl::flat_hash_map<std::string, ItemM, SIZE, string_hash>;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.cbegin() == data.cend());
+
+      // The slot count is a power of 2 and keeps the load factor at or below 7/8.
+      CHECK_EQUAL(0U, data.bucket_count() & (data.bucket_count() - 1U));
+      CHECK(data.bucket_count() > SIZE);
+      CHECK(Data::MAX_SLOTS == data.bucket_count());
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator)
+    {
+      Data data;
+
+      data["A"] = 1;
+      data["B"] = 2;
+      data["C"] = 3;
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, data["A"]);
+      CHECK_EQUAL(2, data["B"]);
+      CHECK_EQUAL(3, data["C"]);
+
+      // Default constructs a new value.
+      CHECK_EQUAL(0, data["D"]);
+      CHECK_EQUAL(4U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator_full)
+    {
+      Data data;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        data[std::to_string(i)] = int(i);
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.available());
+
+      // Existing keys are still accessible.
+      CHECK_EQUAL(5, data["5"]);
+
+      CHECK_THROW(data["X"], etl::flat_hash_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Data data;
+      const Data& cdata = data;
+
+      data.insert(Data::value_type("A", 1));
+      data.insert(Data::value_type("B", 2));
+
+      CHECK_EQUAL(1, data.at("A"));
+      CHECK_EQUAL(2, cdata.at("B"));
+
+      data.at("A") = 10;
+      CHECK_EQUAL(10, cdata.at("A"));
+
+      CHECK_THROW(data.at("C"), etl::flat_hash_map_out_of_range);
+      CHECK_THROW(cdata.at("C"), etl::flat_hash_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_insert)
+    {
+      Data data;
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(Data::value_type("A", 1));
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("A"), result.first->first);
+      CHECK_EQUAL(1, result.first->second);
+
+      // Duplicate keys are not inserted.
+      result = data.insert(Data::value_type("A", 2));
+      CHECK(!result.second);
+      CHECK_EQUAL(1, result.first->second);
+      CHECK_EQUAL(1U, data.size());
+
+      Data::iterator itr = data.insert(data.begin(), Data::value_type("B", 2));
+      CHECK_EQUAL(std::string("B"), itr->first);
+      CHECK_EQUAL(2U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range)
+    {
+      Compare_Data compare;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        compare[std::to_string(i)] = i;
+      }
+
+      Data data;
+      data.insert(compare.begin(), compare.end());
+
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_full)
+    {
+      Data data;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        data.insert(Data::value_type(std::to_string(i), int(i)));
+      }
+
+      // Existing keys do not throw.
+      CHECK_NO_THROW(data.insert(Data::value_type("0", 0)));
+
+      CHECK_THROW(data.insert(Data::value_type("X", 0)), etl::flat_hash_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_moveable)
+    {
+      DataM data;
+
+      data.insert(DataM::value_type("A", ItemM(1)));
+      data.insert(DataM::value_type("B", ItemM(2)));
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(1, data.at("A").value);
+      CHECK_EQUAL(2, data.at("B").value);
+      CHECK(bool(data.at("A")));
+    }
+
+    //*************************************************************************
+    TEST(test_find_count_contains)
+    {
+      Data data;
+      const Data& cdata = data;
+
+      data["A"] = 1;
+      data["B"] = 2;
+
+      CHECK(data.find("A") != data.end());
+      CHECK_EQUAL(1, data.find("A")->second);
+      CHECK(cdata.find("B") != cdata.end());
+      CHECK(data.find("C") == data.end());
+      CHECK(cdata.find("C") == cdata.end());
+
+      CHECK_EQUAL(1U, data.count("A"));
+      CHECK_EQUAL(0U, data.count("C"));
+
+      CHECK(data.contains("B"));
+      CHECK(!data.contains("C"));
+    }
+
+    //*************************************************************************
+    TEST(test_equal_range)
+    {
+      Data data;
+      const Data& cdata = data;
+
+      data["A"] = 1;
+      data["B"] = 2;
+
+      ETL_OR_STD::pair<Data::iterator, Data::iterator> result = data.equal_range("A");
+      CHECK_EQUAL(1, std::distance(result.first, result.second));
+      CHECK_EQUAL(std::string("A"), result.first->first);
+
+      ETL_OR_STD::pair<Data::const_iterator, Data::const_iterator> cresult = cdata.equal_range("C");
+      CHECK(cresult.first == cdata.end());
+      CHECK(cresult.second == cdata.end());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      Data data;
+
+      data["A"] = 1;
+      data["B"] = 2;
+      data["C"] = 3;
+
+      CHECK_EQUAL(1U, data.erase("B"));
+      CHECK_EQUAL(0U, data.erase("B"));
+      CHECK_EQUAL(2U, data.size());
+      CHECK(!data.contains("B"));
+      CHECK(data.contains("A"));
+      CHECK(data.contains("C"));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_while_iterating)
+    {
+      typedef etl::flat_hash_map<int, int, 100, colliding_hash> DataC;
+
+      DataC data;
+      std::map<int, int> compare;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data[i] = i;
+        compare[i] = i;
+      }
+
+      // Erase the odd keys, visiting every element exactly once.
+      size_t visited = 0U;
+
+      DataC::iterator itr = data.begin();
+
+      while (itr != data.end())
+      {
+        ++visited;
+
+        if ((itr->first % 2) != 0)
+        {
+          compare.erase(itr->first);
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(100U, visited);
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[std::to_string(i)] = i;
+      }
+
+      Data::iterator first = data.begin();
+      std::advance(first, 2);
+      Data::iterator last = first;
+      std::advance(last, 5);
+
+      std::vector<std::string> erased;
+
+      for (Data::iterator itr = first; itr != last; ++itr)
+      {
+        erased.push_back(itr->first);
+      }
+
+      std::vector<std::string> remaining;
+      Data::iterator after = last;
+
+      for (; after != data.end(); ++after)
+      {
+        remaining.push_back(after->first);
+      }
+
+      Data::iterator itr = data.erase(first, last);
+
+      CHECK_EQUAL(SIZE - 5U, data.size());
+
+      for (size_t i = 0U; i < erased.size(); ++i)
+      {
+        CHECK(!data.contains(erased[i]));
+      }
+
+      // The returned iterator visits all of the elements that followed the range.
+      std::vector<std::string> visited;
+
+      for (; itr != data.end(); ++itr)
+      {
+        visited.push_back(itr->first);
+      }
+
+      std::sort(visited.begin(), visited.end());
+      std::sort(remaining.begin(), remaining.end());
+
+      CHECK(visited == remaining);
+
+      itr = data.erase(data.begin(), data.end());
+      CHECK(itr == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      DataM data;
+
+      ItemM::reset_instance_count();
+
+      data.insert(DataM::value_type("A", ItemM(1)));
+      data.insert(DataM::value_type("B", ItemM(2)));
+
+      CHECK_EQUAL(2, ItemM::get_instance_count());
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+      CHECK_EQUAL(0, ItemM::get_instance_count());
+
+      data.insert(DataM::value_type("C", ItemM(3)));
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_destructor)
+    {
+      ItemM::reset_instance_count();
+
+      {
+        DataM data;
+
+        for (int i = 0; i < int(SIZE); ++i)
+        {
+          data.insert(DataM::value_type(std::to_string(i), ItemM(i)));
+        }
+
+        data.erase("3");
+        data.erase("7");
+
+        CHECK_EQUAL(int(SIZE - 2U), ItemM::get_instance_count());
+      }
+
+      CHECK_EQUAL(0, ItemM::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_constructor_and_assignment)
+    {
+      Data data;
+
+      data["A"] = 1;
+      data["B"] = 2;
+
+      Data data2(data);
+      CHECK(data2 == data);
+
+      Data data3;
+      data3["C"] = 3;
+      data3 = data;
+      CHECK(data3 == data);
+
+      IData& idata3 = data3;
+      idata3 = idata3;
+      CHECK(data3 == data);
+
+      data3["C"] = 3;
+      CHECK(data3 != data);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      DataM data1;
+
+      data1.insert(DataM::value_type("A", ItemM(1)));
+      data1.insert(DataM::value_type("B", ItemM(2)));
+
+      DataM data2(std::move(data1));
+
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(1, data2.at("A").value);
+      CHECK(!bool(data1.at("A")));
+
+      DataM data3;
+      data3.insert(DataM::value_type("C", ItemM(3)));
+      data3 = std::move(data2);
+
+      CHECK_EQUAL(2U, data3.size());
+      CHECK_EQUAL(2, data3.at("B").value);
+      CHECK(!data3.contains("C"));
+    }
+
+    //*************************************************************************
+    TEST(test_initializer_list_and_make)
+    {
+      Data data = { Data::value_type("A", 1), Data::value_type("B", 2) };
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(2, data["B"]);
+
+      auto data2 = etl::make_flat_hash_map<int, int>(std::pair<int, int>(1, 10), std::pair<int, int>(2, 20), std::pair<int, int>(3, 30));
+
+      CHECK_EQUAL(3U, data2.max_size());
+      CHECK_EQUAL(30, data2.at(3));
+
+#if ETL_USING_CPP17
+      etl::flat_hash_map data3{ std::pair<int, int>(1, 10), std::pair<int, int>(2, 20) };
+
+      CHECK_EQUAL(2U, data3.max_size());
+      CHECK_EQUAL(20, data3.at(2));
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      typedef etl::flat_hash_map_ext<int, int> DataExt;
+
+      static const size_t Slots = 16U;
+
+      typename etl::aligned_storage<sizeof(DataExt::value_type) * Slots, etl::alignment_of<DataExt::value_type>::value>::type slots;
+      uint8_t control[Slots + DataExt::Group_Width - 1U];
+
+      CHECK_EQUAL(sizeof(control), DataExt::control_size(Slots));
+
+      DataExt data(&slots, control, Slots);
+
+      CHECK_EQUAL(14U, data.max_size());
+      CHECK_EQUAL(Slots, data.bucket_count());
+
+      for (int i = 0; i < 14; ++i)
+      {
+        data[i] = i * 10;
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data[100], etl::flat_hash_map_full);
+
+      typename etl::aligned_storage<sizeof(DataExt::value_type) * Slots, etl::alignment_of<DataExt::value_type>::value>::type slots2;
+      uint8_t control2[Slots + DataExt::Group_Width - 1U];
+
+      DataExt data2(data, &slots2, control2, Slots);
+      CHECK(data2 == data);
+
+      data2.erase(5);
+      CHECK(data2 != data);
+      CHECK_EQUAL(50, data.at(5));
+    }
+
+    //*************************************************************************
+    TEST(test_ext_invalid_size)
+    {
+      typedef etl::flat_hash_map_ext<int, int> DataExt;
+
+      typename etl::aligned_storage<sizeof(DataExt::value_type) * 12U, etl::alignment_of<DataExt::value_type>::value>::type slots;
+      uint8_t control[12U + DataExt::Group_Width - 1U];
+
+      CHECK_THROW(DataExt(&slots, control, 12U), etl::flat_hash_map_invalid_size);
+    }
+
+    //*************************************************************************
+    TEST(test_copying_of_hash_and_key_compare)
+    {
+      typedef etl::flat_hash_map<int, int, SIZE, CustomHashFunction, CustomKeyEq> DataCustom;
+
+      DataCustom data1(CustomHashFunction(1), CustomKeyEq(2));
+      DataCustom data2(data1);
+
+      CHECK_EQUAL(1, data2.hash_function().id);
+      CHECK_EQUAL(2, data2.key_eq().id);
+
+      DataCustom data3(CustomHashFunction(3), CustomKeyEq(4));
+      data3 = data1;
+
+      CHECK_EQUAL(1, data3.hash_function().id);
+      CHECK_EQUAL(2, data3.key_eq().id);
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_against_std)
+    {
+      typedef etl::flat_hash_map<int, int, 200, colliding_hash> DataC;
+      typedef etl::flat_hash_map<int, int, 200>                 DataI;
+
+      std::mt19937 generator(12345);
+      std::uniform_int_distribution<int> key_distribution(0, 300);
+      std::uniform_int_distribution<int> operation_distribution(0, 9);
+
+      DataC data_c;
+      DataI data_i;
+      std::unordered_map<int, int> compare;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const int key = key_distribution(generator);
+        const int operation = operation_distribution(generator);
+
+        if (operation < 5)
+        {
+          if (compare.size() < 200U)
+          {
+            compare[key] = i;
+            data_c[key]  = i;
+            data_i[key]  = i;
+          }
+        }
+        else if (operation < 9)
+        {
+          const size_t n = compare.erase(key);
+
+          CHECK_EQUAL(n, data_c.erase(key));
+          CHECK_EQUAL(n, data_i.erase(key));
+        }
+        else
+        {
+          CHECK_EQUAL(compare.count(key), data_c.count(key));
+          CHECK_EQUAL(compare.count(key), data_i.count(key));
+        }
+
+        if ((i % 500) == 0)
+        {
+          CHECK(Check_Equal(data_c, compare));
+          CHECK(Check_Equal(data_i, compare));
+        }
+      }
+
+      CHECK(Check_Equal(data_c, compare));
+      CHECK(Check_Equal(data_i, compare));
+    }
+  };
+}
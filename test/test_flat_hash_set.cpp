@@ -0,0 +1,388 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <random>
+#include <functional>
+#include <unordered_set>
+
+#include "data.h"
+
+#include "etl/flat_hash_set.h"
+
+namespace
+{
+  //*************************************************************************
+  struct string_hash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      return std::hash<std::string>()(text);
+    }
+  };
+
+  //*************************************************************************
+  // Hasher that forces many collisions, to create long probe runs.
+  struct colliding_hash
+  {
+    size_t operator ()(int value) const
+    {
+      return size_t(value % 5);
+    }
+  };
+
+  //*************************************************************************
+  template <typename TSet, typename TCompare>
+  bool Check_Equal(const TSet& set, const TCompare& compare)
+  {
+    if (set.size() != compare.size())
+    {
+      return false;
+    }
+
+    size_t count = 0U;
+
+    for (typename TSet::const_iterator itr = set.begin(); itr != set.end(); ++itr)
+    {
+      if (compare.count(*itr) == 0U)
+      {
+        return false;
+      }
+
+      ++count;
+    }
+
+    return count == compare.size();
+  }
+
+  SUITE(test_flat_hash_set)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::flat_hash_set<std::string, SIZE, string_hash> Data;
+    typedef etl::iflat_hash_set<std::string, string_hash>      IData;
+    typedef std::unordered_set<std::string>                    Compare_Data;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK_EQUAL(0U, data.bucket_count() & (data.bucket_count() - 1U));
+      CHECK(data.bucket_count() > SIZE);
+    }
+
+    //*************************************************************************
+    TEST(test_insert)
+    {
+      Data data;
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(std::string("A"));
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("A"), *result.first);
+
+      // Duplicate keys are not inserted.
+      result = data.insert(std::string("A"));
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("A"), *result.first);
+      CHECK_EQUAL(1U, data.size());
+
+      Data::iterator itr = data.insert(data.begin(), std::string("B"));
+      CHECK_EQUAL(std::string("B"), *itr);
+      CHECK_EQUAL(2U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_and_full)
+    {
+      Compare_Data compare;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        compare.insert(std::to_string(i));
+      }
+
+      Data data;
+      data.insert(compare.begin(), compare.end());
+
+      CHECK(data.full());
+      CHECK(Check_Equal(data, compare));
+
+      // Existing keys do not throw.
+      CHECK_NO_THROW(data.insert(std::string("0")));
+
+      CHECK_THROW(data.insert(std::string("X")), etl::flat_hash_set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_find_count_contains)
+    {
+      Data data;
+      const Data& cdata = data;
+
+      data.insert(std::string("A"));
+      data.insert(std::string("B"));
+
+      CHECK(data.find("A") != data.end());
+      CHECK(cdata.find("B") != cdata.end());
+      CHECK(data.find("C") == data.end());
+
+      CHECK_EQUAL(1U, data.count("A"));
+      CHECK_EQUAL(0U, data.count("C"));
+
+      CHECK(data.contains("B"));
+      CHECK(!data.contains("C"));
+
+      ETL_OR_STD::pair<Data::iterator, Data::iterator> range = data.equal_range("A");
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Data data;
+
+      data.insert(std::string("A"));
+      data.insert(std::string("B"));
+      data.insert(std::string("C"));
+
+      CHECK_EQUAL(1U, data.erase("B"));
+      CHECK_EQUAL(0U, data.erase("B"));
+      CHECK_EQUAL(2U, data.size());
+
+      Data::iterator itr = data.erase(data.find("A"));
+      CHECK(itr == data.end() || *itr == "C");
+      CHECK_EQUAL(1U, data.size());
+
+      itr = data.erase(data.begin(), data.end());
+      CHECK(itr == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_while_iterating)
+    {
+      typedef etl::flat_hash_set<int, 100, colliding_hash> DataC;
+
+      DataC data;
+      std::set<int> compare;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data.insert(i);
+        compare.insert(i);
+      }
+
+      // Erase every third key, visiting every element exactly once.
+      size_t visited = 0U;
+
+      DataC::iterator itr = data.begin();
+
+      while (itr != data.end())
+      {
+        ++visited;
+
+        if ((*itr % 3) == 0)
+        {
+          compare.erase(*itr);
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(100U, visited);
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Data data;
+
+      data.insert(std::string("A"));
+      data.insert(std::string("B"));
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      data.insert(std::string("C"));
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      Data data;
+
+      data.insert(std::string("A"));
+      data.insert(std::string("B"));
+
+      Data data2(data);
+      CHECK(data2 == data);
+
+      Data data3;
+      data3.insert(std::string("C"));
+      data3 = data;
+      CHECK(data3 == data);
+
+      IData& idata3 = data3;
+      idata3 = idata3;
+      CHECK(data3 == data);
+
+      data3.insert(std::string("C"));
+      CHECK(data3 != data);
+
+      Data data4(std::move(data3));
+      CHECK_EQUAL(3U, data4.size());
+      CHECK(data4.contains("C"));
+
+      data2 = std::move(data4);
+      CHECK_EQUAL(3U, data2.size());
+    }
+
+    //*************************************************************************
+    TEST(test_initializer_list_and_make)
+    {
+      Data data = { std::string("A"), std::string("B") };
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK(data.contains("B"));
+
+      auto data2 = etl::make_flat_hash_set<int>(1, 2, 3);
+
+      CHECK_EQUAL(3U, data2.max_size());
+      CHECK(data2.contains(3));
+
+#if ETL_USING_CPP17
+      etl::flat_hash_set data3{ 1, 2 };
+
+      CHECK_EQUAL(2U, data3.max_size());
+      CHECK(data3.contains(2));
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      typedef etl::flat_hash_set_ext<int> DataExt;
+
+      static const size_t Slots = 8U;
+
+      typename etl::aligned_storage<sizeof(int) * Slots, etl::alignment_of<int>::value>::type slots;
+      uint8_t control[Slots + DataExt::Group_Width - 1U];
+
+      DataExt data(&slots, control, Slots);
+
+      CHECK_EQUAL(7U, data.max_size());
+
+      for (int i = 0; i < 7; ++i)
+      {
+        data.insert(i);
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.insert(100), etl::flat_hash_set_full);
+
+      for (int i = 0; i < 7; ++i)
+      {
+        CHECK(data.contains(i));
+      }
+
+    }
+
+    //*************************************************************************
+    TEST(test_ext_invalid_size)
+    {
+      typedef etl::flat_hash_set_ext<int> DataExt;
+
+      typename etl::aligned_storage<sizeof(int) * 6U, etl::alignment_of<int>::value>::type slots;
+      uint8_t control[6U + DataExt::Group_Width - 1U];
+
+      CHECK_THROW(DataExt(&slots, control, 6U), etl::flat_hash_set_invalid_size);
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_against_std)
+    {
+      typedef etl::flat_hash_set<int, 200, colliding_hash> DataC;
+
+      std::mt19937 generator(54321);
+      std::uniform_int_distribution<int> key_distribution(0, 300);
+      std::uniform_int_distribution<int> operation_distribution(0, 2);
+
+      DataC data;
+      std::unordered_set<int> compare;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const int key = key_distribution(generator);
+
+        switch (operation_distribution(generator))
+        {
+          case 0:
+          {
+            if (compare.size() < 200U)
+            {
+              CHECK_EQUAL(compare.insert(key).second, data.insert(key).second);
+            }
+            break;
+          }
+
+          case 1:
+          {
+            CHECK_EQUAL(compare.erase(key), data.erase(key));
+            break;
+          }
+
+          default:
+          {
+            CHECK_EQUAL(compare.count(key), data.count(key));
+            break;
+          }
+        }
+      }
+
+      CHECK(Check_Equal(data, compare));
+    }
+  };
+}
@@ -55,6 +55,9 @@ namespace
       CHECK_EQUAL(true,  format.is_right());
       CHECK_EQUAL(false, format.is_show_base());
       CHECK_EQUAL(false, format.is_upper_case());
+      CHECK_EQUAL(true,  format.is_fixed());
+      CHECK_EQUAL(false, format.is_scientific());
+      CHECK_EQUAL(false, format.is_shortest());
     }
 
     //*************************************************************************
@@ -116,6 +119,32 @@ namespace
       CHECK_EQUAL(true,  show_base);
       CHECK_EQUAL(true,  upper_case);
     }
+
+    //*************************************************************************
+    TEST(test_floating_point_format)
+    {
+      etl::format_spec format;
+
+      format.scientific();
+      CHECK_EQUAL(false, format.is_fixed());
+      CHECK_EQUAL(true,  format.is_scientific());
+      CHECK_EQUAL(false, format.is_shortest());
+      CHECK_EQUAL(int(etl::floating_point_format::Scientific), int(format.get_floating_point_format()));
+
+      format.shortest();
+      CHECK_EQUAL(false, format.is_fixed());
+      CHECK_EQUAL(false, format.is_scientific());
+      CHECK_EQUAL(true,  format.is_shortest());
+      CHECK(format != etl::format_spec());
+
+      format.fixed();
+      CHECK_EQUAL(true,  format.is_fixed());
+      CHECK(format == etl::format_spec());
+
+      format.shortest();
+      format.clear();
+      CHECK_EQUAL(true, format.is_fixed());
+    }
   };
 }
 
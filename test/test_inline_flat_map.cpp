@@ -0,0 +1,638 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <random>
+#include <functional>
+
+#include "data.h"
+
+#include "etl/inline_flat_map.h"
+
+namespace
+{
+  //*************************************************************************
+  template <typename TMap, typename TCompare>
+  bool Check_Equal(const TMap& map, const TCompare& compare)
+  {
+    if (map.size() != compare.size())
+    {
+      return false;
+    }
+
+    typename TMap::const_iterator     itr   = map.begin();
+    typename TCompare::const_iterator other = compare.begin();
+
+    while (itr != map.end())
+    {
+      if ((itr->first != other->first) || (itr->second != other->second))
+      {
+        return false;
+      }
+
+      ++itr;
+      ++other;
+    }
+
+    return true;
+  }
+
+  SUITE(test_inline_flat_map)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::inline_flat_map<std::string, int, SIZE>      Data;
+    typedef etl::iinline_flat_map<std::string, int>           IData;
+    typedef etl::inline_flat_multimap<std::string, int, SIZE> MData;
+    typedef std::map<std::string, int>                        Compare_Data;
+
+    using ItemM = TestDataM<int>;
+    using DataM = etl::inline_flat_map<std::string, ItemM, SIZE>;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.cbegin() == data.cend());
+      CHECK(data.rbegin() == data.rend());
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator)
+    {
+      Data data;
+
+      data["C"] = 3;
+      data["A"] = 1;
+      data["B"] = 2;
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, data["A"]);
+      CHECK_EQUAL(2, data["B"]);
+      CHECK_EQUAL(3, data["C"]);
+
+      // Default constructs a new value.
+      CHECK_EQUAL(0, data["D"]);
+      CHECK_EQUAL(4U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator_full)
+    {
+      Data data;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        data[std::to_string(i)] = int(i);
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.available());
+
+      // Existing keys are still accessible.
+      CHECK_EQUAL(5, data["5"]);
+
+      CHECK_THROW(data["X"], etl::inline_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Data data;
+      const Data& cdata = data;
+
+      data.insert(Data::value_type("A", 1));
+      data.insert(Data::value_type("B", 2));
+
+      CHECK_EQUAL(1, data.at("A"));
+      CHECK_EQUAL(2, cdata.at("B"));
+
+      data.at("A") = 10;
+      CHECK_EQUAL(10, cdata.at("A"));
+
+      CHECK_THROW(data.at("C"), etl::inline_flat_map_out_of_range);
+      CHECK_THROW(cdata.at("C"), etl::inline_flat_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_insert)
+    {
+      Data data;
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(Data::value_type("B", 2));
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("B"), result.first->first);
+      CHECK_EQUAL(2, result.first->second);
+
+      // Duplicate keys are not inserted.
+      result = data.insert(Data::value_type("B", 3));
+      CHECK(!result.second);
+      CHECK_EQUAL(2, result.first->second);
+      CHECK_EQUAL(1U, data.size());
+
+      Data::iterator itr = data.insert(data.begin(), Data::value_type("A", 1));
+      CHECK_EQUAL(std::string("A"), itr->first);
+      CHECK_EQUAL(2U, data.size());
+
+      // Kept in key order.
+      CHECK(data.begin() == itr);
+      CHECK_EQUAL(std::string("B"), (itr + 1)->first);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range)
+    {
+      std::vector<std::pair<std::string, int>> values = { {"E", 5}, {"B", 2}, {"D", 4}, {"A", 1}, {"C", 3}, {"B", 6} };
+
+      Data data;
+      data.insert(values.begin(), values.end());
+
+      Compare_Data compare(values.begin(), values.end());
+
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_full)
+    {
+      Data data;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        data.insert(Data::value_type(std::to_string(i), int(i)));
+      }
+
+      // An existing key does not need space.
+      CHECK(!data.insert(Data::value_type("0", 0)).second);
+
+      CHECK_THROW(data.insert(Data::value_type("X", 0)), etl::inline_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_moveable)
+    {
+      DataM data;
+
+      data.insert(DataM::value_type("B", ItemM(2)));
+      data.insert(DataM::value_type("A", ItemM(1)));
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(1, data.at("A").value);
+      CHECK_EQUAL(2, data.at("B").value);
+
+      data.emplace("C", 3);
+      CHECK_EQUAL(3, data.at("C").value);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_or_assign_and_emplace)
+    {
+      Data data;
+
+      CHECK(data.insert_or_assign("A", 1).second);
+      CHECK(!data.insert_or_assign("A", 2).second);
+      CHECK_EQUAL(2, data["A"]);
+
+      CHECK(data.emplace("B", 3).second);
+      CHECK(!data.emplace("B", 4).second);
+      CHECK_EQUAL(3, data["B"]);
+    }
+
+    //*************************************************************************
+    TEST(test_find_count_contains)
+    {
+      Data data;
+      const Data& cdata = data;
+
+      data["A"] = 1;
+      data["C"] = 3;
+      data["E"] = 5;
+
+      CHECK(data.find("C") != data.end());
+      CHECK_EQUAL(3, data.find("C")->second);
+      CHECK(cdata.find("C") != cdata.end());
+      CHECK(data.find("B") == data.end());
+      CHECK(cdata.find("F") == cdata.end());
+
+      CHECK_EQUAL(1U, data.count("A"));
+      CHECK_EQUAL(0U, data.count("D"));
+
+      CHECK(data.contains("E"));
+      CHECK(!data.contains("0"));
+    }
+
+    //*************************************************************************
+    TEST(test_bounds)
+    {
+      Data data;
+      const Data& cdata = data;
+
+      data["B"] = 2;
+      data["D"] = 4;
+
+      CHECK_EQUAL(std::string("B"), data.lower_bound("A")->first);
+      CHECK_EQUAL(std::string("B"), data.lower_bound("B")->first);
+      CHECK_EQUAL(std::string("D"), data.upper_bound("B")->first);
+      CHECK_EQUAL(std::string("D"), cdata.lower_bound("C")->first);
+      CHECK(cdata.upper_bound("D") == cdata.end());
+
+      ETL_OR_STD::pair<Data::iterator, Data::iterator> range = data.equal_range("D");
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(4, range.first->second);
+
+      ETL_OR_STD::pair<Data::const_iterator, Data::const_iterator> crange = cdata.equal_range("C");
+      CHECK(crange.first == crange.second);
+    }
+
+    //*************************************************************************
+    TEST(test_search_against_std)
+    {
+      // Checks every length, including those that are not powers of 2, and keys between and outside the elements.
+      for (size_t length = 0U; length < 40U; ++length)
+      {
+        std::vector<int> keys;
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          keys.push_back(int(i / 3U) * 2);
+        }
+
+        for (int key = -2; key < int(length); ++key)
+        {
+          const size_t lower = etl::private_inline_flat::lower_bound_index(keys.data(), keys.size(), key, etl::less<int>());
+          const size_t upper = etl::private_inline_flat::upper_bound_index(keys.data(), keys.size(), key, etl::less<int>());
+
+          CHECK_EQUAL(size_t(std::lower_bound(keys.begin(), keys.end(), key) - keys.begin()), lower);
+          CHECK_EQUAL(size_t(std::upper_bound(keys.begin(), keys.end(), key) - keys.begin()), upper);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      Data data;
+
+      data["A"] = 1;
+      data["B"] = 2;
+      data["C"] = 3;
+
+      CHECK_EQUAL(1U, data.erase("B"));
+      CHECK_EQUAL(0U, data.erase("B"));
+      CHECK_EQUAL(2U, data.size());
+      CHECK(!data.contains("B"));
+      CHECK_EQUAL(3, data["C"]);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator_and_range)
+    {
+      Data data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data[std::to_string(i)] = i;
+      }
+
+      Data::iterator itr = data.erase(data.find("3"));
+      CHECK_EQUAL(std::string("4"), itr->first);
+      CHECK_EQUAL(7U, data.size());
+
+      itr = data.erase(data.find("1"), data.find("5"));
+      CHECK_EQUAL(std::string("5"), itr->first);
+      CHECK_EQUAL(4U, data.size());
+
+      Compare_Data compare = { {"0", 0}, {"5", 5}, {"6", 6}, {"7", 7} };
+      CHECK(Check_Equal(data, compare));
+
+      itr = data.erase(data.begin(), data.end());
+      CHECK(itr == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_keys_and_values)
+    {
+      Data data;
+
+      data["C"] = 3;
+      data["A"] = 1;
+      data["B"] = 2;
+
+      etl::span<const std::string> keys = data.keys();
+      etl::span<int>               values = data.values();
+
+      CHECK_EQUAL(3U, keys.size());
+      CHECK_EQUAL(3U, values.size());
+      CHECK_EQUAL(std::string("A"), keys[0]);
+      CHECK_EQUAL(std::string("C"), keys[2]);
+      CHECK_EQUAL(1, values[0]);
+      CHECK_EQUAL(3, values[2]);
+
+      // The arrays are contiguous.
+      CHECK_EQUAL(&keys[0] + 1, &keys[1]);
+      CHECK_EQUAL(&values[0] + 1, &values[1]);
+
+      values[1] = 20;
+      CHECK_EQUAL(20, data["B"]);
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      Data data;
+
+      data["A"] = 1;
+      data["B"] = 2;
+      data["C"] = 3;
+
+      Data::iterator itr = data.begin();
+
+      itr->second = 10;
+      (*itr).second += 1;
+      CHECK_EQUAL(11, data["A"]);
+
+      Data::const_iterator citr = itr;
+      CHECK(citr == data.cbegin());
+
+      CHECK_EQUAL(3, data.end() - data.begin());
+      CHECK_EQUAL(std::string("C"), data.begin()[2].first);
+      CHECK(data.begin() < data.end());
+      CHECK(++itr == data.begin() + 1);
+      CHECK(itr-- == data.begin() + 1);
+      CHECK(itr == data.begin());
+
+      std::pair<std::string, int> value = *data.begin();
+      CHECK_EQUAL(std::string("A"), value.first);
+      CHECK_EQUAL(11, value.second);
+
+      std::vector<std::string> reversed;
+
+      for (Data::reverse_iterator ritr = data.rbegin(); ritr != data.rend(); ++ritr)
+      {
+        reversed.push_back((*ritr).first);
+      }
+
+      CHECK((reversed == std::vector<std::string>{ "C", "B", "A" }));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      ItemM::reset_instance_count();
+
+      DataM data;
+
+      data.insert(DataM::value_type("A", ItemM(1)));
+      data.insert(DataM::value_type("B", ItemM(2)));
+      CHECK_EQUAL(2, ItemM::get_instance_count());
+
+      data.clear();
+      CHECK(data.empty());
+      CHECK_EQUAL(0, ItemM::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_destructor)
+    {
+      ItemM::reset_instance_count();
+
+      {
+        DataM data;
+
+        for (int i = 0; i < int(SIZE); ++i)
+        {
+          data.insert(DataM::value_type(std::to_string(SIZE - i), ItemM(i)));
+        }
+
+        data.erase("3");
+        data.erase(data.begin());
+
+        CHECK_EQUAL(int(SIZE - 2U), ItemM::get_instance_count());
+      }
+
+      CHECK_EQUAL(0, ItemM::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_constructor_and_assignment)
+    {
+      Data data;
+
+      data["A"] = 1;
+      data["B"] = 2;
+
+      Data data2(data);
+      CHECK(data2 == data);
+
+      Data data3;
+      data3["C"] = 3;
+      data3 = data;
+      CHECK(data3 == data);
+
+      IData& idata3 = data3;
+      idata3 = idata3;
+      CHECK(data3 == data);
+
+      data3["C"] = 3;
+      CHECK(data3 != data);
+
+      data3.erase("C");
+      data3["B"] = 4;
+      CHECK(data3 != data);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      DataM data1;
+
+      data1.insert(DataM::value_type("A", ItemM(1)));
+      data1.insert(DataM::value_type("B", ItemM(2)));
+
+      DataM data2(std::move(data1));
+
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(1, data2.at("A").value);
+      CHECK(data1.empty());
+
+      DataM data3;
+      data3.insert(DataM::value_type("C", ItemM(3)));
+      data3 = std::move(data2);
+
+      CHECK_EQUAL(2U, data3.size());
+      CHECK_EQUAL(2, data3.at("B").value);
+      CHECK(!data3.contains("C"));
+    }
+
+    //*************************************************************************
+    TEST(test_initializer_list_and_make)
+    {
+      Data data = { Data::value_type("B", 2), Data::value_type("A", 1) };
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("A"), data.begin()->first);
+
+      auto data2 = etl::make_inline_flat_map<int, int>(std::pair<int, int>(3, 30), std::pair<int, int>(1, 10), std::pair<int, int>(2, 20));
+
+      CHECK_EQUAL(3U, data2.max_size());
+      CHECK_EQUAL(10, data2.begin()->second);
+
+#if ETL_USING_CPP17
+      etl::inline_flat_map data3{ std::pair<int, int>(1, 10), std::pair<int, int>(2, 20) };
+
+      CHECK_EQUAL(2U, data3.max_size());
+      CHECK_EQUAL(20, data3.at(2));
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_key_compare)
+    {
+      typedef etl::inline_flat_map<int, int, 10, etl::greater<int>> DataG;
+
+      DataG data;
+
+      data[1] = 1;
+      data[3] = 3;
+      data[2] = 2;
+
+      CHECK_EQUAL(3, data.begin()->first);
+      CHECK_EQUAL(1, (data.end() - 1)->first);
+      CHECK_EQUAL(2, data.lower_bound(2)->first);
+      CHECK_EQUAL(1, data.upper_bound(2)->first);
+    }
+
+    //*************************************************************************
+    TEST(test_multimap_insert)
+    {
+      MData data;
+
+      data.insert(MData::value_type("B", 1));
+      data.insert(MData::value_type("A", 2));
+      data.insert(MData::value_type("B", 3));
+      data.emplace("B", 4);
+      data.insert(data.begin(), MData::value_type("C", 5));
+
+      CHECK_EQUAL(5U, data.size());
+      CHECK_EQUAL(3U, data.count("B"));
+
+      // Equal keys are kept in insertion order.
+      ETL_OR_STD::pair<MData::iterator, MData::iterator> range = data.equal_range("B");
+      CHECK_EQUAL(3, std::distance(range.first, range.second));
+      CHECK_EQUAL(1, range.first[0].second);
+      CHECK_EQUAL(3, range.first[1].second);
+      CHECK_EQUAL(4, range.first[2].second);
+
+      CHECK_EQUAL(3U, data.erase("B"));
+      CHECK_EQUAL(2U, data.size());
+
+      MData data2(data);
+      CHECK(data2 == data);
+
+      data2.insert(MData::value_type("C", 5));
+      CHECK(data2 != data);
+
+      for (size_t i = data2.size(); i < SIZE; ++i)
+      {
+        data2.insert(MData::value_type("D", 0));
+      }
+
+      CHECK_THROW(data2.insert(MData::value_type("D", 0)), etl::inline_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_against_std)
+    {
+      typedef etl::inline_flat_map<int, int, 200>      DataI;
+      typedef etl::inline_flat_multimap<int, int, 200> MDataI;
+
+      std::mt19937 generator(12345);
+      std::uniform_int_distribution<int> key_distribution(0, 300);
+      std::uniform_int_distribution<int> operation_distribution(0, 9);
+
+      DataI data;
+      MDataI mdata;
+      std::map<int, int> compare;
+      std::multimap<int, int> mcompare;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const int key = key_distribution(generator);
+        const int operation = operation_distribution(generator);
+
+        if (operation < 5)
+        {
+          if (compare.size() < 200U)
+          {
+            compare[key] = i;
+            data[key]    = i;
+          }
+
+          if (mcompare.size() < 200U)
+          {
+            mcompare.insert(std::make_pair(key, i));
+            mdata.insert(MDataI::value_type(key, i));
+          }
+        }
+        else if (operation < 9)
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+          CHECK_EQUAL(mcompare.erase(key), mdata.erase(key));
+        }
+        else
+        {
+          CHECK_EQUAL(compare.count(key), data.count(key));
+          CHECK_EQUAL(mcompare.count(key), mdata.count(key));
+        }
+
+        if ((i % 500) == 0)
+        {
+          CHECK(Check_Equal(data, compare));
+          CHECK(Check_Equal(mdata, mcompare));
+        }
+      }
+
+      CHECK(Check_Equal(data, compare));
+      CHECK(Check_Equal(mdata, mcompare));
+    }
+  };
+}
@@ -0,0 +1,378 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <random>
+#include <functional>
+
+#include "data.h"
+
+#include "etl/inline_flat_set.h"
+
+namespace
+{
+  //*************************************************************************
+  template <typename TSet, typename TCompare>
+  bool Check_Equal(const TSet& set, const TCompare& compare)
+  {
+    return (set.size() == compare.size()) && std::equal(set.begin(), set.end(), compare.begin());
+  }
+
+  SUITE(test_inline_flat_set)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::inline_flat_set<std::string, SIZE>      Data;
+    typedef etl::iinline_flat_set<std::string>           IData;
+    typedef etl::inline_flat_multiset<std::string, SIZE> MData;
+    typedef std::set<std::string>                        Compare_Data;
+
+    using ItemM = TestDataM<int>;
+    using DataM = etl::inline_flat_set<ItemM, SIZE>;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.rbegin() == data.rend());
+    }
+
+    //*************************************************************************
+    TEST(test_insert)
+    {
+      Data data;
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert("B");
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("B"), *result.first);
+
+      // Duplicates are not inserted.
+      result = data.insert("B");
+      CHECK(!result.second);
+      CHECK_EQUAL(1U, data.size());
+
+      Data::iterator itr = data.insert(data.begin(), "A");
+      CHECK_EQUAL(std::string("A"), *itr);
+      CHECK(itr == data.begin());
+
+      CHECK(data.emplace(3U, 'C').second);
+      CHECK_EQUAL(std::string("CCC"), *(data.end() - 1));
+      CHECK_EQUAL(3U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range)
+    {
+      std::vector<std::string> values = { "E", "B", "D", "A", "C", "B" };
+
+      Data data;
+      data.insert(values.begin(), values.end());
+
+      Compare_Data compare(values.begin(), values.end());
+
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_full)
+    {
+      Data data;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        data.insert(std::to_string(i));
+      }
+
+      CHECK(data.full());
+
+      // An existing key does not need space.
+      CHECK(!data.insert("0").second);
+
+      CHECK_THROW(data.insert("X"), etl::inline_flat_set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_moveable)
+    {
+      DataM data;
+
+      data.insert(ItemM(2));
+      data.insert(ItemM(1));
+      data.emplace(3);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, data.begin()->value);
+      CHECK_EQUAL(3, (data.end() - 1)->value);
+    }
+
+    //*************************************************************************
+    TEST(test_find_count_contains_bounds)
+    {
+      Data data = { "A", "C", "E" };
+
+      CHECK(data.find("C") != data.end());
+      CHECK(data.find("B") == data.end());
+      CHECK_EQUAL(1U, data.count("A"));
+      CHECK_EQUAL(0U, data.count("D"));
+      CHECK(data.contains("E"));
+      CHECK(!data.contains("F"));
+
+      CHECK_EQUAL(std::string("C"), *data.lower_bound("B"));
+      CHECK_EQUAL(std::string("C"), *data.lower_bound("C"));
+      CHECK_EQUAL(std::string("E"), *data.upper_bound("C"));
+      CHECK(data.upper_bound("E") == data.end());
+
+      ETL_OR_STD::pair<Data::const_iterator, Data::const_iterator> range = data.equal_range("C");
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Data data = { "0", "1", "2", "3", "4", "5", "6", "7" };
+
+      CHECK_EQUAL(1U, data.erase("2"));
+      CHECK_EQUAL(0U, data.erase("2"));
+
+      Data::iterator itr = data.erase(data.find("3"));
+      CHECK_EQUAL(std::string("4"), *itr);
+
+      itr = data.erase(data.find("1"), data.find("6"));
+      CHECK_EQUAL(std::string("6"), *itr);
+
+      Compare_Data compare = { "0", "6", "7" };
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_keys)
+    {
+      Data data = { "C", "A", "B" };
+
+      etl::span<const std::string> keys = data.keys();
+
+      CHECK_EQUAL(3U, keys.size());
+      CHECK_EQUAL(std::string("A"), keys[0]);
+      CHECK(keys.data() == &*data.begin());
+    }
+
+    //*************************************************************************
+    TEST(test_clear_and_destructor)
+    {
+      ItemM::reset_instance_count();
+
+      {
+        DataM data;
+
+        for (int i = 0; i < int(SIZE); ++i)
+        {
+          data.insert(ItemM(int(SIZE) - i));
+        }
+
+        data.erase(data.begin());
+        CHECK_EQUAL(int(SIZE - 1U), ItemM::get_instance_count());
+
+        data.clear();
+        CHECK_EQUAL(0, ItemM::get_instance_count());
+
+        data.insert(ItemM(1));
+        CHECK_EQUAL(1, ItemM::get_instance_count());
+      }
+
+      CHECK_EQUAL(0, ItemM::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      Data data = { "A", "B" };
+
+      Data data2(data);
+      CHECK(data2 == data);
+
+      Data data3 = { "C" };
+      data3 = data;
+      CHECK(data3 == data);
+
+      IData& idata3 = data3;
+      idata3 = idata3;
+      CHECK(data3 == data);
+
+      data3.insert("C");
+      CHECK(data3 != data);
+
+      Data data4(std::move(data3));
+      CHECK_EQUAL(3U, data4.size());
+      CHECK(data3.empty());
+
+      data2 = std::move(data4);
+      CHECK_EQUAL(3U, data2.size());
+      CHECK(data4.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_make_and_deduction)
+    {
+      auto data = etl::make_inline_flat_set<int>(3, 1, 2);
+
+      CHECK_EQUAL(3U, data.max_size());
+      CHECK_EQUAL(1, *data.begin());
+
+      auto mdata = etl::make_inline_flat_multiset<int>(3, 1, 3);
+
+      CHECK_EQUAL(2U, mdata.count(3));
+
+#if ETL_USING_CPP17
+      etl::inline_flat_set data2{ 5, 4 };
+
+      CHECK_EQUAL(2U, data2.max_size());
+      CHECK_EQUAL(4, *data2.begin());
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_key_compare)
+    {
+      etl::inline_flat_set<int, 10, etl::greater<int>> data = { 1, 3, 2 };
+
+      CHECK_EQUAL(3, *data.begin());
+      CHECK_EQUAL(2, *data.lower_bound(2));
+      CHECK_EQUAL(1, *data.upper_bound(2));
+    }
+
+    //*************************************************************************
+    TEST(test_multiset)
+    {
+      typedef etl::inline_flat_multiset<TestDataNDC<int>, SIZE> MDataNDC;
+
+      MData data;
+
+      data.insert("B");
+      data.insert("A");
+      data.insert("B");
+      data.insert(data.begin(), "C");
+
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(2U, data.count("B"));
+      CHECK_EQUAL(2U, data.erase("B"));
+
+      MData data2(data);
+      CHECK(data2 == data);
+
+      data2.emplace("C");
+      CHECK(data2 != data);
+
+      for (size_t i = data2.size(); i < SIZE; ++i)
+      {
+        data2.insert("D");
+      }
+
+      CHECK_THROW(data2.insert("D"), etl::inline_flat_set_full);
+
+      // Equal elements are kept in insertion order.
+      MDataNDC mdata;
+
+      mdata.insert(TestDataNDC<int>(2, 0));
+      mdata.insert(TestDataNDC<int>(1, 0));
+      mdata.insert(TestDataNDC<int>(2, 1));
+      mdata.insert(TestDataNDC<int>(2, 2));
+
+      CHECK_EQUAL(0, mdata.begin()[1].index);
+      CHECK_EQUAL(1, mdata.begin()[2].index);
+      CHECK_EQUAL(2, mdata.begin()[3].index);
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_against_std)
+    {
+      typedef etl::inline_flat_set<int, 200>      DataI;
+      typedef etl::inline_flat_multiset<int, 200> MDataI;
+
+      std::mt19937 generator(12345);
+      std::uniform_int_distribution<int> key_distribution(0, 300);
+      std::uniform_int_distribution<int> operation_distribution(0, 9);
+
+      DataI data;
+      MDataI mdata;
+      std::set<int> compare;
+      std::multiset<int> mcompare;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const int key = key_distribution(generator);
+        const int operation = operation_distribution(generator);
+
+        if (operation < 5)
+        {
+          if (compare.size() < 200U)
+          {
+            CHECK_EQUAL(compare.insert(key).second, data.insert(key).second);
+          }
+
+          if (mcompare.size() < 200U)
+          {
+            mcompare.insert(key);
+            mdata.insert(key);
+          }
+        }
+        else if (operation < 9)
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+          CHECK_EQUAL(mcompare.erase(key), mdata.erase(key));
+        }
+        else
+        {
+          CHECK_EQUAL(compare.count(key), data.count(key));
+          CHECK_EQUAL(mcompare.count(key), mdata.count(key));
+        }
+
+        if ((i % 500) == 0)
+        {
+          CHECK(Check_Equal(data, compare));
+          CHECK(Check_Equal(mdata, mcompare));
+        }
+      }
+
+      CHECK(Check_Equal(data, compare));
+      CHECK(Check_Equal(mdata, mcompare));
+    }
+  };
+}
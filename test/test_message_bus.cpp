@@ -224,6 +224,39 @@ namespace
     int message_unknown_count;
   };
 
+  //***************************************************************************
+  // Router that handles message 1 and overrides 'accepts' to also accept message 2.
+  //***************************************************************************
+  class RouterC : public etl::message_router<RouterC, Message1>
+  {
+  public:
+
+    RouterC(etl::message_router_id_t id)
+      : message_router(id),
+        message1_count(0),
+        message_unknown_count(0)
+    {
+    }
+
+    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      return (id == MESSAGE1) || (id == MESSAGE2);
+    }
+
+    void on_receive(const Message1&)
+    {
+      ++message1_count;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++message_unknown_count;
+    }
+
+    int message1_count;
+    int message_unknown_count;
+  };
+
   //***************************************************************************
   template <size_t Size>
   class MessageBus : public etl::message_bus<Size>
@@ -951,5 +984,29 @@ namespace
 
       CHECK_EQUAL(1, bus.message_count);
     }
+
+    //*************************************************************************
+    TEST(message_bus_router_overrides_accepts)
+    {
+      MessageBus<1> bus;
+      RouterC router(ROUTER1);
+      RouterA callback(ROUTER2);
+
+      bus.subscribe(router);
+
+      Message1 message1(callback);
+      Message2 message2(callback);
+      Message3 message3(callback);
+
+      // The bus must use the router's own 'accepts'.
+      CHECK(router.get_accepted_message_ids() == ETL_NULLPTR);
+
+      bus.receive(message1);
+      bus.receive(message2);
+      bus.receive(message3);
+
+      CHECK_EQUAL(1, router.message1_count);
+      CHECK_EQUAL(1, router.message_unknown_count);
+    }
   };
 }
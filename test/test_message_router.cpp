@@ -266,6 +266,53 @@ namespace
 
   etl::imessage_router* p_router;
 
+#if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+  //***************************************************************************
+  // Routers for more than 16 messages, and for sparse message ids.
+  //***************************************************************************
+  template <size_t Id>
+  struct LargeMessage : public etl::message<Id>
+  {
+  };
+
+  template <typename TSequence, size_t Stride>
+  class LargeRouter;
+
+  template <size_t... Index, size_t Stride>
+  class LargeRouter<std::index_sequence<Index...>, Stride>
+    : public etl::message_router<LargeRouter<std::index_sequence<Index...>, Stride>, LargeMessage<(Index * Stride) + 1U>...>
+  {
+  public:
+
+    template <size_t Id>
+    void on_receive(const LargeMessage<Id>&)
+    {
+      ++counts[Id];
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++message_unknown_count;
+    }
+
+    int counts[256] = {};
+    int message_unknown_count = 0;
+  };
+
+  // Ids 1 to 24.
+  typedef LargeRouter<std::make_index_sequence<24U>, 1U> DenseRouter;
+
+  // Ids 1, 51, 101, 151, 201.
+  typedef LargeRouter<std::make_index_sequence<5U>, 50U> SparseRouter;
+
+  //***********************************
+  template <size_t... Id>
+  void send_all_messages(etl::imessage_router& router, std::index_sequence<Id...>)
+  {
+    (router.receive(LargeMessage<Id>()), ...);
+  }
+#endif
+
   SUITE(test_message_router)
   {
     //*************************************************************************
@@ -516,6 +563,99 @@ namespace
       CHECK(r2.accepts(message5.get_message_id()));
     }
 
+#if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(message_router_more_than_16_messages)
+    {
+      DenseRouter router;
+
+      send_all_messages(router, std::make_index_sequence<256U>());
+
+      etl::send_message(router, LargeMessage<24U>());
+
+      for (size_t id = 0U; id < 256U; ++id)
+      {
+        const bool is_accepted = (id >= 1U) && (id <= 24U);
+
+        CHECK_EQUAL(is_accepted ? ((id == 24U) ? 2 : 1) : 0, router.counts[id]);
+        CHECK_EQUAL(is_accepted, router.accepts(etl::message_id_t(id)));
+        CHECK_EQUAL(is_accepted, router.accepts_id(etl::message_id_t(id)));
+      }
+
+      CHECK_EQUAL(256 - 24, router.message_unknown_count);
+    }
+
+    //*************************************************************************
+    TEST(message_router_sparse_messages)
+    {
+      SparseRouter router;
+
+      send_all_messages(router, std::make_index_sequence<256U>());
+
+      for (size_t id = 0U; id < 256U; ++id)
+      {
+        const bool is_accepted = ((id % 50U) == 1U) && (id <= 201U);
+
+        CHECK_EQUAL(is_accepted ? 1 : 0, router.counts[id]);
+        CHECK_EQUAL(is_accepted, router.accepts(etl::message_id_t(id)));
+        CHECK_EQUAL(is_accepted, router.accepts_id(etl::message_id_t(id)));
+      }
+
+      CHECK_EQUAL(256 - 5, router.message_unknown_count);
+
+      // Too sparse for a bitmap.
+      CHECK(router.get_accepted_message_ids() == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(message_router_accepted_message_ids)
+    {
+      DenseRouter router;
+
+      const etl::accepted_message_ids* p_ids = router.get_accepted_message_ids();
+
+      CHECK(p_ids != ETL_NULLPTR);
+      CHECK_EQUAL(1U, p_ids->first_id);
+      CHECK_EQUAL(24U, p_ids->size);
+      CHECK(!p_ids->test(0U));
+      CHECK(p_ids->test(1U));
+      CHECK(p_ids->test(24U));
+      CHECK(!p_ids->test(25U));
+
+      Router2 r2;
+
+      p_ids = r2.get_accepted_message_ids();
+
+      CHECK(p_ids != ETL_NULLPTR);
+      CHECK_EQUAL(MESSAGE1, p_ids->first_id);
+      CHECK_EQUAL(5U, p_ids->size);
+      CHECK(p_ids->test(MESSAGE1));
+      CHECK(p_ids->test(MESSAGE2));
+      CHECK(!p_ids->test(MESSAGE3));
+      CHECK(p_ids->test(MESSAGE4));
+      CHECK(p_ids->test(MESSAGE5));
+
+      etl::null_message_router null_router;
+
+      CHECK(null_router.get_accepted_message_ids() == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(message_router_accepts_id_successors)
+    {
+      Router1 r1; // M1, M2, M3, M4, M5
+      Router2 r2; // M1, M2, M4, M5
+
+      CHECK(!r2.accepts_id(MESSAGE3));
+
+      r2.set_successor(r1);
+
+      CHECK(r2.accepts_id(MESSAGE1));
+      CHECK(r2.accepts_id(MESSAGE3));
+      CHECK(!r2.accepts_id(MESSAGE0));
+    }
+#endif
+
     //*************************************************************************
     TEST(message_router_queue)
     {
@@ -142,6 +142,28 @@ namespace
       CHECK_EQUAL(hash1, hash2);
       CHECK_EQUAL(hash1, hash3);
     }
+
+    //*************************************************************************
+    TEST(test_checksum_add_range_blocks)
+    {
+      std::vector<uint8_t> data(100U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37U) + 11U);
+      }
+
+      for (size_t offset = 0UL; offset < 8U; ++offset)
+      {
+        for (size_t length = 0UL; length <= (data.size() - offset); ++length)
+        {
+          uint8_t sum     = etl::parity_checksum<uint8_t>(data.data() + offset, data.data() + offset + length);
+          int     compare = reference_checksum<uint8_t>(data.begin() + offset, data.begin() + offset + length);
+
+          CHECK_EQUAL(compare, int(sum));
+        }
+      }
+    }
   };
 }
 
@@ -0,0 +1,418 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+#include "etl/queue_mpmc_atomic.h"
+
+#include "data.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  struct Data
+  {
+    Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
+      : a(a_),
+        b(b_),
+        c(c_),
+        d(d_)
+    {
+    }
+
+    Data()
+      : a(0),
+        b(0),
+        c(0),
+        d(0)
+    {
+    }
+
+    int a;
+    int b;
+    int c;
+    int d;
+  };
+
+  bool operator ==(const Data& lhs, const Data& rhs)
+  {
+    return (lhs.a == rhs.a) && (lhs.b == rhs.b) && (lhs.c == rhs.c) && (lhs.d == rhs.d);
+  }
+
+  using ItemM = TestDataM<int>;
+
+  SUITE(test_queue_mpmc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+      CHECK(queue.empty());
+      CHECK(!queue.full());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+      CHECK_EQUAL(4U, queue.available());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3U, queue.available());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.available());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      // Queue full.
+      CHECK(!queue.push(5));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(5));
+
+      // Queue full.
+      CHECK(!queue.push(6));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(6));
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(6, i);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop(i));
+      CHECK(!queue.pop(i));
+    }
+
+#if !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_move_push_pop)
+    {
+      etl::queue_mpmc_atomic<ItemM, 4> queue;
+
+      ItemM p1(1);
+      ItemM p2(2);
+      ItemM p3(3);
+      ItemM p4(4);
+
+      queue.push(std::move(p1));
+      queue.push(std::move(p2));
+      queue.push(std::move(p3));
+      queue.push(std::move(p4));
+
+      CHECK(!bool(p1));
+      CHECK(!bool(p2));
+      CHECK(!bool(p3));
+      CHECK(!bool(p4));
+
+      ItemM pr(0);
+
+      queue.pop(pr);
+      CHECK_EQUAL(1, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(2, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(3, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(4, pr.value);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_multiple_emplace)
+    {
+      etl::queue_mpmc_atomic<Data, 4> queue;
+
+      queue.emplace(1);
+      queue.emplace(1, 2);
+      queue.emplace(1, 2, 3);
+      queue.emplace(1, 2, 3, 4);
+
+      CHECK_EQUAL(4U, queue.size());
+      CHECK(!queue.emplace(1));
+
+      Data popped;
+
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_iqueue)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      etl::iqueue_mpmc_atomic<int>& iqueue = queue;
+
+      CHECK(iqueue.push(1));
+      CHECK(iqueue.push(2));
+      CHECK(iqueue.push(3));
+      CHECK(iqueue.push(4));
+      CHECK_EQUAL(4U, iqueue.size());
+      CHECK(!iqueue.push(5));
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK(!iqueue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      queue.push(2);
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+
+      // Do it again to check that clear() didn't screw up the internals.
+      queue.push(1);
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_small_memory_model_position_wrap)
+    {
+      etl::queue_mpmc_atomic<int, 128, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      int expected = 0;
+      int next     = 0;
+
+      // The 8 bit positions and sequences wrap many times.
+      for (int loop = 0; loop < 100; ++loop)
+      {
+        while (queue.push(next))
+        {
+          ++next;
+        }
+
+        CHECK_EQUAL(128U, queue.size());
+        CHECK(queue.full());
+
+        for (int i = 0; i < 77; ++i)
+        {
+          int value;
+          CHECK(queue.pop(value));
+          CHECK_EQUAL(expected, value);
+          ++expected;
+        }
+      }
+
+      int value;
+
+      while (queue.pop(value))
+      {
+        CHECK_EQUAL(expected, value);
+        ++expected;
+      }
+
+      CHECK_EQUAL(next, expected);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_external_buffer)
+    {
+      typedef etl::queue_mpmc_atomic_ext<int> Queue;
+
+      Queue::slot_type buffer[8];
+
+      Queue queue(buffer, 8U);
+
+      etl::iqueue_mpmc_atomic<int>& iqueue = queue;
+
+      CHECK_EQUAL(8U, iqueue.capacity());
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK(iqueue.push(i));
+      }
+
+      CHECK(!iqueue.push(8));
+
+      int value;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK(iqueue.pop(value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(!iqueue.pop(value));
+    }
+
+    //*************************************************************************
+    TEST(test_external_buffer_invalid_size)
+    {
+      typedef etl::queue_mpmc_atomic_ext<int> Queue;
+
+      Queue::slot_type buffer[6];
+
+      CHECK_THROW(Queue queue(buffer, 6U), etl::queue_mpmc_atomic_invalid_size);
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static etl::queue_mpmc_atomic<int, 16> queue;
+
+      const int Length_Per_Producer = 5000;
+
+      std::atomic<bool> start(false);
+      std::vector<int> popped[2];
+
+      auto producer = [&](int first)
+      {
+        while (!start.load())
+        {
+          std::this_thread::yield();
+        }
+
+        for (int i = first; i < (first + Length_Per_Producer); ++i)
+        {
+          while (!queue.push(i))
+          {
+            std::this_thread::yield();
+          }
+        }
+      };
+
+      auto consumer = [&](std::vector<int>& output)
+      {
+        while (!start.load())
+        {
+          std::this_thread::yield();
+        }
+
+        int value;
+
+        while (output.size() < size_t(Length_Per_Producer))
+        {
+          if (queue.pop(value))
+          {
+            output.push_back(value);
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+      };
+
+      std::thread t1(producer, 0);
+      std::thread t2(producer, Length_Per_Producer);
+      std::thread t3(consumer, std::ref(popped[0]));
+      std::thread t4(consumer, std::ref(popped[1]));
+
+      start.store(true);
+
+      t1.join();
+      t2.join();
+      t3.join();
+      t4.join();
+
+      std::vector<int> all;
+      all.insert(all.end(), popped[0].begin(), popped[0].end());
+      all.insert(all.end(), popped[1].begin(), popped[1].end());
+      std::sort(all.begin(), all.end());
+
+      CHECK_EQUAL(size_t(2 * Length_Per_Producer), all.size());
+
+      bool all_received = true;
+
+      for (size_t i = 0UL; i < all.size(); ++i)
+      {
+        all_received = all_received && (all[i] == int(i));
+      }
+
+      CHECK(all_received);
+      CHECK(queue.empty());
+    }
+  };
+}
+
+#endif
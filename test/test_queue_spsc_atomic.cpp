@@ -369,6 +369,137 @@ namespace
       CHECK(!queue.empty());
     }
 
+    //*************************************************************************
+    TEST(test_push_range_pop_range)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      int input[] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0 };
+
+      CHECK_EQUAL(3U, queue.push(input, input + 3));
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK_EQUAL(2U, queue.pop(output, 2U));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+
+      // Wraps around the end of the buffer and stops when full.
+      CHECK_EQUAL(3U, queue.push(input + 3, input + 6));
+      CHECK_EQUAL(0U, queue.push(input, input + 1));
+      CHECK(queue.full());
+
+      CHECK_EQUAL(4U, queue.pop(output, 6U));
+      CHECK_EQUAL(3, output[0]);
+      CHECK_EQUAL(4, output[1]);
+      CHECK_EQUAL(5, output[2]);
+      CHECK_EQUAL(6, output[3]);
+
+      CHECK_EQUAL(0U, queue.pop(output, 6U));
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_range_pop_range_cache_aligned)
+    {
+      etl::queue_spsc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_SMALL, etl::queue_spsc_atomic_layout::CACHE_ALIGNED> queue;
+
+      std::vector<int> input  = { 1, 2, 3, 4, 5, 6 };
+      std::vector<int> output;
+
+      CHECK_EQUAL(4U, queue.push(input.begin(), input.end()));
+      CHECK(!queue.push(5));
+
+      CHECK_EQUAL(4U, queue.pop(std::back_inserter(output), 10U));
+      CHECK(queue.push(5));
+
+      CHECK_EQUAL(1U, queue.pop(std::back_inserter(output), 10U));
+      CHECK((std::vector<int>{ 1, 2, 3, 4, 5 }) == output);
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_commit)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      queue.push(0);
+      queue.push(0);
+      queue.pop();
+      queue.pop();
+
+      // Reserve wraps around the end of the buffer.
+      etl::iqueue_spsc_atomic<int>::span_pair reservation = queue.write_reserve(10U);
+      CHECK_EQUAL(3U, reservation.first.size());
+      CHECK_EQUAL(1U, reservation.second.size());
+
+      reservation.first[0]  = 1;
+      reservation.first[1]  = 2;
+      reservation.first[2]  = 3;
+      reservation.second[0] = 4;
+
+      // Nothing is visible until committed.
+      CHECK(queue.empty());
+
+      queue.write_commit(3U);
+      CHECK_EQUAL(3U, queue.size());
+
+      reservation = queue.write_reserve(10U);
+      CHECK_EQUAL(1U, reservation.first.size());
+      CHECK_EQUAL(0U, reservation.second.size());
+
+      reservation.first[0] = 4;
+      queue.write_commit(1U);
+      CHECK(queue.full());
+
+      int i;
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+    }
+
+    //*************************************************************************
+    TEST(test_read_reserve_commit)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.pop();
+      queue.pop();
+      queue.pop();
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+
+      etl::iqueue_spsc_atomic<int>::span_pair reservation = queue.read_reserve();
+      CHECK_EQUAL(2U, reservation.first.size());
+      CHECK_EQUAL(1U, reservation.second.size());
+      CHECK_EQUAL(1, reservation.first[0]);
+      CHECK_EQUAL(2, reservation.first[1]);
+      CHECK_EQUAL(3, reservation.second[0]);
+
+      queue.read_commit(2U);
+      CHECK_EQUAL(1U, queue.size());
+
+      reservation = queue.read_reserve(1U);
+      CHECK_EQUAL(1U, reservation.first.size());
+      CHECK_EQUAL(0U, reservation.second.size());
+      CHECK_EQUAL(3, reservation.first[0]);
+
+      queue.read_commit(1U);
+      CHECK(queue.empty());
+
+      reservation = queue.read_reserve();
+      CHECK_EQUAL(0U, reservation.first.size() + reservation.second.size());
+    }
+
     //*************************************************************************
     TEST(test_full)
     {
@@ -391,6 +522,141 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_cache_aligned_size_push_pop)
+    {
+      typedef etl::queue_spsc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_LARGE, etl::queue_spsc_atomic_layout::CACHE_ALIGNED> Queue;
+
+      Queue queue;
+
+      CHECK(sizeof(Queue) > (3 * ETL_CACHE_LINE_SIZE));
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+      CHECK(queue.empty());
+
+      CHECK(queue.push(1));
+      CHECK(queue.push(2));
+      CHECK(queue.emplace(3));
+      CHECK(queue.push(4));
+      CHECK_EQUAL(4U, queue.size());
+      CHECK(queue.full());
+
+      // Queue full.
+      CHECK(!queue.push(5));
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(1, i);
+
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(5));
+      CHECK(!queue.push(6));
+
+      CHECK(queue.front(i));
+      CHECK_EQUAL(2, i);
+      CHECK_EQUAL(2, queue.front());
+
+      CHECK(queue.pop());
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop(i));
+      CHECK(!queue.front(i));
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_cache_aligned_size_push_pop_iqueue)
+    {
+      etl::queue_spsc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_SMALL, etl::queue_spsc_atomic_layout::CACHE_ALIGNED> queue;
+
+      etl::iqueue_spsc_atomic<int, etl::memory_model::MEMORY_MODEL_SMALL, etl::queue_spsc_atomic_layout::CACHE_ALIGNED>& iqueue = queue;
+
+      for (int loop = 0; loop < 10; ++loop)
+      {
+        CHECK(iqueue.push(1));
+        CHECK(iqueue.push(2));
+        CHECK(iqueue.push(3));
+        CHECK_EQUAL(3U, iqueue.size());
+        CHECK_EQUAL(1U, iqueue.available());
+
+        int i;
+
+        CHECK(iqueue.pop(i));
+        CHECK_EQUAL(1, i);
+        CHECK(iqueue.pop(i));
+        CHECK_EQUAL(2, i);
+        CHECK(iqueue.pop(i));
+        CHECK_EQUAL(3, i);
+        CHECK(!iqueue.pop(i));
+      }
+
+      iqueue.push(1);
+      iqueue.push(2);
+      iqueue.clear();
+      CHECK(iqueue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_cache_aligned_threads)
+    {
+      static etl::queue_spsc_atomic<size_t, 10, etl::memory_model::MEMORY_MODEL_LARGE, etl::queue_spsc_atomic_layout::CACHE_ALIGNED> queue;
+
+      const size_t Length = 10000UL;
+
+      std::thread producer([&]()
+      {
+        size_t value = 1UL;
+
+        while (value <= Length)
+        {
+          if (queue.push(value))
+          {
+            ++value;
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      std::vector<size_t> values;
+      values.reserve(Length);
+
+      while (values.size() < Length)
+      {
+        size_t value;
+
+        if (queue.pop(value))
+        {
+          values.push_back(value);
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      producer.join();
+
+      bool in_order = true;
+
+      for (size_t i = 0UL; i < Length; ++i)
+      {
+        in_order = in_order && (values[i] == (i + 1));
+      }
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
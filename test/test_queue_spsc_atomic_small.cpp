@@ -79,6 +79,7 @@ namespace
   typedef etl::iqueue_spsc_atomic<int, etl::memory_model::MEMORY_MODEL_SMALL>   IQueueInt;
 
   typedef etl::queue_spsc_atomic<int, 254, etl::memory_model::MEMORY_MODEL_SMALL> QueueInt254;
+  typedef etl::queue_spsc_atomic<int, 250, etl::memory_model::MEMORY_MODEL_SMALL> QueueInt250;
 
   using ItemM = TestDataM<int>;
 
@@ -289,6 +290,51 @@ namespace
       CHECK_EQUAL(254U, queue.size());
     }
 
+    //*************************************************************************
+    TEST(test_write_reserve_commit_wraps_large_commit)
+    {
+      QueueInt250 queue;
+
+      for (int i = 0; i < 240; ++i)
+      {
+        queue.push(i);
+        queue.pop();
+      }
+
+      // Reserve wraps around the end of the buffer.
+      QueueInt250::span_pair reservation = queue.write_reserve(20U);
+      CHECK_EQUAL(11U, reservation.first.size());
+      CHECK_EQUAL(9U, reservation.second.size());
+
+      int value = 0;
+
+      for (size_t i = 0U; i < reservation.first.size(); ++i)
+      {
+        reservation.first[i] = value++;
+      }
+
+      for (size_t i = 0U; i < reservation.second.size(); ++i)
+      {
+        reservation.second[i] = value++;
+      }
+
+      // The index sum must not overflow the 8 bit size_type.
+      queue.write_commit(20U);
+      CHECK_EQUAL(20U, queue.size());
+
+      // The next push must land after the committed values.
+      CHECK(queue.push(20));
+
+      for (int i = 0; i < 21; ++i)
+      {
+        int result = -1;
+        CHECK(queue.pop(result));
+        CHECK_EQUAL(i, result);
+      }
+
+      CHECK(queue.empty());
+    }
+
     //*************************************************************************
     TEST(test_size_push_front_pop)
     {
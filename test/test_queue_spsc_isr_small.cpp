@@ -104,6 +104,7 @@ namespace
   typedef etl::iqueue_spsc_isr<int, Access, etl::memory_model::MEMORY_MODEL_SMALL>   IQueueInt;
 
   typedef etl::queue_spsc_isr<int, 255, Access, etl::memory_model::MEMORY_MODEL_SMALL> QueueInt255;
+  typedef etl::queue_spsc_isr<int, 250, Access, etl::memory_model::MEMORY_MODEL_SMALL> QueueInt250;
 
   using ItemM = TestDataM<int>;
 
@@ -471,6 +472,53 @@ namespace
       CHECK_EQUAL(255U, queue.size());
     }
 
+    //*************************************************************************
+    TEST(test_write_reserve_commit_wraps_large_commit)
+    {
+      Access::clear();
+
+      QueueInt250 queue;
+
+      for (int i = 0; i < 240; ++i)
+      {
+        queue.push(i);
+        queue.pop();
+      }
+
+      // Reserve wraps around the end of the buffer.
+      QueueInt250::span_pair reservation = queue.write_reserve(20U);
+      CHECK_EQUAL(10U, reservation.first.size());
+      CHECK_EQUAL(10U, reservation.second.size());
+
+      int value = 0;
+
+      for (size_t i = 0U; i < reservation.first.size(); ++i)
+      {
+        reservation.first[i] = value++;
+      }
+
+      for (size_t i = 0U; i < reservation.second.size(); ++i)
+      {
+        reservation.second[i] = value++;
+      }
+
+      // The index sum must not overflow the 8 bit size_type.
+      queue.write_commit(20U);
+      CHECK_EQUAL(20U, queue.size());
+
+      // The next push must land after the committed values.
+      CHECK(queue.push(20));
+
+      for (int i = 0; i < 21; ++i)
+      {
+        int result = -1;
+        CHECK(queue.pop(result));
+        CHECK_EQUAL(i, result);
+      }
+
+      CHECK(queue.empty());
+    }
+
     //*************************************************************************
     TEST(test_size_push_front_pop)
     {
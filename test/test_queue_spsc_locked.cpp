@@ -585,6 +585,99 @@ namespace
       CHECK(!access.called_unlock);
     }
 
+    //*************************************************************************
+    TEST(test_push_range_pop_range)
+    {
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      int input[] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0 };
+
+      access.clear();
+      CHECK_EQUAL(3U, queue.push(input, input + 3));
+      CHECK(access.called_lock);
+      CHECK(access.called_unlock);
+
+      access.clear();
+      CHECK_EQUAL(2U, queue.pop(output, 2U));
+      CHECK(access.called_lock);
+      CHECK(access.called_unlock);
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+
+      // Wraps around the end of the buffer and stops when full.
+      access.clear();
+      CHECK_EQUAL(3U, queue.push_from_unlocked(input + 3, input + 6));
+      CHECK(!access.called_lock);
+      CHECK(!access.called_unlock);
+      CHECK(queue.full_from_unlocked());
+
+      access.clear();
+      CHECK_EQUAL(4U, queue.pop_from_unlocked(output, 6U));
+      CHECK(!access.called_lock);
+      CHECK(!access.called_unlock);
+      CHECK_EQUAL(3, output[0]);
+      CHECK_EQUAL(4, output[1]);
+      CHECK_EQUAL(5, output[2]);
+      CHECK_EQUAL(6, output[3]);
+
+      CHECK(queue.empty_from_unlocked());
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_commit_read_reserve_commit)
+    {
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.pop();
+      queue.pop();
+      queue.pop();
+
+      // Reserve wraps around the end of the buffer.
+      access.clear();
+      etl::iqueue_spsc_locked<int>::span_pair reservation = queue.write_reserve(3U);
+      CHECK(access.called_lock);
+      CHECK(access.called_unlock);
+      CHECK_EQUAL(1U, reservation.first.size());
+      CHECK_EQUAL(2U, reservation.second.size());
+
+      reservation.first[0]  = 1;
+      reservation.second[0] = 2;
+      reservation.second[1] = 3;
+      CHECK(queue.empty());
+
+      queue.write_commit(3U);
+      CHECK_EQUAL(3U, queue.size());
+
+      reservation = queue.read_reserve_from_unlocked();
+      CHECK_EQUAL(1U, reservation.first.size());
+      CHECK_EQUAL(2U, reservation.second.size());
+      CHECK_EQUAL(1, reservation.first[0]);
+      CHECK_EQUAL(2, reservation.second[0]);
+      CHECK_EQUAL(3, reservation.second[1]);
+
+      queue.read_commit_from_unlocked(1U);
+      CHECK_EQUAL(2U, queue.size());
+
+      reservation = queue.write_reserve_from_unlocked(10U);
+      CHECK_EQUAL(2U, reservation.first.size() + reservation.second.size());
+      reservation.first[0] = 4;
+      queue.write_commit_from_unlocked(1U);
+
+      reservation = queue.read_reserve(10U);
+      CHECK_EQUAL(3U, reservation.first.size());
+      CHECK_EQUAL(0U, reservation.second.size());
+      CHECK_EQUAL(2, reservation.first[0]);
+      CHECK_EQUAL(3, reservation.first[1]);
+      CHECK_EQUAL(4, reservation.first[2]);
+
+      queue.read_commit(3U);
+      CHECK(queue.empty());
+    }
+
     //*************************************************************************
     TEST(test_full)
     {
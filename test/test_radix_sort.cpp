@@ -0,0 +1,305 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "unit_test_framework.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+#include <stdint.h>
+
+#include "etl/radix_sort.h"
+#include "etl/array.h"
+#include "etl/vector.h"
+
+namespace
+{
+  std::mt19937 urng(12345);
+
+  //***************************************************************************
+  template <typename T>
+  std::vector<T> random_values(size_t length)
+  {
+    std::vector<T> values;
+
+    for (size_t i = 0U; i < length; ++i)
+    {
+      values.push_back(T(urng()));
+    }
+
+    return values;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  void check_radix_sort(std::vector<T> data)
+  {
+    std::vector<T> expected(data);
+    std::stable_sort(expected.begin(), expected.end());
+
+    std::vector<T> scratch(data.size());
+    etl::radix_sort(data.begin(), data.end(), scratch);
+
+    CHECK(expected == data);
+  }
+
+  //***************************************************************************
+  struct Record
+  {
+    uint32_t timestamp;
+    int      id;
+  };
+
+  bool operator ==(const Record& lhs, const Record& rhs)
+  {
+    return (lhs.timestamp == rhs.timestamp) && (lhs.id == rhs.id);
+  }
+
+  bool compare_timestamp(const Record& lhs, const Record& rhs)
+  {
+    return lhs.timestamp < rhs.timestamp;
+  }
+
+  std::vector<Record> random_records(size_t length, uint32_t modulus)
+  {
+    std::vector<Record> records;
+
+    for (size_t i = 0U; i < length; ++i)
+    {
+      Record record = { uint32_t(urng() % modulus), int(i) };
+      records.push_back(record);
+    }
+
+    return records;
+  }
+
+  SUITE(test_radix_sort)
+  {
+    //*************************************************************************
+    TEST(test_radix_sort_unsigned)
+    {
+      for (size_t length : { 0U, 1U, 2U, 100U, 1000U })
+      {
+        check_radix_sort(random_values<uint8_t>(length));
+        check_radix_sort(random_values<uint16_t>(length));
+        check_radix_sort(random_values<uint32_t>(length));
+        check_radix_sort(random_values<uint64_t>(length));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_signed)
+    {
+      for (size_t length : { 0U, 1U, 2U, 100U, 1000U })
+      {
+        check_radix_sort(random_values<int8_t>(length));
+        check_radix_sort(random_values<int16_t>(length));
+        check_radix_sort(random_values<int32_t>(length));
+        check_radix_sort(random_values<int64_t>(length));
+      }
+
+      check_radix_sort(std::vector<int32_t>{ 0, -1, 1, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(), -2, 2 });
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_floating_point)
+    {
+      std::vector<float>  floats;
+      std::vector<double> doubles;
+
+      std::uniform_real_distribution<double> distribution(-1.0E6, 1.0E6);
+
+      for (size_t i = 0U; i < 1000U; ++i)
+      {
+        const double value = distribution(urng);
+
+        floats.push_back(float(value));
+        doubles.push_back(value);
+      }
+
+      floats.push_back(std::numeric_limits<float>::infinity());
+      floats.push_back(-std::numeric_limits<float>::infinity());
+      floats.push_back(std::numeric_limits<float>::denorm_min());
+      floats.push_back(-std::numeric_limits<float>::denorm_min());
+      floats.push_back(0.0F);
+
+      doubles.push_back(std::numeric_limits<double>::infinity());
+      doubles.push_back(-std::numeric_limits<double>::infinity());
+      doubles.push_back(std::numeric_limits<double>::max());
+      doubles.push_back(std::numeric_limits<double>::lowest());
+      doubles.push_back(0.0);
+
+      check_radix_sort(floats);
+      check_radix_sort(doubles);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_negative_zero_before_positive_zero)
+    {
+      std::vector<float> data = { 0.0F, -0.0F, 0.0F, -0.0F };
+      std::vector<float> scratch(data.size());
+
+      etl::radix_sort(data.begin(), data.end(), scratch);
+
+      CHECK(std::signbit(data[0]));
+      CHECK(std::signbit(data[1]));
+      CHECK(!std::signbit(data[2]));
+      CHECK(!std::signbit(data[3]));
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_sorted_and_constant_data)
+    {
+      std::vector<uint32_t> ascending(1000U);
+      std::vector<uint32_t> descending(1000U);
+      std::vector<uint32_t> constant(1000U, 0x12345678UL);
+
+      for (size_t i = 0U; i < 1000U; ++i)
+      {
+        ascending[i]  = uint32_t(i * 65537U);
+        descending[i] = uint32_t((1000U - i) * 65537U);
+      }
+
+      check_radix_sort(ascending);
+      check_radix_sort(descending);
+      check_radix_sort(constant);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_etl_containers)
+    {
+      etl::vector<int16_t, 100> data;
+      etl::array<int16_t, 100>  scratch;
+
+      for (size_t i = 0U; i < data.capacity(); ++i)
+      {
+        data.push_back(int16_t(urng()));
+      }
+
+      std::vector<int16_t> expected(data.begin(), data.end());
+      std::sort(expected.begin(), expected.end());
+
+      etl::radix_sort(data.begin(), data.end(), scratch);
+
+      CHECK(std::equal(expected.begin(), expected.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_key_extractor_is_stable)
+    {
+      for (uint32_t modulus : { 16UL, 100000UL, 0xFFFFFFFFUL })
+      {
+        std::vector<Record> data = random_records(1000U, modulus);
+        std::vector<Record> expected(data);
+        std::vector<Record> scratch(data.size());
+
+        std::stable_sort(expected.begin(), expected.end(), compare_timestamp);
+        etl::radix_sort(data.begin(), data.end(), scratch, [](const Record& r) { return r.timestamp; });
+
+        CHECK(expected == data);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_key_extractor_signed_key)
+    {
+      std::vector<Record> data = random_records(1000U, 0xFFFFFFFFUL);
+      std::vector<Record> expected(data);
+      std::vector<Record> scratch(data.size());
+
+      std::stable_sort(expected.begin(), expected.end(), [](const Record& lhs, const Record& rhs) { return int32_t(lhs.timestamp) < int32_t(rhs.timestamp); });
+      etl::radix_sort(data.begin(), data.end(), scratch, [](const Record& r) { return int32_t(r.timestamp); });
+
+      CHECK(expected == data);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_buffer_too_small)
+    {
+      std::vector<uint32_t> data = random_values<uint32_t>(100U);
+      std::vector<uint32_t> original(data);
+      std::vector<uint32_t> scratch(data.size() - 1U);
+
+      CHECK_THROW(etl::radix_sort(data.begin(), data.end(), scratch), etl::radix_sort_buffer_too_small);
+      CHECK(original == data);
+    }
+
+    //*************************************************************************
+    TEST(test_counting_sort_values)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0U; i < 1000U; ++i)
+      {
+        data.push_back(uint8_t(urng() % 10U));
+      }
+
+      std::vector<uint8_t> expected(data);
+      std::sort(expected.begin(), expected.end());
+
+      std::vector<uint8_t> data1(data);
+      etl::counting_sort<10>(data1.begin(), data1.end());
+      CHECK(expected == data1);
+
+      std::vector<uint8_t> data2(data);
+      std::vector<uint8_t> scratch(data.size());
+      etl::counting_sort<10>(data2.begin(), data2.end(), scratch);
+      CHECK(expected == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_counting_sort_key_extractor_is_stable)
+    {
+      std::vector<Record> data = random_records(1000U, 16U);
+      std::vector<Record> expected(data);
+      std::vector<Record> scratch(data.size());
+
+      std::stable_sort(expected.begin(), expected.end(), compare_timestamp);
+      etl::counting_sort<16>(data.begin(), data.end(), scratch, [](const Record& r) { return r.timestamp; });
+
+      CHECK(expected == data);
+    }
+
+    //*************************************************************************
+    TEST(test_counting_sort_key_out_of_range)
+    {
+      std::vector<int> data     = { 3, 1, 4, 1, 5, 9, 2, 6 };
+      std::vector<int> original = data;
+      std::vector<int> scratch(data.size());
+
+      CHECK_THROW(etl::counting_sort<9>(data.begin(), data.end()), etl::radix_sort_key_out_of_range);
+      CHECK(original == data);
+
+      CHECK_THROW(etl::counting_sort<9>(data.begin(), data.end(), scratch), etl::radix_sort_key_out_of_range);
+      CHECK(original == data);
+
+      CHECK_THROW(etl::counting_sort<9>(data.begin(), data.end(), etl::span<int>(scratch.data(), scratch.size() - 1U)), etl::radix_sort_buffer_too_small);
+      CHECK(original == data);
+    }
+  }
+}
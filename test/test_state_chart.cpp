@@ -231,6 +231,60 @@ namespace
 
   MotorControl motorControl;
 
+  //***************************************************************************
+  // A state chart with guards and transitions from any state, to compare
+  // dispatch with and without a transition index.
+  //***************************************************************************
+  class Dispatcher : public etl::state_chart<Dispatcher>
+  {
+  public:
+
+    Dispatcher()
+      : etl::state_chart<Dispatcher>(*this, transitionTable.begin(), transitionTable.end(), nullptr, nullptr, 0)
+      , action(-1)
+      , count(0)
+    {
+    }
+
+    template <int Action>
+    void OnAction()
+    {
+      action = Action;
+    }
+
+    bool Odd()
+    {
+      return (count % 2) != 0;
+    }
+
+    bool Even()
+    {
+      return (count % 2) == 0;
+    }
+
+    int action;
+    int count;
+
+    static const etl::array<Dispatcher::transition, 12> transitionTable;
+  };
+
+  //***************************************************************************
+  constexpr etl::array<Dispatcher::transition, 12> Dispatcher::transitionTable =
+  {
+    Dispatcher::transition(0, 0, 1, &Dispatcher::OnAction<0>),
+    Dispatcher::transition(   1, 2, &Dispatcher::OnAction<1>),
+    Dispatcher::transition(0, 1, 3, &Dispatcher::OnAction<2>),
+    Dispatcher::transition(1, 0, 2, &Dispatcher::OnAction<3>, &Dispatcher::Odd),
+    Dispatcher::transition(1, 0, 0, &Dispatcher::OnAction<4>),
+    Dispatcher::transition(   0, 3, &Dispatcher::OnAction<5>, &Dispatcher::Even),
+    Dispatcher::transition(2, 0, 1, &Dispatcher::OnAction<6>),
+    Dispatcher::transition(3, 2, 0, &Dispatcher::OnAction<7>),
+    Dispatcher::transition(2, 2, 3, &Dispatcher::OnAction<8>, &Dispatcher::Odd),
+    Dispatcher::transition(   2, 1, &Dispatcher::OnAction<9>),
+    Dispatcher::transition(3, 0, 0, &Dispatcher::OnAction<10>, &Dispatcher::Odd),
+    Dispatcher::transition(   4, 0, &Dispatcher::OnAction<11>, &Dispatcher::Odd)
+  };
+
   SUITE(test_state_chart_class)
   {
     //*************************************************************************
@@ -599,5 +653,102 @@ namespace
       motorControl.process_event(EventId::ABORT);
       CHECK_EQUAL(StateId::IDLE, int(motorControl.get_state_id()));
     }
+
+    //*************************************************************************
+    TEST(test_transition_index)
+    {
+      Dispatcher linear;
+      Dispatcher indexed;
+
+      etl::array<etl::state_chart_traits::transition_index_t, 12> index;
+      indexed.set_transition_index(index.begin(), index.end());
+
+      linear.start();
+      indexed.start();
+
+      uint32_t random = 1U;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        random = (random * 1103515245U) + 12345U;
+        const Dispatcher::event_id_t event_id = Dispatcher::event_id_t((random >> 16U) % 6U);
+
+        linear.count  = i;
+        indexed.count = i;
+        linear.action  = -1;
+        indexed.action = -1;
+
+        linear.process_event(event_id);
+        indexed.process_event(event_id);
+
+        CHECK_EQUAL(int(linear.get_state_id()), int(indexed.get_state_id()));
+        CHECK_EQUAL(linear.action, indexed.action);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_transition_index_order)
+    {
+      Dispatcher indexed;
+
+      etl::array<etl::state_chart_traits::transition_index_t, 12> index;
+      indexed.set_transition_index(index.begin(), index.end());
+      indexed.start();
+
+      // The transition from any state is before the one from state 0.
+      indexed.process_event(1);
+      CHECK_EQUAL(1, indexed.action);
+      CHECK_EQUAL(2, int(indexed.get_state_id()));
+
+      // The guarded transition from state 2 fails, so the one from any state is used.
+      indexed.count = 0;
+      indexed.process_event(2);
+      CHECK_EQUAL(9, indexed.action);
+      CHECK_EQUAL(1, int(indexed.get_state_id()));
+
+      // The guarded transition from state 1 fails, so the next one from state 1 is used.
+      indexed.count = 0;
+      indexed.process_event(0);
+      CHECK_EQUAL(4, indexed.action);
+      CHECK_EQUAL(0, int(indexed.get_state_id()));
+
+      // No transitions.
+      indexed.action = -1;
+      indexed.process_event(3);
+      CHECK_EQUAL(-1, indexed.action);
+      CHECK_EQUAL(0, int(indexed.get_state_id()));
+    }
+
+    //*************************************************************************
+    TEST(test_transition_index_too_small)
+    {
+      Dispatcher indexed;
+
+      // Not used, as it is too small.
+      etl::array<etl::state_chart_traits::transition_index_t, 11> index;
+      indexed.set_transition_index(index.begin(), index.end());
+      indexed.start();
+
+      indexed.process_event(1);
+      CHECK_EQUAL(1, indexed.action);
+      CHECK_EQUAL(2, int(indexed.get_state_id()));
+    }
+
+    //*************************************************************************
+    TEST(test_transition_index_rebuilt_for_new_table)
+    {
+      Dispatcher indexed;
+
+      etl::array<etl::state_chart_traits::transition_index_t, 12> index;
+      indexed.set_transition_index(index.begin(), index.end());
+
+      // Only the transitions from state 0.
+      indexed.set_transition_table(Dispatcher::transitionTable.begin() + 2, Dispatcher::transitionTable.begin() + 3);
+      indexed.start();
+
+      indexed.process_event(1);
+      CHECK_EQUAL(2, indexed.action);
+      CHECK_EQUAL(3, int(indexed.get_state_id()));
+    }
   };
 }
@@ -240,6 +240,17 @@ namespace
                       3,
                       StateId::IDLE> motorControlStateChart;
 
+#if ETL_USING_CPP14
+  etl::state_chart_ct<MotorControl,
+                      motorControl,
+                      transitionTable,
+                      7,
+                      stateTable,
+                      3,
+                      StateId::IDLE,
+                      true> motorControlIndexedStateChart;
+#endif
+
   SUITE(test_state_chart_compile_time)
   {
     //*************************************************************************
@@ -608,5 +619,56 @@ namespace
       motorControlStateChart.process_event(EventId::ABORT);
       CHECK_EQUAL(StateId::IDLE, int(motorControlStateChart.get_state_id()));
     }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_state_chart_with_transition_index)
+    {
+      motorControl.ClearStatistics();
+
+      motorControlIndexedStateChart.start();
+      CHECK_EQUAL(true, motorControl.entered_idle);
+
+      // Send unhandled events.
+      motorControlIndexedStateChart.process_event(EventId::STOP);
+      motorControlIndexedStateChart.process_event(EventId::STOPPED);
+      CHECK_EQUAL(StateId::IDLE, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(0, motorControl.stopCount);
+      CHECK_EQUAL(0, motorControl.stoppedCount);
+
+      // The first transition's guard fails, so the second is used.
+      motorControl.guard = false;
+      motorControlIndexedStateChart.process_event(EventId::START);
+      CHECK_EQUAL(StateId::IDLE, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(0, motorControl.startCount);
+      CHECK_EQUAL(1, motorControl.null);
+
+      motorControl.guard = true;
+      motorControlIndexedStateChart.process_event(EventId::START);
+      CHECK_EQUAL(StateId::RUNNING, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(1, motorControl.startCount);
+      CHECK_EQUAL(true, motorControl.isLampOn);
+
+      motorControlIndexedStateChart.process_event(EventId::SET_SPEED);
+      CHECK_EQUAL(StateId::RUNNING, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(1, motorControl.setSpeedCount);
+      CHECK_EQUAL(100, motorControl.speed);
+
+      motorControlIndexedStateChart.process_event(EventId::STOP);
+      CHECK_EQUAL(StateId::WINDING_DOWN, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(1, motorControl.stopCount);
+      CHECK_EQUAL(1, motorControl.windingDown);
+
+      motorControlIndexedStateChart.process_event(EventId::STOPPED);
+      CHECK_EQUAL(StateId::IDLE, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(1, motorControl.stoppedCount);
+      CHECK_EQUAL(0, motorControl.windingDown);
+
+      // From any state.
+      motorControlIndexedStateChart.process_event(EventId::START);
+      motorControlIndexedStateChart.process_event(EventId::ABORT);
+      CHECK_EQUAL(StateId::IDLE, int(motorControlIndexedStateChart.get_state_id()));
+    }
+#endif
   };
 }
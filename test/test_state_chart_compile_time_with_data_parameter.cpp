@@ -247,6 +247,18 @@ namespace
                        3,
                        StateId::IDLE> motorControlStateChart;
 
+#if ETL_USING_CPP14
+  etl::state_chart_ctp<MotorControl,
+                       int,
+                       motorControl,
+                       transitionTable,
+                       7,
+                       stateTable,
+                       3,
+                       StateId::IDLE,
+                       true> motorControlIndexedStateChart;
+#endif
+
   SUITE(test_state_chart_compile_time_with_data_parameter)
   {
     //*************************************************************************
@@ -504,5 +516,56 @@ namespace
       motorControlStateChart.process_event(EventId::ABORT, 5);
       CHECK_EQUAL(StateId::IDLE, int(motorControlStateChart.get_state_id()));
     }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_state_chart_with_transition_index)
+    {
+      motorControl.ClearStatistics();
+
+      motorControlIndexedStateChart.start();
+      CHECK_EQUAL(true, motorControl.entered_idle);
+
+      // Send unhandled events.
+      motorControlIndexedStateChart.process_event(EventId::STOP, 0);
+      motorControlIndexedStateChart.process_event(EventId::STOPPED, 0);
+      CHECK_EQUAL(StateId::IDLE, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(0, motorControl.stopCount);
+      CHECK_EQUAL(0, motorControl.stoppedCount);
+
+      // The first transition's guard fails, so the second is used.
+      motorControl.guard = false;
+      motorControlIndexedStateChart.process_event(EventId::START, 0);
+      CHECK_EQUAL(StateId::IDLE, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(0, motorControl.startCount);
+      CHECK_EQUAL(1, motorControl.null);
+
+      motorControl.guard = true;
+      motorControlIndexedStateChart.process_event(EventId::START, 0);
+      CHECK_EQUAL(StateId::RUNNING, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(1, motorControl.startCount);
+      CHECK_EQUAL(true, motorControl.isLampOn);
+
+      motorControlIndexedStateChart.process_event(EventId::SET_SPEED, 0);
+      CHECK_EQUAL(StateId::RUNNING, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(1, motorControl.setSpeedCount);
+      CHECK_EQUAL(100, motorControl.speed);
+
+      motorControlIndexedStateChart.process_event(EventId::STOP, 0);
+      CHECK_EQUAL(StateId::WINDING_DOWN, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(1, motorControl.stopCount);
+      CHECK_EQUAL(1, motorControl.windingDown);
+
+      motorControlIndexedStateChart.process_event(EventId::STOPPED, 0);
+      CHECK_EQUAL(StateId::IDLE, int(motorControlIndexedStateChart.get_state_id()));
+      CHECK_EQUAL(1, motorControl.stoppedCount);
+      CHECK_EQUAL(0, motorControl.windingDown);
+
+      // From any state.
+      motorControlIndexedStateChart.process_event(EventId::START, 0);
+      motorControlIndexedStateChart.process_event(EventId::ABORT, 0);
+      CHECK_EQUAL(StateId::IDLE, int(motorControlIndexedStateChart.get_state_id()));
+    }
+#endif
   };
 }
@@ -4063,6 +4063,52 @@ namespace
       CHECK_EQUAL(position1, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_long_text)
+    {
+      // Long enough to cover whole and partial blocks in every search.
+      Compare_Text compare_text;
+      uint32_t     seed = 1U;
+
+      for (size_t i = 0U; i < 150U; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        compare_text += value_t(STR('a') + ((seed >> 16U) % 5U));
+      }
+
+      compare_text[100] = STR(',');
+
+      etl::string<150> text(compare_text.data(), compare_text.size());
+
+      const value_t* needles[] = { STR("a"), STR("ab"), STR("cde"), STR("eeee"), STR("abcab"), STR(","), STR("e,a"), STR("zz") };
+      const value_t* sets[]    = { STR(""), STR("a"), STR("e,"), STR("abc"), STR("bcde"), STR("abcd,xyz"), STR("abcde,") };
+
+      for (size_t position = 0U; position <= (compare_text.size() + 1U); ++position)
+      {
+        for (size_t i = 0U; i < (sizeof(needles) / sizeof(needles[0])); ++i)
+        {
+          const size_t length = etl::strlen(needles[i]);
+
+          // etl::istring::rfind only matches occurrences that end at or before the position.
+          const size_t end           = std::min(position, compare_text.size());
+          const size_t compare_rfind = (length <= end) ? compare_text.rfind(needles[i], end - length) : Compare_Text::npos;
+
+          CHECK_EQUAL(compare_text.find(needles[i], position), text.find(needles[i], position));
+          CHECK_EQUAL(compare_rfind,                           text.rfind(needles[i], position));
+        }
+
+        CHECK_EQUAL(compare_text.find(STR(','), position), text.find(STR(','), position));
+
+        for (size_t i = 0U; i < (sizeof(sets) / sizeof(sets[0])); ++i)
+        {
+          CHECK_EQUAL(compare_text.find_first_of(sets[i], position),     text.find_first_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find_last_of(sets[i], position),      text.find_last_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find_first_not_of(sets[i], position), text.find_first_not_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find_last_not_of(sets[i], position),  text.find_last_not_of(sets[i], position));
+        }
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_hash)
     {
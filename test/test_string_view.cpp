@@ -985,6 +985,76 @@ namespace
       CHECK(View::npos == view.find_last_not_of(s6, 10, 8));
     }
 
+    //*************************************************************************
+    TEST(test_find_long_text)
+    {
+      // Long enough to cover whole and partial blocks in every search.
+      std::string compare_text;
+      uint32_t    seed = 1U;
+
+      for (size_t i = 0U; i < 150U; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        compare_text += char('a' + ((seed >> 16U) % 5U));
+      }
+
+      compare_text[100] = ',';
+
+      View view(compare_text.data(), compare_text.size());
+
+      const char* needles[] = { "a", "ab", "cde", "eeee", "abcab", ",", "e,a", "zz" };
+      const char* sets[]    = { "", "a", "e,", "abc", "bcde", "abcd,xyz", "abcde," };
+
+      for (size_t position = 0U; position <= (compare_text.size() + 1U); ++position)
+      {
+        for (size_t i = 0U; i < (sizeof(needles) / sizeof(needles[0])); ++i)
+        {
+          const size_t length = strlen(needles[i]);
+
+          // etl::string_view::rfind only matches occurrences that end at or before the position.
+          const size_t end            = std::min(position, compare_text.size());
+          const size_t compare_rfind  = (length <= end) ? compare_text.rfind(needles[i], end - length) : std::string::npos;
+
+          CHECK_EQUAL(compare_text.find(needles[i], position), view.find(needles[i], position));
+          CHECK_EQUAL(compare_rfind,                           view.rfind(needles[i], position));
+        }
+
+        CHECK_EQUAL(compare_text.find(',', position), view.find(',', position));
+
+        for (size_t i = 0U; i < (sizeof(sets) / sizeof(sets[0])); ++i)
+        {
+          CHECK_EQUAL(compare_text.find_first_of(sets[i], position),     view.find_first_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find_last_of(sets[i], position),      view.find_last_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find_first_not_of(sets[i], position), view.find_first_not_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find_last_not_of(sets[i], position),  view.find_last_not_of(sets[i], position));
+        }
+      }
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_find_constexpr)
+    {
+      constexpr View view("key=value;key2=value2");
+
+      constexpr size_t find              = view.find("key2");
+      constexpr size_t find_char         = view.find(';');
+      constexpr size_t rfind             = view.rfind("value");
+      constexpr size_t find_first_of     = view.find_first_of("=;");
+      constexpr size_t find_last_of      = view.find_last_of("=;");
+      constexpr size_t find_first_not_of = view.find_first_not_of("eky");
+      constexpr size_t find_last_not_of  = view.find_last_not_of("2eluav");
+
+      CHECK_EQUAL(10U, find);
+      CHECK_EQUAL(9U,  find_char);
+      CHECK_EQUAL(15U, rfind);
+      CHECK_EQUAL(3U,  find_first_of);
+      CHECK_EQUAL(14U, find_last_of);
+      CHECK_EQUAL(3U,  find_first_not_of);
+      CHECK_EQUAL(14U, find_last_not_of);
+    }
+#endif
+
     //*************************************************************************
     TEST(test_hash)
     {
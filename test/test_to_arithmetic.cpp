@@ -31,6 +31,9 @@ SOFTWARE.
 #include <ostream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <string>
 
 #include "etl/to_arithmetic.h"
 #include "etl/string.h"
@@ -572,6 +575,42 @@ namespace
       CHECK(!etl::to_arithmetic<uint64_t>(uint64_overflow_max.c_str(), uint64_overflow_max.size(), etl::dec));
     }
 
+    //*************************************************************************
+    TEST(test_long_decimal_numerics)
+    {
+      const Text text1(STR("12345678"));
+      const Text text2(STR("1234567890123456789"));
+      const Text text3(STR("-0000000000000000000000000123"));
+      const Text text4(STR("00000000000000000000000000000000000000000042"));
+      const Text text5(STR("1234567x"));
+      const Text text6(STR("123456789012345678x"));
+      const Text text7(STR("99999999999x"));
+      const Text text8(STR("9999x99999999"));
+      const Text text9(STR("12345678901234567890"));
+
+      CHECK_EQUAL(12345678, etl::to_arithmetic<int32_t>(text1.c_str(), text1.size()).value());
+      CHECK_EQUAL(12345678U, etl::to_arithmetic<uint32_t>(text1.c_str(), text1.size()).value());
+      CHECK_EQUAL(1234567890123456789LL, etl::to_arithmetic<int64_t>(text2.c_str(), text2.size()).value());
+      CHECK_EQUAL(-123, etl::to_arithmetic<int32_t>(text3.c_str(), text3.size()).value());
+      CHECK_EQUAL(-123, etl::to_arithmetic<int8_t>(text3.c_str(), text3.size()).value());
+      CHECK_EQUAL(42, etl::to_arithmetic<uint8_t>(text4.c_str(), text4.size()).value());
+      CHECK_EQUAL(12345678901234567890ULL, etl::to_arithmetic<uint64_t>(text9.c_str(), text9.size()).value());
+
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<int32_t>(text5.c_str(), text5.size()).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<int64_t>(text6.c_str(), text6.size()).error());
+
+      // Overflow is reported if it happens before an invalid character.
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow,       etl::to_arithmetic<int32_t>(text7.c_str(), text7.size()).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<int64_t>(text7.c_str(), text7.size()).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow,       etl::to_arithmetic<int8_t>(text8.c_str(), text8.size()).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<int16_t>(text8.c_str(), text8.size()).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow,       etl::to_arithmetic<int64_t>(text9.c_str(), text9.size()).error());
+
+      // Wide characters.
+      const std::u16string text10(u"-1234567890123");
+      CHECK_EQUAL(-1234567890123LL, etl::to_arithmetic<int64_t>(text10.c_str(), text10.size()).value());
+    }
+
     //*************************************************************************
     TEST(test_invalid_hex_numerics)
     {
@@ -906,6 +945,58 @@ namespace
       CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<double>(text.c_str(), text.size()).error());
     }
 
+    //*************************************************************************
+    TEST(test_correctly_rounded_float_and_double)
+    {
+      const char* texts[] =
+      {
+        "0", "-0", "1", "0.1", "0.3", "3.14159265358979323846", "1e23", "8.5", "9.5",
+        "2.2250738585072011e-308", "2.2250738585072014e-308", "4.9406564584124654e-324", "2.4703282292062328e-324",
+        "1.7976931348623157e308", "1.7976931348623158e308",
+        "9007199254740993", "9007199254740992.5", "9007199254740993.0000000000000000000000001",
+        "16777217", "16777216.5", "16777217.000000000000000000000000001",
+        "3.4028234663852886e38", "1.4012984643248171e-45", "7.006492321624085e-46", "1.17549435e-38",
+        "4951760157141521099596496896", "123456789012345678901234567890e-30", "0.000000000000000000000000000000000000000000001",
+        "5.0", "2.5e-1", "1234,5678", "5e-324", "1e-400", "0e999", "000000000000000000000000000000001.5"
+      };
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(texts); ++i)
+      {
+        const Text text(texts[i]);
+
+        etl::to_arithmetic_result<double> d = etl::to_arithmetic<double>(text.c_str(), text.size());
+        etl::to_arithmetic_result<float>  f = etl::to_arithmetic<float>(text.c_str(), text.size());
+
+        std::string c_text(texts[i]);
+        std::replace(c_text.begin(), c_text.end(), ',', '.');
+
+        CHECK(d.has_value());
+        CHECK_EQUAL(strtod(c_text.c_str(), nullptr), d.value());
+
+        if (fabs(strtod(c_text.c_str(), nullptr)) < 3.4028236e38)
+        {
+          CHECK(f.has_value());
+          CHECK_EQUAL(strtof(c_text.c_str(), nullptr), f.value());
+        }
+        else
+        {
+          CHECK_EQUAL(etl::to_arithmetic_status::Overflow, f.error());
+        }
+      }
+
+      // Beyond the largest value.
+      const Text text1(STR("1.7976931348623159e308"));
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<double>(text1.c_str(), text1.size()).error());
+
+      const Text text2(STR("3.4028236e38"));
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<float>(text2.c_str(), text2.size()).error());
+
+      // The sign of the exponent may only follow the exponent character.
+      const Text text3(STR("1e5-3"));
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<double>(text3.c_str(), text3.size()).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<long double>(text3.c_str(), text3.size()).error());
+    }
+
     //*************************************************************************
     TEST(test_valid_long_double)
     {
@@ -1036,6 +1127,13 @@ namespace
       constexpr int i = result.value();
 
       CHECK_EQUAL(123, i);
+
+      constexpr Text::const_pointer long_text{ STR("-1234567890123456789") };
+
+      constexpr etl::to_arithmetic_result<int64_t> long_result = etl::to_arithmetic<int64_t>(long_text, 20U, etl::radix::decimal);
+      constexpr int64_t l = long_result.value();
+
+      CHECK_EQUAL(-1234567890123456789LL, l);
     }
   }
 }
@@ -31,6 +31,9 @@ SOFTWARE.
 #include <ostream>
 #include <sstream>
 #include <iomanip>
+#include <random>
+#include <stdlib.h>
+#include <string.h>
 
 #include "etl/to_string.h"
 #include "etl/string.h"
@@ -662,6 +665,192 @@ namespace
       CHECK_EQUAL(etl::string<20>(STR("-124.0000")).c_str(), result_i.c_str());
       CHECK_EQUAL(result_d.c_str(), result_i.c_str());
     }
+
+    //*************************************************************************
+    TEST(test_integral_all_digit_counts)
+    {
+      etl::string<32> str;
+
+      uint64_t value = 1U;
+
+      // Every digit count, and the values either side of each power of 10.
+      for (int i = 0; i < 20; ++i)
+      {
+        const uint64_t values[] = { value - 1U, value, value + 1U, value * 9U + (value - 1U) };
+
+        for (size_t v = 0U; v < 4U; ++v)
+        {
+          std::ostringstream oss;
+
+          oss << values[v];
+          CHECK_EQUAL(oss.str().c_str(), etl::to_string(values[v], str).c_str());
+
+          oss.str("");
+          oss << std::hex << std::showbase << std::uppercase << values[v];
+          CHECK_EQUAL(oss.str().c_str(), etl::to_string(values[v], str, Format().hex().show_base(true).upper_case(true)).c_str());
+
+          oss.str("");
+          oss << std::oct << std::showbase << values[v];
+          CHECK_EQUAL(oss.str().c_str(), etl::to_string(values[v], str, Format().octal().show_base(true)).c_str());
+
+          oss.str("");
+          oss << std::dec << std::noshowbase << std::setw(24) << std::setfill('*') << std::left << -int64_t(values[v] / 2U);
+          CHECK_EQUAL(oss.str().c_str(), etl::to_string(-int64_t(values[v] / 2U), str, Format().width(24).fill(STR('*')).left()).c_str());
+        }
+
+        if (i < 19)
+        {
+          value *= 10U;
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_integral_binary_show_base_append)
+    {
+      etl::string<40> str(STR("value="));
+
+      etl::to_string(uint8_t(0xA5), str, Format().binary().show_base(true).width(12).fill(STR('.')).right(), true);
+      CHECK_EQUAL(etl::string<40>(STR("value=..0b10100101")).c_str(), str.c_str());
+
+      etl::to_string(uint8_t(0), str, Format().binary().show_base(true).width(3).left(), true);
+      CHECK_EQUAL(etl::string<40>(STR("value=..0b101001010  ")).c_str(), str.c_str());
+
+      etl::to_string(35, str, Format().base(36).upper_case(true), true);
+      CHECK_EQUAL(etl::string<40>(STR("value=..0b101001010  Z")).c_str(), str.c_str());
+    }
+
+    //*************************************************************************
+    TEST(test_integral_truncated)
+    {
+      etl::string<4> str;
+
+      etl::to_string(123456789, str);
+      CHECK_EQUAL(etl::string<4>(STR("1234")).c_str(), str.c_str());
+      CHECK(str.is_truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest)
+    {
+      etl::string<32> str;
+
+      const Format format = Format().shortest();
+
+      CHECK_EQUAL(etl::string<32>(STR("0")).c_str(),                       etl::to_string(0.0, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("-0")).c_str(),                      etl::to_string(-0.0, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("0.1")).c_str(),                     etl::to_string(0.1, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("0.30000000000000004")).c_str(),     etl::to_string(0.1 + 0.2, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("123456")).c_str(),                  etl::to_string(123456.0, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("-1.5")).c_str(),                    etl::to_string(-1.5, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("0.001")).c_str(),                   etl::to_string(0.001, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("1e-04")).c_str(),                   etl::to_string(0.0001, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("1e+23")).c_str(),                   etl::to_string(1e23, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("5e-324")).c_str(),                  etl::to_string(5e-324, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("2.2250738585072014e-308")).c_str(), etl::to_string(2.2250738585072014e-308, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("1.7976931348623157e+308")).c_str(), etl::to_string(1.7976931348623157e308, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("1.7976931348623157E+308")).c_str(), etl::to_string(1.7976931348623157e308, str, Format().shortest().upper_case(true)).c_str());
+
+      CHECK_EQUAL(etl::string<32>(STR("0.1")).c_str(),                     etl::to_string(0.1f, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("3.4028235e+38")).c_str(),           etl::to_string(3.4028235e38f, str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("1e-45")).c_str(),                   etl::to_string(1e-45f, str, format).c_str());
+
+      CHECK_EQUAL(etl::string<32>(STR("nan")).c_str(),                     etl::to_string(etl::numeric_limits<double>::quiet_NaN(), str, format).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("inf")).c_str(),                     etl::to_string(etl::numeric_limits<double>::infinity(), str, format).c_str());
+
+      CHECK_EQUAL(etl::string<32>(STR("    2.5")).c_str(),                 etl::to_string(2.5, str, Format().shortest().width(7)).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("2.5****")).c_str(),                 etl::to_string(2.5, str, Format().shortest().width(7).fill(STR('*')).left()).c_str());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest_round_trip)
+    {
+      etl::string<32> str;
+
+      std::mt19937_64 rng(1);
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint64_t bits = rng();
+        double   value;
+        memcpy(&value, &bits, sizeof(value));
+
+        if (isfinite(value))
+        {
+          etl::to_string(value, str, Format().shortest());
+          CHECK_EQUAL(value, strtod(str.c_str(), ETL_NULLPTR));
+        }
+
+        uint32_t fbits = uint32_t(bits);
+        float    fvalue;
+        memcpy(&fvalue, &fbits, sizeof(fvalue));
+
+        if (isfinite(fvalue))
+        {
+          etl::to_string(fvalue, str, Format().shortest());
+          CHECK_EQUAL(fvalue, strtof(str.c_str(), ETL_NULLPTR));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_scientific)
+    {
+      etl::string<32> str;
+
+      CHECK_EQUAL(etl::string<32>(STR("1.235e+03")).c_str(),  etl::to_string(1234.5678, str, Format().scientific().precision(3)).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("-1.235E-03")).c_str(), etl::to_string(-0.0012345678, str, Format().scientific().precision(3).upper_case(true)).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("1e+02")).c_str(),      etl::to_string(123.0, str, Format().scientific()).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("0.00e+00")).c_str(),   etl::to_string(0.0, str, Format().scientific().precision(2)).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("1.00e+01")).c_str(),   etl::to_string(9.9999, str, Format().scientific().precision(2)).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("1.500000e+300")).c_str(), etl::to_string(1.5e300, str, Format().scientific().precision(6)).c_str());
+      CHECK_EQUAL(etl::string<32>(STR("2.5e-320")).c_str(),   etl::to_string(2.5e-320, str, Format().scientific().precision(1)).c_str());
+
+      // 2.675 is stored as 2.67499999999999982236431605997495353221893310546875
+      CHECK_EQUAL(etl::string<32>(STR("2.67e+00")).c_str(),   etl::to_string(2.675, str, Format().scientific().precision(2)).c_str());
+      // 0.375 is exact, so rounds away from zero.
+      CHECK_EQUAL(etl::string<32>(STR("3.8e-01")).c_str(),    etl::to_string(0.375, str, Format().scientific().precision(1)).c_str());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_fixed_precision)
+    {
+      etl::string<64> str;
+
+      CHECK_EQUAL(etl::string<64>(STR("0.10000000000000000555")).c_str(),  etl::to_string(0.1, str, Format().precision(20)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("100000000000000000000.0")).c_str(), etl::to_string(1e20, str, Format().precision(1)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("3")).c_str(),                       etl::to_string(2.5, str, Format().precision(0)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("2.67")).c_str(),                    etl::to_string(2.675, str, Format().precision(2)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("0.000")).c_str(),                   etl::to_string(0.0004, str, Format().precision(3)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("0.001")).c_str(),                   etl::to_string(0.0005, str, Format().precision(3)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("-0.00")).c_str(),                   etl::to_string(-0.0001, str, Format().precision(2)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("1000.00")).c_str(),                 etl::to_string(999.999, str, Format().precision(2)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("0.1234567890123")).c_str(),         etl::to_string(0.1234567890123, str, Format().precision(13)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("12345678901234568.0")).c_str(),     etl::to_string(12345678901234567.0, str, Format().precision(1)).c_str());
+
+      // Digits beyond the shortest are those of the exact value, as printf.
+      CHECK_EQUAL(etl::string<64>(STR("-6168984753.2572594")).c_str(),     etl::to_string(-6168984753.2572594, str, Format().precision(7)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("0.100000000000000005551115123126")).c_str(), etl::to_string(0.1, str, Format().precision(30)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("9.99999999999999916114e+22")).c_str(), etl::to_string(1e23, str, Format().scientific().precision(20)).c_str());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_float_fixed_precision)
+    {
+      etl::string<64> str;
+
+      // The same as printf("%.*f") of the float.
+      CHECK_EQUAL(etl::string<64>(STR("1234.567749")).c_str(),  etl::to_string(1234.5678f, str, Format().precision(6)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("0.100000")).c_str(),     etl::to_string(0.1f, str, Format().precision(6)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("3.142")).c_str(),        etl::to_string(3.14159f, str, Format().precision(3)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("1.1000000238")).c_str(), etl::to_string(1.1f, str, Format().precision(10)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("-2.35")).c_str(),        etl::to_string(-2.345f, str, Format().precision(2)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("16777216.000000")).c_str(), etl::to_string(16777217.0f, str, Format().precision(6)).c_str());
+      CHECK_EQUAL(etl::string<64>(STR("1.0000000149e-01")).c_str(), etl::to_string(0.1f, str, Format().scientific().precision(10)).c_str());
+
+      // 123456.789f is exactly 123456.7890625, so the tie rounds away from zero.
+      CHECK_EQUAL(etl::string<64>(STR("123456.789063")).c_str(), etl::to_string(123456.789f, str, Format().precision(6)).c_str());
+    }
   };
 }
 
@@ -0,0 +1,285 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/tokenizer.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  template <typename TTokenizer>
+  std::vector<std::string> get_tokens(const TTokenizer& tokenizer)
+  {
+    std::vector<std::string> tokens;
+
+    for (typename TTokenizer::const_iterator itr = tokenizer.begin(); itr != tokenizer.end(); ++itr)
+    {
+      tokens.push_back(std::string(itr->data(), itr->size()));
+    }
+
+    return tokens;
+  }
+
+  //***************************************************************************
+  std::vector<std::string> make_tokens(std::initializer_list<const char*> init)
+  {
+    return std::vector<std::string>(init.begin(), init.end());
+  }
+
+  SUITE(test_tokenizer)
+  {
+    //*************************************************************************
+    TEST(test_single_delimiter)
+    {
+      etl::tokenizer tokenizer("The,cat,sat", ",");
+
+      CHECK(make_tokens({ "The", "cat", "sat" }) == get_tokens(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_delimiter_set)
+    {
+      etl::tokenizer tokenizer("The cat;sat,on the:mat", " ;,:");
+
+      CHECK(make_tokens({ "The", "cat", "sat", "on", "the", "mat" }) == get_tokens(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_large_delimiter_set)
+    {
+      // More delimiters than are matched a block at a time.
+      etl::tokenizer tokenizer("The cat;sat,on the:mat.and|the-dog", " ;,:.|-");
+
+      CHECK(make_tokens({ "The", "cat", "sat", "on", "the", "mat", "and", "the", "dog" }) == get_tokens(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_empty_tokens)
+    {
+      etl::tokenizer tokenizer(",The,,cat,", ",");
+
+      CHECK(make_tokens({ "", "The", "", "cat", "" }) == get_tokens(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_ignore_empty_tokens)
+    {
+      etl::tokenizer tokenizer(",The,,cat,", ",", true);
+
+      CHECK(make_tokens({ "The", "cat" }) == get_tokens(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_empty_input)
+    {
+      etl::tokenizer tokenizer1("", ",");
+      etl::tokenizer tokenizer2("", ",", true);
+      etl::tokenizer tokenizer3(etl::string_view(), ",");
+
+      CHECK(make_tokens({ "" }) == get_tokens(tokenizer1));
+      CHECK(get_tokens(tokenizer2).empty());
+      CHECK(make_tokens({ "" }) == get_tokens(tokenizer3));
+    }
+
+    //*************************************************************************
+    TEST(test_no_delimiters)
+    {
+      etl::tokenizer tokenizer("The,cat", "");
+
+      CHECK(make_tokens({ "The,cat" }) == get_tokens(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_tokens_are_views_of_the_input)
+    {
+      etl::string<20> text("The,cat,sat");
+      etl::tokenizer  tokenizer(text, ",");
+
+      etl::tokenizer::iterator itr = tokenizer.begin();
+
+      CHECK(itr->data() == text.data());
+      ++itr;
+      CHECK(itr->data() == (text.data() + 4));
+      ++itr;
+      CHECK(itr->data() == (text.data() + 8));
+      ++itr;
+      CHECK(itr == tokenizer.end());
+    }
+
+    //*************************************************************************
+    TEST(test_quoted)
+    {
+      etl::tokenizer tokenizer("1,\"a,b\",\"c\"\"d,e\",\"f\"g,h", ",", '"');
+
+      CHECK(make_tokens({ "1", "\"a,b\"", "\"c\"\"d,e\"", "\"f\"g", "h" }) == get_tokens(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_unterminated_quote)
+    {
+      etl::tokenizer tokenizer("1,\"a,b,c", ",", '"');
+
+      CHECK(make_tokens({ "1", "\"a,b,c" }) == get_tokens(tokenizer));
+    }
+
+    //*************************************************************************
+    TEST(test_next)
+    {
+      etl::tokenizer   tokenizer("The,cat,,sat", ",", true);
+      etl::string_view token;
+
+      CHECK(!tokenizer.finished());
+      CHECK(tokenizer.next(token));
+      CHECK(token == etl::string_view("The"));
+      CHECK(tokenizer.next(token));
+      CHECK(token == etl::string_view("cat"));
+      CHECK(tokenizer.next(token));
+      CHECK(token == etl::string_view("sat"));
+      CHECK(tokenizer.finished());
+      CHECK(!tokenizer.next(token));
+      CHECK(token == etl::string_view("sat"));
+
+      tokenizer.reset();
+      CHECK(tokenizer.next(token));
+      CHECK(token == etl::string_view("The"));
+    }
+
+    //*************************************************************************
+    TEST(test_iterator_post_increment)
+    {
+      etl::tokenizer tokenizer("The,cat", ",");
+
+      etl::tokenizer::iterator itr = tokenizer.begin();
+      etl::tokenizer::iterator old = itr++;
+
+      CHECK(*old == etl::string_view("The"));
+      CHECK(*itr == etl::string_view("cat"));
+      CHECK(old != itr);
+      CHECK(++itr == tokenizer.end());
+    }
+
+    //*************************************************************************
+    TEST(test_long_input)
+    {
+      // Long enough to cover whole and partial blocks.
+      std::string              text;
+      std::vector<std::string> expected;
+
+      for (size_t i = 0U; i < 200U; ++i)
+      {
+        std::string field(i % 37U, char('a' + (i % 26U)));
+
+        expected.push_back(field);
+        text += field;
+        text += (i % 3U == 0U) ? ',' : ';';
+      }
+
+      text.erase(text.size() - 1U);
+
+      etl::tokenizer tokenizer1(etl::string_view(text.data(), text.size()), ",;");
+      etl::tokenizer tokenizer2(etl::string_view(text.data(), text.size()), ",;:.|-+");
+
+      CHECK(expected == get_tokens(tokenizer1));
+      CHECK(expected == get_tokens(tokenizer2));
+    }
+
+    //*************************************************************************
+    TEST(test_wide_characters)
+    {
+      etl::u16tokenizer tokenizer(u"The,cat;\"sat,on\"", u",;", u'"');
+
+      etl::u16tokenizer::iterator itr = tokenizer.begin();
+
+      CHECK(*itr++ == etl::u16string_view(u"The"));
+      CHECK(*itr++ == etl::u16string_view(u"cat"));
+      CHECK(*itr++ == etl::u16string_view(u"\"sat,on\""));
+      CHECK(itr == tokenizer.end());
+    }
+
+    //*************************************************************************
+    TEST(test_split_view)
+    {
+      etl::split_view splitter("The::cat:sat::::on", "::");
+
+      CHECK(make_tokens({ "The", "cat:sat", "", "on" }) == get_tokens(splitter));
+    }
+
+    //*************************************************************************
+    TEST(test_split_view_ignore_empty_tokens)
+    {
+      etl::split_view splitter("\r\nThe\r\n\r\ncat\r\n", "\r\n", true);
+
+      CHECK(make_tokens({ "The", "cat" }) == get_tokens(splitter));
+    }
+
+    //*************************************************************************
+    TEST(test_split_view_empty_delimiter)
+    {
+      etl::split_view splitter("The cat", "");
+
+      CHECK(make_tokens({ "The cat" }) == get_tokens(splitter));
+    }
+
+    //*************************************************************************
+    TEST(test_split_view_quoted)
+    {
+      etl::split_view splitter("1, \"a, b\", 'c', \"d, e", ", ", '"');
+
+      CHECK(make_tokens({ "1", "\"a, b\"", "'c'", "\"d, e" }) == get_tokens(splitter));
+    }
+
+    //*************************************************************************
+    TEST(test_split_view_long_input)
+    {
+      // Long enough to cover whole and partial blocks.
+      std::string              text;
+      std::vector<std::string> expected;
+
+      for (size_t i = 0U; i < 200U; ++i)
+      {
+        std::string field(i % 37U, char('a' + (i % 26U)));
+
+        expected.push_back(field);
+        text += field;
+        text += "<->";
+      }
+
+      text.erase(text.size() - 3U);
+
+      etl::split_view splitter(etl::string_view(text.data(), text.size()), "<->");
+
+      CHECK(expected == get_tokens(splitter));
+    }
+  };
+}
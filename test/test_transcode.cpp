@@ -0,0 +1,424 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/transcode.h"
+#include "etl/string.h"
+#include "etl/u16string.h"
+#include "etl/u32string.h"
+#include "etl/wstring.h"
+
+#include <vector>
+
+namespace
+{
+  // 'a', e acute, euro, grinning face.
+  const char     Utf8[]  = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+  const char16_t Utf16[] = { 0x0061, 0x00E9, 0x20AC, 0xD83D, 0xDE00, 0 };
+  const char32_t Utf32[] = { 0x61, 0xE9, 0x20AC, 0x1F600, 0 };
+
+  const size_t Utf8_Length  = 10U;
+  const size_t Utf16_Length = 5U;
+  const size_t Utf32_Length = 4U;
+
+  //***************************************************************************
+  // Code points that cover every encoded length, and the surrogate boundaries.
+  std::vector<char32_t> make_code_points()
+  {
+    const char32_t samples[] = { 0x7F, 0x80, 0x7FF, 0x800, 0xD7FF, 0xE000, 0xFFFF, 0x10000, 0x10FFFF };
+
+    std::vector<char32_t> code_points;
+
+    for (size_t i = 0U; i < 500U; ++i)
+    {
+      // Runs of ASCII of varying lengths, to cross the block boundaries.
+      for (size_t j = 0U; j < (i % 41U); ++j)
+      {
+        code_points.push_back(char32_t('A' + (j % 26U)));
+      }
+
+      code_points.push_back(samples[i % (sizeof(samples) / sizeof(samples[0]))]);
+    }
+
+    return code_points;
+  }
+
+  //***************************************************************************
+  size_t utf8_length(const std::vector<char32_t>& code_points)
+  {
+    size_t length = 0U;
+
+    for (size_t i = 0U; i < code_points.size(); ++i)
+    {
+      length += (code_points[i] < 0x80) ? 1U : (code_points[i] < 0x800) ? 2U : (code_points[i] < 0x10000) ? 3U : 4U;
+    }
+
+    return length;
+  }
+
+  //***************************************************************************
+  template <typename TIn>
+  etl::transcode_result to_utf32(const TIn* input, size_t length)
+  {
+    char32_t output[16];
+
+    return etl::transcode(input, length, output, 16U);
+  }
+
+  SUITE(test_transcode)
+  {
+    //*************************************************************************
+    TEST(test_utf8_to_utf16)
+    {
+      etl::u16string<20> output;
+
+      etl::transcode_result result = etl::transcode(etl::string_view(Utf8), output);
+
+      CHECK(result.is_valid());
+      CHECK_EQUAL(Utf8_Length,  result.read);
+      CHECK_EQUAL(Utf16_Length, result.written);
+      CHECK(etl::u16string<20>(Utf16) == output);
+    }
+
+    //*************************************************************************
+    TEST(test_utf8_to_utf32)
+    {
+      etl::u32string<20> output;
+
+      etl::transcode_result result = etl::transcode(etl::string_view(Utf8), output);
+
+      CHECK(result.is_valid());
+      CHECK_EQUAL(Utf8_Length,  result.read);
+      CHECK_EQUAL(Utf32_Length, result.written);
+      CHECK(etl::u32string<20>(Utf32) == output);
+    }
+
+    //*************************************************************************
+    TEST(test_utf16_to_utf8)
+    {
+      etl::string<20> output;
+
+      etl::transcode_result result = etl::transcode(etl::u16string_view(Utf16), output);
+
+      CHECK(result.is_valid());
+      CHECK_EQUAL(Utf16_Length, result.read);
+      CHECK_EQUAL(Utf8_Length,  result.written);
+      CHECK(etl::string<20>(Utf8) == output);
+    }
+
+    //*************************************************************************
+    TEST(test_utf32_to_utf8)
+    {
+      etl::string<20> output;
+
+      etl::transcode_result result = etl::transcode(etl::u32string_view(Utf32), output);
+
+      CHECK(result.is_valid());
+      CHECK_EQUAL(Utf32_Length, result.read);
+      CHECK_EQUAL(Utf8_Length,  result.written);
+      CHECK(etl::string<20>(Utf8) == output);
+    }
+
+    //*************************************************************************
+    TEST(test_utf16_to_utf32)
+    {
+      etl::u32string<20> output;
+
+      etl::transcode_result result = etl::transcode(etl::u16string_view(Utf16), output);
+
+      CHECK(result.is_valid());
+      CHECK(etl::u32string<20>(Utf32) == output);
+    }
+
+    //*************************************************************************
+    TEST(test_utf32_to_utf16)
+    {
+      etl::u16string<20> output;
+
+      etl::transcode_result result = etl::transcode(etl::u32string_view(Utf32), output);
+
+      CHECK(result.is_valid());
+      CHECK(etl::u16string<20>(Utf16) == output);
+    }
+
+    //*************************************************************************
+    TEST(test_same_encoding_validates)
+    {
+      etl::string<20> output;
+
+      etl::transcode_result result = etl::transcode(etl::string_view(Utf8), output);
+
+      CHECK(result.is_valid());
+      CHECK(etl::string<20>(Utf8) == output);
+
+      result = etl::transcode(etl::string_view("a\xC3"), output);
+
+      CHECK(result.status == etl::transcode_status::Incomplete_Sequence);
+      CHECK(etl::string<20>("a") == output);
+    }
+
+    //*************************************************************************
+    TEST(test_from_string)
+    {
+      etl::string<20>    input(Utf8);
+      etl::u16string<20> output;
+
+      etl::transcode_result result = etl::transcode(input, output);
+
+      CHECK(result.is_valid());
+      CHECK(etl::u16string<20>(Utf16) == output);
+    }
+
+    //*************************************************************************
+    TEST(test_wide_string)
+    {
+      etl::wstring<20> wide;
+      etl::string<20>  output;
+
+      etl::transcode_result result = etl::transcode(etl::string_view(Utf8), wide);
+
+      CHECK(result.is_valid());
+      CHECK_EQUAL((sizeof(wchar_t) == 2U) ? Utf16_Length : Utf32_Length, wide.size());
+
+      result = etl::transcode(wide, output);
+
+      CHECK(result.is_valid());
+      CHECK(etl::string<20>(Utf8) == output);
+    }
+
+    //*************************************************************************
+    TEST(test_append)
+    {
+      etl::u16string<20> output(u"xy");
+
+      etl::transcode_result result = etl::transcode(etl::string_view(Utf8), output, true);
+
+      CHECK(result.is_valid());
+      CHECK_EQUAL(Utf16_Length, result.written);
+      CHECK_EQUAL(2U + Utf16_Length, output.size());
+      CHECK(etl::u16string<20>(u"xy") == output.substr(0U, 2U));
+      CHECK(etl::u16string<20>(Utf16) == output.substr(2U));
+    }
+
+    //*************************************************************************
+    TEST(test_span)
+    {
+      char16_t output[Utf16_Length];
+
+      etl::span<const char> input(Utf8, Utf8_Length);
+
+      etl::transcode_result result = etl::transcode(input, etl::span<char16_t>(output));
+
+      CHECK(result.is_valid());
+      CHECK_EQUAL(Utf16_Length, result.written);
+      CHECK_ARRAY_EQUAL(Utf16, output, Utf16_Length);
+    }
+
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::u16string<20> output(u"xy");
+
+      etl::transcode_result result = etl::transcode(etl::string_view(), output);
+
+      CHECK(result.is_valid());
+      CHECK_EQUAL(0U, result.read);
+      CHECK_EQUAL(0U, result.written);
+      CHECK(output.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_truncated)
+    {
+      etl::string<5> output;
+
+      // 'a' and e acute fit, the euro does not.
+      etl::transcode_result result = etl::transcode(etl::u32string_view(Utf32), output);
+
+      CHECK(result.status == etl::transcode_status::Truncated);
+      CHECK_EQUAL(2U, result.read);
+      CHECK_EQUAL(3U, result.written);
+      CHECK(etl::string<5>("a\xC3\xA9") == output);
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+      CHECK(output.is_truncated());
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_truncated_surrogate_pair)
+    {
+      char16_t output[4];
+
+      // The surrogate pair is not split.
+      etl::transcode_result result = etl::transcode(Utf32, Utf32_Length, output, 4U);
+
+      CHECK(result.status == etl::transcode_status::Truncated);
+      CHECK_EQUAL(3U, result.read);
+      CHECK_EQUAL(3U, result.written);
+    }
+
+    //*************************************************************************
+    TEST(test_truncated_ascii)
+    {
+      etl::u16string<20> output;
+
+      etl::transcode_result result = etl::transcode(etl::string_view("abcdefghijklmnopqrstuvwxyz"), output);
+
+      CHECK(result.status == etl::transcode_status::Truncated);
+      CHECK_EQUAL(20U, result.read);
+      CHECK_EQUAL(20U, result.written);
+      CHECK(etl::u16string<20>(u"abcdefghijklmnopqrst") == output);
+#if ETL_HAS_STRING_TRUNCATION_CHECKS
+      CHECK(output.is_truncated());
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_utf8)
+    {
+      struct test_case
+      {
+        const char* text;
+        size_t      length;
+        size_t      read;
+      };
+
+      const test_case cases[] =
+      {
+        { "a\x80",                 2U, 1U }, // Unexpected continuation byte.
+        { "a\xC0\xAF",             3U, 1U }, // Overlong two byte.
+        { "a\xC1\xBF",             3U, 1U }, // Overlong two byte.
+        { "a\xE0\x80\xAF",         4U, 1U }, // Overlong three byte.
+        { "a\xED\xA0\x80",         4U, 1U }, // Surrogate.
+        { "a\xF0\x80\x80\xAF",     5U, 1U }, // Overlong four byte.
+        { "a\xF4\x90\x80\x80",     5U, 1U }, // Above U+10FFFF.
+        { "a\xF5\x80\x80\x80",     5U, 1U }, // Above U+10FFFF.
+        { "a\xFF",                 2U, 1U },
+        { "a\xE2\x82" "b",         4U, 1U }, // Missing continuation byte.
+        { "a\xC3\xA9\xC3\xC3\xA9", 6U, 3U },
+      };
+
+      for (size_t i = 0U; i < (sizeof(cases) / sizeof(cases[0])); ++i)
+      {
+        etl::transcode_result result = to_utf32(cases[i].text, cases[i].length);
+
+        CHECK(result.status == etl::transcode_status::Invalid_Sequence);
+        CHECK_EQUAL(cases[i].read, result.read);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_incomplete_utf8)
+    {
+      etl::transcode_result result = to_utf32("a\xC3", 2U);
+      CHECK(result.status == etl::transcode_status::Incomplete_Sequence);
+      CHECK_EQUAL(1U, result.read);
+      CHECK_EQUAL(1U, result.written);
+
+      result = to_utf32("a\xE2\x82", 3U);
+      CHECK(result.status == etl::transcode_status::Incomplete_Sequence);
+      CHECK_EQUAL(1U, result.read);
+
+      result = to_utf32("a\xF0\x9F\x98", 4U);
+      CHECK(result.status == etl::transcode_status::Incomplete_Sequence);
+      CHECK_EQUAL(1U, result.read);
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_utf16)
+    {
+      const char16_t low_surrogate[]  = { 0x0061, 0xDC00, 0x0062 };
+      const char16_t no_low[]         = { 0x0061, 0xD800, 0x0062 };
+      const char16_t high_at_end[]    = { 0x0061, 0xD800 };
+
+      etl::transcode_result result = to_utf32(low_surrogate, 3U);
+      CHECK(result.status == etl::transcode_status::Invalid_Sequence);
+      CHECK_EQUAL(1U, result.read);
+
+      result = to_utf32(no_low, 3U);
+      CHECK(result.status == etl::transcode_status::Invalid_Sequence);
+      CHECK_EQUAL(1U, result.read);
+
+      result = to_utf32(high_at_end, 2U);
+      CHECK(result.status == etl::transcode_status::Incomplete_Sequence);
+      CHECK_EQUAL(1U, result.read);
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_utf32)
+    {
+      const char32_t too_large[] = { 0x61, 0x110000 };
+      const char32_t surrogate[] = { 0x61, 0xDFFF };
+
+      char output[16];
+
+      etl::transcode_result result = etl::transcode(too_large, 2U, output, 16U);
+      CHECK(result.status == etl::transcode_status::Invalid_Sequence);
+      CHECK_EQUAL(1U, result.read);
+      CHECK_EQUAL(1U, result.written);
+
+      result = etl::transcode(surrogate, 2U, output, 16U);
+      CHECK(result.status == etl::transcode_status::Invalid_Sequence);
+      CHECK_EQUAL(1U, result.read);
+    }
+
+    //*************************************************************************
+    TEST(test_long_text_round_trip)
+    {
+      const std::vector<char32_t> code_points = make_code_points();
+
+      std::vector<char>     utf8(code_points.size() * 4U);
+      std::vector<char16_t> utf16(code_points.size() * 2U);
+      std::vector<char32_t> utf32(code_points.size());
+
+      etl::transcode_result result = etl::transcode(code_points.data(), code_points.size(), utf8.data(), utf8.size());
+      CHECK(result.is_valid());
+      CHECK_EQUAL(utf8_length(code_points), result.written);
+      utf8.resize(result.written);
+
+      result = etl::transcode(utf8.data(), utf8.size(), utf16.data(), utf16.size());
+      CHECK(result.is_valid());
+      utf16.resize(result.written);
+
+      result = etl::transcode(utf16.data(), utf16.size(), utf32.data(), utf32.size());
+      CHECK(result.is_valid());
+      CHECK(code_points == utf32);
+
+      std::vector<char> utf8_again(utf8.size());
+
+      result = etl::transcode(utf16.data(), utf16.size(), utf8_again.data(), utf8_again.size());
+      CHECK(result.is_valid());
+      CHECK(utf8 == utf8_again);
+
+      result = etl::transcode(utf8.data(), utf8.size(), utf32.data(), utf32.size());
+      CHECK(result.is_valid());
+      CHECK(code_points == utf32);
+    }
+  };
+}
@@ -1192,5 +1192,87 @@ namespace
       using Map = etl::unordered_map<int, int, 1, 1>;
       CHECK((!std::is_same_v<typename Map::const_iterator::value_type, typename Map::iterator::value_type>));
     }
+
+    //*************************************************************************
+    TEST(test_power_of_2_buckets)
+    {
+      typedef etl::unordered_map<int, int, 40, 20, etl::hash<int>, etl::equal_to<int>, etl::unordered_power_of_2_buckets> DataP2;
+
+      CHECK_EQUAL(32U, DataP2::MAX_BUCKETS);
+
+      DataP2 data;
+      std::map<int, int> compare;
+
+      CHECK_EQUAL(32U, data.bucket_count());
+
+      for (int i = 0; i < 40; ++i)
+      {
+        data[i * 32] = i;
+        compare[i * 32] = i;
+      }
+
+      for (int i = 0; i < 40; i += 3)
+      {
+        CHECK_EQUAL(1U, data.erase(i * 32));
+        compare.erase(i * 32);
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+
+      for (std::map<int, int>::const_iterator itr = compare.begin(); itr != compare.end(); ++itr)
+      {
+        CHECK_EQUAL(itr->second, data.at(itr->first));
+        CHECK(data.get_bucket_index(itr->first) < data.bucket_count());
+      }
+
+      CHECK(data.find(3 * 32) == data.end());
+      CHECK_EQUAL(compare.size(), size_t(std::distance(data.begin(), data.end())));
+
+      DataP2 data2(data);
+      CHECK(data2 == data);
+    }
+
+    //*************************************************************************
+    TEST(test_power_of_2_buckets_cached_hash)
+    {
+      struct counting_equal
+      {
+        int* pcount;
+
+        bool operator()(int lhs, int rhs) const
+        {
+          ++*pcount;
+          return lhs == rhs;
+        }
+      };
+
+      struct identity_hash
+      {
+        size_t operator()(int key) const
+        {
+          return size_t(key);
+        }
+      };
+
+      int count = 0;
+      counting_equal equal = { &count };
+
+      // Buckets are shared, but the keys are only compared for nodes with an equal hash.
+      etl::unordered_map<int, int, 8, 2, identity_hash, counting_equal, etl::unordered_power_of_2_buckets> data(identity_hash(), equal);
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data.insert(std::make_pair(i * 256, i));
+      }
+
+      CHECK_EQUAL(0, count);
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK_EQUAL(i, data.find(i * 256)->second);
+      }
+
+      CHECK_EQUAL(8, count);
+    }
   };
 }
@@ -928,5 +928,40 @@ namespace
         CHECK_EQUAL(std::distance(range.first, range.second), 3);
       }
     }
+
+    //*************************************************************************
+    TEST(test_power_of_2_buckets)
+    {
+      typedef etl::unordered_multiset<int, 40, 12, etl::hash<int>, etl::equal_to<int>, etl::unordered_power_of_2_buckets> DataP2;
+
+      CHECK_EQUAL(16U, DataP2::MAX_BUCKETS);
+
+      DataP2 data;
+      std::multiset<int> compare;
+
+      CHECK_EQUAL(16U, data.bucket_count());
+
+      for (int i = 0; i < 40; ++i)
+      {
+        data.insert((i % 20) * 16);
+        compare.insert((i % 20) * 16);
+      }
+
+      for (int i = 0; i < 20; i += 3)
+      {
+        CHECK_EQUAL(2U, data.erase(i * 16));
+        compare.erase(i * 16);
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK_EQUAL(compare.count(i * 16), data.count(i * 16));
+      }
+
+      DataP2 data2(data);
+      CHECK(data2 == data);
+    }
   };
 }
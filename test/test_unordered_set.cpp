@@ -28,6 +28,7 @@ SOFTWARE.
 
 #include "unit_test_framework.h"
 
+#include <set>
 #include <array>
 #include <algorithm>
 #include <utility>
@@ -863,5 +864,40 @@ namespace
       using Set = etl::unordered_set<int, 1, 1>;
       CHECK((!std::is_same_v<typename Set::const_iterator::value_type, typename Set::iterator::value_type>));
     }
+
+    //*************************************************************************
+    TEST(test_power_of_2_buckets)
+    {
+      typedef etl::unordered_set<int, 40, 20, etl::hash<int>, etl::equal_to<int>, etl::unordered_power_of_2_buckets> DataP2;
+
+      CHECK_EQUAL(32U, DataP2::MAX_BUCKETS);
+
+      DataP2 data;
+      std::set<int> compare;
+
+      CHECK_EQUAL(32U, data.bucket_count());
+
+      for (int i = 0; i < 40; ++i)
+      {
+        data.insert(i * 32);
+        compare.insert(i * 32);
+      }
+
+      for (int i = 0; i < 40; i += 3)
+      {
+        CHECK_EQUAL(1U, data.erase(i * 32));
+        compare.erase(i * 32);
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+
+      for (int i = 0; i < 40; ++i)
+      {
+        CHECK_EQUAL(compare.count(i * 32), data.count(i * 32));
+      }
+
+      DataP2 data2(data);
+      CHECK(data2 == data);
+    }
   };
 }
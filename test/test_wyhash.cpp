@@ -0,0 +1,185 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2023 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "unit_test_framework.h"
+
+#include <string>
+#include <vector>
+#include <set>
+#include <stdint.h>
+
+#include "etl/wyhash.h"
+#include "etl/hash.h"
+#include "etl/fnv_1.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/unordered_map.h"
+
+namespace
+{
+  //***************************************************************************
+  uint64_t wyhash_of(const std::string& text, uint64_t seed)
+  {
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(text.data());
+
+    return etl::wyhash_64(p, p + text.size(), seed);
+  }
+
+  SUITE(test_wyhash)
+  {
+    //*************************************************************************
+    TEST(test_wyhash_64_reference_vectors)
+    {
+      // The reference vectors use the message index as the seed.
+      CHECK_EQUAL(0x93228A4DE0EEC5A2ULL, wyhash_of("", 0));
+      CHECK_EQUAL(0xC5BAC3DB178713C4ULL, wyhash_of("a", 1));
+      CHECK_EQUAL(0xA97F2F7B1D9B3314ULL, wyhash_of("abc", 2));
+      CHECK_EQUAL(0x786D1F1DF3801DF4ULL, wyhash_of("message digest", 3));
+      CHECK_EQUAL(0xDCA5A8138AD37C87ULL, wyhash_of("abcdefghijklmnopqrstuvwxyz", 4));
+      CHECK_EQUAL(0xB9E734F117CFAF70ULL, wyhash_of("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 5));
+      CHECK_EQUAL(0x6CC5EAB49A92D617ULL, wyhash_of("12345678901234567890123456789012345678901234567890123456789012345678901234567890", 6));
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_32)
+    {
+      std::string data("123456789");
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(data.data());
+
+      uint64_t h64 = etl::wyhash_64(p, p + data.size());
+      uint32_t h32 = etl::wyhash_32(p, p + data.size());
+
+      CHECK_EQUAL(uint32_t(h64 ^ (h64 >> 32U)), h32);
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_seed)
+    {
+      std::string data("123456789");
+
+      CHECK(wyhash_of(data, 0) == wyhash_of(data, 0));
+      CHECK(wyhash_of(data, 0) != wyhash_of(data, 1));
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_all_lengths_distinct)
+    {
+      // Covers the 0, 1-3, 4-16, 17-48 and >48 byte paths.
+      std::vector<uint8_t> data(200U, 0x5AU);
+      std::set<uint64_t>   hashes;
+
+      for (size_t i = 0U; i <= data.size(); ++i)
+      {
+        hashes.insert(etl::wyhash_64(data.data(), data.data() + i));
+      }
+
+      CHECK_EQUAL(data.size() + 1U, hashes.size());
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_every_byte_matters)
+    {
+      std::vector<uint8_t> data(100U, 0U);
+      std::set<uint64_t>   hashes;
+
+      hashes.insert(etl::wyhash_64(data.data(), data.data() + data.size()));
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = 1U;
+        hashes.insert(etl::wyhash_64(data.data(), data.data() + data.size()));
+        data[i] = 0U;
+      }
+
+      CHECK_EQUAL(data.size() + 1U, hashes.size());
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_unaligned)
+    {
+      std::string data("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789");
+
+      uint64_t expected = wyhash_of(data, 0);
+
+      for (size_t offset = 1U; offset < 8U; ++offset)
+      {
+        std::vector<uint8_t> buffer(offset + data.size());
+        std::copy(data.begin(), data.end(), buffer.begin() + offset);
+
+        const uint8_t* p = buffer.data() + offset;
+
+        CHECK_EQUAL(expected, etl::wyhash_64(p, p + data.size()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_hash_policies)
+    {
+      std::string data("123456789");
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(data.data());
+
+      CHECK_EQUAL(size_t(etl::wyhash_64(p, p + data.size())), etl::hash_policy_wyhash::hash(p, p + data.size()));
+      CHECK_EQUAL(size_t(etl::fnv_1a_64(data.begin(), data.end())), etl::hash_policy_fnv_1a::hash(p, p + data.size()));
+    }
+
+    //*************************************************************************
+    TEST(test_contiguous_hash)
+    {
+      etl::string<20> text("Hello World");
+      etl::string_view view(text.data(), text.size());
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(text.data());
+
+      size_t expected = etl::hash_policy_wyhash::hash(p, p + text.size());
+
+      CHECK_EQUAL(expected, (etl::contiguous_hash<etl::istring, etl::hash_policy_wyhash>()(text)));
+      CHECK_EQUAL(expected, (etl::contiguous_hash<etl::string_view, etl::hash_policy_wyhash>()(view)));
+
+      // The default policy matches etl::hash.
+      CHECK_EQUAL(etl::hash<etl::istring>()(text), etl::contiguous_hash<etl::istring>()(text));
+      CHECK_EQUAL(etl::hash<etl::string_view>()(view), etl::contiguous_hash<etl::string_view>()(view));
+    }
+
+    //*************************************************************************
+    TEST(test_contiguous_hash_in_unordered_map)
+    {
+      typedef etl::string<20> Key;
+      typedef etl::contiguous_hash<etl::istring, etl::hash_policy_wyhash> Hash;
+
+      etl::unordered_map<Key, int, 8, 8, Hash> data;
+
+      data[Key("one")]   = 1;
+      data[Key("two")]   = 2;
+      data[Key("three")] = 3;
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, data[Key("one")]);
+      CHECK_EQUAL(2, data[Key("two")]);
+      CHECK_EQUAL(3, data[Key("three")]);
+      CHECK(data.find(Key("four")) == data.end());
+    }
+  };
+}